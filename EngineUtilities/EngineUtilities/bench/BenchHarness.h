@@ -0,0 +1,539 @@
+/**
+ * @file BenchHarness.h
+ * @brief Utilidades de medición compartidas por los benchmarks de EngineUtilities.
+ * @author Hannin Abarca
+ *
+ * Dos formas de medir:
+ *  - measure(): repite una operación con calentamiento, calibra las iteraciones por
+ *    muestra y calcula media, mediana, desviación e intervalo de confianza al 95 %.
+ *  - printResult(): registra una medición hecha a mano (escenarios multihilo o con
+ *    preparación costosa) como una sola muestra.
+ *
+ * Todos los resultados se acumulan para poder escribirlos en JSON al terminar y para
+ * compararlos con una línea base guardada (--baseline), que actúa como control de
+ * regresiones de rendimiento.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace Bench {
+
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Impide que el compilador elimine el cálculo que produce un valor.
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+        const volatile char* bytes = reinterpret_cast<const volatile char*>(&value);
+        (void)*bytes;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    /**
+     * @brief Segundos transcurridos desde un instante dado.
+     */
+    inline double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief Ejecuta fn(threadIndex) en numThreads hilos que arrancan a la vez.
+     *
+     * @return Tiempo de pared en segundos desde la liberación de los hilos hasta que termina el último.
+     */
+    template<typename Fn>
+    double runParallel(int numThreads, Fn fn) {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        std::atomic<int> ready{ 0 };
+        std::atomic<bool> go{ false };
+
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&, t]() {
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+                fn(t);
+            });
+        }
+        while (ready.load() != numThreads) {
+            std::this_thread::yield();
+        }
+
+        Clock::time_point start = Clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        return secondsSince(start);
+    }
+
+    /**
+     * @brief Opciones de la ejecución, leídas de la línea de comandos.
+     */
+    struct Options {
+        int samples = 15;             ///< Muestras por medición de measure().
+        double sampleSeconds = 0.002; ///< Duración mínima de cada muestra.
+        double warmupSeconds = 0.02;  ///< Calentamiento antes de tomar muestras.
+        std::string filter;           ///< Solo se ejecutan las suites cuyo nombre lo contiene.
+        std::string jsonPath;         ///< Archivo JSON de salida (vacío: no se escribe).
+        std::string baselinePath;     ///< JSON de referencia con el que comparar (vacío: no se compara).
+        double threshold = 0.25;      ///< Empeoramiento relativo de la mediana que cuenta como regresión.
+        bool list = false;            ///< Listar las suites y salir.
+    };
+
+    /**
+     * @brief Resultado de una medición.
+     */
+    struct Result {
+        std::string suite;      ///< Suite a la que pertenece.
+        std::string name;       ///< Operación medida (con el grupo como prefijo, si lo hay).
+        double nsPerOp;         ///< Media de ns por operación.
+        double ci95Ns;          ///< Semiamplitud del intervalo de confianza al 95 %.
+        double stddevNs;        ///< Desviación típica entre muestras.
+        double minNs;           ///< Mejor muestra.
+        double medianNs;        ///< Mediana de las muestras.
+        double opsPerSec;       ///< Operaciones por segundo (a partir de la media).
+        double cyclesPerOp;     ///< Ciclos de TSC por operación (0 si no hay contador).
+        int samples;            ///< Muestras tomadas.
+        uint64_t iterations;    ///< Iteraciones por muestra.
+    };
+
+    /// @brief Opciones globales de la ejecución.
+    inline Options& options() {
+        static Options instance;
+        return instance;
+    }
+
+    /// @brief Resultados acumulados en orden de ejecución.
+    inline std::vector<Result>& results() {
+        static std::vector<Result> instance;
+        return instance;
+    }
+
+    /// Suite y grupo en curso (los asignan BenchMain y beginGroup()).
+    inline std::string& currentSuite() {
+        static std::string instance;
+        return instance;
+    }
+
+    inline std::string& currentGroup() {
+        static std::string instance;
+        return instance;
+    }
+
+    /**
+     * @brief Lee el contador de ciclos de la CPU (TSC en x86).
+     *
+     * @return Valor del contador, o 0 en plataformas sin contador accesible.
+     */
+    inline uint64_t readCycleCounter() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Ciclos del contador por nanosegundo, calibrados una vez frente a steady_clock.
+     *
+     * El TSC avanza a frecuencia nominal, así que los ciclos derivados son ciclos de
+     * referencia y no cuentan turbo ni escalado de frecuencia.
+     */
+    inline double cyclesPerNs() {
+        static const double ratio = []() {
+            uint64_t startCycles = readCycleCounter();
+            if (startCycles == 0) {
+                return 0.0;
+            }
+            Clock::time_point start = Clock::now();
+            while (secondsSince(start) < 0.02) {
+            }
+            uint64_t cycles = readCycleCounter() - startCycles;
+            return static_cast<double>(cycles) / (secondsSince(start) * 1e9);
+        }();
+        return ratio;
+    }
+
+    /**
+     * @brief Empieza un grupo dentro de la suite (p. ej. un número de hilos).
+     *
+     * Los resultados siguientes llevan el grupo como prefijo en el JSON.
+     */
+    inline void beginGroup(const std::string& label) {
+        currentGroup() = label;
+        std::printf(" %s:\n", label.c_str());
+    }
+
+    /**
+     * @brief Empieza una suite: reinicia el grupo y fija el nombre usado en el JSON.
+     */
+    inline void beginSuite(const std::string& name) {
+        currentSuite() = name;
+        currentGroup().clear();
+    }
+
+    /**
+     * @brief Valor crítico de la t de Student bilateral al 95 % para df grados de libertad.
+     */
+    inline double studentT95(int df) {
+        static const double table[] = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+        if (df < 1) {
+            return 0.0;
+        }
+        return df <= 30 ? table[df - 1] : 1.960;
+    }
+
+    /**
+     * @brief Guarda un resultado y lo imprime con el formato común.
+     */
+    inline void record(Result result) {
+        result.suite = currentSuite();
+        if (!currentGroup().empty()) {
+            result.name = currentGroup() + "/" + result.name;
+        }
+        results().push_back(result);
+
+        const char* name = result.name.c_str() + (currentGroup().empty() ? 0 : currentGroup().size() + 1);
+        if (result.samples > 1) {
+            std::printf("  %-40s %10.2f ns/op +-%6.2f %10.2f Mops/s %9.1f ciclos\n", name,
+                result.nsPerOp, result.ci95Ns, result.opsPerSec / 1e6, result.cyclesPerOp);
+        }
+        else {
+            std::printf("  %-40s %10.2f ns/op         %10.2f Mops/s %9.1f ciclos\n", name,
+                result.nsPerOp, result.opsPerSec / 1e6, result.cyclesPerOp);
+        }
+    }
+
+    /**
+     * @brief Imprime y registra una medición tomada a mano (una sola muestra).
+     *
+     * @param name Nombre de la operación medida.
+     * @param nsPerOp Nanosegundos por operación.
+     */
+    inline void printResult(const char* name, double nsPerOp) {
+        Result result;
+        result.name = name;
+        result.nsPerOp = nsPerOp;
+        result.ci95Ns = 0.0;
+        result.stddevNs = 0.0;
+        result.minNs = nsPerOp;
+        result.medianNs = nsPerOp;
+        result.opsPerSec = nsPerOp > 0.0 ? 1e9 / nsPerOp : 0.0;
+        result.cyclesPerOp = nsPerOp * cyclesPerNs();
+        result.samples = 1;
+        result.iterations = 0;
+        record(result);
+    }
+
+    /**
+     * @brief Ejecuta fn(i) iters veces y devuelve los segundos empleados.
+     *
+     * Si fn devuelve un valor, se pasa por doNotOptimize() para que el cálculo no se elimine.
+     */
+    template<typename Fn>
+    double timeBatch(Fn& fn, uint64_t iters) {
+        Clock::time_point start = Clock::now();
+        for (uint64_t i = 0; i < iters; ++i) {
+            if constexpr (std::is_void<decltype(fn(i))>::value) {
+                fn(i);
+            }
+            else {
+                doNotOptimize(fn(i));
+            }
+        }
+        return secondsSince(start);
+    }
+
+    /**
+     * @brief Mide una operación con calentamiento y varias muestras.
+     *
+     * fn recibe el número de iteración (útil para recorrer un array de entradas y evitar
+     * que el compilador pliegue el cálculo a una constante).
+     *
+     * @param name Nombre de la operación.
+     * @param fn Operación a medir: fn(uint64_t i).
+     */
+    template<typename Fn>
+    void measure(const char* name, Fn fn) {
+        const Options& opts = options();
+
+        // Calentamiento y calibración: duplicar las iteraciones hasta que una tanda dure
+        // al menos sampleSeconds y haya pasado el tiempo de calentamiento.
+        uint64_t iters = 1;
+        Clock::time_point warmupStart = Clock::now();
+        for (;;) {
+            double seconds = timeBatch(fn, iters);
+            if (seconds >= opts.sampleSeconds) {
+                if (secondsSince(warmupStart) >= opts.warmupSeconds) {
+                    break;
+                }
+            }
+            else if (seconds > 0.0) {
+                double scale = std::min(opts.sampleSeconds / seconds * 1.2, 100.0);
+                iters = std::max(iters * 2, static_cast<uint64_t>(static_cast<double>(iters) * scale));
+            }
+            else {
+                iters *= 100;
+            }
+        }
+
+        std::vector<double> samples(opts.samples);
+        for (double& sample : samples) {
+            sample = timeBatch(fn, iters) * 1e9 / static_cast<double>(iters);
+        }
+
+        double mean = 0.0;
+        for (double sample : samples) {
+            mean += sample;
+        }
+        mean /= samples.size();
+        double variance = 0.0;
+        for (double sample : samples) {
+            variance += (sample - mean) * (sample - mean);
+        }
+        variance = samples.size() > 1 ? variance / (samples.size() - 1) : 0.0;
+        std::sort(samples.begin(), samples.end());
+
+        Result result;
+        result.name = name;
+        result.nsPerOp = mean;
+        result.stddevNs = std::sqrt(variance);
+        result.ci95Ns = studentT95(static_cast<int>(samples.size()) - 1) * result.stddevNs
+            / std::sqrt(static_cast<double>(samples.size()));
+        result.minNs = samples.front();
+        result.medianNs = samples[samples.size() / 2];
+        result.opsPerSec = mean > 0.0 ? 1e9 / mean : 0.0;
+        result.cyclesPerOp = mean * cyclesPerNs();
+        result.samples = static_cast<int>(samples.size());
+        result.iterations = iters;
+        record(result);
+    }
+
+    /**
+     * @brief Lee las opciones de la línea de comandos.
+     *
+     * --json <archivo>, --filter <texto>, --samples <n>, --quick, --list,
+     * --baseline <archivo> y --threshold <fracción>.
+     *
+     * @return false si algún argumento no es válido.
+     */
+    inline bool parseArgs(int argc, char** argv) {
+        Options& opts = options();
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (std::strcmp(arg, "--json") == 0 && hasValue) {
+                opts.jsonPath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--filter") == 0 && hasValue) {
+                opts.filter = argv[++i];
+            }
+            else if (std::strcmp(arg, "--samples") == 0 && hasValue) {
+                opts.samples = std::max(2, std::atoi(argv[++i]));
+            }
+            else if (std::strcmp(arg, "--quick") == 0) {
+                opts.samples = 5;
+                opts.sampleSeconds = 0.0005;
+                opts.warmupSeconds = 0.002;
+            }
+            else if (std::strcmp(arg, "--baseline") == 0 && hasValue) {
+                opts.baselinePath = argv[++i];
+            }
+            else if (std::strcmp(arg, "--threshold") == 0 && hasValue) {
+                opts.threshold = std::atof(argv[++i]);
+                if (opts.threshold <= 0.0) {
+                    return false;
+                }
+            }
+            else if (std::strcmp(arg, "--list") == 0) {
+                opts.list = true;
+            }
+            else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Escribe text entre comillas escapando los caracteres especiales de JSON.
+    inline void writeJsonString(std::FILE* file, const std::string& text) {
+        std::fputc('"', file);
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                std::fputc('\\', file);
+                std::fputc(c, file);
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                std::fprintf(file, "\\u%04x", c);
+            }
+            else {
+                std::fputc(c, file);
+            }
+        }
+        std::fputc('"', file);
+    }
+
+    /**
+     * @brief Escribe todos los resultados en un archivo JSON.
+     *
+     * @return false si no se pudo abrir el archivo.
+     */
+    inline bool writeJson(const std::string& path) {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        if (file == nullptr) {
+            return false;
+        }
+        std::fprintf(file, "{\n  \"cycles_per_ns\": %.6f,\n  \"samples\": %d,\n  \"benchmarks\": [\n",
+            cyclesPerNs(), options().samples);
+        const std::vector<Result>& all = results();
+        for (size_t i = 0; i < all.size(); ++i) {
+            const Result& r = all[i];
+            std::fprintf(file, "    { \"suite\": ");
+            writeJsonString(file, r.suite);
+            std::fprintf(file, ", \"name\": ");
+            writeJsonString(file, r.name);
+            std::fprintf(file,
+                ", \"ns_per_op\": %.4f, \"ci95_ns\": %.4f, \"stddev_ns\": %.4f, \"min_ns\": %.4f, "
+                "\"median_ns\": %.4f, \"ops_per_sec\": %.1f, \"cycles_per_op\": %.2f, \"samples\": %d, "
+                "\"iterations\": %llu }%s\n",
+                r.nsPerOp, r.ci95Ns, r.stddevNs, r.minNs, r.medianNs, r.opsPerSec, r.cyclesPerOp,
+                r.samples, static_cast<unsigned long long>(r.iterations), i + 1 < all.size() ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+        std::fclose(file);
+        return true;
+    }
+
+    /**
+     * @brief Lee el valor de texto del campo key en una línea escrita por writeJson().
+     *
+     * @return false si la línea no contiene el campo.
+     */
+    inline bool readJsonString(const std::string& line, const char* key, std::string& value) {
+        std::string pattern = std::string("\"") + key + "\": \"";
+        size_t pos = line.find(pattern);
+        if (pos == std::string::npos) {
+            return false;
+        }
+        value.clear();
+        for (pos += pattern.size(); pos < line.size() && line[pos] != '"'; ++pos) {
+            if (line[pos] == '\\' && pos + 1 < line.size()) {
+                ++pos;
+            }
+            value += line[pos];
+        }
+        return pos < line.size();
+    }
+
+    /**
+     * @brief Lee el valor numérico del campo key en una línea escrita por writeJson().
+     *
+     * @return false si la línea no contiene el campo.
+     */
+    inline bool readJsonNumber(const std::string& line, const char* key, double& value) {
+        std::string pattern = std::string("\"") + key + "\": ";
+        size_t pos = line.find(pattern);
+        if (pos == std::string::npos) {
+            return false;
+        }
+        value = std::atof(line.c_str() + pos + pattern.size());
+        return true;
+    }
+
+    /**
+     * @brief Compara los resultados con una línea base guardada con --json.
+     *
+     * Solo se comparan las mediciones de measure() (más de una muestra) presentes en ambos
+     * lados, por su mediana, que es robusta frente a muestras aisladas lentas. Una medición
+     * es una regresión si su mediana supera la de la línea base en más de threshold.
+     *
+     * @return Número de regresiones, o -1 si no se pudo leer el archivo.
+     */
+    inline int compareWithBaseline(const std::string& path, double threshold) {
+        std::FILE* file = std::fopen(path.c_str(), "r");
+        if (file == nullptr) {
+            return -1;
+        }
+
+        std::vector<Result> baseline;
+        std::string line;
+        for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) {
+            if (c != '\n') {
+                line += static_cast<char>(c);
+                continue;
+            }
+            Result entry = Result();
+            double samples = 0.0;
+            if (readJsonString(line, "suite", entry.suite) && readJsonString(line, "name", entry.name) &&
+                readJsonNumber(line, "median_ns", entry.medianNs) && readJsonNumber(line, "samples", samples)) {
+                entry.samples = static_cast<int>(samples);
+                baseline.push_back(entry);
+            }
+            line.clear();
+        }
+        std::fclose(file);
+
+        std::printf("\n=== Comparacion con %s (umbral %+.0f %%) ===\n", path.c_str(), threshold * 100.0);
+        int regressions = 0;
+        int compared = 0;
+        for (const Result& current : results()) {
+            if (current.samples < 2) {
+                continue;
+            }
+            const Result* reference = nullptr;
+            for (const Result& entry : baseline) {
+                if (entry.samples > 1 && entry.suite == current.suite && entry.name == current.name) {
+                    reference = &entry;
+                    break;
+                }
+            }
+            if (reference == nullptr) {
+                std::printf("  [nuevo]     %s / %s\n", current.suite.c_str(), current.name.c_str());
+                continue;
+            }
+            ++compared;
+            double change = reference->medianNs > 0.0 ? current.medianNs / reference->medianNs - 1.0 : 0.0;
+            if (change > threshold) {
+                ++regressions;
+                std::printf("  [REGRESION] %s / %s: %.3f -> %.3f ns (%+.1f %%)\n", current.suite.c_str(),
+                    current.name.c_str(), reference->medianNs, current.medianNs, change * 100.0);
+            }
+        }
+        std::printf("  %d mediciones comparadas, %d regresiones\n", compared, regressions);
+        return regressions;
+    }
+
+}
@@ -0,0 +1,146 @@
+/**
+ * @file BenchMain.cpp
+ * @brief Punto de entrada no interactivo de los benchmarks de EngineUtilities.
+ * @author Hannin Abarca
+ *
+ * Se compila como un ejecutable independiente del menú de pruebas, a partir de todos
+ * los archivos .cpp de bench/ (con optimizaciones y soporte de hilos).
+ *
+ * Uso: bench [--filter <suite>] [--json <archivo>] [--samples <n>] [--quick] [--list]
+ *            [--baseline <archivo>] [--threshold <fraccion>]
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "BenchHarness.h"
+
+// Declaraciones de los benchmarks
+
+void benchEngineMath();     ///< Funciones de EngineMath.
+void benchCVector2();       ///< Operaciones de CVector2.
+void benchCVector3();       ///< Operaciones de CVector3.
+void benchCVector4();       ///< Operaciones de CVector4.
+void benchCQuaternion();    ///< Operaciones de CQuaternion.
+void benchMatriz2x2();      ///< Operaciones de Matriz2x2.
+void benchMatriz3x3();      ///< Operaciones de Matriz3x3.
+void benchMatriz4x4();      ///< Operaciones de Matriz4x4.
+void benchSmartPointers();  ///< Punteros inteligentes en un hilo.
+void benchTStaticPtr();     ///< Acceso concurrente a TStaticPtr.
+void benchTObjectPool();    ///< TObjectPool frente al heap global.
+void benchAllocators();     ///< Asignadores temporales frente al heap global.
+void benchTSlotMap();       ///< TSlotMap frente a TSharedPointer.
+void benchMemoryTracking(); ///< Coste de la instrumentación de memoria.
+void benchProfiler();       ///< Coste de las zonas de perfilado.
+void benchJobSystem();      ///< Escalado de CJobSystem y coste por trabajo.
+void benchQueues();         ///< Colas sin bloqueos frente a una cola con mutex.
+void benchEpochReclamation(); ///< Lecturas protegidas por épocas frente a recuento atómico.
+void benchTasks();          ///< Coste de las tareas con corrutinas frente a callbacks (C++20).
+void benchTransformHierarchy(); ///< Jerarquía de transformaciones frente a una Matriz4x4 por objeto.
+void benchBounds();         ///< Pruebas de cajas y esferas una a una frente a lotes SoA.
+void benchFrustum();        ///< Descarte por frustum de 1M objetos, uno a uno, SIMD y en paralelo.
+void benchDynamicAABBTree(); ///< Árbol dinámico de cajas frente a fuerza bruta (10K y 100K objetos).
+void benchStaticBVH();      ///< BVH estática sobre un millón de triángulos (Mrayos/s).
+void benchSpatialHashGrid(); ///< Rejilla hash uniforme frente a O(n^2) (10K a 1M puntos).
+void benchLooseTree();      ///< Octree holgado frente a rejilla y fuerza bruta en un mundo disperso.
+void benchKdTree();         ///< Árbol k-d: vecinos sueltos y por lotes frente a fuerza bruta SIMD.
+void benchSpaceFillingCurves(); ///< Códigos de Morton y Hilbert y ordenación radix (claves/s).
+void benchRayIntersection();    ///< Rayos contra cajas, esferas, planos y triángulos, escalar y por paquetes.
+void benchGJK();                ///< GJK y EPA con movimiento coherente e incoherente, con y sin caché.
+void benchOBB();                ///< Cajas orientadas: ejes separadores, por lotes y frente a GJK.
+
+namespace {
+
+    /// Suite de benchmarks seleccionable con --filter.
+    struct Suite {
+        const char* name;
+        void (*run)();
+    };
+
+    const Suite kSuites[] = {
+        { "EngineMath", benchEngineMath },
+        { "CVector2", benchCVector2 },
+        { "CVector3", benchCVector3 },
+        { "CVector4", benchCVector4 },
+        { "CQuaternion", benchCQuaternion },
+        { "Matriz2x2", benchMatriz2x2 },
+        { "Matriz3x3", benchMatriz3x3 },
+        { "Matriz4x4", benchMatriz4x4 },
+        { "SmartPointers", benchSmartPointers },
+        { "TStaticPtr", benchTStaticPtr },
+        { "TObjectPool", benchTObjectPool },
+        { "Allocators", benchAllocators },
+        { "TSlotMap", benchTSlotMap },
+        { "MemoryTracking", benchMemoryTracking },
+        { "Profiler", benchProfiler },
+        { "JobSystem", benchJobSystem },
+        { "Queues", benchQueues },
+        { "EpochReclamation", benchEpochReclamation },
+        { "Tasks", benchTasks },
+        { "TransformHierarchy", benchTransformHierarchy },
+        { "Bounds", benchBounds },
+        { "Frustum", benchFrustum },
+        { "DynamicAABBTree", benchDynamicAABBTree },
+        { "StaticBVH", benchStaticBVH },
+        { "SpatialHashGrid", benchSpatialHashGrid },
+        { "LooseTree", benchLooseTree },
+        { "KdTree", benchKdTree },
+        { "SpaceFillingCurves", benchSpaceFillingCurves },
+        { "RayIntersection", benchRayIntersection },
+        { "GJK", benchGJK },
+        { "OBB", benchOBB },
+    };
+
+}
+
+/**
+ * @brief Ejecuta los benchmarks seleccionados en secuencia sin pedir datos al usuario.
+ * @return 0 al finalizar; 1 si los argumentos no son válidos, no se pudo escribir el JSON o
+ *         hay regresiones respecto a la línea base.
+ */
+int main(int argc, char** argv) {
+    if (!Bench::parseArgs(argc, argv)) {
+        std::fprintf(stderr, "Uso: %s [--filter <suite>] [--json <archivo>] [--samples <n>] [--quick] [--list] "
+            "[--baseline <archivo>] [--threshold <fraccion>]\n", argv[0]);
+        return 1;
+    }
+
+    const Bench::Options& options = Bench::options();
+    if (options.list) {
+        for (const Suite& suite : kSuites) {
+            std::printf("%s\n", suite.name);
+        }
+        return 0;
+    }
+
+    std::printf("=== Benchmarks de EngineUtilities ===\n");
+    std::printf("Muestras por medicion: %d, intervalo de confianza al 95%%, %.3f ciclos TSC/ns\n",
+        options.samples, Bench::cyclesPerNs());
+
+    for (const Suite& suite : kSuites) {
+        if (options.filter.empty() || std::strstr(suite.name, options.filter.c_str()) != nullptr) {
+            Bench::beginSuite(suite.name);
+            suite.run();
+        }
+    }
+
+    if (!options.jsonPath.empty()) {
+        if (!Bench::writeJson(options.jsonPath)) {
+            std::fprintf(stderr, "No se pudo escribir %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+        std::printf("\nResultados escritos en %s\n", options.jsonPath.c_str());
+    }
+
+    if (!options.baselinePath.empty()) {
+        int regressions = Bench::compareWithBaseline(options.baselinePath, options.threshold);
+        if (regressions < 0) {
+            std::fprintf(stderr, "No se pudo leer %s\n", options.baselinePath.c_str());
+            return 1;
+        }
+        if (regressions > 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
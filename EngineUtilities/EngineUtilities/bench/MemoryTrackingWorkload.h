@@ -0,0 +1,72 @@
+/**
+ * @file MemoryTrackingWorkload.h
+ * @brief Carga de trabajo común para medir el coste de MemoryTracker.
+ * @author Hannin Abarca
+ *
+ * Lo incluyen benchMemoryTracking.cpp (instrumentación desactivada) y
+ * benchMemoryTrackingEnabled.cpp (activada) dentro de un espacio de nombres anónimo,
+ * de modo que cada unidad instancia los punteros sobre sus propios tipos y ambas
+ * versiones conviven en el mismo ejecutable sin violar la regla de definición única.
+ */
+
+#pragma once
+
+/// Objeto de motor típico gestionado por los punteros inteligentes.
+struct TrackedBody {
+    EngineUtilities::CVector3 position;
+    EngineUtilities::CVector3 velocity;
+};
+
+/// Resultados en ns por operación de cada medición.
+struct TrackingWorkloadResult {
+    double makeSharedReset;
+    double sharedCopy;
+    double makeUniqueReset;
+    double sharedCopyParallel;
+};
+
+const int kTrackingIterations = 1000000; ///< Operaciones por medición.
+const int kTrackingThreads = 4;          ///< Hilos de la medición concurrente.
+
+/**
+ * @brief Crea, copia y destruye punteros inteligentes y devuelve el coste de cada operación.
+ */
+inline TrackingWorkloadResult runTrackingWorkload() {
+    using EngineUtilities::TSharedPointer;
+    using EngineUtilities::TUniquePtr;
+
+    TrackingWorkloadResult result;
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+    for (int i = 0; i < kTrackingIterations; ++i) {
+        TSharedPointer<TrackedBody> body = EngineUtilities::MakeShared<TrackedBody>();
+        Bench::doNotOptimize(body.ptr);
+    }
+    result.makeSharedReset = Bench::secondsSince(start) * 1e9 / kTrackingIterations;
+
+    TSharedPointer<TrackedBody> shared = EngineUtilities::MakeShared<TrackedBody>();
+    start = Bench::Clock::now();
+    for (int i = 0; i < kTrackingIterations; ++i) {
+        TSharedPointer<TrackedBody> copy = shared;
+        Bench::doNotOptimize(copy.ptr);
+    }
+    result.sharedCopy = Bench::secondsSince(start) * 1e9 / kTrackingIterations;
+
+    start = Bench::Clock::now();
+    for (int i = 0; i < kTrackingIterations; ++i) {
+        TUniquePtr<TrackedBody> body = EngineUtilities::MakeUnique<TrackedBody>();
+        Bench::doNotOptimize(body.get());
+    }
+    result.makeUniqueReset = Bench::secondsSince(start) * 1e9 / kTrackingIterations;
+
+    // Cada hilo copia su propio puntero: solo se mide el coste de los contadores.
+    double seconds = Bench::runParallel(kTrackingThreads, [](int) {
+        TSharedPointer<TrackedBody> local = EngineUtilities::MakeShared<TrackedBody>();
+        for (int i = 0; i < kTrackingIterations; ++i) {
+            TSharedPointer<TrackedBody> copy = local;
+            Bench::doNotOptimize(copy.ptr);
+        }
+    });
+    result.sharedCopyParallel = seconds * 1e9 / (double(kTrackingIterations) * kTrackingThreads);
+    return result;
+}
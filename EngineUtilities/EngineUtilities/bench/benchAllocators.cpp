@@ -0,0 +1,199 @@
+/**
+ * @file benchAllocators.cpp
+ * @brief Benchmark de CLinearAllocator, CStackAllocator y CFrameAllocator frente al heap.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Memory/CFrameAllocator.h"
+#include "../include/Memory/CStackAllocator.h"
+#include "../include/Memory/TAllocatorAdapter.h"
+#include "../include/Vector/CVector3.h"
+#include "../include/Matriz/Matriz4x4.h"
+
+namespace {
+
+    using EngineUtilities::CFrameAllocator;
+    using EngineUtilities::CLinearAllocator;
+    using EngineUtilities::CStackAllocator;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+    using EngineUtilities::TAllocatorAdapter;
+
+    const int kFrames = 500;          ///< Frames simulados.
+    const int kVisible = 4096;        ///< Elementos de la lista de culling por frame.
+    const int kPaletteBones = 128;    ///< Matrices de la paleta de skinning por frame.
+    const int kPalettesPerFrame = 16; ///< Paletas de skinning por frame.
+
+    /**
+     * @brief Simula el trabajo temporal de un frame: una lista de visibles que crece sin
+     *        reserva previa y varias paletas de skinning.
+     */
+    template<typename VecAlloc, typename MatAlloc>
+    double buildFrame(const VecAlloc& vecAlloc, const MatAlloc& matAlloc) {
+        std::vector<CVector3, VecAlloc> visible(vecAlloc);
+        for (int i = 0; i < kVisible; ++i) {
+            visible.push_back(CVector3(static_cast<float>(i), 0.0f, 1.0f));
+        }
+        double checksum = visible.back().x;
+        for (int p = 0; p < kPalettesPerFrame; ++p) {
+            std::vector<Matriz4x4, MatAlloc> palette(kPaletteBones, Matriz4x4(), matAlloc);
+            checksum += palette[p].m[0][0];
+        }
+        return checksum;
+    }
+
+    void benchFrames() {
+        std::printf(" Trabajo temporal por frame (%d visibles, %d paletas de %d huesos):\n",
+            kVisible, kPalettesPerFrame, kPaletteBones);
+
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            Bench::doNotOptimize(buildFrame(std::allocator<CVector3>(), std::allocator<Matriz4x4>()));
+        }
+        Bench::printResult("frame con std::allocator (heap)", Bench::secondsSince(start) * 1e9 / kFrames);
+
+        {
+            CFrameAllocator frameAllocator(4 << 20);
+            start = Bench::Clock::now();
+            for (int frame = 0; frame < kFrames; ++frame) {
+                frameAllocator.beginFrame();
+                Bench::doNotOptimize(buildFrame(TAllocatorAdapter<CVector3, CFrameAllocator>(frameAllocator),
+                    TAllocatorAdapter<Matriz4x4, CFrameAllocator>(frameAllocator)));
+            }
+            Bench::printResult("frame con CFrameAllocator", Bench::secondsSince(start) * 1e9 / kFrames);
+        }
+        {
+            CStackAllocator stack(4 << 20);
+            start = Bench::Clock::now();
+            for (int frame = 0; frame < kFrames; ++frame) {
+                CStackAllocator::Scope scope(stack);
+                Bench::doNotOptimize(buildFrame(TAllocatorAdapter<CVector3, CStackAllocator>(stack),
+                    TAllocatorAdapter<Matriz4x4, CStackAllocator>(stack)));
+            }
+            Bench::printResult("frame con CStackAllocator::Scope", Bench::secondsSince(start) * 1e9 / kFrames);
+            std::printf("  pico de la pila: %zu KiB\n", stack.peak() / 1024);
+        }
+    }
+
+    /// Tamaños de asignación mezclados (16 a 1024 bytes) con semilla fija.
+    std::vector<size_t> makeSizes(int count) {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> dist(1, 64);
+        std::vector<size_t> sizes(count);
+        for (size_t& size : sizes) {
+            size = static_cast<size_t>(dist(rng)) * 16;
+        }
+        return sizes;
+    }
+
+    void benchAllocationCost() {
+        const int count = 100000;
+        const std::vector<size_t> sizes = makeSizes(count);
+        std::vector<void*> blocks(count);
+
+        std::printf(" Coste por asignacion (%d bloques de 16 a 1024 bytes):\n", count);
+
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int i = 0; i < count; ++i) {
+            blocks[i] = std::malloc(sizes[i]);
+        }
+        for (int i = 0; i < count; ++i) {
+            std::free(blocks[i]);
+        }
+        Bench::printResult("malloc + free", Bench::secondsSince(start) * 1e9 / count);
+
+        CLinearAllocator arena(64 << 20);
+        start = Bench::Clock::now();
+        for (int i = 0; i < count; ++i) {
+            blocks[i] = arena.allocate(sizes[i], 16);
+        }
+        arena.reset();
+        Bench::printResult("CLinearAllocator::allocate + reset", Bench::secondsSince(start) * 1e9 / count);
+        Bench::doNotOptimize(blocks[count - 1]);
+    }
+
+    /**
+     * @brief Fragmentación: tras liberar la mitad de los bloques al azar y volver a reservar,
+     *        compara el rango de direcciones que ocupan los bloques vivos con los bytes vivos.
+     */
+    void benchFragmentation() {
+        const int count = 20000;
+        const std::vector<size_t> sizes = makeSizes(count);
+        std::vector<int> order(count);
+        for (int i = 0; i < count; ++i) {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), std::mt19937(7));
+
+        std::vector<unsigned char*> blocks(count);
+        std::vector<size_t> liveSizes(sizes);
+        for (int i = 0; i < count; ++i) {
+            blocks[i] = static_cast<unsigned char*>(std::malloc(sizes[i]));
+        }
+        for (int i = 0; i < count / 2; ++i) {
+            int index = order[i];
+            std::free(blocks[index]);
+            liveSizes[index] *= 2;
+            blocks[index] = static_cast<unsigned char*>(std::malloc(liveSizes[index]));
+        }
+
+        // Rango ocupado: suma de los tramos de direcciones cubiertos por bloques vivos, sin
+        // contar los saltos de más de 1 MiB (segmentos distintos del heap).
+        std::vector<std::pair<uintptr_t, size_t>> spans(count);
+        size_t liveBytes = 0;
+        for (int i = 0; i < count; ++i) {
+            spans[i] = std::make_pair(reinterpret_cast<uintptr_t>(blocks[i]), liveSizes[i]);
+            liveBytes += liveSizes[i];
+        }
+        std::sort(spans.begin(), spans.end());
+        uintptr_t occupied = 0;
+        uintptr_t segmentStart = spans[0].first;
+        uintptr_t segmentEnd = spans[0].first + spans[0].second;
+        for (const std::pair<uintptr_t, size_t>& span : spans) {
+            if (span.first > segmentEnd + (1u << 20)) {
+                occupied += segmentEnd - segmentStart;
+                segmentStart = span.first;
+            }
+            segmentEnd = std::max(segmentEnd, span.first + span.second);
+        }
+        occupied += segmentEnd - segmentStart;
+        for (unsigned char* block : blocks) {
+            std::free(block);
+        }
+
+        std::printf(" Fragmentacion (%d bloques, mitad reasignados al doble de tamano):\n", count);
+        std::printf("  %-48s %10.2f %% de bytes vivos en el rango ocupado\n", "heap (malloc)",
+            100.0 * static_cast<double>(liveBytes) / static_cast<double>(occupied));
+
+        // Una arena por frame no tiene huecos: los bloques reasignados se añaden al final
+        // y los antiguos se descartan en bloque con reset().
+        CLinearAllocator arena(64 << 20);
+        size_t arenaLive = 0;
+        for (int i = 0; i < count; ++i) {
+            arena.allocate(sizes[i], 16);
+            arenaLive += sizes[i];
+        }
+        std::printf("  %-48s %10.2f %% de bytes vivos en el rango ocupado\n", "CLinearAllocator (antes de reasignar)",
+            100.0 * static_cast<double>(arenaLive) / static_cast<double>(arena.used()));
+    }
+
+}
+
+/**
+ * @brief Mide el coste de asignación y la fragmentación de los asignadores temporales
+ *        frente al heap global.
+ */
+void benchAllocators() {
+    std::printf("\n=== Asignadores temporales (arena, frame, pila) ===\n");
+    benchFrames();
+    benchAllocationCost();
+    benchFragmentation();
+}
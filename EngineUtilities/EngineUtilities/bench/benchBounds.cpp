@@ -0,0 +1,102 @@
+/**
+ * @file benchBounds.cpp
+ * @brief Benchmark de las pruebas de solapamiento de cajas y esferas, una a una y por lotes SoA.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/BoundsBatch.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CAABBArray;
+    using EngineUtilities::CBoundingSphere;
+    using EngineUtilities::CBoundingSphereArray;
+    using EngineUtilities::CVector3;
+
+    const size_t kCount = 1 << 16; ///< Objetos por lote (caben en la caché L2).
+    const int kPasses = 20;        ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por prueba.
+    template<typename Fn>
+    double timePasses(Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(kCount) * kPasses);
+    }
+
+}
+
+/**
+ * @brief Mide pruebas por segundo de CAABB y CBoundingSphere una a una (arrays de objetos)
+ *        frente a las versiones por lotes sobre arrays SoA.
+ */
+void benchBounds() {
+    std::printf("\n=== Volumenes envolventes (%zu objetos, SIMD: %s) ===\n", kCount, EngineUtilities::simdLevelName());
+
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> size(0.5f, 10.0f);
+    std::vector<CAABB> boxes(kCount);
+    std::vector<CBoundingSphere> spheres(kCount);
+    CAABBArray boxArray;
+    CBoundingSphereArray sphereArray;
+    for (size_t i = 0; i < kCount; ++i) {
+        CVector3 min(position(rng), position(rng), position(rng));
+        boxes[i] = CAABB(min, min + CVector3(size(rng), size(rng), size(rng)));
+        spheres[i] = CBoundingSphere(min, size(rng));
+        boxArray.push(boxes[i]);
+        sphereArray.push(spheres[i]);
+    }
+    const CAABB query(CVector3(-30.0f, -30.0f, -30.0f), CVector3(30.0f, 30.0f, 30.0f));
+    const CBoundingSphere sphereQuery(CVector3(10.0f, 0.0f, -5.0f), 40.0f);
+    std::vector<uint8_t> flags(kCount);
+
+    Bench::beginGroup("Una a una (array de objetos)");
+    Bench::printResult("CAABB::overlaps (por prueba)", timePasses([&]() {
+        for (size_t i = 0; i < kCount; ++i) {
+            flags[i] = boxes[i].overlaps(query) ? 1 : 0;
+        }
+        Bench::doNotOptimize(flags[kCount - 1]);
+    }));
+    Bench::printResult("CAABB::contains (por prueba)", timePasses([&]() {
+        for (size_t i = 0; i < kCount; ++i) {
+            flags[i] = query.contains(boxes[i]) ? 1 : 0;
+        }
+        Bench::doNotOptimize(flags[kCount - 1]);
+    }));
+    Bench::printResult("esfera-esfera (por prueba)", timePasses([&]() {
+        for (size_t i = 0; i < kCount; ++i) {
+            flags[i] = spheres[i].overlaps(sphereQuery) ? 1 : 0;
+        }
+        Bench::doNotOptimize(flags[kCount - 1]);
+    }));
+    Bench::printResult("esfera-caja (por prueba)", timePasses([&]() {
+        for (size_t i = 0; i < kCount; ++i) {
+            flags[i] = spheres[i].overlaps(query) ? 1 : 0;
+        }
+        Bench::doNotOptimize(flags[kCount - 1]);
+    }));
+
+    Bench::beginGroup("Por lotes (SoA)");
+    Bench::printResult("overlapBatch cajas (por prueba)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::overlapBatch(boxArray, query, flags.data()));
+    }));
+    Bench::printResult("containedBatch (por prueba)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::containedBatch(boxArray, query, flags.data()));
+    }));
+    Bench::printResult("overlapBatch esfera-esfera (por prueba)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::overlapBatch(sphereArray, sphereQuery, flags.data()));
+    }));
+    Bench::printResult("overlapBatch esfera-caja (por prueba)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::overlapBatch(sphereArray, query, flags.data()));
+    }));
+}
@@ -0,0 +1,82 @@
+/**
+ * @file benchCQuaternion.cpp
+ * @brief Benchmark de las operaciones de CQuaternion.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Vector/CQuaternion.h"
+
+namespace {
+
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CVector3;
+
+    const uint64_t kInputMask = 1023; ///< Entradas distintas por medición (potencia de dos menos uno).
+
+    /// Rotaciones unitarias aleatorias con semilla fija.
+    std::vector<CQuaternion> makeRotations(unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        std::vector<CQuaternion> values(kInputMask + 1);
+        for (CQuaternion& value : values) {
+            CVector3 axis(dist(rng), dist(rng), dist(rng) + 2.0f);
+            value = CQuaternion::fromAxisAngle(axis.normalized(), dist(rng) * 3.0f);
+        }
+        return values;
+    }
+
+}
+
+/**
+ * @brief Mide todas las operaciones de CQuaternion.
+ */
+void benchCQuaternion() {
+    std::printf("\n=== CQuaternion ===\n");
+
+    const std::vector<CQuaternion> as = makeRotations(1);
+    const std::vector<CQuaternion> bs = makeRotations(2);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<CVector3> points(kInputMask + 1);
+    std::vector<float> scalars(kInputMask + 1);
+    for (uint64_t i = 0; i <= kInputMask; ++i) {
+        points[i] = CVector3(dist(rng), dist(rng), dist(rng));
+        scalars[i] = dist(rng) * 0.5f + 0.5f;
+    }
+    const CQuaternion* a = as.data();
+    const CQuaternion* b = bs.data();
+    const CVector3* v = points.data();
+    const float* s = scalars.data();
+
+    Bench::measure("operator+", [&](uint64_t i) { return a[i & kInputMask] + b[i & kInputMask]; });
+    Bench::measure("operator-", [&](uint64_t i) { return a[i & kInputMask] - b[i & kInputMask]; });
+    Bench::measure("operator* (cuaternion)", [&](uint64_t i) { return a[i & kInputMask] * b[i & kInputMask]; });
+    Bench::measure("operator* (escalar)", [&](uint64_t i) { return a[i & kInputMask] * s[i & kInputMask]; });
+    Bench::measure("operator==", [&](uint64_t i) { return a[i & kInputMask] == b[i & kInputMask]; });
+    Bench::measure("operator!=", [&](uint64_t i) { return a[i & kInputMask] != b[i & kInputMask]; });
+    Bench::measure("operator[]", [&](uint64_t i) { return a[i & kInputMask][static_cast<int>(i & 3)]; });
+    Bench::measure("lengthSquare", [&](uint64_t i) { return a[i & kInputMask].lengthSquare(); });
+    Bench::measure("length", [&](uint64_t i) { return a[i & kInputMask].length(); });
+    Bench::measure("dot", [&](uint64_t i) { return a[i & kInputMask].dot(b[i & kInputMask]); });
+    Bench::measure("normalize", [&](uint64_t i) {
+        CQuaternion q = a[i & kInputMask] * 2.0f;
+        q.normalize();
+        return q;
+    });
+    Bench::measure("normalized", [&](uint64_t i) { return a[i & kInputMask].normalized(); });
+    Bench::measure("conjugate", [&](uint64_t i) { return a[i & kInputMask].conjugate(); });
+    Bench::measure("rotate", [&](uint64_t i) { return a[i & kInputMask].rotate(v[i & kInputMask]); });
+    Bench::measure("fromAxisAngle", [&](uint64_t i) {
+        return CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), s[i & kInputMask]);
+    });
+    Bench::measure("slerp", [&](uint64_t i) {
+        return CQuaternion::slerp(a[i & kInputMask], b[i & kInputMask], s[i & kInputMask]);
+    });
+    Bench::measure("identity", [&](uint64_t) { return CQuaternion::identity(); });
+    Bench::measure("zero", [&](uint64_t) { return CQuaternion::zero(); });
+}
@@ -0,0 +1,185 @@
+/**
+ * @file benchDynamicAABBTree.cpp
+ * @brief Benchmark de CDynamicAABBTree frente a fuerza bruta con 10K y 100K objetos.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/BoundsBatch.h"
+#include "../include/Geometry/CDynamicAABBTree.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CAABBArray;
+    using EngineUtilities::CDynamicAABBTree;
+    using EngineUtilities::CVector3;
+
+    const int kPasses = 3;      ///< Repeticiones por medición (más una de calentamiento).
+    const size_t kQueries = 1000; ///< Consultas por medición.
+    const size_t kRays = 1000;    ///< Rayos por medición.
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    /// Mide una escena de count objetos en el cubo [-range, range]^3.
+    void benchScene(size_t count, float range) {
+        std::mt19937 rng(static_cast<unsigned>(count));
+        std::uniform_real_distribution<float> position(-range, range);
+        std::uniform_real_distribution<float> size(0.5f, 2.0f);
+        std::vector<CAABB> objects(count);
+        CAABBArray boxes;
+        boxes.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            objects[i] = CAABB::fromCenterExtents(CVector3(position(rng), position(rng), position(rng)),
+                CVector3(size(rng), size(rng), size(rng)));
+            boxes.push(objects[i]);
+        }
+        std::vector<CAABB> queries(kQueries);
+        for (CAABB& query : queries) {
+            query = CAABB::fromCenterExtents(CVector3(position(rng), position(rng), position(rng)), CVector3(8.0f, 8.0f, 8.0f));
+        }
+        std::vector<CVector3> rayOrigins(kRays);
+        std::vector<CVector3> rayDirections(kRays);
+        for (size_t i = 0; i < kRays; ++i) {
+            rayOrigins[i] = CVector3(position(rng), position(rng), position(rng));
+            rayDirections[i] = CVector3(position(rng), position(rng), position(rng)).normalized();
+        }
+        const float rayLength = 2.0f * range;
+
+        CDynamicAABBTree tree(0.1f);
+        std::vector<uint32_t> proxies(count);
+        std::printf("\n--- %zu objetos ---\n", count);
+        Bench::beginGroup("Construcción (" + std::to_string(count) + ")");
+        Bench::printResult("CDynamicAABBTree::insert (por objeto)", timePasses(count, [&]() {
+            tree.clear();
+            tree.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                proxies[i] = tree.insert(objects[i], static_cast<uint32_t>(i));
+            }
+        }));
+        std::printf("  altura %d, coste SAH relativo %.1f\n", tree.height(), tree.areaRatio());
+
+        Bench::beginGroup("Consulta de caja (" + std::to_string(count) + ")");
+        std::vector<uint8_t> flags(count);
+        Bench::printResult("Fuerza bruta overlapBatch SoA (por consulta)", timePasses(kQueries, [&]() {
+            size_t hits = 0;
+            for (const CAABB& query : queries) {
+                hits += EngineUtilities::overlapBatch(boxes, query, flags.data());
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("CDynamicAABBTree::query (por consulta)", timePasses(kQueries, [&]() {
+            size_t hits = 0;
+            for (const CAABB& query : queries) {
+                tree.query(query, [&](uint32_t) {
+                    ++hits;
+                    return true;
+                });
+            }
+            Bench::doNotOptimize(hits);
+        }));
+
+        Bench::beginGroup("Rayo, impacto más cercano (" + std::to_string(count) + ")");
+        Bench::printResult("Fuerza bruta CAABB::intersectsRay (por rayo)", timePasses(kRays, [&]() {
+            float sum = 0.0f;
+            for (size_t r = 0; r < kRays; ++r) {
+                CVector3 d = rayDirections[r];
+                CVector3 inverse(1.0f / d.x, 1.0f / d.y, 1.0f / d.z);
+                float closest = rayLength;
+                for (size_t i = 0; i < count; ++i) {
+                    float t = 0.0f;
+                    if (objects[i].intersectsRay(rayOrigins[r], inverse, closest, t)) {
+                        closest = t;
+                    }
+                }
+                sum += closest;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult("CDynamicAABBTree::raycast (por rayo)", timePasses(kRays, [&]() {
+            float sum = 0.0f;
+            for (size_t r = 0; r < kRays; ++r) {
+                CVector3 d = rayDirections[r];
+                CVector3 inverse(1.0f / d.x, 1.0f / d.y, 1.0f / d.z);
+                float closest = rayLength;
+                tree.raycast(rayOrigins[r], d, rayLength, [&](uint32_t proxy, float maxT) {
+                    float t = 0.0f;
+                    if (objects[tree.userData(proxy)].intersectsRay(rayOrigins[r], inverse, maxT, t)) {
+                        closest = t;
+                        return t;
+                    }
+                    return maxT;
+                });
+                sum += closest;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+
+        // Todos los pares: la fuerza bruta completa es O(n^2); se mide una muestra de filas
+        // y se extrapola al total.
+        Bench::beginGroup("Pares solapados (" + std::to_string(count) + ")");
+        const size_t sampleRows = 200;
+        double rowNs = timePasses(sampleRows, [&]() {
+            size_t pairs = 0;
+            for (size_t i = 0; i < sampleRows; ++i) {
+                pairs += EngineUtilities::overlapBatch(boxes, objects[i], flags.data());
+            }
+            Bench::doNotOptimize(pairs);
+        });
+        Bench::printResult("Fuerza bruta overlapBatch, extrapolado (por escena)", rowNs * count / 2.0);
+        size_t pairCount = 0;
+        double pairsNs = timePasses(1, [&]() {
+            pairCount = 0;
+            tree.findPairs([&](uint32_t, uint32_t) { ++pairCount; });
+        });
+        Bench::printResult("CDynamicAABBTree::findPairs (por escena)", pairsNs);
+        std::printf("  %zu pares\n", pairCount);
+
+        // Simulación: el 10% de los objetos se mueve cada fotograma.
+        Bench::beginGroup("Actualización (" + std::to_string(count) + ")");
+        std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+        std::vector<CVector3> velocities(count);
+        for (CVector3& velocity : velocities) {
+            velocity = CVector3(step(rng), step(rng), step(rng));
+        }
+        size_t moving = count / 10;
+        size_t frame = 0;
+        size_t reinserted = 0;
+        Bench::printResult("CDynamicAABBTree::move (por objeto movido)", timePasses(moving, [&]() {
+            size_t first = (frame++ * moving) % count;
+            for (size_t k = 0; k < moving; ++k) {
+                size_t i = (first + k) % count;
+                objects[i] = CAABB(objects[i].min + velocities[i], objects[i].max + velocities[i]);
+                reinserted += tree.move(proxies[i], objects[i], velocities[i]) ? 1 : 0;
+            }
+        }));
+        std::printf("  %.1f%% reinsertados, altura %d, coste SAH relativo %.1f\n",
+            100.0 * static_cast<double>(reinserted) / (static_cast<double>(moving) * (kPasses + 1)), tree.height(), tree.areaRatio());
+    }
+
+}
+
+/**
+ * @brief Mide construcción, consultas de caja, rayos, pares y actualización de
+ *        CDynamicAABBTree frente a recorrer todos los objetos.
+ */
+void benchDynamicAABBTree() {
+    std::printf("\n=== Árbol dinámico de cajas (SIMD: %s) ===\n", EngineUtilities::simdLevelName());
+    // Misma densidad en las dos escenas: el lado crece con la raíz cúbica del número de objetos.
+    benchScene(10000, 215.0f);
+    benchScene(100000, 464.0f);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file benchEngineMath.cpp
+ * @brief Benchmark de todas las funciones de EngineMath.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Utilities/EngineMath.h"
+
+namespace {
+
+    namespace EM = EngineUtilities;
+
+    const uint64_t kInputMask = 1023; ///< Entradas distintas por medición (potencia de dos menos uno).
+
+    /// Entradas uniformes en [lo, hi) con semilla fija.
+    std::vector<double> makeInputs(double lo, double hi, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(lo, hi);
+        std::vector<double> values(kInputMask + 1);
+        for (double& value : values) {
+            value = dist(rng);
+        }
+        return values;
+    }
+
+}
+
+/**
+ * @brief Mide cada función de EngineMath sobre entradas de su dominio, con algunas
+ *        funciones de <cmath> como referencia.
+ */
+void benchEngineMath() {
+    std::printf("\n=== EngineMath ===\n");
+
+    const std::vector<double> anyValues = makeInputs(-100.0, 100.0, 1);
+    const std::vector<double> otherValues = makeInputs(-100.0, 100.0, 2);
+    const std::vector<double> positiveValues = makeInputs(0.1, 10.0, 3);
+    const std::vector<double> angleValues = makeInputs(-EM::PI, EM::PI, 4);
+    const std::vector<double> unitValues = makeInputs(-0.9, 0.9, 5);
+    const std::vector<double> expValues = makeInputs(-5.0, 5.0, 6);
+    const std::vector<double> tValues = makeInputs(0.0, 1.0, 7);
+    const double* a = anyValues.data();
+    const double* b = otherValues.data();
+    const double* p = positiveValues.data();
+    const double* angle = angleValues.data();
+    const double* unit = unitValues.data();
+    const double* e = expValues.data();
+    const double* t = tValues.data();
+
+    Bench::beginGroup("Aritmetica");
+    Bench::measure("abs", [&](uint64_t i) { return EM::abs(a[i & kInputMask]); });
+    Bench::measure("fabs", [&](uint64_t i) { return EM::fabs(a[i & kInputMask]); });
+    Bench::measure("square", [&](uint64_t i) { return EM::square(a[i & kInputMask]); });
+    Bench::measure("cube", [&](uint64_t i) { return EM::cube(a[i & kInputMask]); });
+    Bench::measure("EMax", [&](uint64_t i) { return EM::EMax(a[i & kInputMask], b[i & kInputMask]); });
+    Bench::measure("EMin", [&](uint64_t i) { return EM::EMin(a[i & kInputMask], b[i & kInputMask]); });
+    Bench::measure("round", [&](uint64_t i) { return EM::round(a[i & kInputMask]); });
+    Bench::measure("floor", [&](uint64_t i) { return EM::floor(a[i & kInputMask]); });
+    Bench::measure("ceil", [&](uint64_t i) { return EM::ceil(a[i & kInputMask]); });
+    Bench::measure("mod", [&](uint64_t i) { return EM::mod(a[i & kInputMask], p[i & kInputMask]); });
+
+    Bench::beginGroup("Avanzadas");
+    Bench::measure("sqrt", [&](uint64_t i) { return EM::sqrt(p[i & kInputMask]); });
+    Bench::measure("std::sqrt (referencia)", [&](uint64_t i) { return std::sqrt(p[i & kInputMask]); });
+    Bench::measure("exp", [&](uint64_t i) { return EM::exp(e[i & kInputMask]); });
+    Bench::measure("std::exp (referencia)", [&](uint64_t i) { return std::exp(e[i & kInputMask]); });
+    Bench::measure("log", [&](uint64_t i) { return EM::log(p[i & kInputMask]); });
+    Bench::measure("std::log (referencia)", [&](uint64_t i) { return std::log(p[i & kInputMask]); });
+    Bench::measure("log10", [&](uint64_t i) { return EM::log10(p[i & kInputMask]); });
+    Bench::measure("power", [&](uint64_t i) { return EM::power(p[i & kInputMask], e[i & kInputMask]); });
+    Bench::measure("factorial", [&](uint64_t i) { return EM::factorial(static_cast<int>(i & 15)); });
+
+    Bench::beginGroup("Trigonometria");
+    Bench::measure("radians", [&](uint64_t i) { return EM::radians(a[i & kInputMask]); });
+    Bench::measure("degrees", [&](uint64_t i) { return EM::degrees(angle[i & kInputMask]); });
+    Bench::measure("sin", [&](uint64_t i) { return EM::sin(angle[i & kInputMask]); });
+    Bench::measure("std::sin (referencia)", [&](uint64_t i) { return std::sin(angle[i & kInputMask]); });
+    Bench::measure("cos", [&](uint64_t i) { return EM::cos(angle[i & kInputMask]); });
+    Bench::measure("tan", [&](uint64_t i) { return EM::tan(angle[i & kInputMask]); });
+    Bench::measure("asin", [&](uint64_t i) { return EM::asin(unit[i & kInputMask]); });
+    Bench::measure("acos", [&](uint64_t i) { return EM::acos(unit[i & kInputMask]); });
+    Bench::measure("atan", [&](uint64_t i) { return EM::atan(unit[i & kInputMask]); });
+    Bench::measure("sinh", [&](uint64_t i) { return EM::sinh(e[i & kInputMask]); });
+    Bench::measure("cosh", [&](uint64_t i) { return EM::cosh(e[i & kInputMask]); });
+    Bench::measure("tanh", [&](uint64_t i) { return EM::tanh(e[i & kInputMask]); });
+
+    Bench::beginGroup("Geometria");
+    Bench::measure("circleArea", [&](uint64_t i) { return EM::circleArea(p[i & kInputMask]); });
+    Bench::measure("circleCircumference", [&](uint64_t i) { return EM::circleCircumference(p[i & kInputMask]); });
+    Bench::measure("rectangleArea", [&](uint64_t i) { return EM::rectangleArea(p[i & kInputMask], a[i & kInputMask]); });
+    Bench::measure("rectanglePerimeter", [&](uint64_t i) { return EM::rectanglePerimeter(p[i & kInputMask], a[i & kInputMask]); });
+    Bench::measure("triangleArea", [&](uint64_t i) { return EM::triangleArea(p[i & kInputMask], a[i & kInputMask]); });
+    Bench::measure("distance", [&](uint64_t i) {
+        uint64_t j = (i + 1) & kInputMask;
+        return EM::distance(a[i & kInputMask], b[i & kInputMask], a[j], b[j]);
+    });
+    Bench::measure("lerp", [&](uint64_t i) { return EM::lerp(a[i & kInputMask], b[i & kInputMask], t[i & kInputMask]); });
+    Bench::measure("approxEqual", [&](uint64_t i) { return EM::approxEqual(a[i & kInputMask], b[i & kInputMask]); });
+}
@@ -0,0 +1,210 @@
+/**
+ * @file benchEpochReclamation.cpp
+ * @brief Benchmark de lectura de una tabla de recursos protegida por épocas frente a recuento atómico.
+ * @author Hannin Abarca
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Memory/CEpochManager.h"
+#include "../include/Memory/TSharedPointer.h"
+
+namespace {
+
+    using EngineUtilities::CEpochGuard;
+    using EngineUtilities::CEpochManager;
+    using EngineUtilities::TSharedPointer;
+
+    const int kSlots = 1024;              ///< Entradas de la tabla de recursos.
+    const long kReadsPerThread = 1 << 20; ///< Lecturas de cada hilo lector por medición.
+    const int kReadsPerGuard = 64;        ///< Lecturas por sección crítica en la variante por lotes.
+
+    /// Recurso de ejemplo (metadatos de una textura).
+    struct Asset {
+        explicit Asset(int v) : width(256 + v), height(256), version(v) {}
+        int width;
+        int height;
+        int version;
+    };
+
+    /**
+     * @brief Tabla de recursos de lectura mayoritaria: lecturas sin recuento dentro de una
+     *        sección crítica y reemplazos que retiran la versión anterior.
+     */
+    class EpochAssetTable {
+    public:
+        EpochAssetTable() : slots(kSlots) {
+            for (std::atomic<Asset*>& slot : slots) {
+                slot.store(new Asset(0), std::memory_order_relaxed);
+            }
+        }
+
+        ~EpochAssetTable() {
+            for (std::atomic<Asset*>& slot : slots) {
+                manager.retire(slot.load(std::memory_order_relaxed));
+            }
+        }
+
+        /// Solo válido dentro de un CEpochGuard de manager.
+        const Asset* find(size_t index) const {
+            return slots[index].load(std::memory_order_acquire);
+        }
+
+        void replace(size_t index, int version) {
+            manager.retire(slots[index].exchange(new Asset(version), std::memory_order_acq_rel));
+        }
+
+        CEpochManager manager;
+
+    private:
+        std::vector<std::atomic<Asset*>> slots;
+    };
+
+    /// Misma tabla con std::shared_ptr y carga atómica: cada lectura copia el puntero (recuento atómico).
+    class SharedAssetTable {
+    public:
+        SharedAssetTable() : slots(kSlots) {
+            for (std::shared_ptr<Asset>& slot : slots) {
+                slot = std::make_shared<Asset>(0);
+            }
+        }
+
+        std::shared_ptr<Asset> find(size_t index) const {
+            return std::atomic_load(&slots[index]);
+        }
+
+        void replace(size_t index, int version) {
+            std::atomic_store(&slots[index], std::make_shared<Asset>(version));
+        }
+
+    private:
+        std::vector<std::shared_ptr<Asset>> slots;
+    };
+
+    /// Misma tabla con TSharedPointer: su recuento no es atómico, así que cada lectura toma un mutex.
+    class LockedAssetTable {
+    public:
+        LockedAssetTable() : slots(kSlots) {
+            for (TSharedPointer<Asset>& slot : slots) {
+                slot = TSharedPointer<Asset>(new Asset(0));
+            }
+        }
+
+        int readWidth(size_t index) {
+            std::lock_guard<std::mutex> lock(mutex);
+            TSharedPointer<Asset> asset = slots[index];
+            return asset->width;
+        }
+
+        void replace(size_t index, int version) {
+            TSharedPointer<Asset> fresh(new Asset(version));
+            std::lock_guard<std::mutex> lock(mutex);
+            slots[index] = fresh;
+        }
+
+    private:
+        std::mutex mutex;
+        std::vector<TSharedPointer<Asset>> slots;
+    };
+
+    /**
+     * @brief readers hilos leen entradas aleatorias mientras un escritor reemplaza una
+     *        entrada cada ~50 us.
+     *
+     * @return Nanosegundos por lectura (tiempo de pared entre el total de lecturas).
+     */
+    template<typename Table, typename ReadFn>
+    double readWhileWriting(int readers, ReadFn read) {
+        Table table;
+        std::atomic<int> finished{ 0 };
+        double seconds = Bench::runParallel(readers + 1, [&](int thread) {
+            if (thread == readers) {
+                std::mt19937 rng(7);
+                for (int version = 1; finished.load(std::memory_order_relaxed) < readers; ++version) {
+                    table.replace(rng() % kSlots, version);
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                }
+                return;
+            }
+            uint32_t index = static_cast<uint32_t>(thread) * 2654435761u;
+            long sum = 0;
+            for (long i = 0; i < kReadsPerThread; i += kReadsPerGuard) {
+                sum += read(table, index);
+                index = index * 1664525u + 1013904223u;
+            }
+            Bench::doNotOptimize(sum);
+            finished.fetch_add(1);
+        });
+        return seconds * 1e9 / (static_cast<double>(kReadsPerThread) * readers);
+    }
+
+    /// Devuelve los índices de las kReadsPerGuard lecturas de un lote a partir de seed.
+    inline size_t slotAt(uint32_t seed, int i) {
+        return ((seed >> 8) + static_cast<uint32_t>(i) * 97u) % kSlots;
+    }
+
+}
+
+/**
+ * @brief Compara el rendimiento de lectura de la tabla de recursos con CEpochManager frente a
+ *        std::shared_ptr con carga atómica y TSharedPointer con mutex, de 1 a 16 lectores.
+ */
+void benchEpochReclamation() {
+    std::printf("\n=== Reclamacion por epocas: tabla de %d recursos, %ld lecturas por hilo ===\n",
+        kSlots, kReadsPerThread);
+
+    for (int readers = 1; readers <= 16; readers *= 2) {
+        Bench::beginGroup(std::to_string(readers) + " lector(es) + 1 escritor");
+
+        Bench::printResult("CEpochGuard por lectura (por lectura)", readWhileWriting<EpochAssetTable>(readers,
+            [](EpochAssetTable& table, uint32_t seed) {
+                long sum = 0;
+                for (int i = 0; i < kReadsPerGuard; ++i) {
+                    CEpochGuard guard(table.manager);
+                    sum += table.find(slotAt(seed, i))->width;
+                }
+                return sum;
+            }));
+        Bench::printResult("CEpochGuard cada 64 lecturas (por lectura)", readWhileWriting<EpochAssetTable>(readers,
+            [](EpochAssetTable& table, uint32_t seed) {
+                long sum = 0;
+                CEpochGuard guard(table.manager);
+                for (int i = 0; i < kReadsPerGuard; ++i) {
+                    sum += table.find(slotAt(seed, i))->width;
+                }
+                return sum;
+            }));
+        Bench::printResult("std::atomic_load(shared_ptr) (por lectura)", readWhileWriting<SharedAssetTable>(readers,
+            [](SharedAssetTable& table, uint32_t seed) {
+                long sum = 0;
+                for (int i = 0; i < kReadsPerGuard; ++i) {
+                    sum += table.find(slotAt(seed, i))->width;
+                }
+                return sum;
+            }));
+        Bench::printResult("mutex + TSharedPointer (por lectura)", readWhileWriting<LockedAssetTable>(readers,
+            [](LockedAssetTable& table, uint32_t seed) {
+                long sum = 0;
+                for (int i = 0; i < kReadsPerGuard; ++i) {
+                    sum += table.readWidth(slotAt(seed, i));
+                }
+                return sum;
+            }));
+    }
+
+    // Coste del escritor: reemplazar una entrada, incluida la parte proporcional de collect().
+    EpochAssetTable table;
+    int version = 0;
+    Bench::measure("EpochAssetTable::replace (sin lectores)", [&](uint64_t i) {
+        table.replace(i % kSlots, ++version);
+    });
+}
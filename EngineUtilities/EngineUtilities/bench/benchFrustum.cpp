@@ -0,0 +1,121 @@
+/**
+ * @file benchFrustum.cpp
+ * @brief Benchmark del descarte por frustum de 1M objetos: uno a uno, por lotes SIMD y en paralelo.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/FrustumCulling.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CAABBArray;
+    using EngineUtilities::CBoundingSphere;
+    using EngineUtilities::CBoundingSphereArray;
+    using EngineUtilities::CFrustum;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+
+    const size_t kObjects = 1000000; ///< Objetos de la escena.
+    const int kPasses = 5;           ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por objeto.
+    template<typename Fn>
+    double timePasses(Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(kObjects) * kPasses);
+    }
+
+    /// Cámara en el origen mirando hacia -z, fov vertical de 60 grados, 16:9.
+    CFrustum makeFrustum() {
+        double f = 1.0 / EngineUtilities::tan(EngineUtilities::PI / 6.0);
+        double nearZ = 0.1;
+        double farZ = 500.0;
+        Matriz4x4 projection(
+            f / (16.0 / 9.0), 0.0, 0.0, 0.0,
+            0.0, f, 0.0, 0.0,
+            0.0, 0.0, (farZ + nearZ) / (nearZ - farZ), 2.0 * farZ * nearZ / (nearZ - farZ),
+            0.0, 0.0, -1.0, 0.0);
+        return CFrustum::fromMatrix(projection * Matriz4x4::RotateZ(0.2));
+    }
+
+}
+
+/**
+ * @brief Mide el descarte de esferas y cajas uno a uno (CFrustum sobre arrays de objetos)
+ *        frente a cullSpheres()/cullAABBs() en SoA y a sus versiones paralelas.
+ */
+void benchFrustum() {
+    CFrustum frustum = makeFrustum();
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> size(0.5f, 4.0f);
+    std::vector<CBoundingSphere> sphereObjects(kObjects);
+    std::vector<CAABB> boxObjects(kObjects);
+    CBoundingSphereArray spheres;
+    CAABBArray boxes;
+    spheres.reserve(kObjects);
+    boxes.reserve(kObjects);
+    for (size_t i = 0; i < kObjects; ++i) {
+        CVector3 center(position(rng), position(rng), position(rng));
+        sphereObjects[i] = CBoundingSphere(center, size(rng));
+        boxObjects[i] = CAABB::fromCenterExtents(center, CVector3(size(rng), size(rng), size(rng)));
+        spheres.push(sphereObjects[i]);
+        boxes.push(boxObjects[i]);
+    }
+    std::vector<uint32_t> visible(kObjects);
+    size_t visibleSpheres = EngineUtilities::cullSpheres(frustum, spheres, visible.data());
+    std::printf("\n=== Descarte por frustum (%zu objetos, %.1f%% visibles, SIMD: %s) ===\n", kObjects,
+        100.0 * static_cast<double>(visibleSpheres) / kObjects, EngineUtilities::simdLevelName());
+
+    Bench::beginGroup("Uno a uno (array de objetos)");
+    Bench::printResult("CFrustum::intersects esfera (por objeto)", timePasses([&]() {
+        size_t count = 0;
+        for (size_t i = 0; i < kObjects; ++i) {
+            if (frustum.intersects(sphereObjects[i])) {
+                visible[count++] = static_cast<uint32_t>(i);
+            }
+        }
+        Bench::doNotOptimize(count);
+    }));
+    Bench::printResult("CFrustum::intersects caja (por objeto)", timePasses([&]() {
+        size_t count = 0;
+        for (size_t i = 0; i < kObjects; ++i) {
+            if (frustum.intersects(boxObjects[i])) {
+                visible[count++] = static_cast<uint32_t>(i);
+            }
+        }
+        Bench::doNotOptimize(count);
+    }));
+
+    Bench::beginGroup("Por lotes SoA (serie)");
+    Bench::printResult("cullSpheres (por objeto)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::cullSpheres(frustum, spheres, visible.data()));
+    }));
+    Bench::printResult("cullAABBs (por objeto)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::cullAABBs(frustum, boxes, visible.data()));
+    }));
+
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    CJobSystem jobs(cores - 1);
+    Bench::beginGroup("Por lotes SoA, " + std::to_string(cores) + " hilo(s)");
+    Bench::printResult("parallelCullSpheres (por objeto)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::parallelCullSpheres(jobs, frustum, spheres, visible.data()));
+    }));
+    Bench::printResult("parallelCullAABBs (por objeto)", timePasses([&]() {
+        Bench::doNotOptimize(EngineUtilities::parallelCullAABBs(jobs, frustum, boxes, visible.data()));
+    }));
+}
@@ -0,0 +1,184 @@
+/**
+ * @file benchGJK.cpp
+ * @brief Benchmark de GJK y EPA (pares/s) con movimiento coherente e incoherente.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/GJK.h"
+
+namespace {
+
+    using EngineUtilities::CBoxShape;
+    using EngineUtilities::CCapsuleShape;
+    using EngineUtilities::CConvexHullShape;
+    using EngineUtilities::CGjkCache;
+    using EngineUtilities::CGjkResult;
+    using EngineUtilities::CGjkSolver;
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CVector3;
+
+    const size_t kPairs = 1024;   ///< Pares por fotograma.
+    const int kFrames = 32;       ///< Fotogramas simulados por medición.
+    const int kHullPoints = 32;   ///< Puntos de la envolvente (sobre una esfera, todos son vértices).
+    const int kPasses = 3;        ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    CQuaternion randomRotation(std::mt19937& rng) {
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        CQuaternion q(normal(rng), normal(rng), normal(rng), normal(rng));
+        float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        return CQuaternion(q.x / length, q.y / length, q.z / length, q.w / length);
+    }
+
+    /// Posición y orientación de B respecto a A (que queda fija en el origen) en un fotograma.
+    struct Placement {
+        CVector3 position;
+        CQuaternion rotation;
+    };
+
+    /**
+     * Trayectorias de kPairs pares durante kFrames fotogramas (fotograma a fotograma). Con
+     * movimiento coherente B avanza un poco y gira unos grados por fotograma, entrando y
+     * saliendo de contacto; con incoherente cada fotograma es una colocación nueva.
+     */
+    std::vector<Placement> makePlacements(bool coherent, std::mt19937& rng) {
+        std::uniform_real_distribution<float> offset(-2.5f, 2.5f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::vector<Placement> placements(kPairs * kFrames);
+        for (size_t pair = 0; pair < kPairs; ++pair) {
+            CVector3 start(offset(rng), offset(rng), offset(rng));
+            CVector3 velocity = CVector3(unit(rng), unit(rng), unit(rng)) * 0.03f;
+            CQuaternion rotation = randomRotation(rng);
+            CVector3 spinAxis = CVector3(unit(rng), unit(rng), unit(rng)).normalized();
+            for (int frame = 0; frame < kFrames; ++frame) {
+                Placement& placement = placements[frame * kPairs + pair];
+                if (coherent) {
+                    placement.position = start + velocity * static_cast<float>(frame);
+                    placement.rotation = CQuaternion::fromAxisAngle(spinAxis, 0.02f * frame) * rotation;
+                }
+                else {
+                    placement.position = CVector3(offset(rng), offset(rng), offset(rng));
+                    placement.rotation = randomRotation(rng);
+                }
+            }
+        }
+        return placements;
+    }
+
+    /// Mide overlap y contact sobre los pares de todos los fotogramas, con y sin caché.
+    template<typename ShapeA, typename ShapeB>
+    void benchPairs(const std::string& label, const std::vector<ShapeA>& a, const std::vector<ShapeB>& b) {
+        CGjkSolver solver;
+        std::vector<CGjkCache> caches(kPairs);
+        const size_t tests = a.size();
+        auto resetCaches = [&]() {
+            for (CGjkCache& cache : caches) {
+                cache.reset();
+            }
+        };
+
+        Bench::printResult((label + ", overlap").c_str(), timePasses(tests, [&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < tests; ++i) {
+                hits += solver.overlap(a[i], b[i]) ? 1 : 0;
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult((label + ", overlap con caché").c_str(), timePasses(tests, [&]() {
+            resetCaches();
+            size_t hits = 0;
+            for (size_t i = 0; i < tests; ++i) {
+                hits += solver.overlap(a[i], b[i], &caches[i % kPairs]) ? 1 : 0;
+            }
+            Bench::doNotOptimize(hits);
+        }));
+
+        size_t coldSupports = 0;
+        size_t warmSupports = 0;
+        size_t intersecting = 0;
+        Bench::printResult((label + ", contact").c_str(), timePasses(tests, [&]() {
+            CGjkResult result;
+            float sum = 0.0f;
+            coldSupports = 0;
+            intersecting = 0;
+            for (size_t i = 0; i < tests; ++i) {
+                intersecting += solver.contact(a[i], b[i], result) ? 1 : 0;
+                coldSupports += result.iterations;
+                sum += result.distance;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult((label + ", contact con caché").c_str(), timePasses(tests, [&]() {
+            resetCaches();
+            CGjkResult result;
+            float sum = 0.0f;
+            warmSupports = 0;
+            for (size_t i = 0; i < tests; ++i) {
+                solver.contact(a[i], b[i], result, &caches[i % kPairs]);
+                warmSupports += result.iterations;
+                sum += result.distance;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        std::printf(" %s: %.0f%% en contacto, %.2f soportes por par sin caché y %.2f con caché\n", label.c_str(),
+            100.0 * intersecting / tests, static_cast<double>(coldSupports) / tests, static_cast<double>(warmSupports) / tests);
+    }
+
+    void benchMotion(bool coherent, const std::vector<CVector3>& hullPoints, std::mt19937& rng) {
+        Bench::beginGroup(coherent ? "movimiento coherente" : "movimiento incoherente");
+        std::vector<Placement> placements = makePlacements(coherent, rng);
+        const std::string motion = coherent ? " (coherente)" : " (incoherente)";
+
+        std::vector<CBoxShape> boxesA;
+        std::vector<CBoxShape> boxesB;
+        std::vector<CCapsuleShape> capsules;
+        std::vector<CConvexHullShape> hullsA;
+        std::vector<CConvexHullShape> hullsB;
+        CQuaternion tilt = CQuaternion::fromAxisAngle(CVector3(1.0f, 1.0f, 0.0f).normalized(), 0.4f);
+        for (const Placement& placement : placements) {
+            boxesA.push_back(CBoxShape(CVector3(), tilt, CVector3(1.0f, 0.6f, 0.8f)));
+            boxesB.push_back(CBoxShape(placement.position, placement.rotation, CVector3(0.7f, 0.9f, 0.5f)));
+            CVector3 axis = placement.rotation.rotate(CVector3(0.0f, 0.8f, 0.0f));
+            capsules.push_back(CCapsuleShape(placement.position - axis, placement.position + axis, 0.4f));
+            hullsA.push_back(CConvexHullShape(hullPoints.data(), hullPoints.size(), CVector3(), tilt));
+            hullsB.push_back(CConvexHullShape(hullPoints.data(), hullPoints.size(), placement.position, placement.rotation));
+        }
+        benchPairs("caja-caja" + motion, boxesA, boxesB);
+        benchPairs("caja-cápsula" + motion, boxesA, capsules);
+        benchPairs("envolvente-envolvente" + motion, hullsA, hullsB);
+    }
+
+}
+
+/**
+ * @brief Mide GJK (overlap) y GJK + EPA (contact) en pares caja-caja, caja-cápsula y
+ *        envolvente-envolvente, con movimiento coherente e incoherente y con y sin arranque en
+ *        caliente, en pares/s.
+ */
+void benchGJK() {
+    std::printf("\n=== GJK y EPA ===\n");
+    std::mt19937 rng(49);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    std::vector<CVector3> hullPoints;
+    for (int i = 0; i < kHullPoints; ++i) {
+        hullPoints.push_back(CVector3(normal(rng), normal(rng), normal(rng)).normalized());
+    }
+    benchMotion(true, hullPoints, rng);
+    benchMotion(false, hullPoints, rng);
+}
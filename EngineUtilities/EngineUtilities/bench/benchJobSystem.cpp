@@ -0,0 +1,137 @@
+/**
+ * @file benchJobSystem.cpp
+ * @brief Benchmark de CJobSystem: coste por trabajo y escalado de los lotes paralelos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Threading/CJobSystem.h"
+#include "../include/Threading/ParallelBatch.h"
+
+namespace {
+
+    using EngineUtilities::CJobCounter;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+
+    const size_t kPoints = 1 << 20;  ///< Puntos de los lotes de vectores.
+    const size_t kMatrices = 1 << 16; ///< Matrices del lote de matrices.
+    const int kPasses = 10;           ///< Repeticiones de cada lote por medición.
+    const int kJobs = 100000;         ///< Trabajos vacíos para medir el coste por trabajo.
+
+    /// Datos de entrada compartidos por todas las configuraciones.
+    struct BatchData {
+        std::vector<CVector3> points;
+        std::vector<CVector3> velocities;
+        std::vector<CVector3> output;
+        std::vector<Matriz4x4> parents;
+        std::vector<Matriz4x4> locals;
+        std::vector<Matriz4x4> world;
+        Matriz4x4 transform;
+    };
+
+    BatchData makeData() {
+        BatchData data;
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        data.points.resize(kPoints);
+        data.velocities.resize(kPoints);
+        data.output.resize(kPoints);
+        for (size_t i = 0; i < kPoints; ++i) {
+            data.points[i] = CVector3(dist(rng), dist(rng), dist(rng));
+            data.velocities[i] = CVector3(dist(rng), dist(rng), dist(rng));
+        }
+        data.parents.resize(kMatrices);
+        data.locals.resize(kMatrices);
+        data.world.resize(kMatrices);
+        for (size_t i = 0; i < kMatrices; ++i) {
+            data.parents[i] = Matriz4x4::RotateZ(dist(rng)) * Matriz4x4::Translate(dist(rng), 0.0, 1.0);
+            data.locals[i] = Matriz4x4::Translate(dist(rng), dist(rng), dist(rng));
+        }
+        data.transform = Matriz4x4::Translate(1.0, 2.0, 3.0) * Matriz4x4::RotateZ(0.5);
+        return data;
+    }
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por elemento.
+    template<typename Fn>
+    double timePasses(size_t elements, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(elements) * kPasses);
+    }
+
+    void benchConfiguration(BatchData& data, unsigned threads) {
+        CJobSystem jobs(threads - 1);
+        Bench::beginGroup(std::to_string(threads) + " hilo(s)");
+
+        Bench::printResult("parallelTransformPoints (por punto)", timePasses(kPoints, [&]() {
+            EngineUtilities::parallelTransformPoints(jobs, data.transform, data.points.data(), data.output.data(), kPoints);
+        }));
+        Bench::printResult("parallelIntegrate (por punto)", timePasses(kPoints, [&]() {
+            EngineUtilities::parallelIntegrate(jobs, data.output.data(), data.velocities.data(), 0.016f, kPoints);
+        }));
+        Bench::printResult("parallelNormalizeVectors (por vector)", timePasses(kPoints, [&]() {
+            EngineUtilities::parallelNormalizeVectors(jobs, data.output.data(), kPoints);
+        }));
+        Bench::printResult("parallelMultiplyMatrices (por matriz)", timePasses(kMatrices, [&]() {
+            EngineUtilities::parallelMultiplyMatrices(jobs, data.parents.data(), data.locals.data(), data.world.data(), kMatrices);
+        }));
+
+        // Coste de encolar, robar y completar un trabajo vacío.
+        Bench::printResult("run + wait (por trabajo vacio)", timePasses(kJobs, [&]() {
+            CJobCounter counter;
+            for (int i = 0; i < kJobs; ++i) {
+                jobs.run([]() {}, &counter);
+            }
+            jobs.wait(counter);
+        }));
+        Bench::printResult("parallelFor grano 1 (por trozo)", timePasses(kJobs, [&]() {
+            jobs.parallelFor(0, kJobs, 1, [](size_t first, size_t last) { Bench::doNotOptimize(first + last); });
+        }));
+    }
+
+}
+
+/**
+ * @brief Mide los lotes de ParallelBatch.h en serie y con CJobSystem de 1 a N hilos, y el
+ *        coste por trabajo del sistema.
+ */
+void benchJobSystem() {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("\n=== CJobSystem (%zu puntos, %zu matrices, %u nucleos) ===\n", kPoints, kMatrices, cores);
+    BatchData data = makeData();
+
+    Bench::beginGroup("Serie (referencia)");
+    Bench::printResult("transformPoints (por punto)", timePasses(kPoints, [&]() {
+        EngineUtilities::transformPoints(data.transform, data.points.data(), data.output.data(), kPoints);
+    }));
+    Bench::printResult("integrate (por punto)", timePasses(kPoints, [&]() {
+        EngineUtilities::integrate(data.output.data(), data.velocities.data(), 0.016f, kPoints);
+    }));
+    Bench::printResult("normalizeVectors (por vector)", timePasses(kPoints, [&]() {
+        EngineUtilities::normalizeVectors(data.output.data(), kPoints);
+    }));
+    Bench::printResult("multiplyMatrices (por matriz)", timePasses(kMatrices, [&]() {
+        EngineUtilities::multiplyMatrices(data.parents.data(), data.locals.data(), data.world.data(), kMatrices);
+    }));
+
+    // 1, 2, 4, ... hilos hasta el número de núcleos (incluido).
+    for (unsigned threads = 1; ; threads *= 2) {
+        threads = std::min(threads, cores);
+        benchConfiguration(data, threads);
+        if (threads == cores) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,220 @@
+/**
+ * @file benchKdTree.cpp
+ * @brief Benchmark de CKdTree frente a la fuerza bruta con el núcleo SIMD de distancias.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/CKdTree.h"
+#include "../include/Geometry/TSpatialHashGrid.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CKdTree;
+    using EngineUtilities::CSpatialHashGrid3D;
+    using EngineUtilities::CVector3;
+
+    const int kPasses = 3;          ///< Repeticiones por medición (más una de calentamiento).
+    const size_t kQueries = 20000;  ///< Consultas por medición.
+    const size_t kSampleRows = 20;  ///< Consultas medidas con fuerza bruta.
+    const size_t kNeighbours = 8;   ///< k de las consultas de k vecinos.
+    const size_t kBruteBlock = 1024; ///< Puntos por bloque de la fuerza bruta (el bloque de distancias cabe en L1).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    /**
+     * Muestras de navegación: count puntos sobre cuatro plantas de un edificio de side x side,
+     * más densas alrededor de unos pocos pasillos.
+     */
+    std::vector<CVector3> makeSamples(size_t count, float side) {
+        std::mt19937 rng(static_cast<unsigned>(count));
+        std::uniform_real_distribution<float> position(0.0f, side);
+        std::normal_distribution<float> corridor(0.0f, side * 0.01f);
+        std::vector<CVector3> points(count);
+        for (size_t i = 0; i < count; ++i) {
+            float floor = static_cast<float>(rng() % 4) * 4.0f;
+            float x = position(rng);
+            float z = i % 3 == 0 ? side * 0.25f * static_cast<float>(1 + rng() % 3) + corridor(rng) : position(rng);
+            points[i] = CVector3(x, floor + corridor(rng) * 0.01f, z);
+        }
+        return points;
+    }
+
+    /// Menor distancia al cuadrado a query recorriendo todos los puntos por bloques con el núcleo SIMD.
+    float bruteNearest(const float* xs, const float* ys, const float* zs, size_t count, const CVector3& query) {
+        float block[kBruteBlock];
+        // Ocho mínimos independientes: uno solo encadenaría cada comparación con la anterior.
+        float best[8] = { INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY, INFINITY };
+        for (size_t first = 0; first < count; first += kBruteBlock) {
+            size_t n = std::min(kBruteBlock, count - first);
+            EngineUtilities::distanceSquaredBatch(xs + first, ys + first, zs + first, n, query, block);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                for (size_t lane = 0; lane < 8; ++lane) {
+                    best[lane] = block[i + lane] < best[lane] ? block[i + lane] : best[lane];
+                }
+            }
+            for (; i < n; ++i) {
+                best[0] = block[i] < best[0] ? block[i] : best[0];
+            }
+        }
+        return *std::min_element(best, best + 8);
+    }
+
+    void benchCloud(CJobSystem& jobs, size_t count, float side) {
+        std::vector<CVector3> points = makeSamples(count, side);
+        std::vector<float> xs(count);
+        std::vector<float> ys(count);
+        std::vector<float> zs(count);
+        for (size_t i = 0; i < count; ++i) {
+            xs[i] = points[i].x;
+            ys[i] = points[i].y;
+            zs[i] = points[i].z;
+        }
+        // Consultas cerca de la nube: incoherentes (al azar) y coherentes (un agente que avanza).
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> jitter(-1.0f, 1.0f);
+        std::vector<CVector3> scattered(kQueries);
+        std::vector<CVector3> path(kQueries);
+        for (size_t q = 0; q < kQueries; ++q) {
+            scattered[q] = points[rng() % count] + CVector3(jitter(rng), jitter(rng), jitter(rng));
+            float t = static_cast<float>(q) / kQueries;
+            path[q] = CVector3(side * t, 4.0f + jitter(rng) * 0.1f, side * 0.5f + side * 0.2f * t);
+        }
+        std::string label = std::to_string(count);
+        std::printf("\n--- %zu puntos ---\n", count);
+
+        CKdTree tree;
+        Bench::beginGroup("Construcción (" + label + ")");
+        Bench::printResult("build en serie (por punto)", timePasses(count, [&]() {
+            tree.build(points.data(), count);
+        }));
+        std::string parallelName = "build, " + std::to_string(jobs.concurrency() + 1) + " hilo(s) (por punto)";
+        Bench::printResult(parallelName.c_str(), timePasses(count, [&]() {
+            tree.build(points.data(), count, &jobs);
+        }));
+
+        Bench::beginGroup("Vecino más cercano (" + label + ")");
+        Bench::printResult("CKdTree::nearest (por consulta)", timePasses(kQueries, [&]() {
+            uint32_t sum = 0;
+            for (const CVector3& query : scattered) {
+                sum += tree.nearest(query);
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        CSpatialHashGrid3D grid(1.0f);
+        grid.build(points.data(), count);
+        Bench::printResult("CSpatialHashGrid3D::nearest (por consulta)", timePasses(kQueries, [&]() {
+            uint32_t sum = 0;
+            for (const CVector3& query : scattered) {
+                sum += grid.nearest(query);
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        std::vector<float> distances(count);
+        Bench::printResult("Fuerza bruta distanceSquaredBatch (por consulta)", timePasses(kSampleRows, [&]() {
+            float sum = 0.0f;
+            for (size_t q = 0; q < kSampleRows; ++q) {
+                sum += bruteNearest(xs.data(), ys.data(), zs.data(), count, scattered[q]);
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult("Fuerza bruta escalar (por consulta)", timePasses(kSampleRows, [&]() {
+            float sum = 0.0f;
+            for (size_t q = 0; q < kSampleRows; ++q) {
+                float best = INFINITY;
+                for (const CVector3& point : points) {
+                    float distanceSquared = (point - scattered[q]).lengthSquare();
+                    best = distanceSquared < best ? distanceSquared : best;
+                }
+                sum += best;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+
+        Bench::beginGroup("k = " + std::to_string(kNeighbours) + " vecinos y radio (" + label + ")");
+        uint32_t indices[kNeighbours];
+        float nearest[kNeighbours];
+        Bench::printResult("CKdTree::nearest, k vecinos (por consulta)", timePasses(kQueries, [&]() {
+            float sum = 0.0f;
+            for (const CVector3& query : scattered) {
+                size_t n = tree.nearest(query, kNeighbours, indices, nearest);
+                sum += nearest[n - 1];
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult("Fuerza bruta SIMD + nth_element (por consulta)", timePasses(kSampleRows, [&]() {
+            float sum = 0.0f;
+            for (size_t q = 0; q < kSampleRows; ++q) {
+                EngineUtilities::distanceSquaredBatch(xs.data(), ys.data(), zs.data(), count, scattered[q], distances.data());
+                std::nth_element(distances.begin(), distances.begin() + kNeighbours, distances.end());
+                sum += distances[kNeighbours];
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        size_t inRadius = 0;
+        Bench::printResult("CKdTree::queryRadius, radio 2 (por consulta)", timePasses(kQueries, [&]() {
+            inRadius = 0;
+            for (const CVector3& query : scattered) {
+                tree.queryRadius(query, 2.0f, [&](uint32_t, float) { ++inRadius; });
+            }
+            Bench::doNotOptimize(inRadius);
+        }));
+        std::printf("  %.1f puntos por consulta de radio\n", static_cast<double>(inRadius) / kQueries);
+
+        // Lotes: el orden de Morton y el radio inicial de la consulta anterior.
+        std::vector<uint32_t> batchIndices(kQueries * kNeighbours);
+        std::vector<float> batchDistances(kQueries * kNeighbours);
+        const std::vector<CVector3>* sets[2] = { &scattered, &path };
+        const char* setNames[2] = { "dispersas", "coherentes" };
+        for (int set = 0; set < 2; ++set) {
+            const std::vector<CVector3>& queries = *sets[set];
+            Bench::beginGroup(std::string("Lote de k vecinos, consultas ") + setNames[set] + " (" + label + ")");
+            Bench::printResult("nearest una a una (por consulta)", timePasses(kQueries, [&]() {
+                for (size_t q = 0; q < kQueries; ++q) {
+                    tree.nearest(queries[q], kNeighbours, &batchIndices[q * kNeighbours], &batchDistances[q * kNeighbours]);
+                }
+                Bench::doNotOptimize(batchDistances[0]);
+            }));
+            Bench::printResult("nearestBatch, 1 hilo (por consulta)", timePasses(kQueries, [&]() {
+                tree.nearestBatch(queries.data(), kQueries, kNeighbours, batchIndices.data(), batchDistances.data());
+                Bench::doNotOptimize(batchDistances[0]);
+            }));
+            std::string batchName = "nearestBatch, " + std::to_string(jobs.concurrency() + 1) + " hilo(s) (por consulta)";
+            Bench::printResult(batchName.c_str(), timePasses(kQueries, [&]() {
+                tree.nearestBatch(queries.data(), kQueries, kNeighbours, batchIndices.data(), batchDistances.data(), &jobs);
+                Bench::doNotOptimize(batchDistances[0]);
+            }));
+        }
+    }
+
+}
+
+/**
+ * @brief Mide la construcción (en serie y en paralelo) y las consultas de vecinos, radio y
+ *        lotes de CKdTree frente a la fuerza bruta escalar y con SIMD.
+ */
+void benchKdTree() {
+    std::printf("\n=== Árbol k-d (SIMD: %s) ===\n", EngineUtilities::simdLevelName());
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    CJobSystem jobs(cores - 1);
+    benchCloud(jobs, 100000, 300.0f);
+    benchCloud(jobs, 1000000, 1000.0f);
+}
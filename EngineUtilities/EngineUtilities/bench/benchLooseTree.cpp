@@ -0,0 +1,212 @@
+/**
+ * @file benchLooseTree.cpp
+ * @brief Benchmark del octree holgado frente a la rejilla hash y la fuerza bruta en un mundo disperso.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/BoundsBatch.h"
+#include "../include/Geometry/TLooseTree.h"
+#include "../include/Geometry/TSpatialHashGrid.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CAABBArray;
+    using EngineUtilities::CLooseOctree;
+    using EngineUtilities::CSpatialHashGrid3D;
+    using EngineUtilities::CVector3;
+
+    const int kPasses = 3;          ///< Repeticiones por medición (más una de calentamiento).
+    const size_t kQueries = 2000;   ///< Consultas por medición.
+    const float kWorldSize = 8192.0f; ///< Lado del mundo.
+    const float kQueryExtent = 24.0f; ///< Semilado de las cajas de consulta.
+    const int kDepth = 7;             ///< Profundidad del octree: celdas de 64, del orden de las consultas.
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    /**
+     * Mundo abierto: count objetos repartidos en clusters (ciudades) de radio 150 dentro de
+     * un cubo de kWorldSize, con un 2% de objetos grandes (edificios, terreno).
+     */
+    void makeWorld(size_t count, size_t clusters, std::vector<CAABB>& objects, std::vector<CVector3>& centers) {
+        std::mt19937 rng(static_cast<unsigned>(count + clusters));
+        std::uniform_real_distribution<float> world(0.0f, kWorldSize);
+        std::normal_distribution<float> spread(0.0f, 150.0f);
+        std::uniform_real_distribution<float> size(0.5f, 3.0f);
+        std::vector<CVector3> sites(clusters);
+        for (CVector3& site : sites) {
+            site = CVector3(world(rng), world(rng) * 0.05f, world(rng));
+        }
+        objects.resize(count);
+        centers.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const CVector3& site = sites[i % clusters];
+            CVector3 extents(size(rng), size(rng), size(rng));
+            if (rng() % 50 == 0) {
+                extents = extents * 12.0f;
+            }
+            centers[i] = site + CVector3(spread(rng), spread(rng) * 0.2f, spread(rng));
+            objects[i] = CAABB::fromCenterExtents(centers[i], extents);
+        }
+    }
+
+    void benchWorld(size_t count, size_t clusters) {
+        std::vector<CAABB> objects;
+        std::vector<CVector3> centers;
+        makeWorld(count, clusters, objects, centers);
+        CAABBArray boxes;
+        boxes.reserve(count);
+        float maxHalfDiagonal = 0.0f;
+        for (const CAABB& object : objects) {
+            boxes.push(object);
+            float halfDiagonal = object.extents().length();
+            maxHalfDiagonal = halfDiagonal > maxHalfDiagonal ? halfDiagonal : maxHalfDiagonal;
+        }
+        // Consultas alrededor de objetos existentes (donde está la acción).
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> jitter(-30.0f, 30.0f);
+        std::vector<CAABB> queries(kQueries);
+        for (size_t q = 0; q < kQueries; ++q) {
+            CVector3 center = centers[rng() % count] + CVector3(jitter(rng), jitter(rng), jitter(rng));
+            queries[q] = CAABB::fromCenterExtents(center, CVector3(kQueryExtent, kQueryExtent, kQueryExtent));
+        }
+        std::string label = std::to_string(count) + " objetos, " + std::to_string(clusters) + " clusters";
+        std::printf("\n--- %s ---\n", label.c_str());
+
+        CLooseOctree tree(CVector3(0.0f, -kWorldSize * 0.5f, 0.0f), kWorldSize, kDepth);
+        std::vector<uint32_t> proxies(count);
+        CSpatialHashGrid3D grid(2.0f * kQueryExtent);
+        Bench::beginGroup("Construcción (" + label + ")");
+        Bench::printResult("CLooseOctree::insert (por objeto)", timePasses(count, [&]() {
+            tree.clear();
+            tree.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                proxies[i] = tree.insert(objects[i], static_cast<uint32_t>(i));
+            }
+        }));
+        Bench::printResult("CSpatialHashGrid3D::build, centros (por objeto)", timePasses(count, [&]() {
+            grid.build(centers.data(), count);
+        }));
+        size_t gridBytes = grid.bucketCount() * sizeof(uint32_t) + count * (2 * sizeof(uint32_t) + sizeof(CVector3));
+        std::printf("  memoria: octree %zu KiB (%zu nodos), rejilla %zu KiB, cajas SoA %zu KiB\n",
+            tree.memoryUsage() / 1024, tree.nodeCount(), gridBytes / 1024, count * 6 * sizeof(float) / 1024);
+
+        Bench::beginGroup("Consulta de caja (" + label + ")");
+        std::vector<uint8_t> flags(count);
+        Bench::printResult("Fuerza bruta overlapBatch SoA (por consulta)", timePasses(kQueries / 10, [&]() {
+            size_t hits = 0;
+            for (size_t q = 0; q < kQueries / 10; ++q) {
+                hits += EngineUtilities::overlapBatch(boxes, queries[q], flags.data());
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        // La rejilla guarda centros: se amplía el radio con la mayor semidiagonal y se filtra.
+        const float gridRadius = CVector3(kQueryExtent, kQueryExtent, kQueryExtent).length() + maxHalfDiagonal;
+        Bench::printResult("Rejilla de centros + filtro (por consulta)", timePasses(kQueries, [&]() {
+            size_t hits = 0;
+            for (const CAABB& query : queries) {
+                grid.queryRadius(query.center(), gridRadius, [&](uint32_t index, float) {
+                    hits += objects[index].overlaps(query) ? 1 : 0;
+                });
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("CLooseOctree::query (por consulta)", timePasses(kQueries, [&]() {
+            size_t hits = 0;
+            for (const CAABB& query : queries) {
+                tree.query(query, [&](uint32_t) {
+                    ++hits;
+                    return true;
+                });
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("CLooseOctree::querySphere (por consulta)", timePasses(kQueries, [&]() {
+            size_t hits = 0;
+            for (const CAABB& query : queries) {
+                tree.querySphere(query.center(), kQueryExtent, [&](uint32_t) {
+                    ++hits;
+                    return true;
+                });
+            }
+            Bench::doNotOptimize(hits);
+        }));
+
+        Bench::beginGroup("Rayo, impacto más cercano (" + label + ")");
+        const float rayLength = 500.0f;
+        std::vector<CVector3> directions(kQueries);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        for (CVector3& direction : directions) {
+            direction = CVector3(unit(rng), unit(rng) * 0.2f, unit(rng)).normalized();
+        }
+        Bench::printResult("CLooseOctree::raycast, 500 unidades (por rayo)", timePasses(kQueries, [&]() {
+            float sum = 0.0f;
+            for (size_t r = 0; r < kQueries; ++r) {
+                CVector3 origin = queries[r].center();
+                CVector3 d = directions[r];
+                CVector3 inverse(1.0f / d.x, 1.0f / d.y, 1.0f / d.z);
+                float closest = rayLength;
+                tree.raycast(origin, d, rayLength, [&](uint32_t proxy, float maxT) {
+                    float t = 0.0f;
+                    if (objects[tree.userData(proxy)].intersectsRay(origin, inverse, maxT, t)) {
+                        closest = t;
+                        return t;
+                    }
+                    return maxT;
+                });
+                sum += closest;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+
+        // Simulación: el 10% de los objetos se mueve cada fotograma.
+        Bench::beginGroup("Actualización (" + label + ")");
+        std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+        size_t moving = count / 10;
+        size_t frame = 0;
+        size_t relinked = 0;
+        Bench::printResult("CLooseOctree::update (por objeto movido)", timePasses(moving, [&]() {
+            size_t first = (frame++ * moving) % count;
+            for (size_t k = 0; k < moving; ++k) {
+                size_t i = (first + k) % count;
+                CVector3 offset(step(rng), 0.0f, step(rng));
+                objects[i] = CAABB(objects[i].min + offset, objects[i].max + offset);
+                relinked += tree.update(proxies[i], objects[i]) ? 1 : 0;
+            }
+        }));
+        std::printf("  %.1f%% cambian de nodo, %zu nodos\n",
+            100.0 * static_cast<double>(relinked) / (static_cast<double>(moving) * (kPasses + 1)), tree.nodeCount());
+        for (size_t i = 0; i < count; ++i) {
+            centers[i] = objects[i].center();
+        }
+        Bench::printResult("CSpatialHashGrid3D::build completo (por objeto movido)", timePasses(moving, [&]() {
+            grid.build(centers.data(), count);
+        }));
+    }
+
+}
+
+/**
+ * @brief Mide inserción, consultas de caja, esfera y rayo, actualización y memoria del
+ *        octree holgado frente a la rejilla hash y a recorrer todos los objetos.
+ */
+void benchLooseTree() {
+    std::printf("\n=== Octree holgado (SIMD: %s) ===\n", EngineUtilities::simdLevelName());
+    benchWorld(100000, 16);
+    benchWorld(1000000, 64);
+}
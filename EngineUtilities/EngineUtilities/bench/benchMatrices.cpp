@@ -0,0 +1,131 @@
+/**
+ * @file benchMatrices.cpp
+ * @brief Benchmark de las operaciones de Matriz2x2, Matriz3x3 y Matriz4x4.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Matriz/Matriz2x2.h"
+#include "../include/Matriz/Matriz3x3.h"
+#include "../include/Matriz/Matriz4x4.h"
+
+namespace {
+
+    using EngineUtilities::Matriz2x2;
+    using EngineUtilities::Matriz3x3;
+    using EngineUtilities::Matriz4x4;
+
+    const uint64_t kInputMask = 255; ///< Entradas distintas por medición (potencia de dos menos uno).
+
+    /// Escalares en [0.5, 1.5) con semilla fija (ángulos, factores de escala y divisores).
+    std::vector<double> makeScalars(unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(0.5, 1.5);
+        std::vector<double> values(kInputMask + 1);
+        for (double& value : values) {
+            value = dist(rng);
+        }
+        return values;
+    }
+
+    /// Matrices invertibles: rotación por escala, con traslación en 4x4.
+    std::vector<Matriz2x2> makeMatrices2(const std::vector<double>& s) {
+        std::vector<Matriz2x2> values(kInputMask + 1);
+        for (uint64_t i = 0; i <= kInputMask; ++i) {
+            values[i] = Matriz2x2::Rotate(s[i] * 3.0) * Matriz2x2::Scale(s[i], 2.0 - s[i]);
+        }
+        return values;
+    }
+
+    std::vector<Matriz3x3> makeMatrices3(const std::vector<double>& s) {
+        std::vector<Matriz3x3> values(kInputMask + 1);
+        for (uint64_t i = 0; i <= kInputMask; ++i) {
+            values[i] = Matriz3x3::Rotate(s[i] * 3.0) * Matriz3x3::Scale(s[i], 2.0 - s[i]);
+        }
+        return values;
+    }
+
+    std::vector<Matriz4x4> makeMatrices4(const std::vector<double>& s) {
+        std::vector<Matriz4x4> values(kInputMask + 1);
+        for (uint64_t i = 0; i <= kInputMask; ++i) {
+            values[i] = Matriz4x4::Translate(s[i], -s[i], 2.0 * s[i]) * Matriz4x4::RotateZ(s[i] * 3.0)
+                * Matriz4x4::Scale(s[i], 2.0 - s[i], 1.0 + s[i]);
+        }
+        return values;
+    }
+
+    /// Operaciones que comparten las tres matrices.
+    template<typename M>
+    void benchCommonOperations(const std::vector<M>& as, const std::vector<M>& bs, const std::vector<double>& scalars) {
+        const M* a = as.data();
+        const M* b = bs.data();
+        const double* s = scalars.data();
+
+        Bench::measure("transpose", [&](uint64_t i) { return a[i & kInputMask].transpose(); });
+        Bench::measure("inverse", [&](uint64_t i) { return a[i & kInputMask].inverse(); });
+        Bench::measure("operator* (matriz)", [&](uint64_t i) { return a[i & kInputMask] * b[i & kInputMask]; });
+        Bench::measure("operator* (escalar)", [&](uint64_t i) { return a[i & kInputMask] * s[i & kInputMask]; });
+        Bench::measure("operator/", [&](uint64_t i) { return a[i & kInputMask] / s[i & kInputMask]; });
+        Bench::measure("operator+", [&](uint64_t i) { return a[i & kInputMask] + b[i & kInputMask]; });
+        Bench::measure("operator-", [&](uint64_t i) { return a[i & kInputMask] - b[i & kInputMask]; });
+        Bench::measure("operator==", [&](uint64_t i) { return a[i & kInputMask] == b[i & kInputMask]; });
+        Bench::measure("operator!=", [&](uint64_t i) { return a[i & kInputMask] != b[i & kInputMask]; });
+    }
+
+}
+
+/**
+ * @brief Mide todas las operaciones de Matriz2x2.
+ */
+void benchMatriz2x2() {
+    std::printf("\n=== Matriz2x2 ===\n");
+    const std::vector<double> scalars = makeScalars(1);
+    const std::vector<Matriz2x2> as = makeMatrices2(scalars);
+    const std::vector<Matriz2x2> bs = makeMatrices2(makeScalars(2));
+    const double* s = scalars.data();
+
+    Bench::measure("Scale", [&](uint64_t i) { return Matriz2x2::Scale(s[i & kInputMask], s[(i + 1) & kInputMask]); });
+    Bench::measure("Rotate", [&](uint64_t i) { return Matriz2x2::Rotate(s[i & kInputMask]); });
+    Bench::measure("determinant", [&](uint64_t i) { return as[i & kInputMask].determinant(); });
+    benchCommonOperations(as, bs, scalars);
+}
+
+/**
+ * @brief Mide todas las operaciones de Matriz3x3.
+ */
+void benchMatriz3x3() {
+    std::printf("\n=== Matriz3x3 ===\n");
+    const std::vector<double> scalars = makeScalars(3);
+    const std::vector<Matriz3x3> as = makeMatrices3(scalars);
+    const std::vector<Matriz3x3> bs = makeMatrices3(makeScalars(4));
+    const double* s = scalars.data();
+
+    Bench::measure("Scale", [&](uint64_t i) { return Matriz3x3::Scale(s[i & kInputMask], s[(i + 1) & kInputMask]); });
+    Bench::measure("Rotate", [&](uint64_t i) { return Matriz3x3::Rotate(s[i & kInputMask]); });
+    Bench::measure("determinant", [&](uint64_t i) { return as[i & kInputMask].determinant(); });
+    benchCommonOperations(as, bs, scalars);
+}
+
+/**
+ * @brief Mide todas las operaciones de Matriz4x4.
+ */
+void benchMatriz4x4() {
+    std::printf("\n=== Matriz4x4 ===\n");
+    const std::vector<double> scalars = makeScalars(5);
+    const std::vector<Matriz4x4> as = makeMatrices4(scalars);
+    const std::vector<Matriz4x4> bs = makeMatrices4(makeScalars(6));
+    const double* s = scalars.data();
+
+    Bench::measure("Scale", [&](uint64_t i) {
+        return Matriz4x4::Scale(s[i & kInputMask], s[(i + 1) & kInputMask], s[(i + 2) & kInputMask]);
+    });
+    Bench::measure("Translate", [&](uint64_t i) {
+        return Matriz4x4::Translate(s[i & kInputMask], s[(i + 1) & kInputMask], s[(i + 2) & kInputMask]);
+    });
+    Bench::measure("RotateZ", [&](uint64_t i) { return Matriz4x4::RotateZ(s[i & kInputMask]); });
+    benchCommonOperations(as, bs, scalars);
+}
@@ -0,0 +1,50 @@
+/**
+ * @file benchMemoryTracking.cpp
+ * @brief Benchmark del coste de MemoryTracker: instrumentación activa frente a eliminada.
+ * @author Hannin Abarca
+ */
+
+#include <cstdio>
+#include "BenchHarness.h"
+#include "../include/Memory/TSharedPointer.h"
+#include "../include/Memory/TUniquePtr.h"
+#include "../include/Vector/CVector3.h"
+
+namespace {
+#include "MemoryTrackingWorkload.h"
+}
+
+void runTrackedMemoryWorkload(double nsPerOp[4]); ///< Definida en benchMemoryTrackingEnabled.cpp.
+void printMemoryTrackingReport();                 ///< Definida en benchMemoryTrackingEnabled.cpp.
+
+/**
+ * @brief Compara la misma carga de trabajo con ENGINEUTILITIES_MEMORY_TRACKING a 0 y a 1.
+ */
+void benchMemoryTracking() {
+    std::printf("\n=== MemoryTracker: instrumentacion activa frente a eliminada ===\n");
+
+    TrackingWorkloadResult plain = runTrackingWorkload();
+    double tracked[4];
+    runTrackedMemoryWorkload(tracked);
+
+    const char* names[4] = {
+        "MakeShared + destruccion",
+        "copia de TSharedPointer",
+        "MakeUnique + destruccion",
+        "copia TSharedPointer, 4 hilos"
+    };
+    const double plainValues[4] = {
+        plain.makeSharedReset, plain.sharedCopy, plain.makeUniqueReset, plain.sharedCopyParallel
+    };
+
+    char label[96];
+    for (int i = 0; i < 4; ++i) {
+        std::snprintf(label, sizeof(label), "%s (sin instrumentar)", names[i]);
+        Bench::printResult(label, plainValues[i]);
+        std::snprintf(label, sizeof(label), "%s (instrumentado)", names[i]);
+        Bench::printResult(label, tracked[i]);
+        std::printf("  sobrecoste: %+.2f ns/op\n", tracked[i] - plainValues[i]);
+    }
+
+    printMemoryTrackingReport();
+}
@@ -0,0 +1,39 @@
+/**
+ * @file benchMemoryTrackingEnabled.cpp
+ * @brief Carga de trabajo de benchMemoryTracking compilada con MemoryTracker activo.
+ * @author Hannin Abarca
+ */
+
+// Solo esta unidad activa la instrumentación; sus tipos están en un espacio de nombres
+// anónimo para no compartir instancias de plantilla con el resto del ejecutable.
+#define ENGINEUTILITIES_MEMORY_TRACKING 1
+
+#include <iostream>
+#include "BenchHarness.h"
+#include "../include/Memory/TSharedPointer.h"
+#include "../include/Memory/TUniquePtr.h"
+#include "../include/Vector/CVector3.h"
+
+namespace {
+#include "MemoryTrackingWorkload.h"
+}
+
+/**
+ * @brief Ejecuta la carga de trabajo con la instrumentación activa.
+ *
+ * @param nsPerOp Recibe el coste de cada operación en el orden de TrackingWorkloadResult.
+ */
+void runTrackedMemoryWorkload(double nsPerOp[4]) {
+    TrackingWorkloadResult result = runTrackingWorkload();
+    nsPerOp[0] = result.makeSharedReset;
+    nsPerOp[1] = result.sharedCopy;
+    nsPerOp[2] = result.makeUniqueReset;
+    nsPerOp[3] = result.sharedCopyParallel;
+}
+
+/**
+ * @brief Imprime el informe de MemoryTracker acumulado por la carga de trabajo.
+ */
+void printMemoryTrackingReport() {
+    EngineUtilities::MemoryTracker::report(std::cout);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file benchOBB.cpp
+ * @brief Benchmark de las pruebas de cajas orientadas por ejes separadores frente a GJK (pares/s).
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/BoundsBatch.h"
+#include "../include/Geometry/COBB.h"
+#include "../include/Geometry/GJK.h"
+
+namespace {
+
+    using EngineUtilities::CBoxShape;
+    using EngineUtilities::CConvexHullShape;
+    using EngineUtilities::CGjkResult;
+    using EngineUtilities::CGjkSolver;
+    using EngineUtilities::COBB;
+    using EngineUtilities::COBBArray;
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CVector3;
+
+    const size_t kBoxes = 1024;     ///< Cajas de la escena, repartidas por [-3, 3]^3.
+    const size_t kQueries = 64;     ///< Cajas y triángulos de consulta (cada uno contra toda la escena).
+    const size_t kFitPoints = 4096; ///< Puntos del ajuste por covarianza.
+    const int kPasses = 3;          ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    CQuaternion randomRotation(std::mt19937& rng) {
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        CQuaternion q(normal(rng), normal(rng), normal(rng), normal(rng));
+        float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        return CQuaternion(q.x / length, q.y / length, q.z / length, q.w / length);
+    }
+
+    /// Las mismas cajas como COBB, en SoA y como forma de GJK.
+    struct BoxSet {
+        std::vector<COBB> boxes;
+        std::vector<CBoxShape> shapes;
+        COBBArray array;
+    };
+
+    BoxSet makeBoxes(size_t count, float spread, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-spread, spread);
+        std::uniform_real_distribution<float> extent(0.2f, 1.0f);
+        BoxSet set;
+        for (size_t i = 0; i < count; ++i) {
+            CVector3 center(position(rng), position(rng), position(rng));
+            CQuaternion rotation = randomRotation(rng);
+            CVector3 halfExtents(extent(rng), extent(rng), extent(rng));
+            set.boxes.push_back(COBB(center, rotation, halfExtents));
+            set.shapes.push_back(CBoxShape(center, rotation, halfExtents));
+            set.array.push(set.boxes.back());
+        }
+        return set;
+    }
+
+    void benchBoxBox(const BoxSet& scene, const BoxSet& queries) {
+        Bench::beginGroup("caja-caja");
+        const size_t pairs = kBoxes * kQueries;
+        size_t hits = 0;
+        Bench::printResult("SAT escalar", timePasses(pairs, [&]() {
+            hits = 0;
+            for (const COBB& query : queries.boxes) {
+                for (const COBB& box : scene.boxes) {
+                    hits += query.overlaps(box) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        std::vector<uint8_t> flags(kBoxes);
+        Bench::printResult("SAT por lotes", timePasses(pairs, [&]() {
+            size_t batchHits = 0;
+            for (const COBB& query : queries.boxes) {
+                batchHits += EngineUtilities::overlapBatch(scene.array, query, flags.data());
+            }
+            Bench::doNotOptimize(batchHits);
+        }));
+        CGjkSolver solver;
+        Bench::printResult("GJK overlap", timePasses(pairs, [&]() {
+            size_t gjkHits = 0;
+            for (const CBoxShape& query : queries.shapes) {
+                for (const CBoxShape& box : scene.shapes) {
+                    gjkHits += solver.overlap(query, box) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(gjkHits);
+        }));
+        Bench::printResult("GJK + EPA contact", timePasses(pairs, [&]() {
+            CGjkResult result;
+            float sum = 0.0f;
+            for (const CBoxShape& query : queries.shapes) {
+                for (const CBoxShape& box : scene.shapes) {
+                    solver.contact(query, box, result);
+                    sum += result.distance;
+                }
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        std::printf(" %.1f%% de los pares se solapan\n", 100.0 * hits / pairs);
+    }
+
+    void benchBoxTriangle(const BoxSet& scene, std::mt19937& rng) {
+        Bench::beginGroup("caja-triángulo");
+        std::uniform_real_distribution<float> position(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> unit(-1.5f, 1.5f);
+        std::vector<CVector3> triangles;
+        for (size_t i = 0; i < kQueries; ++i) {
+            CVector3 base(position(rng), position(rng), position(rng));
+            triangles.push_back(base);
+            triangles.push_back(base + CVector3(unit(rng), unit(rng), unit(rng)));
+            triangles.push_back(base + CVector3(unit(rng), unit(rng), unit(rng)));
+        }
+        const size_t pairs = kBoxes * kQueries;
+        size_t hits = 0;
+        Bench::printResult("SAT escalar", timePasses(pairs, [&]() {
+            hits = 0;
+            for (size_t t = 0; t < kQueries; ++t) {
+                for (const COBB& box : scene.boxes) {
+                    hits += box.overlapsTriangle(triangles[3 * t], triangles[3 * t + 1], triangles[3 * t + 2]) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        CGjkSolver solver;
+        Bench::printResult("GJK overlap", timePasses(pairs, [&]() {
+            size_t gjkHits = 0;
+            for (size_t t = 0; t < kQueries; ++t) {
+                CConvexHullShape triangle(triangles.data() + 3 * t, 3, CVector3(), CQuaternion());
+                for (const CBoxShape& box : scene.shapes) {
+                    gjkHits += solver.overlap(box, triangle) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(gjkHits);
+        }));
+        std::printf(" %.1f%% de los pares se solapan\n", 100.0 * hits / pairs);
+    }
+
+    void benchFit(std::mt19937& rng) {
+        Bench::beginGroup("ajuste");
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        COBB truth(CVector3(3.0f, 1.0f, -2.0f), randomRotation(rng), CVector3(4.0f, 1.5f, 0.5f));
+        std::vector<CVector3> points;
+        for (size_t i = 0; i < kFitPoints; ++i) {
+            points.push_back(truth.center + truth.axes[0] * (unit(rng) * truth.halfExtents.x) +
+                truth.axes[1] * (unit(rng) * truth.halfExtents.y) + truth.axes[2] * (unit(rng) * truth.halfExtents.z));
+        }
+        COBB fitted;
+        Bench::printResult("covarianza, por punto", timePasses(points.size(), [&]() {
+            fitted = COBB::fromPoints(points.data(), points.size());
+            Bench::doNotOptimize(fitted);
+        }));
+        std::printf(" Volumen ajustado / real: %.3f (la caja alineada que lo envuelve: %.3f)\n",
+            fitted.volume() / truth.volume(), truth.bounds().volume() / truth.volume());
+    }
+
+}
+
+/**
+ * @brief Mide las pruebas de solape caja-caja y caja-triángulo por ejes separadores (escalar
+ *        y por lotes) frente a GJK sobre las mismas cajas, y el ajuste por covarianza.
+ */
+void benchOBB() {
+    std::printf("\n=== Cajas orientadas (%s) ===\n", EngineUtilities::simdLevelName());
+    std::mt19937 rng(50);
+    BoxSet scene = makeBoxes(kBoxes, 3.0f, rng);
+    BoxSet queries = makeBoxes(kQueries, 3.0f, rng);
+    benchBoxBox(scene, queries);
+    benchBoxTriangle(scene, rng);
+    benchFit(rng);
+}
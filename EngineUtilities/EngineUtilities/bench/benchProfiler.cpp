@@ -0,0 +1,93 @@
+/**
+ * @file benchProfiler.cpp
+ * @brief Benchmark del coste por zona de Profiler y de la exportación a Chrome trace.
+ * @author Hannin Abarca
+ */
+
+// Solo esta unidad activa las zonas: sin ENGINEUTILITIES_PROFILING las macros no generan
+// código, así que el caso "sin zona" es exactamente el coste con la instrumentación eliminada.
+#define ENGINEUTILITIES_PROFILING 1
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include "BenchHarness.h"
+#include "../include/Utilities/Profiler.h"
+#include "../include/Vector/CVector3.h"
+
+namespace {
+
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Profiler;
+
+    const uint64_t kZonesPerThread = 1 << 20; ///< Zonas por hilo en la prueba multihilo.
+
+    /// Trabajo pequeño típico de un bucle de motor.
+    CVector3 integrate(uint64_t i) {
+        CVector3 position(static_cast<float>(i & 1023), 1.0f, 2.0f);
+        CVector3 velocity(0.5f, -1.0f, 0.25f);
+        return position + velocity * 0.016f;
+    }
+
+    double zonesInParallel(int numThreads) {
+        double seconds = Bench::runParallel(numThreads, [](int) {
+            for (uint64_t i = 0; i < kZonesPerThread; ++i) {
+                EU_PROFILE_ZONE("hilo");
+                Bench::doNotOptimize(i);
+            }
+        });
+        return seconds * 1e9 / static_cast<double>(kZonesPerThread);
+    }
+
+}
+
+/**
+ * @brief Mide el coste de las marcas de tiempo, de una zona vacía o con trabajo, de las
+ *        zonas en varios hilos y de exportar un buffer lleno.
+ */
+void benchProfiler() {
+    std::printf("\n=== Profiler (zonas de perfilado) ===\n");
+    Profiler::clear();
+
+    Bench::beginGroup("Marcas de tiempo");
+    Bench::measure("Profiler::now()", [](uint64_t) { return Profiler::now(); });
+    Bench::measure("steady_clock::now()", [](uint64_t) { return std::chrono::steady_clock::now(); });
+
+    Bench::beginGroup("Zona en un hilo");
+    Bench::measure("sin zona (compilada fuera)", [](uint64_t i) { return integrate(i); });
+    Bench::measure("zona vacia", [](uint64_t i) {
+        EU_PROFILE_ZONE("vacia");
+        return i;
+    });
+    Bench::measure("zona con trabajo", [](uint64_t i) {
+        EU_PROFILE_ZONE("integrar");
+        return integrate(i);
+    });
+    Bench::measure("dos zonas anidadas", [](uint64_t i) {
+        EU_PROFILE_ZONE("exterior");
+        EU_PROFILE_ZONE("interior");
+        return integrate(i);
+    });
+
+    for (int numThreads = 1; numThreads <= 4; numThreads *= 2) {
+        Bench::beginGroup(std::to_string(numThreads) + " hilo(s)");
+        Bench::printResult("zona vacia por hilo", zonesInParallel(numThreads));
+    }
+
+    // Exportar el buffer lleno del hilo principal.
+    Profiler::clear();
+    for (uint64_t i = 0; i < Profiler::kBufferEvents; ++i) {
+        EU_PROFILE_ZONE("exportada");
+    }
+    size_t events = Profiler::collect().size();
+    std::ostringstream trace;
+    Bench::Clock::time_point start = Bench::Clock::now();
+    Profiler::writeChromeTrace(trace);
+    double seconds = Bench::secondsSince(start);
+    Bench::beginGroup("Exportacion");
+    Bench::printResult("writeChromeTrace por zona", seconds * 1e9 / static_cast<double>(events));
+    std::printf("  %zu zonas, %zu KiB de JSON\n", events, trace.str().size() / 1024);
+    Profiler::clear();
+}
@@ -0,0 +1,197 @@
+/**
+ * @file benchQueues.cpp
+ * @brief Benchmark de TSPSCQueue y TMPMCQueue frente a una cola protegida con mutex.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "BenchHarness.h"
+#include "../include/Containers/TMPMCQueue.h"
+#include "../include/Containers/TSPSCQueue.h"
+
+namespace {
+
+    using EngineUtilities::TMPMCQueue;
+    using EngineUtilities::TSPSCQueue;
+
+    const size_t kCapacity = 1024;   ///< Capacidad de todas las colas.
+    const uint64_t kItems = 1 << 20; ///< Elementos transferidos por medición.
+    const size_t kBatch = 32;        ///< Tamaño de lote de las variantes por lotes.
+    const int kRoundTrips = 100000;  ///< Idas y vueltas de la medición de latencia.
+
+    /**
+     * @brief Referencia: cola acotada con std::deque y un mutex, como la que usa hoy el pipeline.
+     */
+    template<typename T>
+    class MutexQueue {
+    public:
+        explicit MutexQueue(size_t capacity) : limit(capacity) {}
+
+        bool tryPush(const T& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (items.size() == limit) {
+                return false;
+            }
+            items.push_back(value);
+            return true;
+        }
+
+        bool tryPop(T& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (items.empty()) {
+                return false;
+            }
+            value = items.front();
+            items.pop_front();
+            return true;
+        }
+
+        size_t tryPushBatch(const T* values, size_t count) {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t pushed = std::min(count, limit - items.size());
+            items.insert(items.end(), values, values + pushed);
+            return pushed;
+        }
+
+        size_t tryPopBatch(T* values, size_t maxCount) {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t popped = std::min(maxCount, items.size());
+            std::copy(items.begin(), items.begin() + popped, values);
+            items.erase(items.begin(), items.begin() + popped);
+            return popped;
+        }
+
+    private:
+        std::mutex mutex;
+        std::deque<T> items;
+        size_t limit;
+    };
+
+    /**
+     * @brief Transfiere kItems elementos de pairs productores a pairs consumidores.
+     *
+     * Con la cola llena o vacía los hilos ceden la CPU, para que la medición tenga sentido
+     * también con más hilos que núcleos.
+     *
+     * @return Nanosegundos por elemento transferido (tiempo de pared).
+     */
+    template<typename Queue>
+    double transfer(int pairs, size_t batch) {
+        Queue queue(kCapacity);
+        const uint64_t perProducer = kItems / pairs;
+        const uint64_t total = perProducer * pairs;
+        std::atomic<uint64_t> consumed{ 0 };
+        std::atomic<uint64_t> checksum{ 0 };
+
+        double seconds = Bench::runParallel(pairs * 2, [&](int thread) {
+            uint64_t values[kBatch];
+            if (thread < pairs) {
+                uint64_t next = 0;
+                while (next < perProducer) {
+                    size_t pushed = 0;
+                    if (batch == 1) {
+                        pushed = queue.tryPush(next) ? 1 : 0;
+                    }
+                    else {
+                        size_t n = static_cast<size_t>(std::min<uint64_t>(batch, perProducer - next));
+                        for (size_t i = 0; i < n; ++i) {
+                            values[i] = next + i;
+                        }
+                        pushed = queue.tryPushBatch(values, n);
+                    }
+                    next += pushed;
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            else {
+                uint64_t sum = 0;
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    size_t popped = batch == 1 ? (queue.tryPop(values[0]) ? 1 : 0) : queue.tryPopBatch(values, batch);
+                    for (size_t i = 0; i < popped; ++i) {
+                        sum += values[i];
+                    }
+                    if (popped == 0) {
+                        std::this_thread::yield();
+                    }
+                    else {
+                        consumed.fetch_add(popped, std::memory_order_relaxed);
+                    }
+                }
+                checksum.fetch_add(sum);
+            }
+        });
+        Bench::doNotOptimize(checksum.load());
+        return seconds * 1e9 / static_cast<double>(total);
+    }
+
+    /**
+     * @brief Latencia de ida: mitad del tiempo de un ping-pong entre dos hilos con dos colas.
+     */
+    template<typename Queue>
+    double pingPong() {
+        Queue ping(kCapacity);
+        Queue pong(kCapacity);
+        double seconds = Bench::runParallel(2, [&](int thread) {
+            Queue& in = thread == 0 ? pong : ping;
+            Queue& out = thread == 0 ? ping : pong;
+            uint64_t value = 0;
+            for (int i = 0; i < kRoundTrips; ++i) {
+                if (thread == 0) {
+                    while (!out.tryPush(static_cast<uint64_t>(i))) {
+                        std::this_thread::yield();
+                    }
+                }
+                while (!in.tryPop(value)) {
+                    std::this_thread::yield();
+                }
+                if (thread == 1) {
+                    while (!out.tryPush(value)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            Bench::doNotOptimize(value);
+        });
+        return seconds * 1e9 / (2.0 * kRoundTrips);
+    }
+
+}
+
+/**
+ * @brief Mide el rendimiento (ns por elemento) de TSPSCQueue y TMPMCQueue con 1 a 16
+ *        pares de productores y consumidores, con y sin lotes, y la latencia de ida.
+ */
+void benchQueues() {
+    std::printf("\n=== Colas sin bloqueos (%llu elementos, capacidad %zu, %u nucleos) ===\n",
+        static_cast<unsigned long long>(kItems), kCapacity, std::max(1u, std::thread::hardware_concurrency()));
+
+    Bench::beginGroup("1 productor / 1 consumidor");
+    Bench::printResult("TSPSCQueue (por elemento)", transfer<TSPSCQueue<uint64_t>>(1, 1));
+    Bench::printResult("TSPSCQueue lotes de 32 (por elemento)", transfer<TSPSCQueue<uint64_t>>(1, kBatch));
+    Bench::printResult("TMPMCQueue (por elemento)", transfer<TMPMCQueue<uint64_t>>(1, 1));
+    Bench::printResult("TMPMCQueue lotes de 32 (por elemento)", transfer<TMPMCQueue<uint64_t>>(1, kBatch));
+    Bench::printResult("mutex + deque (por elemento)", transfer<MutexQueue<uint64_t>>(1, 1));
+    Bench::printResult("mutex + deque lotes de 32 (por elemento)", transfer<MutexQueue<uint64_t>>(1, kBatch));
+
+    for (int pairs = 2; pairs <= 16; pairs *= 2) {
+        Bench::beginGroup(std::to_string(pairs) + " productores / " + std::to_string(pairs) + " consumidores");
+        Bench::printResult("TMPMCQueue (por elemento)", transfer<TMPMCQueue<uint64_t>>(pairs, 1));
+        Bench::printResult("TMPMCQueue lotes de 32 (por elemento)", transfer<TMPMCQueue<uint64_t>>(pairs, kBatch));
+        Bench::printResult("mutex + deque (por elemento)", transfer<MutexQueue<uint64_t>>(pairs, 1));
+        Bench::printResult("mutex + deque lotes de 32 (por elemento)", transfer<MutexQueue<uint64_t>>(pairs, kBatch));
+    }
+
+    Bench::beginGroup("Latencia de ida (ping-pong)");
+    Bench::printResult("TSPSCQueue", pingPong<TSPSCQueue<uint64_t>>());
+    Bench::printResult("TMPMCQueue", pingPong<TMPMCQueue<uint64_t>>());
+    Bench::printResult("mutex + deque", pingPong<MutexQueue<uint64_t>>());
+}
@@ -0,0 +1,322 @@
+/**
+ * @file benchRayIntersection.cpp
+ * @brief Benchmark de las intersecciones de rayos, escalares y por paquetes (pruebas/s).
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/RayIntersection.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CBoundingSphere;
+    using EngineUtilities::CRayArray;
+    using EngineUtilities::CTriangleHit;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::CVector4;
+    using EngineUtilities::CWatertightRay;
+    using EngineUtilities::TRayPacket;
+
+    const size_t kRays = 16384;      ///< Rayos por medición (múltiplo de 8).
+    const size_t kPrimitives = 64;   ///< Primitivas de cada tipo contra las que se prueba cada rayo.
+    const size_t kGrazingRays = 50000;  ///< Rayos rasantes de la prueba de estanqueidad.
+    const int kPasses = 3;           ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    /// Primitivas repartidas por [-50, 50]^3.
+    struct Scene {
+        std::vector<CAABB> boxes;
+        std::vector<CBoundingSphere> spheres;
+        std::vector<CVector4> planes;
+        std::vector<CVector3> triangles; ///< Tres vértices consecutivos por triángulo.
+    };
+
+    Scene makeScene(std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> size(1.0f, 8.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        Scene scene;
+        for (size_t i = 0; i < kPrimitives; ++i) {
+            CVector3 center(position(rng), position(rng), position(rng));
+            CVector3 half(size(rng), size(rng), size(rng));
+            scene.boxes.push_back(CAABB(center - half, center + half));
+            scene.spheres.push_back(CBoundingSphere(center, size(rng)));
+            CVector3 normal = CVector3(unit(rng), unit(rng), unit(rng)).normalized();
+            scene.planes.push_back(CVector4(normal.x, normal.y, normal.z, -normal.dot(center)));
+            for (int k = 0; k < 3; ++k) {
+                scene.triangles.push_back(center + CVector3(unit(rng), unit(rng), unit(rng)) * 8.0f);
+            }
+        }
+        return scene;
+    }
+
+    /// Rayos desde un punto fuera de la escena hacia puntos al azar de ella (un haz de cámara).
+    CRayArray makeRays(std::mt19937& rng) {
+        std::uniform_real_distribution<float> target(-50.0f, 50.0f);
+        CVector3 eye(0.0f, 20.0f, -120.0f);
+        CRayArray rays;
+        rays.reserve(kRays);
+        for (size_t i = 0; i < kRays; ++i) {
+            rays.push(eye, CVector3(target(rng), target(rng), target(rng)) - eye, 1000.0f);
+        }
+        return rays;
+    }
+
+    /// Recorre los rayos en paquetes de Pack y suma lo que devuelve fn(paquete).
+    template<typename Pack, typename Fn>
+    uint64_t forEachPacket(const CRayArray& rays, Fn fn) {
+        uint64_t sum = 0;
+        for (size_t i = 0; i + Pack::kWidth <= rays.size(); i += Pack::kWidth) {
+            TRayPacket<Pack> packet(rays, i);
+            sum += fn(packet);
+        }
+        return sum;
+    }
+
+    /// Mide las pruebas por paquetes de un ancho contra todas las primitivas de la escena.
+    template<typename Pack>
+    void benchPackets(const char* width, const CRayArray& rays, const Scene& scene) {
+        size_t tests = rays.size() * kPrimitives;
+        std::string prefix = std::string("paquete de ") + width + ": ";
+        Bench::printResult((prefix + "caja").c_str(), timePasses(tests, [&]() {
+            uint64_t hits = forEachPacket<Pack>(rays, [&](const TRayPacket<Pack>& packet) {
+                uint64_t bits = 0;
+                for (const CAABB& box : scene.boxes) {
+                    Pack t;
+                    bits += static_cast<uint64_t>(EngineUtilities::intersectRayAABB(packet, box, t));
+                }
+                return bits;
+            });
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult((prefix + "esfera").c_str(), timePasses(tests, [&]() {
+            uint64_t hits = forEachPacket<Pack>(rays, [&](const TRayPacket<Pack>& packet) {
+                uint64_t bits = 0;
+                for (const CBoundingSphere& sphere : scene.spheres) {
+                    Pack t;
+                    bits += static_cast<uint64_t>(EngineUtilities::intersectRaySphere(packet, sphere, t));
+                }
+                return bits;
+            });
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult((prefix + "plano").c_str(), timePasses(tests, [&]() {
+            uint64_t hits = forEachPacket<Pack>(rays, [&](const TRayPacket<Pack>& packet) {
+                uint64_t bits = 0;
+                for (const CVector4& plane : scene.planes) {
+                    Pack t;
+                    bits += static_cast<uint64_t>(EngineUtilities::intersectRayPlane(packet, plane, t));
+                }
+                return bits;
+            });
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult((prefix + "triángulo, Möller-Trumbore").c_str(), timePasses(tests, [&]() {
+            uint64_t hits = forEachPacket<Pack>(rays, [&](const TRayPacket<Pack>& packet) {
+                uint64_t bits = 0;
+                for (size_t k = 0; k < scene.triangles.size(); k += 3) {
+                    Pack t, u, v;
+                    bits += static_cast<uint64_t>(EngineUtilities::intersectRayTriangle(packet, scene.triangles[k],
+                        scene.triangles[k + 1], scene.triangles[k + 2], t, u, v));
+                }
+                return bits;
+            });
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult((prefix + "triángulo, estanca").c_str(), timePasses(tests, [&]() {
+            uint64_t hits = forEachPacket<Pack>(rays, [&](const TRayPacket<Pack>& packet) {
+                uint64_t bits = 0;
+                for (size_t k = 0; k < scene.triangles.size(); k += 3) {
+                    Pack t, u, v;
+                    bits += static_cast<uint64_t>(EngineUtilities::intersectRayTriangleWatertight(packet, scene.triangles[k],
+                        scene.triangles[k + 1], scene.triangles[k + 2], t, u, v));
+                }
+                return bits;
+            });
+            Bench::doNotOptimize(hits);
+        }));
+    }
+
+    void benchKernels(const CRayArray& rays, const Scene& scene) {
+        size_t tests = rays.size() * kPrimitives;
+        std::vector<CVector3> origins(rays.size()), directions(rays.size()), inverses(rays.size());
+        std::vector<float> limits(rays.size());
+        for (size_t i = 0; i < rays.size(); ++i) {
+            rays.get(i, origins[i], directions[i], limits[i]);
+            inverses[i] = CVector3(1.0f / directions[i].x, 1.0f / directions[i].y, 1.0f / directions[i].z);
+        }
+        Bench::beginGroup("Pruebas por segundo, " + std::to_string(rays.size()) + " rayos x " + std::to_string(kPrimitives) +
+            " primitivas (por prueba)");
+        Bench::printResult("escalar: caja", timePasses(tests, [&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < rays.size(); ++i) {
+                for (const CAABB& box : scene.boxes) {
+                    float tEnter, tExit;
+                    hits += EngineUtilities::intersectRayAABB(origins[i], inverses[i], box, limits[i], tEnter, tExit) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("escalar: esfera", timePasses(tests, [&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < rays.size(); ++i) {
+                for (const CBoundingSphere& sphere : scene.spheres) {
+                    float t;
+                    hits += EngineUtilities::intersectRaySphere(origins[i], directions[i], sphere, limits[i], t) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("escalar: plano", timePasses(tests, [&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < rays.size(); ++i) {
+                for (const CVector4& plane : scene.planes) {
+                    float t;
+                    hits += EngineUtilities::intersectRayPlane(origins[i], directions[i], plane, limits[i], t) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("escalar: triángulo, Möller-Trumbore", timePasses(tests, [&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < rays.size(); ++i) {
+                for (size_t k = 0; k < scene.triangles.size(); k += 3) {
+                    float t, u, v;
+                    hits += EngineUtilities::intersectRayTriangle(origins[i], directions[i], scene.triangles[k],
+                        scene.triangles[k + 1], scene.triangles[k + 2], limits[i], t, u, v) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+        Bench::printResult("escalar: triángulo, estanca", timePasses(tests, [&]() {
+            size_t hits = 0;
+            for (size_t i = 0; i < rays.size(); ++i) {
+                CWatertightRay ray(origins[i], directions[i]);
+                for (size_t k = 0; k < scene.triangles.size(); k += 3) {
+                    float t, u, v;
+                    hits += EngineUtilities::intersectRayTriangleWatertight(ray, scene.triangles[k], scene.triangles[k + 1],
+                        scene.triangles[k + 2], limits[i], t, u, v) ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(hits);
+        }));
+#if defined(ENGINEUTILITIES_SSE)
+        benchPackets<EngineUtilities::CFloat4>("4", rays, scene);
+#endif
+#if defined(ENGINEUTILITIES_AVX)
+        benchPackets<EngineUtilities::CFloat8>("8", rays, scene);
+#endif
+
+        Bench::beginGroup("Impacto más cercano contra " + std::to_string(kPrimitives) + " triángulos (por rayo)");
+        std::vector<CTriangleHit> hits(rays.size());
+        Bench::printResult("escalar, estanca", timePasses(rays.size(), [&]() {
+            for (size_t i = 0; i < rays.size(); ++i) {
+                CWatertightRay ray(origins[i], directions[i]);
+                CTriangleHit best{ limits[i], 0.0f, 0.0f, UINT32_MAX };
+                for (size_t k = 0; k < scene.triangles.size(); k += 3) {
+                    float t, u, v;
+                    if (EngineUtilities::intersectRayTriangleWatertight(ray, scene.triangles[k], scene.triangles[k + 1],
+                        scene.triangles[k + 2], best.t, t, u, v)) {
+                        best = CTriangleHit{ t, u, v, static_cast<uint32_t>(k / 3) };
+                    }
+                }
+                hits[i] = best;
+            }
+            Bench::doNotOptimize(hits[0]);
+        }));
+        Bench::printResult("intersectTrianglesBatch (paquetes)", timePasses(rays.size(), [&]() {
+            size_t found = EngineUtilities::intersectTrianglesBatch(rays, scene.triangles.data(), kPrimitives, hits.data());
+            Bench::doNotOptimize(found);
+        }));
+    }
+
+    /// Rayos casi paralelos a una malla plana dirigidos a sus aristas y vértices: cuántos no tocan ningún triángulo.
+    void benchGrazing(std::mt19937& rng) {
+        const int n = 16;
+        std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+        std::vector<CVector3> points(static_cast<size_t>((n + 1) * (n + 1)));
+        for (int j = 0; j <= n; ++j) {
+            for (int i = 0; i <= n; ++i) {
+                points[j * (n + 1) + i] = CVector3(i + jitter(rng), j + jitter(rng), 0.0f);
+            }
+        }
+        std::vector<CVector3> triangles;
+        for (int j = 0; j < n; ++j) {
+            for (int i = 0; i < n; ++i) {
+                const CVector3& a = points[j * (n + 1) + i];
+                const CVector3& b = points[j * (n + 1) + i + 1];
+                const CVector3& c = points[(j + 1) * (n + 1) + i];
+                const CVector3& d = points[(j + 1) * (n + 1) + i + 1];
+                triangles.insert(triangles.end(), { a, b, d, a, d, c });
+            }
+        }
+        std::uniform_real_distribution<float> azimuth(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> elevation(1e-4f, 1e-2f);
+        std::uniform_real_distribution<float> along(0.0f, 1.0f);
+        std::uniform_int_distribution<int> interior(2, n - 2);
+        CRayArray rays;
+        for (size_t i = 0; i < kGrazingRays; ++i) {
+            int x = interior(rng), y = interior(rng);
+            CVector3 target = points[y * (n + 1) + x];
+            if (i % 4 != 0) {
+                int step = i % 4 == 1 ? 1 : (i % 4 == 2 ? n + 1 : n + 2);
+                target = CVector3::lerp(target, points[y * (n + 1) + x + step], along(rng));
+                target.z = 0.0f;
+            }
+            float a = azimuth(rng), e = elevation(rng);
+            CVector3 direction(static_cast<float>(EngineUtilities::cos(e) * EngineUtilities::cos(a)),
+                static_cast<float>(EngineUtilities::cos(e) * EngineUtilities::sin(a)), static_cast<float>(-EngineUtilities::sin(e)));
+            rays.push(target - direction * 5.0f, direction);
+        }
+        size_t leaksMT = 0, leaksWatertight = 0;
+        for (size_t r = 0; r < rays.size(); ++r) {
+            CVector3 origin, direction;
+            float maxT;
+            rays.get(r, origin, direction, maxT);
+            CWatertightRay ray(origin, direction);
+            bool hitMT = false, hitWatertight = false;
+            for (size_t k = 0; k + 2 < triangles.size(); k += 3) {
+                float t, u, v;
+                hitMT = hitMT || EngineUtilities::intersectRayTriangle(origin, direction, triangles[k], triangles[k + 1],
+                    triangles[k + 2], maxT, t, u, v);
+                hitWatertight = hitWatertight || EngineUtilities::intersectRayTriangleWatertight(ray, triangles[k],
+                    triangles[k + 1], triangles[k + 2], maxT, t, u, v);
+            }
+            leaksMT += hitMT ? 0 : 1;
+            leaksWatertight += hitWatertight ? 0 : 1;
+        }
+        std::printf(" Rayos rasantes a aristas y vértices de una malla (%zu): se cuelan %zu con Möller-Trumbore, %zu con la estanca\n",
+            rays.size(), leaksMT, leaksWatertight);
+    }
+
+}
+
+/**
+ * @brief Mide las pruebas de rayo contra caja, esfera, plano y triángulo en escalar y por
+ *        paquetes de 4 y 8, el trazado por paquetes del impacto más cercano y cuántos rayos
+ *        rasantes se cuelan entre triángulos con cada prueba.
+ */
+void benchRayIntersection() {
+    std::printf("\n=== Intersecciones de rayos (%s) ===\n", EngineUtilities::simdLevelName());
+    std::mt19937 rng(23);
+    Scene scene = makeScene(rng);
+    CRayArray rays = makeRays(rng);
+    benchKernels(rays, scene);
+    benchGrazing(rng);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file benchSmartPointers.cpp
+ * @brief Benchmark de las operaciones de TSharedPointer, TWeakPointer, TUniquePtr y TStaticPtr.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Memory/TSharedPointer.h"
+#include "../include/Memory/TStaticPtr.h"
+#include "../include/Memory/TUniquePtr.h"
+#include "../include/Memory/TWeakPointer.h"
+#include "../include/Vector/CVector3.h"
+
+namespace {
+
+    using EngineUtilities::CVector3;
+    using EngineUtilities::TSharedPointer;
+    using EngineUtilities::TStaticPtr;
+    using EngineUtilities::TUniquePtr;
+    using EngineUtilities::TWeakPointer;
+
+    const uint64_t kInputMask = 255; ///< Punteros distintos por medición (potencia de dos menos uno).
+
+    /// Objeto polimórfico para medir dynamic_pointer_cast.
+    struct BenchEntity {
+        virtual ~BenchEntity() {}
+        CVector3 position;
+    };
+
+    struct BenchActor : BenchEntity {
+        CVector3 velocity;
+    };
+
+    /// Servicio accedido a través de TStaticPtr.
+    struct BenchLocatorService {
+        int value = 7;
+    };
+
+}
+
+/**
+ * @brief Mide creación, copia, movimiento, acceso y liberación de los punteros inteligentes
+ *        en un solo hilo.
+ */
+void benchSmartPointers() {
+    std::printf("\n=== Punteros inteligentes (un hilo) ===\n");
+
+    std::vector<TSharedPointer<BenchEntity>> shared(kInputMask + 1);
+    for (TSharedPointer<BenchEntity>& pointer : shared) {
+        pointer = TSharedPointer<BenchEntity>(new BenchActor());
+    }
+    std::vector<TWeakPointer<BenchEntity>> weak(shared.begin(), shared.end());
+
+    Bench::beginGroup("TSharedPointer");
+    Bench::measure("MakeShared + destruccion", [&](uint64_t) {
+        TSharedPointer<CVector3> pointer = EngineUtilities::MakeShared<CVector3>();
+        Bench::doNotOptimize(pointer.get());
+    });
+    Bench::measure("copia + destruccion", [&](uint64_t i) {
+        TSharedPointer<BenchEntity> copy = shared[i & kInputMask];
+        return copy.get();
+    });
+    Bench::measure("asignacion por copia", [&](uint64_t i) {
+        TSharedPointer<BenchEntity> copy;
+        copy = shared[i & kInputMask];
+        return copy.get();
+    });
+    Bench::measure("movimiento", [&](uint64_t i) {
+        TSharedPointer<BenchEntity>& slot = shared[i & kInputMask];
+        TSharedPointer<BenchEntity> moved(std::move(slot));
+        slot = std::move(moved);
+        return slot.get();
+    });
+    Bench::measure("reset(new T)", [&](uint64_t) {
+        TSharedPointer<CVector3> pointer;
+        pointer.reset(new CVector3());
+        Bench::doNotOptimize(pointer.get());
+    });
+    Bench::measure("operator->", [&](uint64_t i) { return shared[i & kInputMask]->position.x; });
+    Bench::measure("swap", [&](uint64_t i) {
+        shared[i & kInputMask].swap(shared[(i + 1) & kInputMask]);
+        return shared[i & kInputMask].get();
+    });
+    Bench::measure("dynamic_pointer_cast", [&](uint64_t i) {
+        return shared[i & kInputMask].dynamic_pointer_cast<BenchActor>().get();
+    });
+
+    Bench::beginGroup("TWeakPointer");
+    Bench::measure("construccion desde TSharedPointer", [&](uint64_t i) {
+        TWeakPointer<BenchEntity> pointer(shared[i & kInputMask]);
+        Bench::doNotOptimize(pointer);
+    });
+    Bench::measure("lock", [&](uint64_t i) { return weak[i & kInputMask].lock().get(); });
+
+    Bench::beginGroup("TUniquePtr");
+    Bench::measure("MakeUnique + destruccion", [&](uint64_t) {
+        TUniquePtr<CVector3> pointer = EngineUtilities::MakeUnique<CVector3>();
+        Bench::doNotOptimize(pointer.get());
+    });
+    TUniquePtr<CVector3> unique = EngineUtilities::MakeUnique<CVector3>();
+    Bench::measure("movimiento", [&](uint64_t) {
+        TUniquePtr<CVector3> moved(std::move(unique));
+        unique = std::move(moved);
+        return unique.get();
+    });
+    Bench::measure("release + reset", [&](uint64_t) {
+        unique.reset(unique.release());
+        return unique.get();
+    });
+    Bench::measure("reset(new T)", [&](uint64_t) {
+        unique.reset(new CVector3());
+        return unique.get();
+    });
+    Bench::measure("operator->", [&](uint64_t) { return unique->x; });
+
+    Bench::beginGroup("TStaticPtr");
+    TStaticPtr<BenchLocatorService>::getOrCreate();
+    Bench::measure("get", [&](uint64_t) { return TStaticPtr<BenchLocatorService>::get(); });
+    Bench::measure("getOrCreate (camino rapido)", [&](uint64_t) {
+        return TStaticPtr<BenchLocatorService>::getOrCreate();
+    });
+    Bench::measure("isNull", [&](uint64_t) { return TStaticPtr<BenchLocatorService>::isNull(); });
+    Bench::measure("reset(new T)", [&](uint64_t) {
+        TStaticPtr<BenchLocatorService>::reset(new BenchLocatorService());
+        return TStaticPtr<BenchLocatorService>::get();
+    });
+    TStaticPtr<BenchLocatorService>::shutdown();
+}
@@ -0,0 +1,241 @@
+/**
+ * @file benchSpaceFillingCurves.cpp
+ * @brief Benchmark de los códigos de Morton y Hilbert y de CRadixSorter, en claves por segundo.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/SpaceFillingCurves.h"
+#include "../include/Geometry/TSpatialHashGrid.h"
+#include "../include/Utilities/CRadixSorter.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CRadixSorter;
+    using EngineUtilities::CSpatialHashGrid3D;
+    using EngineUtilities::CSpatialQuantizer;
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+
+    const int kPasses = 3;            ///< Repeticiones por medición (más una de calentamiento).
+    const size_t kPoints = 1000000;   ///< Puntos de las mediciones de códigos.
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    void benchEncode(CJobSystem& jobs, const std::vector<CVector3>& points, const CAABB& bounds) {
+        size_t count = points.size();
+        std::vector<uint64_t> codes(count);
+        Bench::beginGroup("Códigos 3D desde CVector3 (" + std::to_string(count) + ")");
+        Bench::printResult("mortonCodes (por clave)", timePasses(count, [&]() {
+            EngineUtilities::mortonCodes(points.data(), count, bounds, codes.data());
+            Bench::doNotOptimize(codes[0]);
+        }));
+        const CSpatialQuantizer quantizer(bounds);
+        Bench::printResult("mortonEncode3Portable (por clave)", timePasses(count, [&]() {
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t x, y, z;
+                quantizer.cell(points[i], x, y, z);
+                codes[i] = EngineUtilities::mortonEncode3Portable(x, y, z);
+            }
+            Bench::doNotOptimize(codes[0]);
+        }));
+        Bench::printResult("hilbertCodes (por clave)", timePasses(count, [&]() {
+            EngineUtilities::hilbertCodes(points.data(), count, bounds, codes.data());
+            Bench::doNotOptimize(codes[0]);
+        }));
+        std::string parallelName = "parallelMortonCodes, " + std::to_string(jobs.concurrency() + 1) + " hilo(s) (por clave)";
+        Bench::printResult(parallelName.c_str(), timePasses(count, [&]() {
+            EngineUtilities::parallelMortonCodes(jobs, points.data(), count, bounds, codes.data());
+            Bench::doNotOptimize(codes[0]);
+        }));
+
+        Bench::beginGroup("Intercalado sin cuantizar (" + std::to_string(count) + ")");
+        std::vector<uint32_t> cells(count);
+        for (size_t i = 0; i < count; ++i) {
+            cells[i] = static_cast<uint32_t>(i * 2654435761u) & 0x1FFFFF;
+        }
+        Bench::printResult("mortonEncode3 (por clave)", timePasses(count, [&]() {
+            uint64_t sum = 0;
+            for (size_t i = 0; i + 2 < count; ++i) {
+                sum += EngineUtilities::mortonEncode3(cells[i], cells[i + 1], cells[i + 2]);
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult("mortonEncode3Portable (por clave)", timePasses(count, [&]() {
+            uint64_t sum = 0;
+            for (size_t i = 0; i + 2 < count; ++i) {
+                sum += EngineUtilities::mortonEncode3Portable(cells[i], cells[i + 1], cells[i + 2]);
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        EngineUtilities::mortonCodes(points.data(), count, bounds, codes.data());
+        Bench::printResult("mortonDecode3 (por clave)", timePasses(count, [&]() {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t x, y, z;
+                EngineUtilities::mortonDecode3(codes[i], x, y, z);
+                sum += x ^ y ^ z;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult("mortonDecode3Portable (por clave)", timePasses(count, [&]() {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t x, y, z;
+                EngineUtilities::mortonDecode3Portable(codes[i], x, y, z);
+                sum += x ^ y ^ z;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        Bench::printResult("hilbertDecode3 (por clave)", timePasses(count, [&]() {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                uint32_t x, y, z;
+                EngineUtilities::hilbertDecode3(codes[i], x, y, z);
+                sum += x ^ y ^ z;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+
+        // 2D: 32 bits por eje.
+        std::vector<CVector2> plane(count);
+        for (size_t i = 0; i < count; ++i) {
+            plane[i] = CVector2(points[i].x, points[i].z);
+        }
+        CVector2 planeMin(bounds.min.x, bounds.min.z);
+        CVector2 planeMax(bounds.max.x, bounds.max.z);
+        Bench::beginGroup("Códigos 2D desde CVector2 (" + std::to_string(count) + ")");
+        Bench::printResult("mortonCodes (por clave)", timePasses(count, [&]() {
+            EngineUtilities::mortonCodes(plane.data(), count, planeMin, planeMax, codes.data());
+            Bench::doNotOptimize(codes[0]);
+        }));
+        Bench::printResult("hilbertCodes (por clave)", timePasses(count, [&]() {
+            EngineUtilities::hilbertCodes(plane.data(), count, planeMin, planeMax, codes.data());
+            Bench::doNotOptimize(codes[0]);
+        }));
+    }
+
+    void benchSort(CJobSystem& jobs, const std::vector<CVector3>& points, const CAABB& bounds) {
+        size_t count = points.size();
+        std::vector<uint64_t> codes(count);
+        EngineUtilities::mortonCodes(points.data(), count, bounds, codes.data());
+        std::vector<uint64_t> keys(count);
+        std::vector<uint32_t> values(count);
+        auto reset = [&]() {
+            keys = codes;
+            for (size_t i = 0; i < count; ++i) {
+                values[i] = static_cast<uint32_t>(i);
+            }
+        };
+        // Cada medición incluye la copia de las claves; se mide aparte para restarla.
+        double resetNs = timePasses(count, reset);
+        CRadixSorter sorter;
+        Bench::beginGroup("Ordenación por código de Morton (" + std::to_string(count) + ")");
+        Bench::printResult("std::sort clave + índice (por clave)", timePasses(count, [&]() {
+            reset();
+            std::vector<std::pair<uint64_t, uint32_t>> pairs(count);
+            for (size_t i = 0; i < count; ++i) {
+                pairs[i] = std::make_pair(keys[i], values[i]);
+            }
+            std::sort(pairs.begin(), pairs.end());
+            Bench::doNotOptimize(pairs[0]);
+        }) - resetNs);
+        Bench::printResult("CRadixSorter, 63 bits, 1 hilo (por clave)", timePasses(count, [&]() {
+            reset();
+            sorter.sort(keys.data(), values.data(), count, 63);
+        }) - resetNs);
+        std::string parallelName = "CRadixSorter, 63 bits, " + std::to_string(jobs.concurrency() + 1) + " hilo(s) (por clave)";
+        Bench::printResult(parallelName.c_str(), timePasses(count, [&]() {
+            reset();
+            sorter.sort(keys.data(), values.data(), count, 63, &jobs);
+        }) - resetNs);
+        // Con 2^10 celdas por eje bastan los 30 bits altos del código (4 pasadas en vez de 8).
+        for (uint64_t& code : codes) {
+            code >>= 33;
+        }
+        Bench::printResult("CRadixSorter, 30 bits, 1 hilo (por clave)", timePasses(count, [&]() {
+            reset();
+            sorter.sort(keys.data(), values.data(), count, 30);
+        }) - resetNs);
+        Bench::printResult("CRadixSorter, solo claves de 30 bits (por clave)", timePasses(count, [&]() {
+            reset();
+            sorter.sort(keys.data(), nullptr, count, 30);
+        }) - resetNs);
+    }
+
+    /// Efecto del orden de los puntos: consultas de radio de la rejilla recorriendo el array.
+    void benchLocality(const std::vector<CVector3>& points, const CAABB& bounds) {
+        size_t count = points.size();
+        std::vector<uint64_t> codes(count);
+        std::vector<uint32_t> order(count);
+        EngineUtilities::hilbertCodes(points.data(), count, bounds, codes.data());
+        for (size_t i = 0; i < count; ++i) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        CRadixSorter sorter;
+        sorter.sort(codes, order, 63);
+        std::vector<CVector3> sorted(count);
+        for (size_t i = 0; i < count; ++i) {
+            sorted[i] = points[order[i]];
+        }
+        Bench::beginGroup("Localidad: rejilla y un queryRadius por punto (" + std::to_string(count) + ")");
+        const std::vector<CVector3>* sets[2] = { &points, &sorted };
+        const char* names[2] = { "orden original (por punto)", "orden de Hilbert (por punto)" };
+        for (int set = 0; set < 2; ++set) {
+            const std::vector<CVector3>& cloud = *sets[set];
+            CSpatialHashGrid3D grid(1.0f);
+            Bench::printResult(names[set], timePasses(count, [&]() {
+                grid.build(cloud.data(), count);
+                size_t found = 0;
+                for (const CVector3& point : cloud) {
+                    grid.queryRadius(point, 1.0f, [&](uint32_t, float) { ++found; });
+                }
+                Bench::doNotOptimize(found);
+            }));
+        }
+    }
+
+}
+
+/**
+ * @brief Mide el cálculo de códigos de Morton y Hilbert (con BMI2 y portable), la ordenación
+ *        radix en serie y en paralelo frente a std::sort, y el efecto del orden en una rejilla.
+ */
+void benchSpaceFillingCurves() {
+#if defined(ENGINEUTILITIES_BMI2)
+    const char* path = "BMI2 pdep/pext";
+#else
+    const char* path = "portable";
+#endif
+    std::printf("\n=== Curvas de Morton y Hilbert (intercalado: %s) ===\n", path);
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    CJobSystem jobs(cores - 1);
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(0.0f, 79.4f);
+    std::vector<CVector3> points(kPoints);
+    for (CVector3& point : points) {
+        point = CVector3(position(rng), position(rng), position(rng));
+    }
+    CAABB bounds = CAABB::fromPoints(points.data(), points.size());
+    benchEncode(jobs, points, bounds);
+    benchSort(jobs, points, bounds);
+    benchLocality(points, bounds);
+}
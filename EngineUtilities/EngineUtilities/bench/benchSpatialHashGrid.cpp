@@ -0,0 +1,163 @@
+/**
+ * @file benchSpatialHashGrid.cpp
+ * @brief Benchmark de TSpatialHashGrid frente a la búsqueda O(n^2) con 10K, 100K y 1M puntos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/TSpatialHashGrid.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CSpatialHashGrid2D;
+    using EngineUtilities::CSpatialHashGrid3D;
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+
+    const int kPasses = 3;          ///< Repeticiones por medición (más una de calentamiento).
+    const size_t kQueries = 10000;  ///< Consultas por medición.
+    const size_t kSampleRows = 50;  ///< Filas medidas de la búsqueda O(n^2) (se extrapola al total).
+    const float kRadius = 1.0f;     ///< Radio de búsqueda (y lado de celda).
+    const size_t kNeighbours = 8;   ///< k de las consultas de k vecinos.
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    /// Mide una nube de count puntos 3D en un cubo de lado side (unos 8 vecinos por radio).
+    void benchCloud(CJobSystem& jobs, size_t count, float side) {
+        std::mt19937 rng(static_cast<unsigned>(count));
+        std::uniform_real_distribution<float> position(0.0f, side);
+        std::vector<CVector3> points(count);
+        for (CVector3& point : points) {
+            point = CVector3(position(rng), position(rng), position(rng));
+        }
+        std::string label = std::to_string(count);
+        std::printf("\n--- %zu puntos ---\n", count);
+
+        CSpatialHashGrid3D grid(kRadius);
+        Bench::beginGroup("Reconstrucción (" + label + ")");
+        Bench::printResult("build en serie (por punto)", timePasses(count, [&]() {
+            grid.build(points.data(), count);
+        }));
+        std::string parallelName = "build, " + std::to_string(jobs.concurrency() + 1) + " hilo(s) (por punto)";
+        Bench::printResult(parallelName.c_str(), timePasses(count, [&]() {
+            grid.build(points.data(), count, &jobs);
+        }));
+
+        Bench::beginGroup("Vecinos en un radio (" + label + ")");
+        size_t neighbours = 0;
+        Bench::printResult("queryRadius (por consulta)", timePasses(kQueries, [&]() {
+            neighbours = 0;
+            for (size_t q = 0; q < kQueries; ++q) {
+                grid.queryRadius(points[q], kRadius, [&](uint32_t, float) { ++neighbours; });
+            }
+            Bench::doNotOptimize(neighbours);
+        }));
+        std::printf("  %.1f vecinos por consulta\n", static_cast<double>(neighbours) / kQueries);
+        const float radiusSquared = kRadius * kRadius;
+        double rowNs = timePasses(kSampleRows, [&]() {
+            size_t found = 0;
+            for (size_t q = 0; q < kSampleRows; ++q) {
+                const CVector3 center = points[q];
+                for (size_t i = 0; i < count; ++i) {
+                    found += (points[i] - center).lengthSquare() <= radiusSquared ? 1 : 0;
+                }
+            }
+            Bench::doNotOptimize(found);
+        });
+        Bench::printResult("Fuerza bruta (por consulta)", rowNs);
+
+        Bench::beginGroup("Todos los vecinos de todos los puntos (" + label + ")");
+        Bench::printResult("queryRadius x n, 1 hilo (por escena)", timePasses(1, [&]() {
+            size_t found = 0;
+            for (size_t q = 0; q < count; ++q) {
+                grid.queryRadius(points[q], kRadius, [&](uint32_t, float) { ++found; });
+            }
+            Bench::doNotOptimize(found);
+        }));
+        Bench::printResult("Fuerza bruta O(n^2), extrapolado (por escena)", rowNs * static_cast<double>(count));
+
+        Bench::beginGroup("k = " + std::to_string(kNeighbours) + " vecinos (" + label + ")");
+        uint32_t indices[kNeighbours];
+        float distances[kNeighbours];
+        Bench::printResult("nearest (por consulta)", timePasses(kQueries, [&]() {
+            float sum = 0.0f;
+            for (size_t q = 0; q < kQueries; ++q) {
+                size_t n = grid.nearest(points[q], kNeighbours, indices, distances);
+                sum += n > 0 ? distances[n - 1] : 0.0f;
+            }
+            Bench::doNotOptimize(sum);
+        }));
+        std::vector<float> all(count);
+        Bench::printResult("Fuerza bruta, nth_element (por consulta)", timePasses(kSampleRows, [&]() {
+            float sum = 0.0f;
+            for (size_t q = 0; q < kSampleRows; ++q) {
+                const CVector3 center = points[q];
+                for (size_t i = 0; i < count; ++i) {
+                    all[i] = (points[i] - center).lengthSquare();
+                }
+                std::nth_element(all.begin(), all.begin() + kNeighbours, all.end());
+                sum += all[kNeighbours];
+            }
+            Bench::doNotOptimize(sum);
+        }));
+    }
+
+    /// Reconstrucción y consultas de radio de la variante 2D (1M puntos).
+    void benchPlane(CJobSystem& jobs, size_t count, float side) {
+        std::mt19937 rng(static_cast<unsigned>(count) + 1);
+        std::uniform_real_distribution<float> position(0.0f, side);
+        std::vector<CVector2> points(count);
+        for (CVector2& point : points) {
+            point = CVector2(position(rng), position(rng));
+        }
+        CSpatialHashGrid2D grid(kRadius);
+        std::printf("\n--- %zu puntos 2D ---\n", count);
+        Bench::beginGroup("CSpatialHashGrid2D (" + std::to_string(count) + ")");
+        Bench::printResult("build en serie (por punto)", timePasses(count, [&]() {
+            grid.build(points.data(), count);
+        }));
+        Bench::printResult("build en paralelo (por punto)", timePasses(count, [&]() {
+            grid.build(points.data(), count, &jobs);
+        }));
+        Bench::printResult("queryRadius (por consulta)", timePasses(kQueries, [&]() {
+            size_t found = 0;
+            for (size_t q = 0; q < kQueries; ++q) {
+                grid.queryRadius(points[q], kRadius, [&](uint32_t, float) { ++found; });
+            }
+            Bench::doNotOptimize(found);
+        }));
+    }
+
+}
+
+/**
+ * @brief Mide la reconstrucción (en serie y en paralelo) y las consultas de radio y de k
+ *        vecinos de TSpatialHashGrid frente a recorrer todos los puntos.
+ */
+void benchSpatialHashGrid() {
+    std::printf("\n=== Rejilla hash uniforme ===\n");
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    CJobSystem jobs(cores - 1);
+    // Misma densidad (~2 puntos por celda) en las tres nubes: el lado crece con la raíz cúbica.
+    benchCloud(jobs, 10000, 17.1f);
+    benchCloud(jobs, 100000, 36.8f);
+    benchCloud(jobs, 1000000, 79.4f);
+    benchPlane(jobs, 1000000, 707.0f);
+}
@@ -0,0 +1,198 @@
+/**
+ * @file benchStaticBVH.cpp
+ * @brief Benchmark de CStaticBVH sobre un terreno de un millón de triángulos (Mrayos/s).
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Geometry/CStaticBVH.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CStaticBVH;
+    using EngineUtilities::CTriangleHit;
+    using EngineUtilities::CVector3;
+
+    const uint32_t kGrid = 708;  ///< Celdas por lado del terreno (2 * 708^2 ~ 1M triángulos).
+    const size_t kRays = 200000; ///< Rayos por medición.
+    const int kPasses = 3;       ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(size_t operations, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(operations) * kPasses);
+    }
+
+    /// Altura del terreno: suma de ondas (colinas y detalle).
+    float terrainHeight(float x, float z) {
+        return 20.0f * static_cast<float>(EngineUtilities::sin(x * 0.011) * EngineUtilities::cos(z * 0.013)) +
+            3.0f * static_cast<float>(EngineUtilities::sin(x * 0.07 + z * 0.05));
+    }
+
+    /// Malla indexada del terreno: kGrid x kGrid celdas de 1 unidad, dos triángulos por celda.
+    void makeTerrain(std::vector<CVector3>& vertices, std::vector<uint32_t>& indices) {
+        const uint32_t side = kGrid + 1;
+        vertices.resize(static_cast<size_t>(side) * side);
+        for (uint32_t z = 0; z < side; ++z) {
+            for (uint32_t x = 0; x < side; ++x) {
+                float fx = static_cast<float>(x);
+                float fz = static_cast<float>(z);
+                vertices[z * side + x] = CVector3(fx, terrainHeight(fx, fz), fz);
+            }
+        }
+        indices.clear();
+        indices.reserve(static_cast<size_t>(kGrid) * kGrid * 6);
+        for (uint32_t z = 0; z < kGrid; ++z) {
+            for (uint32_t x = 0; x < kGrid; ++x) {
+                uint32_t a = z * side + x;
+                uint32_t b = a + 1;
+                uint32_t c = a + side;
+                uint32_t d = c + 1;
+                indices.insert(indices.end(), { a, b, d, a, d, c });
+            }
+        }
+    }
+
+}
+
+/**
+ * @brief Mide la construcción de CStaticBVH (en serie y en paralelo) y su rendimiento en
+ *        rayos coherentes (cámara) e incoherentes, frente a probar todos los triángulos.
+ */
+void benchStaticBVH() {
+    std::vector<CVector3> vertices;
+    std::vector<uint32_t> indices;
+    makeTerrain(vertices, indices);
+    const size_t triangleCount = indices.size() / 3;
+    std::printf("\n=== BVH estática (%zu triángulos) ===\n", triangleCount);
+
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    CJobSystem jobs(cores - 1);
+    CStaticBVH bvh;
+    Bench::beginGroup("Construcción");
+    Bench::printResult("SAH por cubetas, en serie (por triángulo)", timePasses(triangleCount, [&]() {
+        bvh.build(vertices.data(), indices.data(), triangleCount);
+    }));
+    std::string parallelName = "SAH por cubetas, " + std::to_string(cores) + " hilo(s) (por triángulo)";
+    Bench::printResult(parallelName.c_str(), timePasses(triangleCount, [&]() {
+        bvh.build(vertices.data(), indices.data(), triangleCount, &jobs);
+    }));
+    std::printf("  %zu nodos (%zu KiB), profundidad %d\n", bvh.nodeCount(), bvh.nodeCount() * 32 / 1024, bvh.depth());
+
+    // Rayos de cámara: una rejilla de píxeles mirando al terreno desde arriba y en diagonal.
+    std::vector<CVector3> cameraOrigins(kRays);
+    std::vector<CVector3> cameraDirections(kRays);
+    const size_t width = 500;
+    CVector3 eye(-50.0f, 120.0f, -50.0f);
+    for (size_t i = 0; i < kRays; ++i) {
+        float px = static_cast<float>(i % width) / width - 0.5f;
+        float py = static_cast<float>(i / width) / (kRays / width) - 0.5f;
+        cameraOrigins[i] = eye;
+        cameraDirections[i] = (CVector3(1.0f, -0.6f, 1.0f) + CVector3(px, py, -px) * 1.2f).normalized();
+    }
+    // Rayos incoherentes: origen y dirección aleatorios sobre el terreno.
+    std::vector<CVector3> randomOrigins(kRays);
+    std::vector<CVector3> randomDirections(kRays);
+    std::mt19937 rng(43);
+    std::uniform_real_distribution<float> position(0.0f, static_cast<float>(kGrid));
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    for (size_t i = 0; i < kRays; ++i) {
+        float x = position(rng);
+        float z = position(rng);
+        randomOrigins[i] = CVector3(x, terrainHeight(x, z) + 5.0f, z);
+        randomDirections[i] = CVector3(unit(rng), unit(rng), unit(rng)).normalized();
+    }
+    const float maxT = 2000.0f;
+
+    auto castAll = [&](const std::vector<CVector3>& origins, const std::vector<CVector3>& directions, size_t first,
+        size_t last) {
+        uint32_t sum = 0;
+        for (size_t i = first; i < last; ++i) {
+            CTriangleHit hit;
+            if (bvh.raycast(origins[i], directions[i], maxT, hit)) {
+                sum += hit.triangle;
+            }
+        }
+        return sum;
+    };
+
+    Bench::beginGroup("Rayos, 1 hilo");
+    Bench::printResult("raycast coherente, cámara (por rayo)", timePasses(kRays, [&]() {
+        Bench::doNotOptimize(castAll(cameraOrigins, cameraDirections, 0, kRays));
+    }));
+    Bench::printResult("raycast incoherente (por rayo)", timePasses(kRays, [&]() {
+        Bench::doNotOptimize(castAll(randomOrigins, randomDirections, 0, kRays));
+    }));
+    Bench::printResult("anyHit incoherente (por rayo)", timePasses(kRays, [&]() {
+        size_t blocked = 0;
+        for (size_t i = 0; i < kRays; ++i) {
+            blocked += bvh.anyHit(randomOrigins[i], randomDirections[i], maxT) ? 1 : 0;
+        }
+        Bench::doNotOptimize(blocked);
+    }));
+    Bench::printResult("segmentBlocked, 30 unidades (por segmento)", timePasses(kRays, [&]() {
+        size_t blocked = 0;
+        for (size_t i = 0; i < kRays; ++i) {
+            blocked += bvh.segmentBlocked(randomOrigins[i], randomOrigins[i] + randomDirections[i] * 30.0f) ? 1 : 0;
+        }
+        Bench::doNotOptimize(blocked);
+    }));
+
+    Bench::beginGroup("Rayos, " + std::to_string(cores) + " hilo(s)");
+    Bench::printResult("raycast coherente, cámara (por rayo)", timePasses(kRays, [&]() {
+        jobs.parallelFor(0, kRays, 4096, [&](size_t first, size_t last) {
+            Bench::doNotOptimize(castAll(cameraOrigins, cameraDirections, first, last));
+        });
+    }));
+    Bench::printResult("raycast incoherente (por rayo)", timePasses(kRays, [&]() {
+        jobs.parallelFor(0, kRays, 4096, [&](size_t first, size_t last) {
+            Bench::doNotOptimize(castAll(randomOrigins, randomDirections, first, last));
+        });
+    }));
+
+    // Referencia: el mismo Möller-Trumbore sobre todos los triángulos (pocos rayos: ~1M pruebas cada uno).
+    Bench::beginGroup("Sin jerarquía");
+    const size_t bruteRays = 16;
+    Bench::printResult("Möller-Trumbore, todos los triángulos (por rayo)", timePasses(bruteRays, [&]() {
+        float sum = 0.0f;
+        for (size_t r = 0; r < bruteRays; ++r) {
+            const CVector3& origin = randomOrigins[r];
+            const CVector3& direction = randomDirections[r];
+            float closest = maxT;
+            for (size_t i = 0; i < triangleCount; ++i) {
+                const CVector3& v0 = vertices[indices[3 * i]];
+                CVector3 edge1 = vertices[indices[3 * i + 1]] - v0;
+                CVector3 edge2 = vertices[indices[3 * i + 2]] - v0;
+                CVector3 p = direction.cross(edge2);
+                float det = edge1.dot(p);
+                if (det > -1e-12f && det < 1e-12f) {
+                    continue;
+                }
+                float inverseDet = 1.0f / det;
+                CVector3 s = origin - v0;
+                float u = s.dot(p) * inverseDet;
+                CVector3 q = s.cross(edge1);
+                float v = direction.dot(q) * inverseDet;
+                float t = edge2.dot(q) * inverseDet;
+                if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && t >= 0.0f && t < closest) {
+                    closest = t;
+                }
+            }
+            sum += closest;
+        }
+        Bench::doNotOptimize(sum);
+    }));
+}
@@ -0,0 +1,126 @@
+/**
+ * @file benchTObjectPool.cpp
+ * @brief Benchmark de TObjectPool frente al heap global con churn de 1 y 16 hilos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Memory/TObjectPool.h"
+#include "../include/Vector/CVector3.h"
+#include "../include/Vector/CQuaternion.h"
+#include "../include/Matriz/Matriz4x4.h"
+
+namespace {
+
+    /// Componente típico de una entidad: transformación local y matriz de mundo.
+    struct BenchComponent {
+        EngineUtilities::CVector3 position;
+        EngineUtilities::CQuaternion rotation;
+        EngineUtilities::CVector3 scale;
+        EngineUtilities::Matriz4x4 world;
+    };
+
+    const int kBatch = 1024;  ///< Objetos vivos a la vez por hilo.
+    const int kRounds = 200;  ///< Rondas de creación/destrucción por hilo.
+
+    /// Orden aleatorio (fijo) en que se liberan los objetos de cada ronda.
+    std::vector<int> makeFreeOrder() {
+        std::vector<int> order(kBatch);
+        for (int i = 0; i < kBatch; ++i) {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+        return order;
+    }
+
+    /**
+     * @brief Ejecuta kRounds rondas de kBatch creaciones seguidas de kBatch destrucciones
+     *        en orden aleatorio, en numThreads hilos.
+     *
+     * @return Nanosegundos por pareja creación/destrucción (agregado entre hilos).
+     */
+    template<typename Handle, typename CreateFn, typename DestroyFn>
+    double churn(int numThreads, CreateFn create, DestroyFn destroy) {
+        const std::vector<int> order = makeFreeOrder();
+        double seconds = Bench::runParallel(numThreads, [&](int) {
+            std::vector<Handle> live(kBatch);
+            for (int round = 0; round < kRounds; ++round) {
+                for (int i = 0; i < kBatch; ++i) {
+                    live[i] = create();
+                }
+                Bench::doNotOptimize(live[kBatch - 1]);
+                for (int i = 0; i < kBatch; ++i) {
+                    destroy(live[order[i]]);
+                }
+            }
+        });
+        return seconds * 1e9 / (static_cast<double>(kBatch) * kRounds * numThreads);
+    }
+
+    void runChurn(int numThreads) {
+        using namespace EngineUtilities;
+
+        Bench::beginGroup(std::to_string(numThreads) + " hilo(s)");
+
+        Bench::printResult("new/delete",
+            churn<BenchComponent*>(numThreads,
+                []() { return new BenchComponent(); },
+                [](BenchComponent*& c) { delete c; }));
+
+        {
+            TObjectPool<BenchComponent> pool(kBatch, false);
+            Bench::printResult("TObjectPool sin caches por hilo",
+                churn<BenchComponent*>(numThreads,
+                    [&]() { return pool.create(); },
+                    [&](BenchComponent*& c) { pool.destroy(c); }));
+        }
+        {
+            TObjectPool<BenchComponent> pool(kBatch, true);
+            Bench::printResult("TObjectPool con caches por hilo",
+                churn<BenchComponent*>(numThreads,
+                    [&]() { return pool.create(); },
+                    [&](BenchComponent*& c) { pool.destroy(c); }));
+        }
+
+        Bench::printResult("MakeShared (heap)",
+            churn<TSharedPointer<BenchComponent>>(numThreads,
+                []() { return MakeShared<BenchComponent>(); },
+                [](TSharedPointer<BenchComponent>& c) { c.reset(); }));
+        {
+            TObjectPool<BenchComponent> pool(kBatch);
+            Bench::printResult("MakeShared (TObjectPool)",
+                churn<TSharedPointer<BenchComponent>>(numThreads,
+                    [&]() { return MakeShared(pool); },
+                    [](TSharedPointer<BenchComponent>& c) { c.reset(); }));
+        }
+
+        Bench::printResult("MakeUnique (heap)",
+            churn<TUniquePtr<BenchComponent>>(numThreads,
+                []() { return MakeUnique<BenchComponent>(); },
+                [](TUniquePtr<BenchComponent>& c) { c.reset(); }));
+        {
+            TObjectPool<BenchComponent> pool(kBatch);
+            Bench::printResult("MakeUnique (TObjectPool)",
+                churn<TUniquePtr<BenchComponent, TPoolDeleter<BenchComponent>>>(numThreads,
+                    [&]() { return MakeUnique(pool); },
+                    [](TUniquePtr<BenchComponent, TPoolDeleter<BenchComponent>>& c) { c.reset(); }));
+        }
+    }
+
+}
+
+/**
+ * @brief Compara TObjectPool (con y sin cachés por hilo) y sus MakeShared/MakeUnique con el
+ *        heap global, con churn de un hilo y de 16 hilos.
+ */
+void benchTObjectPool() {
+    std::printf("\n=== TObjectPool: churn de %d objetos de %zu bytes x %d rondas por hilo ===\n",
+        kBatch, sizeof(BenchComponent), kRounds);
+    runChurn(1);
+    runChurn(16);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file benchTSlotMap.cpp
+ * @brief Benchmark de TSlotMap frente a arrays de TSharedPointer.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Containers/TSlotMap.h"
+#include "../include/Memory/TSharedPointer.h"
+#include "../include/Vector/CVector3.h"
+
+namespace {
+
+    using EngineUtilities::CVector3;
+    using EngineUtilities::SlotHandle32;
+    using EngineUtilities::SlotHandle64;
+    using EngineUtilities::TSharedPointer;
+    using EngineUtilities::TSlotMap;
+
+    /// Objeto de motor típico: posición y velocidad.
+    struct BenchBody {
+        CVector3 position;
+        CVector3 velocity;
+    };
+
+    const int kObjects = 100000; ///< Objetos en cada contenedor.
+    const int kPasses = 50;      ///< Recorridos/búsquedas completos por medición.
+
+    BenchBody makeBody(int i) {
+        BenchBody body;
+        body.position = CVector3(static_cast<float>(i), 0.0f, 0.0f);
+        body.velocity = CVector3(0.0f, 1.0f, 0.0f);
+        return body;
+    }
+
+    /// Crea los objetos compartidos intercalados con otras asignaciones, como en un motor real.
+    std::vector<TSharedPointer<BenchBody>> makeSharedBodies(std::vector<TSharedPointer<BenchBody>>& noise) {
+        std::vector<TSharedPointer<BenchBody>> bodies;
+        bodies.reserve(kObjects);
+        for (int i = 0; i < kObjects; ++i) {
+            bodies.push_back(EngineUtilities::MakeShared<BenchBody>(makeBody(i)));
+            noise.push_back(EngineUtilities::MakeShared<BenchBody>(makeBody(-i)));
+        }
+        // Liberar la mitad del ruido para dejar huecos en el heap.
+        for (size_t i = 0; i < noise.size(); i += 2) {
+            noise[i].reset();
+        }
+        std::shuffle(bodies.begin(), bodies.end(), std::mt19937(3));
+        return bodies;
+    }
+
+    template<typename HandleT>
+    void benchSlotMap(const char* iterateName, const char* lookupName, const std::vector<int>& lookupOrder) {
+        TSlotMap<BenchBody, HandleT> map;
+        std::vector<HandleT> handles;
+        map.reserve(kObjects);
+        for (int i = 0; i < kObjects; ++i) {
+            handles.push_back(map.insert(makeBody(i)));
+        }
+
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            for (BenchBody& body : map) {
+                body.position += body.velocity;
+            }
+        }
+        Bench::doNotOptimize(map.data()[0]);
+        Bench::printResult(iterateName, Bench::secondsSince(start) * 1e9 / (double(kObjects) * kPasses));
+
+        start = Bench::Clock::now();
+        float sum = 0.0f;
+        for (int pass = 0; pass < kPasses; ++pass) {
+            for (int index : lookupOrder) {
+                sum += map.get(handles[index])->position.x;
+            }
+        }
+        Bench::doNotOptimize(sum);
+        Bench::printResult(lookupName, Bench::secondsSince(start) * 1e9 / (double(kObjects) * kPasses));
+    }
+
+}
+
+/**
+ * @brief Compara recorrido, búsqueda aleatoria, copia de referencias y churn de TSlotMap con
+ *        un array de TSharedPointer.
+ */
+void benchTSlotMap() {
+    std::printf("\n=== TSlotMap frente a TSharedPointer (%d objetos) ===\n", kObjects);
+
+    std::vector<int> lookupOrder(kObjects);
+    for (int i = 0; i < kObjects; ++i) {
+        lookupOrder[i] = i;
+    }
+    std::shuffle(lookupOrder.begin(), lookupOrder.end(), std::mt19937(11));
+
+    // TSharedPointer: objetos dispersos en el heap.
+    std::vector<TSharedPointer<BenchBody>> noise;
+    std::vector<TSharedPointer<BenchBody>> bodies = makeSharedBodies(noise);
+
+    Bench::Clock::time_point start = Bench::Clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (const TSharedPointer<BenchBody>& body : bodies) {
+            body->position += body->velocity;
+        }
+    }
+    Bench::doNotOptimize(bodies[0]->position);
+    Bench::printResult("recorrido: vector<TSharedPointer>", Bench::secondsSince(start) * 1e9 / (double(kObjects) * kPasses));
+
+    benchSlotMap<SlotHandle32>("recorrido: TSlotMap (denso)", "busqueda aleatoria: TSlotMap 32 bits", lookupOrder);
+    benchSlotMap<SlotHandle64>("recorrido: TSlotMap 64 bits (denso)", "busqueda aleatoria: TSlotMap 64 bits", lookupOrder);
+
+    start = Bench::Clock::now();
+    float sum = 0.0f;
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (int index : lookupOrder) {
+            sum += bodies[index]->position.x;
+        }
+    }
+    Bench::doNotOptimize(sum);
+    Bench::printResult("busqueda aleatoria: TSharedPointer", Bench::secondsSince(start) * 1e9 / (double(kObjects) * kPasses));
+
+    // Copiar referencias: el handle es un entero, el puntero compartido toca el recuento.
+    std::vector<TSharedPointer<BenchBody>> sharedCopies(kObjects);
+    start = Bench::Clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (int i = 0; i < kObjects; ++i) {
+            sharedCopies[i] = bodies[lookupOrder[i]];
+        }
+    }
+    Bench::printResult("copia de referencia: TSharedPointer", Bench::secondsSince(start) * 1e9 / (double(kObjects) * kPasses));
+
+    TSlotMap<BenchBody> map;
+    std::vector<SlotHandle32> handles;
+    for (int i = 0; i < kObjects; ++i) {
+        handles.push_back(map.insert(makeBody(i)));
+    }
+    std::vector<SlotHandle32> handleCopies(kObjects);
+    start = Bench::Clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (int i = 0; i < kObjects; ++i) {
+            handleCopies[i] = handles[lookupOrder[i]];
+        }
+        Bench::doNotOptimize(handleCopies[pass]);
+    }
+    Bench::printResult("copia de referencia: SlotHandle32", Bench::secondsSince(start) * 1e9 / (double(kObjects) * kPasses));
+
+    // Churn: borrar y volver a insertar la mitad de los objetos.
+    start = Bench::Clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (int i = 0; i < kObjects / 2; ++i) {
+            int index = lookupOrder[i];
+            map.erase(handles[index]);
+            handles[index] = map.insert(makeBody(index));
+        }
+    }
+    Bench::printResult("erase + insert: TSlotMap", Bench::secondsSince(start) * 1e9 / (double(kObjects / 2) * kPasses));
+
+    start = Bench::Clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (int i = 0; i < kObjects / 2; ++i) {
+            int index = lookupOrder[i];
+            sharedCopies[index].reset();
+            bodies[index] = EngineUtilities::MakeShared<BenchBody>(makeBody(index));
+        }
+    }
+    Bench::printResult("reset + MakeShared: TSharedPointer", Bench::secondsSince(start) * 1e9 / (double(kObjects / 2) * kPasses));
+}
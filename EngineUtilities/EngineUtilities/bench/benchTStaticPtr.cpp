@@ -0,0 +1,84 @@
+/**
+ * @file benchTStaticPtr.cpp
+ * @brief Benchmark de acceso concurrente a TStaticPtr desde varios hilos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include "BenchHarness.h"
+#include "../include/Memory/TStaticPtr.h"
+
+namespace {
+
+    /// Servicio de ejemplo accedido a través del localizador.
+    struct BenchService {
+        explicit BenchService(int v) : value(v) {}
+        int value;
+    };
+
+    /// Singleton de Meyers (static local) usado como referencia.
+    BenchService& meyersService() {
+        static BenchService service(7);
+        return service;
+    }
+
+    /// Acceso con bloqueo en cada llamada, como alternativa ingenua.
+    std::mutex lockedMutex;
+    BenchService* lockedInstance = nullptr;
+
+    BenchService* lockedGet() {
+        std::lock_guard<std::mutex> lock(lockedMutex);
+        if (lockedInstance == nullptr) {
+            lockedInstance = new BenchService(7);
+        }
+        return lockedInstance;
+    }
+
+    /// Mide fn() repetida iterations veces en cada uno de numThreads hilos.
+    template<typename Fn>
+    double measure(int numThreads, long iterations, Fn fn) {
+        double seconds = Bench::runParallel(numThreads, [&](int) {
+            long sum = 0;
+            for (long i = 0; i < iterations; ++i) {
+                sum += fn()->value;
+            }
+            Bench::doNotOptimize(sum);
+        });
+        // Tiempo por operación agregado: tiempo de pared entre el total de accesos.
+        return seconds * 1e9 / (static_cast<double>(iterations) * numThreads);
+    }
+
+}
+
+/**
+ * @brief Compara get()/getOrCreate() de TStaticPtr con un acceso bloqueante y un static local
+ *        usando de 1 a 16 hilos.
+ */
+void benchTStaticPtr() {
+    using EngineUtilities::TStaticPtr;
+
+    const long iterations = 1000000;
+    TStaticPtr<BenchService>::getOrCreate(7);
+    lockedGet();
+
+    std::printf("\n=== TStaticPtr: acceso concurrente (%ld accesos por hilo) ===\n", iterations);
+    for (int threads = 1; threads <= 16; threads *= 2) {
+        Bench::beginGroup(std::to_string(threads) + " hilo(s)");
+
+        Bench::printResult("TStaticPtr::get",
+            measure(threads, iterations, []() { return TStaticPtr<BenchService>::get(); }));
+        Bench::printResult("TStaticPtr::getOrCreate (camino rapido)",
+            measure(threads, iterations, []() { return TStaticPtr<BenchService>::getOrCreate(7); }));
+        Bench::printResult("static local (Meyers)",
+            measure(threads, iterations, []() { return &meyersService(); }));
+        Bench::printResult("std::mutex en cada acceso",
+            measure(threads, iterations, []() { return lockedGet(); }));
+    }
+
+    TStaticPtr<BenchService>::shutdown();
+    delete lockedInstance;
+    lockedInstance = nullptr;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file benchTasks.cpp
+ * @brief Benchmark del coste de crear y reanudar tareas TTask frente a callbacks de CJobSystem.
+ * @author Hannin Abarca
+ *
+ * TTask requiere C++20; compilado con un estándar anterior la suite no mide nada.
+ */
+
+#include <cstdio>
+#include "BenchHarness.h"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <functional>
+#include <vector>
+#include "../include/Threading/TTask.h"
+
+namespace {
+
+    using EngineUtilities::CJobCounter;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CTaskScheduler;
+    using EngineUtilities::TTask;
+
+    const int kCount = 100000; ///< Tareas, trabajos o saltos por medición.
+    const int kPasses = 5;     ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por operación.
+    template<typename Fn>
+    double timePasses(Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(kCount) * kPasses);
+    }
+
+    TTask<> emptyTask() {
+        co_return;
+    }
+
+    TTask<int> addOne(int value) {
+        co_return value + 1;
+    }
+
+    /// Una tarea que salta al pool count veces.
+    TTask<> hop(CTaskScheduler& scheduler, int count) {
+        for (int i = 0; i < count; ++i) {
+            co_await scheduler.schedule();
+        }
+    }
+
+    /// Una tarea que espera count subtareas ya listas (continuación por transferencia simétrica).
+    TTask<int> awaitChildren(int count) {
+        int value = 0;
+        for (int i = 0; i < count; ++i) {
+            value = co_await addOne(value);
+        }
+        co_return value;
+    }
+
+    /// Equivalente con callbacks: un trabajo que vuelve a encolarse count veces.
+    struct CallbackChain {
+        CJobSystem& jobs;
+        CJobCounter& counter;
+        int remaining;
+
+        void step() {
+            if (--remaining > 0) {
+                jobs.run([this]() { step(); }, &counter);
+            }
+        }
+    };
+
+}
+
+/**
+ * @brief Compara lanzar y reanudar corrutinas TTask con encolar callbacks en CJobSystem.
+ */
+void benchTasks() {
+    CJobSystem jobs;
+    CTaskScheduler scheduler(jobs);
+    std::printf("\n=== TTask frente a callbacks (%d operaciones, %u hilos) ===\n", kCount, jobs.concurrency());
+
+    Bench::beginGroup("Lanzar y completar");
+    Bench::printResult("jobs.run(callback) + wait (por trabajo)", timePasses([&]() {
+        CJobCounter counter;
+        for (int i = 0; i < kCount; ++i) {
+            jobs.run([]() {}, &counter);
+        }
+        jobs.wait(counter);
+    }));
+    Bench::printResult("scheduler.spawn(TTask) + wait (por tarea)", timePasses([&]() {
+        CJobCounter counter;
+        for (int i = 0; i < kCount; ++i) {
+            scheduler.spawn(emptyTask(), counter);
+        }
+        jobs.wait(counter);
+    }));
+    Bench::printResult("whenAll de tareas (por tarea)", timePasses([&]() {
+        std::vector<TTask<>> tasks;
+        tasks.reserve(kCount);
+        for (int i = 0; i < kCount; ++i) {
+            tasks.push_back(emptyTask());
+        }
+        scheduler.syncWait(scheduler.whenAll(std::move(tasks)));
+    }));
+
+    Bench::beginGroup("Reanudar en el pool (saltos encadenados)");
+    Bench::printResult("callback que se vuelve a encolar (por salto)", timePasses([&]() {
+        CJobCounter counter;
+        CallbackChain chain{ jobs, counter, kCount + 1 };
+        jobs.run([&chain]() { chain.step(); }, &counter);
+        jobs.wait(counter);
+    }));
+    Bench::printResult("co_await scheduler.schedule() (por salto)", timePasses([&]() {
+        scheduler.syncWait(hop(scheduler, kCount));
+    }));
+
+    Bench::beginGroup("Continuaciones sin cambiar de hilo");
+    std::function<int(int)> callback = [](int value) { return value + 1; };
+    Bench::printResult("llamada a std::function (por llamada)", timePasses([&]() {
+        int value = 0;
+        for (int i = 0; i < kCount; ++i) {
+            value = callback(value);
+        }
+        Bench::doNotOptimize(value);
+    }));
+    Bench::printResult("co_await subtarea (por subtarea)", timePasses([&]() {
+        Bench::doNotOptimize(scheduler.syncWait(awaitChildren(kCount)));
+    }));
+}
+
+#else
+
+void benchTasks() {
+    std::printf("\n=== TTask: omitida (requiere C++20) ===\n");
+}
+
+#endif
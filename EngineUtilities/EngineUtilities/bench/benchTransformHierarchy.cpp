@@ -0,0 +1,119 @@
+/**
+ * @file benchTransformHierarchy.cpp
+ * @brief Benchmark de CTransformHierarchy frente a componer una Matriz4x4 por objeto.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Scene/CTransformHierarchy.h"
+#include "../include/Utilities/Simd.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CTransformHierarchy;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+    using Handle = CTransformHierarchy::Handle;
+
+    const size_t kBranching = 8; ///< Hijos por nodo del árbol de prueba.
+    const int kPasses = 5;       ///< Repeticiones por medición (más una de calentamiento).
+
+    /// Ejecuta fn kPasses veces (más una de calentamiento) y devuelve ns por nodo.
+    template<typename Fn>
+    double timePasses(size_t nodes, Fn fn) {
+        fn();
+        Bench::Clock::time_point start = Bench::Clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            fn();
+        }
+        return Bench::secondsSince(start) * 1e9 / (static_cast<double>(nodes) * kPasses);
+    }
+
+    /// Árbol kBranching-ario: el padre del nodo i es (i - 1) / kBranching.
+    std::vector<Handle> buildTree(CTransformHierarchy& hierarchy, size_t count) {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        std::vector<Handle> nodes;
+        nodes.reserve(count);
+        hierarchy.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            Handle parent = i == 0 ? Handle() : nodes[(i - 1) / kBranching];
+            CQuaternion rotation = CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), dist(rng));
+            nodes.push_back(hierarchy.create(parent, CVector3(dist(rng), dist(rng), dist(rng)), rotation,
+                CVector3(1.0f, 1.0f, 1.0f)));
+        }
+        return nodes;
+    }
+
+    void benchSize(size_t count) {
+        Bench::beginGroup(std::to_string(count) + " nodos");
+
+        // Referencia: una Matriz4x4 double local y otra mundial por objeto, todo recalculado.
+        {
+            std::vector<Matriz4x4> locals(count);
+            std::vector<Matriz4x4> worlds(count);
+            std::mt19937 rng(3);
+            std::uniform_real_distribution<double> dist(-1.0, 1.0);
+            for (size_t i = 0; i < count; ++i) {
+                locals[i] = Matriz4x4::Translate(dist(rng), dist(rng), dist(rng)) * Matriz4x4::RotateZ(dist(rng));
+            }
+            Bench::printResult("Matriz4x4 por objeto (por nodo)", timePasses(count, [&]() {
+                worlds[0] = locals[0];
+                for (size_t i = 1; i < count; ++i) {
+                    worlds[i] = worlds[(i - 1) / kBranching] * locals[i];
+                }
+                Bench::doNotOptimize(worlds[count - 1]);
+            }));
+        }
+
+        CTransformHierarchy hierarchy;
+        std::vector<Handle> nodes = buildTree(hierarchy, count);
+        std::mt19937 rng(7);
+
+        Bench::printResult("update completo (por nodo)", timePasses(count, [&]() {
+            hierarchy.setLocalRotation(nodes[0], CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 0.1f));
+            hierarchy.update();
+        }));
+
+        // Un 1 % de nodos movidos cada fotograma (solo se recalculan sus subárboles).
+        const size_t moved = count / 100;
+        Bench::printResult("update 1% movido (por nodo)", timePasses(count, [&]() {
+            for (size_t i = 0; i < moved; ++i) {
+                hierarchy.setLocalPosition(nodes[count / 2 + rng() % (count / 2)], CVector3(1.0f, 0.0f, 0.0f));
+            }
+            hierarchy.update();
+        }));
+        Bench::printResult("update sin cambios (por nodo)", timePasses(count, [&]() {
+            hierarchy.update();
+        }));
+
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        CJobSystem jobs(cores - 1);
+        std::string parallelName = "update completo " + std::to_string(cores) + " hilo(s) (por nodo)";
+        Bench::printResult(parallelName.c_str(), timePasses(count, [&]() {
+            hierarchy.setLocalRotation(nodes[0], CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 0.2f));
+            hierarchy.update(jobs);
+        }));
+    }
+
+}
+
+/**
+ * @brief Mide la actualización de CTransformHierarchy (completa, parcial, sin cambios y en
+ *        paralelo) frente a componer una Matriz4x4 double por objeto.
+ */
+void benchTransformHierarchy() {
+    std::printf("\n=== CTransformHierarchy (arbol %zu-ario, SIMD: %s) ===\n", kBranching,
+        EngineUtilities::simdLevelName());
+    benchSize(100000);
+    benchSize(1000000);
+}
@@ -0,0 +1,182 @@
+/**
+ * @file benchVectors.cpp
+ * @brief Benchmark de las operaciones de CVector2, CVector3 y CVector4.
+ * @author Hannin Abarca
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "BenchHarness.h"
+#include "../include/Vector/CVector2.h"
+#include "../include/Vector/CVector3.h"
+#include "../include/Vector/CVector4.h"
+
+namespace {
+
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::CVector4;
+
+    const uint64_t kInputMask = 1023; ///< Entradas distintas por medición (potencia de dos menos uno).
+
+    CVector2 makeVector(std::mt19937& rng, std::uniform_real_distribution<float>& dist, CVector2*) {
+        return CVector2(dist(rng), dist(rng));
+    }
+
+    CVector3 makeVector(std::mt19937& rng, std::uniform_real_distribution<float>& dist, CVector3*) {
+        return CVector3(dist(rng), dist(rng), dist(rng));
+    }
+
+    CVector4 makeVector(std::mt19937& rng, std::uniform_real_distribution<float>& dist, CVector4*) {
+        return CVector4(dist(rng), dist(rng), dist(rng), dist(rng));
+    }
+
+    /// Vectores con componentes en [-10, 10) y semilla fija.
+    template<typename V>
+    std::vector<V> makeVectors(unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+        std::vector<V> values(kInputMask + 1);
+        for (V& value : values) {
+            value = makeVector(rng, dist, static_cast<V*>(nullptr));
+        }
+        return values;
+    }
+
+    /// Escalares en [0.5, 1.5) (también sirven como parámetro de lerp).
+    std::vector<float> makeScalars(unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(0.5f, 1.5f);
+        std::vector<float> values(kInputMask + 1);
+        for (float& value : values) {
+            value = dist(rng);
+        }
+        return values;
+    }
+
+    /**
+     * @brief Mide las operaciones comunes a CVector2, CVector3 y CVector4.
+     *
+     * Las operaciones que modifican el vector trabajan sobre una copia para que los
+     * valores no crezcan sin límite entre iteraciones.
+     */
+    template<typename V>
+    void benchCommonOperations(const std::vector<V>& as, const std::vector<V>& bs,
+        const std::vector<float>& scalars) {
+        const V* a = as.data();
+        const V* b = bs.data();
+        const float* s = scalars.data();
+
+        Bench::measure("operator+", [&](uint64_t i) { return a[i & kInputMask] + b[i & kInputMask]; });
+        Bench::measure("operator-", [&](uint64_t i) { return a[i & kInputMask] - b[i & kInputMask]; });
+        Bench::measure("operator*", [&](uint64_t i) { return a[i & kInputMask] * s[i & kInputMask]; });
+        Bench::measure("operator/", [&](uint64_t i) { return a[i & kInputMask] / s[i & kInputMask]; });
+        Bench::measure("operator+=", [&](uint64_t i) {
+            V v = a[i & kInputMask];
+            v += b[i & kInputMask];
+            return v;
+        });
+        Bench::measure("operator-=", [&](uint64_t i) {
+            V v = a[i & kInputMask];
+            v -= b[i & kInputMask];
+            return v;
+        });
+        Bench::measure("operator*=", [&](uint64_t i) {
+            V v = a[i & kInputMask];
+            v *= s[i & kInputMask];
+            return v;
+        });
+        Bench::measure("operator/=", [&](uint64_t i) {
+            V v = a[i & kInputMask];
+            v /= s[i & kInputMask];
+            return v;
+        });
+        Bench::measure("operator==", [&](uint64_t i) { return a[i & kInputMask] == b[i & kInputMask]; });
+        Bench::measure("operator!=", [&](uint64_t i) { return a[i & kInputMask] != b[i & kInputMask]; });
+        Bench::measure("operator[]", [&](uint64_t i) { return a[i & kInputMask][static_cast<int>(i % 2)]; });
+        Bench::measure("lengthSquare", [&](uint64_t i) { return a[i & kInputMask].lengthSquare(); });
+        Bench::measure("length", [&](uint64_t i) { return a[i & kInputMask].length(); });
+        Bench::measure("dot", [&](uint64_t i) { return a[i & kInputMask].dot(b[i & kInputMask]); });
+        Bench::measure("normalized", [&](uint64_t i) { return a[i & kInputMask].normalized(); });
+        Bench::measure("normalize", [&](uint64_t i) {
+            V v = a[i & kInputMask];
+            v.normalize();
+            return v;
+        });
+        Bench::measure("distance", [&](uint64_t i) { return V::distance(a[i & kInputMask], b[i & kInputMask]); });
+        Bench::measure("lerp", [&](uint64_t i) {
+            return V::lerp(a[i & kInputMask], b[i & kInputMask], s[i & kInputMask] - 0.5f);
+        });
+        Bench::measure("zero", [&](uint64_t) { return V::zero(); });
+        Bench::measure("one", [&](uint64_t) { return V::one(); });
+    }
+
+}
+
+/**
+ * @brief Mide todas las operaciones de CVector2, incluidas las de transformación 2D.
+ */
+void benchCVector2() {
+    std::printf("\n=== CVector2 ===\n");
+    const std::vector<CVector2> as = makeVectors<CVector2>(1);
+    const std::vector<CVector2> bs = makeVectors<CVector2>(2);
+    const std::vector<float> scalars = makeScalars(3);
+    benchCommonOperations<CVector2>(as, bs, scalars);
+
+    const CVector2* a = as.data();
+    const CVector2* b = bs.data();
+    Bench::measure("cross", [&](uint64_t i) { return a[i & kInputMask].cross(b[i & kInputMask]); });
+    Bench::measure("setPosition", [&](uint64_t i) {
+        CVector2 v;
+        v.setPosition(a[i & kInputMask]);
+        return v;
+    });
+    Bench::measure("move", [&](uint64_t i) {
+        CVector2 v = a[i & kInputMask];
+        v.move(b[i & kInputMask]);
+        return v;
+    });
+    Bench::measure("setScale", [&](uint64_t i) {
+        CVector2 v = a[i & kInputMask];
+        v.setScale(b[i & kInputMask]);
+        return v;
+    });
+    Bench::measure("scale", [&](uint64_t i) {
+        CVector2 v = a[i & kInputMask];
+        v.scale(b[i & kInputMask]);
+        return v;
+    });
+    Bench::measure("setOrigin", [&](uint64_t i) {
+        CVector2 v;
+        v.setOrigin(a[i & kInputMask]);
+        return v;
+    });
+}
+
+/**
+ * @brief Mide todas las operaciones de CVector3.
+ */
+void benchCVector3() {
+    std::printf("\n=== CVector3 ===\n");
+    const std::vector<CVector3> as = makeVectors<CVector3>(4);
+    const std::vector<CVector3> bs = makeVectors<CVector3>(5);
+    const std::vector<float> scalars = makeScalars(6);
+    benchCommonOperations<CVector3>(as, bs, scalars);
+
+    const CVector3* a = as.data();
+    const CVector3* b = bs.data();
+    Bench::measure("cross", [&](uint64_t i) { return a[i & kInputMask].cross(b[i & kInputMask]); });
+}
+
+/**
+ * @brief Mide todas las operaciones de CVector4.
+ */
+void benchCVector4() {
+    std::printf("\n=== CVector4 ===\n");
+    const std::vector<CVector4> as = makeVectors<CVector4>(7);
+    const std::vector<CVector4> bs = makeVectors<CVector4>(8);
+    const std::vector<float> scalars = makeScalars(9);
+    benchCommonOperations<CVector4>(as, bs, scalars);
+}
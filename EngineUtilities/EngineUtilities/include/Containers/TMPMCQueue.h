@@ -0,0 +1,241 @@
+/**
+ * @file TMPMCQueue.h
+ * @brief Cola circular acotada sin bloqueos para varios productores y consumidores.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "TSPSCQueue.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class TMPMCQueue
+     * @brief Cola FIFO acotada para cualquier número de productores y consumidores
+     *        (algoritmo de D. Vyukov).
+     *
+     * Cada celda lleva un número de secuencia que indica si está libre para la vuelta
+     * actual del productor o publicada para la del consumidor. Productores y consumidores
+     * solo compiten por su propio índice (cada uno en su línea de caché) con un
+     * compare-exchange; nunca se bloquean entre sí.
+     *
+     * Las operaciones por lotes reservan varias celdas consecutivas con un único
+     * compare-exchange, lo que reparte el coste de la contención entre todo el lote.
+     *
+     * El orden FIFO es global respecto a las reservas de índice: los elementos de un mismo
+     * productor se extraen en el orden en que se insertaron.
+     *
+     * @tparam T Tipo de los elementos (al menos movible).
+     */
+    template<typename T>
+    class TMPMCQueue {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Capacidad mínima; se redondea a la siguiente potencia de dos.
+         */
+        explicit TMPMCQueue(size_t capacity)
+            : mask(roundUpPowerOfTwo(capacity) - 1), cells(new Cell[mask + 1]), enqueuePosition(0), dequeuePosition(0) {
+            for (size_t i = 0; i <= mask; ++i) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /// @brief Destructor. Destruye los elementos que no se extrajeron.
+        ~TMPMCQueue() {
+            size_t end = enqueuePosition.load(std::memory_order_relaxed);
+            for (size_t i = dequeuePosition.load(std::memory_order_relaxed); i != end; ++i) {
+                std::launder(reinterpret_cast<T*>(cells[i & mask].storage))->~T();
+            }
+            delete[] cells;
+        }
+
+        TMPMCQueue(const TMPMCQueue&) = delete;
+        TMPMCQueue& operator=(const TMPMCQueue&) = delete;
+
+        /**
+         * @brief Inserta una copia de value. Cualquier hilo.
+         *
+         * @return false si la cola está llena.
+         */
+        bool tryPush(const T& value) {
+            return tryEmplace(value);
+        }
+
+        /**
+         * @brief Inserta value moviéndolo. Cualquier hilo.
+         *
+         * @return false si la cola está llena (value no se modifica).
+         */
+        bool tryPush(T&& value) {
+            return tryEmplace(std::move(value));
+        }
+
+        /**
+         * @brief Construye un elemento al final de la cola. Cualquier hilo.
+         *
+         * @return false si la cola está llena.
+         */
+        template<typename... Args>
+        bool tryEmplace(Args&&... args) {
+            size_t position = enqueuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = cells[position & mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0) {
+                    if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        new (cell.storage) T(std::forward<Args>(args)...);
+                        cell.sequence.store(position + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (difference < 0) {
+                    return false;
+                }
+                else {
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Extrae el elemento más antiguo. Cualquier hilo.
+         *
+         * @return false si la cola está vacía.
+         */
+        bool tryPop(T& value) {
+            size_t position = dequeuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = cells[position & mask];
+                size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+                if (difference == 0) {
+                    if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        take(cell, position, value);
+                        return true;
+                    }
+                }
+                else if (difference < 0) {
+                    return false;
+                }
+                else {
+                    position = dequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Inserta copias de hasta count elementos en celdas consecutivas. Cualquier hilo.
+         *
+         * @return Elementos insertados (menos de count si la cola se llenó).
+         */
+        size_t tryPushBatch(const T* values, size_t count) {
+            size_t position = enqueuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                // Celdas libres consecutivas a partir de position.
+                size_t ready = 0;
+                while (ready < count &&
+                    cells[(position + ready) & mask].sequence.load(std::memory_order_acquire) == position + ready) {
+                    ++ready;
+                }
+                if (ready == 0) {
+                    size_t sequence = cells[position & mask].sequence.load(std::memory_order_acquire);
+                    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position) < 0) {
+                        return 0;
+                    }
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (enqueuePosition.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                    for (size_t i = 0; i < ready; ++i) {
+                        Cell& cell = cells[(position + i) & mask];
+                        new (cell.storage) T(values[i]);
+                        cell.sequence.store(position + i + 1, std::memory_order_release);
+                    }
+                    return ready;
+                }
+            }
+        }
+
+        /**
+         * @brief Extrae hasta maxCount elementos de celdas consecutivas. Cualquier hilo.
+         *
+         * @return Elementos extraídos.
+         */
+        size_t tryPopBatch(T* values, size_t maxCount) {
+            size_t position = dequeuePosition.load(std::memory_order_relaxed);
+            for (;;) {
+                // Celdas publicadas consecutivas a partir de position.
+                size_t ready = 0;
+                while (ready < maxCount &&
+                    cells[(position + ready) & mask].sequence.load(std::memory_order_acquire) == position + ready + 1) {
+                    ++ready;
+                }
+                if (ready == 0) {
+                    size_t sequence = cells[position & mask].sequence.load(std::memory_order_acquire);
+                    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1) < 0) {
+                        return 0;
+                    }
+                    position = dequeuePosition.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (dequeuePosition.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                    for (size_t i = 0; i < ready; ++i) {
+                        take(cells[(position + i) & mask], position + i, values[i]);
+                    }
+                    return ready;
+                }
+            }
+        }
+
+        /// @brief Número aproximado de elementos.
+        size_t sizeApprox() const {
+            size_t begin = dequeuePosition.load(std::memory_order_acquire);
+            size_t end = enqueuePosition.load(std::memory_order_acquire);
+            return end > begin ? end - begin : 0;
+        }
+
+        /// @brief Indica si la cola parece vacía.
+        bool empty() const { return sizeApprox() == 0; }
+
+        /// @brief Capacidad real (potencia de dos).
+        size_t capacity() const { return mask + 1; }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        static size_t roundUpPowerOfTwo(size_t value) {
+            size_t result = 2;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        /// Mueve el elemento de cell a value y libera la celda para la siguiente vuelta.
+        void take(Cell& cell, size_t position, T& value) {
+            T* item = std::launder(reinterpret_cast<T*>(cell.storage));
+            value = std::move(*item);
+            item->~T();
+            cell.sequence.store(position + mask + 1, std::memory_order_release);
+        }
+
+        const size_t mask;
+        Cell* const cells;
+
+        alignas(kQueueCacheLine) std::atomic<size_t> enqueuePosition; ///< Siguiente celda de los productores.
+        alignas(kQueueCacheLine) std::atomic<size_t> dequeuePosition; ///< Siguiente celda de los consumidores.
+    };
+
+}
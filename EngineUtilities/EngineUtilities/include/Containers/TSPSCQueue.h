@@ -0,0 +1,194 @@
+/**
+ * @file TSPSCQueue.h
+ * @brief Cola circular acotada sin bloqueos para un productor y un consumidor.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace EngineUtilities {
+
+    /// Tamaño de línea de caché usado para separar los índices que escriben hilos distintos.
+    const size_t kQueueCacheLine = 64;
+
+    /**
+     * @class TSPSCQueue
+     * @brief Cola FIFO acotada para exactamente un hilo productor y un hilo consumidor.
+     *
+     * Cada índice lo escribe un solo hilo y vive en su propia línea de caché; además cada
+     * lado guarda una copia del índice del otro y solo la refresca cuando la cola parece
+     * llena (productor) o vacía (consumidor), de modo que en régimen estable push y pop no
+     * tocan las líneas de caché del otro hilo. No hay operaciones de
+     * lectura-modificación-escritura.
+     *
+     * Las operaciones por lotes publican todos los elementos con una sola escritura del índice.
+     *
+     * @tparam T Tipo de los elementos (al menos movible).
+     */
+    template<typename T>
+    class TSPSCQueue {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Capacidad mínima; se redondea a la siguiente potencia de dos.
+         */
+        explicit TSPSCQueue(size_t capacity)
+            : mask(roundUpPowerOfTwo(capacity) - 1),
+            slots(static_cast<T*>(::operator new(sizeof(T) * (mask + 1), std::align_val_t(alignof(T))))),
+            head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+        /// @brief Destructor. Destruye los elementos que no se extrajeron.
+        ~TSPSCQueue() {
+            size_t end = tail.load(std::memory_order_relaxed);
+            for (size_t i = head.load(std::memory_order_relaxed); i != end; ++i) {
+                slots[i & mask].~T();
+            }
+            ::operator delete(slots, std::align_val_t(alignof(T)));
+        }
+
+        TSPSCQueue(const TSPSCQueue&) = delete;
+        TSPSCQueue& operator=(const TSPSCQueue&) = delete;
+
+        /**
+         * @brief Inserta una copia de value. Solo el hilo productor.
+         *
+         * @return false si la cola está llena.
+         */
+        bool tryPush(const T& value) {
+            return tryEmplace(value);
+        }
+
+        /**
+         * @brief Inserta value moviéndolo. Solo el hilo productor.
+         *
+         * @return false si la cola está llena (value no se modifica).
+         */
+        bool tryPush(T&& value) {
+            return tryEmplace(std::move(value));
+        }
+
+        /**
+         * @brief Construye un elemento al final de la cola. Solo el hilo productor.
+         *
+         * @return false si la cola está llena.
+         */
+        template<typename... Args>
+        bool tryEmplace(Args&&... args) {
+            size_t position = tail.load(std::memory_order_relaxed);
+            if (position - cachedHead == mask + 1) {
+                cachedHead = head.load(std::memory_order_acquire);
+                if (position - cachedHead == mask + 1) {
+                    return false;
+                }
+            }
+            new (&slots[position & mask]) T(std::forward<Args>(args)...);
+            tail.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Extrae el elemento más antiguo. Solo el hilo consumidor.
+         *
+         * @return false si la cola está vacía.
+         */
+        bool tryPop(T& value) {
+            size_t position = head.load(std::memory_order_relaxed);
+            if (position == cachedTail) {
+                cachedTail = tail.load(std::memory_order_acquire);
+                if (position == cachedTail) {
+                    return false;
+                }
+            }
+            T& slot = slots[position & mask];
+            value = std::move(slot);
+            slot.~T();
+            head.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Inserta copias de hasta count elementos consecutivos. Solo el hilo productor.
+         *
+         * @return Elementos insertados (menos de count si la cola se llenó).
+         */
+        size_t tryPushBatch(const T* values, size_t count) {
+            size_t position = tail.load(std::memory_order_relaxed);
+            size_t free = mask + 1 - (position - cachedHead);
+            if (free < count) {
+                cachedHead = head.load(std::memory_order_acquire);
+                free = mask + 1 - (position - cachedHead);
+            }
+            size_t pushed = count < free ? count : free;
+            for (size_t i = 0; i < pushed; ++i) {
+                new (&slots[(position + i) & mask]) T(values[i]);
+            }
+            if (pushed > 0) {
+                tail.store(position + pushed, std::memory_order_release);
+            }
+            return pushed;
+        }
+
+        /**
+         * @brief Extrae hasta maxCount elementos en orden. Solo el hilo consumidor.
+         *
+         * @return Elementos extraídos.
+         */
+        size_t tryPopBatch(T* values, size_t maxCount) {
+            size_t position = head.load(std::memory_order_relaxed);
+            size_t available = cachedTail - position;
+            if (available < maxCount) {
+                cachedTail = tail.load(std::memory_order_acquire);
+                available = cachedTail - position;
+            }
+            size_t popped = maxCount < available ? maxCount : available;
+            for (size_t i = 0; i < popped; ++i) {
+                T& slot = slots[(position + i) & mask];
+                values[i] = std::move(slot);
+                slot.~T();
+            }
+            if (popped > 0) {
+                head.store(position + popped, std::memory_order_release);
+            }
+            return popped;
+        }
+
+        /// @brief Número de elementos (aproximado si los dos hilos están trabajando).
+        size_t sizeApprox() const {
+            // head primero: tail solo crece, así que el resultado nunca es negativo.
+            size_t begin = head.load(std::memory_order_acquire);
+            size_t end = tail.load(std::memory_order_acquire);
+            return end - begin;
+        }
+
+        /// @brief Indica si la cola parece vacía.
+        bool empty() const { return sizeApprox() == 0; }
+
+        /// @brief Capacidad real (potencia de dos).
+        size_t capacity() const { return mask + 1; }
+
+    private:
+        static size_t roundUpPowerOfTwo(size_t value) {
+            size_t result = 2;
+            while (result < value) {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        const size_t mask;
+        T* const slots;
+
+        alignas(kQueueCacheLine) std::atomic<size_t> head; ///< Siguiente elemento a extraer (consumidor).
+        size_t cachedTail;                                 ///< Copia de tail del consumidor.
+
+        alignas(kQueueCacheLine) std::atomic<size_t> tail; ///< Siguiente hueco libre (productor).
+        size_t cachedHead;                                 ///< Copia de head del productor.
+    };
+
+}
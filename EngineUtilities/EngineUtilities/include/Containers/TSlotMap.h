@@ -0,0 +1,294 @@
+/**
+ * @file TSlotMap.h
+ * @brief Contenedor de objetos referenciados por handles generacionales.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace EngineUtilities {
+
+    /**
+     * @class TSlotHandle
+     * @brief Handle generacional: índice de slot y generación empaquetados en un entero.
+     *
+     * Los IndexBits bits bajos guardan el índice del slot y el resto la generación. La
+     * generación 0 no se asigna nunca, así que un handle con valor 0 es nulo.
+     *
+     * @tparam StorageT Entero sin signo que almacena el handle.
+     * @tparam IndexBits Bits reservados para el índice.
+     */
+    template<typename StorageT, unsigned IndexBits>
+    class TSlotHandle {
+    public:
+        using Storage = StorageT;
+
+        static constexpr unsigned kIndexBits = IndexBits;
+        static constexpr StorageT kIndexMask = (StorageT(1) << IndexBits) - 1;
+        static constexpr StorageT kGenerationMask = StorageT(~StorageT(0)) >> IndexBits;
+
+        /// @brief Constructor por defecto. Crea un handle nulo.
+        TSlotHandle() : value(0) {}
+
+        /// @brief Constructor a partir de índice y generación.
+        TSlotHandle(StorageT index, StorageT generation)
+            : value(static_cast<StorageT>((generation << IndexBits) | (index & kIndexMask))) {}
+
+        /// @brief Índice del slot.
+        StorageT index() const { return value & kIndexMask; }
+
+        /// @brief Generación del slot en el momento de crear el handle.
+        StorageT generation() const { return value >> IndexBits; }
+
+        /// @brief Indica si el handle es nulo.
+        bool isNull() const { return value == 0; }
+
+        /// @brief Valor empaquetado (útil como clave de hash o para serializar).
+        StorageT raw() const { return value; }
+
+        bool operator==(const TSlotHandle& other) const { return value == other.value; }
+        bool operator!=(const TSlotHandle& other) const { return value != other.value; }
+
+    private:
+        StorageT value; ///< Índice y generación empaquetados.
+    };
+
+    /// Handle de 32 bits: hasta 1M de slots y 4096 generaciones por slot.
+    using SlotHandle32 = TSlotHandle<uint32_t, 20>;
+
+    /// Handle de 64 bits: hasta 4G de slots y 4G de generaciones por slot.
+    using SlotHandle64 = TSlotHandle<uint64_t, 32>;
+
+    /**
+     * @class TSlotMap
+     * @brief Contenedor con inserción, borrado y búsqueda O(1) mediante handles generacionales.
+     *
+     * Los objetos se guardan contiguos en un array denso (el borrado mueve el último
+     * elemento al hueco), de modo que recorrerlos es tan rápido como recorrer un
+     * std::vector. Un array de slots traduce cada handle a su posición densa; cada
+     * borrado incrementa la generación del slot, por lo que los handles antiguos
+     * dejan de ser válidos y get() devuelve nullptr en lugar de un objeto ajeno.
+     *
+     * Los slots libres se reutilizan en orden FIFO para que una misma generación tarde
+     * lo máximo posible en repetirse.
+     *
+     * Los punteros devueltos por get() y los iteradores se invalidan al insertar o borrar;
+     * los handles no.
+     *
+     * @tparam T Tipo de los objetos almacenados.
+     * @tparam HandleT Tipo de handle (SlotHandle32 o SlotHandle64).
+     */
+    template<typename T, typename HandleT = SlotHandle32>
+    class TSlotMap {
+    public:
+        using Handle = HandleT;
+        using Storage = typename HandleT::Storage;
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        /// @brief Constructor por defecto. Crea un contenedor vacío.
+        TSlotMap() : freeHead(kNoSlot), freeTail(kNoSlot) {}
+
+        /**
+         * @brief Reserva memoria para count objetos.
+         */
+        void reserve(size_t count) {
+            dense.reserve(count);
+            denseToSlot.reserve(count);
+            slots.reserve(count);
+        }
+
+        /**
+         * @brief Inserta una copia de value.
+         *
+         * @return Handle del nuevo objeto, o un handle nulo si se agotaron los índices.
+         */
+        Handle insert(const T& value) {
+            return emplace(value);
+        }
+
+        /**
+         * @brief Inserta value moviéndolo.
+         *
+         * @return Handle del nuevo objeto, o un handle nulo si se agotaron los índices.
+         */
+        Handle insert(T&& value) {
+            return emplace(std::move(value));
+        }
+
+        /**
+         * @brief Construye un objeto dentro del contenedor.
+         *
+         * @param args Argumentos del constructor de T.
+         * @return Handle del nuevo objeto, o un handle nulo si se agotaron los índices.
+         */
+        template<typename... Args>
+        Handle emplace(Args&&... args) {
+            if (freeHead == kNoSlot && slots.size() > static_cast<size_t>(Handle::kIndexMask)) {
+                return Handle();
+            }
+
+            // Primero lo que puede lanzar (el constructor de T y el crecimiento de los
+            // vectores); si algo falla el contenedor queda como estaba.
+            dense.emplace_back(std::forward<Args>(args)...);
+            try {
+                denseToSlot.push_back(kNoSlot);
+                if (freeHead == kNoSlot) {
+                    slots.push_back(Slot{ kNoSlot, 1 });
+                }
+            }
+            catch (...) {
+                if (denseToSlot.size() == dense.size()) {
+                    denseToSlot.pop_back();
+                }
+                dense.pop_back();
+                throw;
+            }
+
+            Storage slotIndex;
+            if (freeHead != kNoSlot) {
+                slotIndex = freeHead;
+                freeHead = slots[slotIndex].next;
+                if (freeHead == kNoSlot) {
+                    freeTail = kNoSlot;
+                }
+            }
+            else {
+                slotIndex = static_cast<Storage>(slots.size() - 1);
+            }
+
+            Slot& slot = slots[slotIndex];
+            slot.next = static_cast<Storage>(dense.size() - 1);
+            denseToSlot.back() = slotIndex;
+            return Handle(slotIndex, slot.generation);
+        }
+
+        /**
+         * @brief Elimina el objeto referenciado por handle.
+         *
+         * @return true si el handle era válido y el objeto se eliminó.
+         */
+        bool erase(Handle handle) {
+            if (!contains(handle)) {
+                return false;
+            }
+
+            Storage slotIndex = handle.index();
+            Slot& slot = slots[slotIndex];
+            Storage denseIndex = slot.next;
+            Storage lastIndex = static_cast<Storage>(dense.size() - 1);
+
+            // Mover el último objeto al hueco para mantener el array denso.
+            if (denseIndex != lastIndex) {
+                dense[denseIndex] = std::move(dense[lastIndex]);
+                denseToSlot[denseIndex] = denseToSlot[lastIndex];
+                slots[denseToSlot[denseIndex]].next = denseIndex;
+            }
+            dense.pop_back();
+            denseToSlot.pop_back();
+
+            // Invalidar los handles existentes y encolar el slot como libre.
+            slot.generation = (slot.generation + 1) & Handle::kGenerationMask;
+            if (slot.generation == 0) {
+                slot.generation = 1;
+            }
+            slot.next = kNoSlot;
+            if (freeTail != kNoSlot) {
+                slots[freeTail].next = slotIndex;
+            }
+            else {
+                freeHead = slotIndex;
+            }
+            freeTail = slotIndex;
+            return true;
+        }
+
+        /**
+         * @brief Comprueba si handle referencia un objeto vivo.
+         */
+        bool contains(Handle handle) const {
+            Storage slotIndex = handle.index();
+            return !handle.isNull() &&
+                slotIndex < slots.size() &&
+                slots[slotIndex].generation == handle.generation() &&
+                isOccupied(slotIndex);
+        }
+
+        /**
+         * @brief Obtiene el objeto referenciado por handle.
+         *
+         * @return Puntero al objeto, o nullptr si el handle es nulo o está obsoleto.
+         */
+        T* get(Handle handle) {
+            return contains(handle) ? &dense[slots[handle.index()].next] : nullptr;
+        }
+
+        /// @brief Versión constante de get().
+        const T* get(Handle handle) const {
+            return contains(handle) ? &dense[slots[handle.index()].next] : nullptr;
+        }
+
+        /**
+         * @brief Obtiene el handle del objeto en la posición densa denseIndex.
+         *
+         * Permite recorrer el array denso y recuperar el handle de cada objeto.
+         */
+        Handle handleAt(size_t denseIndex) const {
+            Storage slotIndex = denseToSlot[denseIndex];
+            return Handle(slotIndex, slots[slotIndex].generation);
+        }
+
+        /// @brief Elimina todos los objetos e invalida todos los handles.
+        void clear() {
+            while (!dense.empty()) {
+                erase(handleAt(dense.size() - 1));
+            }
+        }
+
+        /// @brief Número de objetos vivos.
+        size_t size() const { return dense.size(); }
+
+        /// @brief Indica si el contenedor está vacío.
+        bool empty() const { return dense.empty(); }
+
+        /// @brief Puntero al array denso de objetos.
+        T* data() { return dense.data(); }
+        const T* data() const { return dense.data(); }
+
+        iterator begin() { return dense.begin(); }
+        iterator end() { return dense.end(); }
+        const_iterator begin() const { return dense.begin(); }
+        const_iterator end() const { return dense.end(); }
+
+    private:
+        static constexpr Storage kNoSlot = Storage(~Storage(0));
+
+        /**
+         * @brief Slot de indirección.
+         *
+         * Si está ocupado, next es la posición en el array denso; si está libre, es el
+         * siguiente slot de la lista libre.
+         */
+        struct Slot {
+            Storage next;
+            Storage generation;
+        };
+
+        bool isOccupied(Storage slotIndex) const {
+            Storage denseIndex = slots[slotIndex].next;
+            return denseIndex < denseToSlot.size() && denseToSlot[denseIndex] == slotIndex;
+        }
+
+        std::vector<T> dense;             ///< Objetos vivos, contiguos.
+        std::vector<Storage> denseToSlot; ///< Slot de cada objeto del array denso.
+        std::vector<Slot> slots;          ///< Indirección handle -> posición densa.
+        Storage freeHead;                 ///< Primer slot libre (FIFO).
+        Storage freeTail;                 ///< Último slot libre (FIFO).
+    };
+
+}
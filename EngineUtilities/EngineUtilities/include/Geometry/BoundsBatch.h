@@ -0,0 +1,393 @@
+/**
+ * @file BoundsBatch.h
+ * @brief Arrays SoA de cajas (alineadas y orientadas) y esferas envolventes y pruebas por lotes con SIMD.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CAABB.h"
+#include "CBoundingSphere.h"
+#include "COBB.h"
+#include "../Utilities/Simd.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CAABBArray
+     * @brief Cajas guardadas como seis arrays de float (min y max por eje).
+     *
+     * Con esta disposición un registro AVX carga la misma coordenada de 8 cajas y una prueba
+     * contra una caja común se resuelve con 6 comparaciones para las 8.
+     */
+    class CAABBArray {
+    public:
+        /// @brief Número de cajas.
+        size_t size() const { return mins[0].size(); }
+
+        /// @brief Reserva espacio para count cajas.
+        void reserve(size_t count) {
+            for (int axis = 0; axis < 3; ++axis) {
+                mins[axis].reserve(count);
+                maxs[axis].reserve(count);
+            }
+        }
+
+        /// @brief Elimina todas las cajas.
+        void clear() {
+            for (int axis = 0; axis < 3; ++axis) {
+                mins[axis].clear();
+                maxs[axis].clear();
+            }
+        }
+
+        /// @brief Añade una caja al final.
+        void push(const CAABB& box) {
+            for (int axis = 0; axis < 3; ++axis) {
+                mins[axis].push_back(box.min[axis]);
+                maxs[axis].push_back(box.max[axis]);
+            }
+        }
+
+        /// @brief Sustituye la caja index.
+        void set(size_t index, const CAABB& box) {
+            for (int axis = 0; axis < 3; ++axis) {
+                mins[axis][index] = box.min[axis];
+                maxs[axis][index] = box.max[axis];
+            }
+        }
+
+        /// @brief Caja index.
+        CAABB get(size_t index) const {
+            return CAABB(CVector3(mins[0][index], mins[1][index], mins[2][index]),
+                CVector3(maxs[0][index], maxs[1][index], maxs[2][index]));
+        }
+
+        /// @brief Coordenadas mínimas de todas las cajas en el eje axis (0 = x, 1 = y, 2 = z).
+        const float* min(int axis) const { return mins[axis].data(); }
+
+        /// @brief Coordenadas máximas de todas las cajas en el eje axis.
+        const float* max(int axis) const { return maxs[axis].data(); }
+
+    private:
+        std::vector<float> mins[3];
+        std::vector<float> maxs[3];
+    };
+
+    /**
+     * @class CBoundingSphereArray
+     * @brief Esferas guardadas como cuatro arrays de float (centro por eje y radio).
+     */
+    class CBoundingSphereArray {
+    public:
+        /// @brief Número de esferas.
+        size_t size() const { return radii.size(); }
+
+        /// @brief Reserva espacio para count esferas.
+        void reserve(size_t count) {
+            for (int axis = 0; axis < 3; ++axis) {
+                centers[axis].reserve(count);
+            }
+            radii.reserve(count);
+        }
+
+        /// @brief Elimina todas las esferas.
+        void clear() {
+            for (int axis = 0; axis < 3; ++axis) {
+                centers[axis].clear();
+            }
+            radii.clear();
+        }
+
+        /// @brief Añade una esfera al final.
+        void push(const CBoundingSphere& sphere) {
+            for (int axis = 0; axis < 3; ++axis) {
+                centers[axis].push_back(sphere.center[axis]);
+            }
+            radii.push_back(sphere.radius);
+        }
+
+        /// @brief Sustituye la esfera index.
+        void set(size_t index, const CBoundingSphere& sphere) {
+            for (int axis = 0; axis < 3; ++axis) {
+                centers[axis][index] = sphere.center[axis];
+            }
+            radii[index] = sphere.radius;
+        }
+
+        /// @brief Esfera index.
+        CBoundingSphere get(size_t index) const {
+            return CBoundingSphere(CVector3(centers[0][index], centers[1][index], centers[2][index]), radii[index]);
+        }
+
+        /// @brief Coordenada axis de los centros de todas las esferas.
+        const float* center(int axis) const { return centers[axis].data(); }
+
+        /// @brief Radios de todas las esferas.
+        const float* radius() const { return radii.data(); }
+
+    private:
+        std::vector<float> centers[3];
+        std::vector<float> radii;
+    };
+
+    /**
+     * @class COBBArray
+     * @brief Cajas orientadas guardadas como quince arrays de float (centro, ejes y semiextensiones).
+     */
+    class COBBArray {
+    public:
+        /// @brief Número de cajas.
+        size_t size() const { return extents[0].size(); }
+
+        /// @brief Reserva espacio para count cajas.
+        void reserve(size_t count) {
+            for (int i = 0; i < 3; ++i) {
+                centers[i].reserve(count);
+                extents[i].reserve(count);
+            }
+            for (std::vector<float>& component : axes) {
+                component.reserve(count);
+            }
+        }
+
+        /// @brief Elimina todas las cajas.
+        void clear() {
+            for (int i = 0; i < 3; ++i) {
+                centers[i].clear();
+                extents[i].clear();
+            }
+            for (std::vector<float>& component : axes) {
+                component.clear();
+            }
+        }
+
+        /// @brief Añade una caja al final.
+        void push(const COBB& box) {
+            for (int i = 0; i < 3; ++i) {
+                centers[i].push_back(box.center[i]);
+                extents[i].push_back(box.halfExtents[i]);
+                for (int k = 0; k < 3; ++k) {
+                    axes[3 * i + k].push_back(box.axes[i][k]);
+                }
+            }
+        }
+
+        /// @brief Sustituye la caja index.
+        void set(size_t index, const COBB& box) {
+            for (int i = 0; i < 3; ++i) {
+                centers[i][index] = box.center[i];
+                extents[i][index] = box.halfExtents[i];
+                for (int k = 0; k < 3; ++k) {
+                    axes[3 * i + k][index] = box.axes[i][k];
+                }
+            }
+        }
+
+        /// @brief Caja index.
+        COBB get(size_t index) const {
+            COBB box;
+            for (int i = 0; i < 3; ++i) {
+                box.center[i] = centers[i][index];
+                box.halfExtents[i] = extents[i][index];
+                for (int k = 0; k < 3; ++k) {
+                    box.axes[i][k] = axes[3 * i + k][index];
+                }
+            }
+            return box;
+        }
+
+        /// @brief Coordenada axis de los centros.
+        const float* center(int axis) const { return centers[axis].data(); }
+
+        /// @brief Componente component (0 = x, 1 = y, 2 = z) del eje axis de todas las cajas.
+        const float* axis(int axis, int component) const { return axes[3 * axis + component].data(); }
+
+        /// @brief Semiextensiones a lo largo del eje axis.
+        const float* halfExtent(int axis) const { return extents[axis].data(); }
+
+    private:
+        std::vector<float> centers[3];
+        std::vector<float> axes[9];    ///< Componente k del eje i en axes[3 * i + k].
+        std::vector<float> extents[3];
+    };
+
+    /**
+     * @brief flags[i] = boxes[i] se solapa con query (mismo criterio que CAABB::overlaps).
+     *
+     * @param flags Un byte por caja (0 o 1).
+     * @return Número de cajas que se solapan.
+     */
+    inline size_t overlapBatch(const CAABBArray& boxes, const CAABB& query, uint8_t* flags) {
+        // Copias locales: las escrituras en flags (uint8_t) podrían solapar con cualquier
+        // dato y obligarían a recargar la consulta y los punteros en cada paquete.
+        const CAABB q = query;
+        const float* mins[3] = { boxes.min(0), boxes.min(1), boxes.min(2) };
+        const float* maxs[3] = { boxes.max(0), boxes.max(1), boxes.max(2) };
+        size_t hits = 0;
+        simdForEach(0, boxes.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            auto mask = (Pack::load(mins[0] + i) <= Pack(q.max.x)) & (Pack::load(maxs[0] + i) >= Pack(q.min.x)) &
+                (Pack::load(mins[1] + i) <= Pack(q.max.y)) & (Pack::load(maxs[1] + i) >= Pack(q.min.y)) &
+                (Pack::load(mins[2] + i) <= Pack(q.max.z)) & (Pack::load(maxs[2] + i) >= Pack(q.min.z));
+            hits += simdStoreFlags(simdBits(mask), Pack::kWidth, flags + i);
+        });
+        return hits;
+    }
+
+    /**
+     * @brief flags[i] = boxes[i] está completamente dentro de query (como query.contains(boxes[i])).
+     *
+     * @return Número de cajas contenidas.
+     */
+    inline size_t containedBatch(const CAABBArray& boxes, const CAABB& query, uint8_t* flags) {
+        const CAABB q = query;
+        const float* mins[3] = { boxes.min(0), boxes.min(1), boxes.min(2) };
+        const float* maxs[3] = { boxes.max(0), boxes.max(1), boxes.max(2) };
+        size_t hits = 0;
+        simdForEach(0, boxes.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            Pack minX = Pack::load(mins[0] + i), maxX = Pack::load(maxs[0] + i);
+            Pack minY = Pack::load(mins[1] + i), maxY = Pack::load(maxs[1] + i);
+            Pack minZ = Pack::load(mins[2] + i), maxZ = Pack::load(maxs[2] + i);
+            // min <= max descarta las cajas vacías.
+            auto mask = (Pack(q.min.x) <= minX) & (minX <= maxX) & (maxX <= Pack(q.max.x)) &
+                (Pack(q.min.y) <= minY) & (minY <= maxY) & (maxY <= Pack(q.max.y)) &
+                (Pack(q.min.z) <= minZ) & (minZ <= maxZ) & (maxZ <= Pack(q.max.z));
+            hits += simdStoreFlags(simdBits(mask), Pack::kWidth, flags + i);
+        });
+        return hits;
+    }
+
+    /**
+     * @brief flags[i] = spheres[i] se solapa con query (como CBoundingSphere::overlaps).
+     *
+     * @return Número de esferas que se solapan.
+     */
+    inline size_t overlapBatch(const CBoundingSphereArray& spheres, const CBoundingSphere& query, uint8_t* flags) {
+        const CVector3 center = query.center;
+        const float queryRadius = query.isEmpty() ? -INFINITY : query.radius;
+        const float* centers[3] = { spheres.center(0), spheres.center(1), spheres.center(2) };
+        const float* radii = spheres.radius();
+        size_t hits = 0;
+        simdForEach(0, spheres.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            Pack dx = Pack::load(centers[0] + i) - Pack(center.x);
+            Pack dy = Pack::load(centers[1] + i) - Pack(center.y);
+            Pack dz = Pack::load(centers[2] + i) - Pack(center.z);
+            Pack radius = Pack::load(radii + i);
+            Pack sum = radius + Pack(queryRadius);
+            auto mask = (dx * dx + dy * dy + dz * dz <= sum * sum) & (radius >= Pack(0.0f)) &
+                (Pack(queryRadius) >= Pack(0.0f));
+            hits += simdStoreFlags(simdBits(mask), Pack::kWidth, flags + i);
+        });
+        return hits;
+    }
+
+    /**
+     * @brief flags[i] = spheres[i] se solapa con la caja query (como CBoundingSphere::overlaps).
+     *
+     * @return Número de esferas que se solapan.
+     */
+    inline size_t overlapBatch(const CBoundingSphereArray& spheres, const CAABB& query, uint8_t* flags) {
+        size_t count = spheres.size();
+        if (query.isEmpty()) {
+            for (size_t i = 0; i < count; ++i) {
+                flags[i] = 0;
+            }
+            return 0;
+        }
+        const CAABB q = query;
+        const float* centers[3] = { spheres.center(0), spheres.center(1), spheres.center(2) };
+        const float* radii = spheres.radius();
+        size_t hits = 0;
+        simdForEach(0, count, [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            Pack cx = Pack::load(centers[0] + i);
+            Pack cy = Pack::load(centers[1] + i);
+            Pack cz = Pack::load(centers[2] + i);
+            // Distancia del centro al punto más cercano de la caja.
+            Pack dx = simdMax(simdMin(cx, Pack(q.max.x)), Pack(q.min.x)) - cx;
+            Pack dy = simdMax(simdMin(cy, Pack(q.max.y)), Pack(q.min.y)) - cy;
+            Pack dz = simdMax(simdMin(cz, Pack(q.max.z)), Pack(q.min.z)) - cz;
+            Pack radius = Pack::load(radii + i);
+            auto mask = (dx * dx + dy * dy + dz * dz <= radius * radius) & (radius >= Pack(0.0f));
+            hits += simdStoreFlags(simdBits(mask), Pack::kWidth, flags + i);
+        });
+        return hits;
+    }
+
+    /**
+     * @brief flags[i] = boxes[i] se solapa con query (mismo criterio que COBB::overlaps).
+     *
+     * Los 15 ejes se evalúan para kWidth cajas a la vez en los ejes de query; si tras los 6
+     * ejes de caras ya no queda ningún carril, el paquete se descarta sin mirar las aristas.
+     * @return Número de cajas que se solapan.
+     */
+    inline size_t overlapBatch(const COBBArray& boxes, const COBB& query, uint8_t* flags) {
+        const COBB q = query;
+        const float* centers[3] = { boxes.center(0), boxes.center(1), boxes.center(2) };
+        const float* extents[3] = { boxes.halfExtent(0), boxes.halfExtent(1), boxes.halfExtent(2) };
+        const float* axes[3][3];
+        for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                axes[j][k] = boxes.axis(j, k);
+            }
+        }
+        size_t hits = 0;
+        simdForEach(0, boxes.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            Pack bAxes[3][3];
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    bAxes[j][k] = Pack::load(axes[j][k] + i);
+                }
+            }
+            Pack R[3][3];
+            Pack absR[3][3];
+            for (int r = 0; r < 3; ++r) {
+                for (int j = 0; j < 3; ++j) {
+                    R[r][j] = Pack(q.axes[r].x) * bAxes[j][0] + Pack(q.axes[r].y) * bAxes[j][1] + Pack(q.axes[r].z) * bAxes[j][2];
+                    absR[r][j] = simdAbs(R[r][j]) + Pack(COBB::kParallelEpsilon);
+                }
+            }
+            Pack dx = Pack::load(centers[0] + i) - Pack(q.center.x);
+            Pack dy = Pack::load(centers[1] + i) - Pack(q.center.y);
+            Pack dz = Pack::load(centers[2] + i) - Pack(q.center.z);
+            Pack t[3];
+            for (int r = 0; r < 3; ++r) {
+                t[r] = dx * Pack(q.axes[r].x) + dy * Pack(q.axes[r].y) + dz * Pack(q.axes[r].z);
+            }
+            Pack a[3] = { Pack(q.halfExtents.x), Pack(q.halfExtents.y), Pack(q.halfExtents.z) };
+            Pack b[3] = { Pack::load(extents[0] + i), Pack::load(extents[1] + i), Pack::load(extents[2] + i) };
+
+            auto mask = simdAbs(t[0]) <= a[0] + b[0] * absR[0][0] + b[1] * absR[0][1] + b[2] * absR[0][2];
+            for (int r = 1; r < 3; ++r) {
+                mask = mask & (simdAbs(t[r]) <= a[r] + b[0] * absR[r][0] + b[1] * absR[r][1] + b[2] * absR[r][2]);
+            }
+            for (int j = 0; j < 3; ++j) {
+                Pack ra = a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j];
+                mask = mask & (simdAbs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) <= ra + b[j]);
+            }
+            if (simdBits(mask) != 0) {
+                for (int r = 0; r < 3; ++r) {
+                    int r1 = (r + 1) % 3;
+                    int r2 = (r + 2) % 3;
+                    for (int j = 0; j < 3; ++j) {
+                        int j1 = (j + 1) % 3;
+                        int j2 = (j + 2) % 3;
+                        Pack ra = a[r1] * absR[r2][j] + a[r2] * absR[r1][j];
+                        Pack rb = b[j1] * absR[r][j2] + b[j2] * absR[r][j1];
+                        mask = mask & (simdAbs(t[r2] * R[r1][j] - t[r1] * R[r2][j]) <= ra + rb);
+                    }
+                }
+            }
+            hits += simdStoreFlags(simdBits(mask), Pack::kWidth, flags + i);
+        });
+        return hits;
+    }
+
+}
@@ -0,0 +1,203 @@
+/**
+ * @file CAABB.h
+ * @brief Caja envolvente alineada con los ejes (AABB) sobre CVector3.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "../Matriz/Matriz4x4.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CAABB
+     * @brief Caja alineada con los ejes definida por sus esquinas mínima y máxima.
+     *
+     * Una caja vacía tiene min > max en algún eje (la caja por defecto usa +inf/-inf); es
+     * neutra para merge() y no se solapa con nada ni contiene nada.
+     */
+    class CAABB {
+    public:
+        CVector3 min; ///< Esquina mínima.
+        CVector3 max; ///< Esquina máxima.
+
+        /// @brief Constructor por defecto. Crea una caja vacía.
+        CAABB() : min(INFINITY, INFINITY, INFINITY), max(-INFINITY, -INFINITY, -INFINITY) {}
+
+        /// @brief Constructor a partir de las esquinas.
+        CAABB(const CVector3& min, const CVector3& max) : min(min), max(max) {}
+
+        /// @brief Caja de centro y semiextensiones dados.
+        static CAABB fromCenterExtents(const CVector3& center, const CVector3& extents) {
+            return CAABB(center - extents, center + extents);
+        }
+
+        /// @brief Caja mínima que contiene count puntos (vacía si count es 0).
+        static CAABB fromPoints(const CVector3* points, size_t count) {
+            CAABB box;
+            for (size_t i = 0; i < count; ++i) {
+                box.expand(points[i]);
+            }
+            return box;
+        }
+
+        /// @brief Indica si la caja está vacía.
+        bool isEmpty() const {
+            return !(min.x <= max.x && min.y <= max.y && min.z <= max.z);
+        }
+
+        /// @brief Centro de la caja.
+        CVector3 center() const {
+            return (min + max) * 0.5f;
+        }
+
+        /// @brief Semiextensiones (mitad del tamaño en cada eje).
+        CVector3 extents() const {
+            return (max - min) * 0.5f;
+        }
+
+        /// @brief Tamaño en cada eje.
+        CVector3 size() const {
+            return max - min;
+        }
+
+        /// @brief Área de la superficie (0 si está vacía).
+        float surfaceArea() const {
+            if (isEmpty()) {
+                return 0.0f;
+            }
+            CVector3 d = size();
+            return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+
+        /// @brief Volumen (0 si está vacía).
+        float volume() const {
+            if (isEmpty()) {
+                return 0.0f;
+            }
+            CVector3 d = size();
+            return d.x * d.y * d.z;
+        }
+
+        /// @brief Amplía la caja para incluir un punto.
+        void expand(const CVector3& point) {
+            min = CVector3(min.x < point.x ? min.x : point.x, min.y < point.y ? min.y : point.y,
+                min.z < point.z ? min.z : point.z);
+            max = CVector3(max.x > point.x ? max.x : point.x, max.y > point.y ? max.y : point.y,
+                max.z > point.z ? max.z : point.z);
+        }
+
+        /// @brief Amplía la caja para incluir otra caja.
+        void expand(const CAABB& other) {
+            if (!other.isEmpty()) {
+                expand(other.min);
+                expand(other.max);
+            }
+        }
+
+        /// @brief Caja mínima que contiene a las dos.
+        CAABB merged(const CAABB& other) const {
+            CAABB result = *this;
+            result.expand(other);
+            return result;
+        }
+
+        /// @brief Caja ampliada margin unidades en cada dirección.
+        CAABB inflated(float margin) const {
+            CVector3 delta(margin, margin, margin);
+            return CAABB(min - delta, max + delta);
+        }
+
+        /**
+         * @brief Caja alineada que envuelve esta caja transformada por matrix (método de Arvo).
+         *
+         * En lugar de transformar las ocho esquinas, cada eje del resultado es la traslación
+         * más la suma, por columna, del menor y el mayor de m[i][j] * min[j] y m[i][j] * max[j].
+         * La matriz debe ser afín (sin proyección).
+         */
+        CAABB transformed(const Matriz4x4& matrix) const {
+            if (isEmpty()) {
+                return *this;
+            }
+            double newMin[3];
+            double newMax[3];
+            for (int i = 0; i < 3; ++i) {
+                newMin[i] = matrix.m[i][3];
+                newMax[i] = matrix.m[i][3];
+                for (int j = 0; j < 3; ++j) {
+                    double a = matrix.m[i][j] * min[j];
+                    double b = matrix.m[i][j] * max[j];
+                    newMin[i] += a < b ? a : b;
+                    newMax[i] += a < b ? b : a;
+                }
+            }
+            return CAABB(
+                CVector3(static_cast<float>(newMin[0]), static_cast<float>(newMin[1]), static_cast<float>(newMin[2])),
+                CVector3(static_cast<float>(newMax[0]), static_cast<float>(newMax[1]), static_cast<float>(newMax[2])));
+        }
+
+        /// @brief Indica si las dos cajas se solapan (tocarse cuenta como solapamiento).
+        bool overlaps(const CAABB& other) const {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                min.y <= other.max.y && max.y >= other.min.y &&
+                min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        /// @brief Indica si el punto está dentro de la caja (o en su borde).
+        bool contains(const CVector3& point) const {
+            return min.x <= point.x && point.x <= max.x &&
+                min.y <= point.y && point.y <= max.y &&
+                min.z <= point.z && point.z <= max.z;
+        }
+
+        /// @brief Indica si other está completamente dentro de la caja (una caja vacía no contiene nada).
+        bool contains(const CAABB& other) const {
+            return !other.isEmpty() &&
+                min.x <= other.min.x && other.max.x <= max.x &&
+                min.y <= other.min.y && other.max.y <= max.y &&
+                min.z <= other.min.z && other.max.z <= max.z;
+        }
+
+        /// @brief Punto de la caja más cercano a point.
+        CVector3 closestPoint(const CVector3& point) const {
+            return CVector3(
+                point.x < min.x ? min.x : (point.x > max.x ? max.x : point.x),
+                point.y < min.y ? min.y : (point.y > max.y ? max.y : point.y),
+                point.z < min.z ? min.z : (point.z > max.z ? max.z : point.z));
+        }
+
+        /// @brief Distancia al cuadrado de point a la caja (0 si está dentro).
+        float distanceSquared(const CVector3& point) const {
+            return (closestPoint(point) - point).lengthSquare();
+        }
+
+        /**
+         * @brief Prueba de rayo por franjas (slab test) para origin + t * direction, t en [0, maxT].
+         *
+         * @param inverseDirection 1 / direction por componente (±inf en las componentes nulas).
+         * @param tEnter Parámetro de entrada en la caja (0 si el origen está dentro).
+         * @return true si el rayo toca la caja dentro del intervalo.
+         */
+        bool intersectsRay(const CVector3& origin, const CVector3& inverseDirection, float maxT, float& tEnter) const {
+            float tMin = 0.0f;
+            float tMax = maxT;
+            for (int axis = 0; axis < 3; ++axis) {
+                float t1 = (min[axis] - origin[axis]) * inverseDirection[axis];
+                float t2 = (max[axis] - origin[axis]) * inverseDirection[axis];
+                if (t1 > t2) {
+                    float swap = t1;
+                    t1 = t2;
+                    t2 = swap;
+                }
+                tMin = t1 > tMin ? t1 : tMin;
+                tMax = t2 < tMax ? t2 : tMax;
+            }
+            tEnter = tMin;
+            return tMin <= tMax;
+        }
+    };
+
+}
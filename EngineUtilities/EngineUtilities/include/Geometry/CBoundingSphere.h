@@ -0,0 +1,191 @@
+/**
+ * @file CBoundingSphere.h
+ * @brief Esfera envolvente sobre CVector3.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "CAABB.h"
+#include "../Matriz/Matriz4x4.h"
+#include "../Utilities/EngineMath.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CBoundingSphere
+     * @brief Esfera definida por centro y radio.
+     *
+     * Un radio negativo indica una esfera vacía (la esfera por defecto), neutra para merge().
+     */
+    class CBoundingSphere {
+    public:
+        CVector3 center; ///< Centro.
+        float radius;    ///< Radio (negativo si está vacía).
+
+        /// @brief Constructor por defecto. Crea una esfera vacía.
+        CBoundingSphere() : center(), radius(-1.0f) {}
+
+        /// @brief Constructor a partir del centro y el radio.
+        CBoundingSphere(const CVector3& center, float radius) : center(center), radius(radius) {}
+
+        /// @brief Esfera que envuelve una caja (centrada en ella, con la semidiagonal como radio).
+        static CBoundingSphere fromAABB(const CAABB& box) {
+            if (box.isEmpty()) {
+                return CBoundingSphere();
+            }
+            return CBoundingSphere(box.center(), box.extents().length());
+        }
+
+        /**
+         * @brief Esfera que envuelve count puntos (algoritmo de Ritter).
+         *
+         * Parte de los dos puntos más separados a lo largo del eje de mayor extensión y
+         * amplía la esfera con cada punto que queda fuera. No es la mínima, pero suele estar
+         * a menos de un 5-20 % de ella y cuesta dos recorridos.
+         */
+        static CBoundingSphere fromPoints(const CVector3* points, size_t count) {
+            if (count == 0) {
+                return CBoundingSphere();
+            }
+            size_t minIndex[3] = { 0, 0, 0 };
+            size_t maxIndex[3] = { 0, 0, 0 };
+            for (size_t i = 1; i < count; ++i) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (points[i][axis] < points[minIndex[axis]][axis]) minIndex[axis] = i;
+                    if (points[i][axis] > points[maxIndex[axis]][axis]) maxIndex[axis] = i;
+                }
+            }
+            int best = 0;
+            float bestSpan = -1.0f;
+            for (int axis = 0; axis < 3; ++axis) {
+                float span = (points[maxIndex[axis]] - points[minIndex[axis]]).lengthSquare();
+                if (span > bestSpan) {
+                    bestSpan = span;
+                    best = axis;
+                }
+            }
+            CBoundingSphere sphere((points[minIndex[best]] + points[maxIndex[best]]) * 0.5f,
+                static_cast<float>(EngineUtilities::sqrt(bestSpan)) * 0.5f);
+            for (size_t i = 0; i < count; ++i) {
+                sphere.expand(points[i]);
+            }
+            return sphere;
+        }
+
+        /// @brief Indica si la esfera está vacía.
+        bool isEmpty() const {
+            return radius < 0.0f;
+        }
+
+        /// @brief Caja alineada que envuelve la esfera.
+        CAABB toAABB() const {
+            if (isEmpty()) {
+                return CAABB();
+            }
+            return CAABB::fromCenterExtents(center, CVector3(radius, radius, radius));
+        }
+
+        /// @brief Amplía la esfera lo mínimo para incluir un punto (moviendo el centro hacia él).
+        void expand(const CVector3& point) {
+            if (isEmpty()) {
+                center = point;
+                radius = 0.0f;
+                return;
+            }
+            CVector3 offset = point - center;
+            float distanceSquared = offset.lengthSquare();
+            if (distanceSquared > radius * radius) {
+                float distance = static_cast<float>(EngineUtilities::sqrt(distanceSquared));
+                float newRadius = (radius + distance) * 0.5f;
+                center += offset * ((newRadius - radius) / distance);
+                radius = newRadius;
+            }
+        }
+
+        /// @brief Esfera mínima que contiene a las dos.
+        CBoundingSphere merged(const CBoundingSphere& other) const {
+            if (other.isEmpty()) {
+                return *this;
+            }
+            if (isEmpty()) {
+                return other;
+            }
+            CVector3 offset = other.center - center;
+            float distance = offset.length();
+            if (distance + other.radius <= radius) {
+                return *this;
+            }
+            if (distance + radius <= other.radius) {
+                return other;
+            }
+            float newRadius = (distance + radius + other.radius) * 0.5f;
+            return CBoundingSphere(center + offset * ((newRadius - radius) / distance), newRadius);
+        }
+
+        /**
+         * @brief Esfera transformada por una matriz afín.
+         *
+         * El radio se escala por la mayor longitud de las columnas de la parte 3x3, de modo que
+         * el resultado sigue envolviendo al objeto con escalas no uniformes.
+         */
+        CBoundingSphere transformed(const Matriz4x4& matrix) const {
+            if (isEmpty()) {
+                return *this;
+            }
+            const double (*m)[4] = matrix.m;
+            CVector3 newCenter(
+                static_cast<float>(m[0][0] * center.x + m[0][1] * center.y + m[0][2] * center.z + m[0][3]),
+                static_cast<float>(m[1][0] * center.x + m[1][1] * center.y + m[1][2] * center.z + m[1][3]),
+                static_cast<float>(m[2][0] * center.x + m[2][1] * center.y + m[2][2] * center.z + m[2][3]));
+            double maxScale = 0.0;
+            for (int column = 0; column < 3; ++column) {
+                double lengthSquared = m[0][column] * m[0][column] + m[1][column] * m[1][column] +
+                    m[2][column] * m[2][column];
+                maxScale = lengthSquared > maxScale ? lengthSquared : maxScale;
+            }
+            return CBoundingSphere(newCenter, static_cast<float>(radius * EngineUtilities::sqrt(maxScale)));
+        }
+
+        /// @brief Indica si las dos esferas se solapan (tocarse cuenta como solapamiento).
+        bool overlaps(const CBoundingSphere& other) const {
+            float radii = radius + other.radius;
+            return !isEmpty() && !other.isEmpty() && (other.center - center).lengthSquare() <= radii * radii;
+        }
+
+        /// @brief Indica si la esfera se solapa con una caja.
+        bool overlaps(const CAABB& box) const {
+            return !isEmpty() && !box.isEmpty() && box.distanceSquared(center) <= radius * radius;
+        }
+
+        /// @brief Indica si el punto está dentro de la esfera (o en su superficie).
+        bool contains(const CVector3& point) const {
+            return (point - center).lengthSquare() <= radius * radius && !isEmpty();
+        }
+
+        /// @brief Indica si other está completamente dentro de la esfera.
+        bool contains(const CBoundingSphere& other) const {
+            if (isEmpty() || other.isEmpty() || other.radius > radius) {
+                return false;
+            }
+            float slack = radius - other.radius;
+            return (other.center - center).lengthSquare() <= slack * slack;
+        }
+
+        /// @brief Indica si la caja está completamente dentro de la esfera (sus ocho esquinas lo están).
+        bool contains(const CAABB& box) const {
+            if (isEmpty() || box.isEmpty()) {
+                return false;
+            }
+            // La esquina más lejana del centro en cada eje.
+            CVector3 farthest(
+                center.x - box.min.x > box.max.x - center.x ? box.min.x : box.max.x,
+                center.y - box.min.y > box.max.y - center.y ? box.min.y : box.max.y,
+                center.z - box.min.z > box.max.z - center.z ? box.min.z : box.max.z);
+            return contains(farthest);
+        }
+    };
+
+}
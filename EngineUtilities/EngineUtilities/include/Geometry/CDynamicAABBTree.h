@@ -0,0 +1,676 @@
+/**
+ * @file CDynamicAABBTree.h
+ * @brief Árbol dinámico de cajas envolventes (BVH) para la fase amplia de colisiones y consultas.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "CAABB.h"
+#include "CFrustum.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CDynamicAABBTree
+     * @brief Jerarquía binaria de cajas sobre objetos móviles, actualizable objeto a objeto.
+     *
+     * Cada objeto (proxy) es una hoja con una caja "gruesa": su caja real ampliada con un
+     * margen y, al moverse, en la dirección del desplazamiento. Mientras la caja real siga
+     * dentro de la gruesa, mover el objeto no toca el árbol.
+     *
+     * La inserción desciende eligiendo en cada nodo el hijo que menos aumenta el coste SAH
+     * (suma de áreas) y, al subir, cada ancestro prueba a intercambiar un hijo con un nieto
+     * del otro lado si eso reduce el área del nodo intermedio (rotaciones de árbol). Así el
+     * árbol se mantiene equilibrado en área, que es lo que cuentan las consultas, sin
+     * reconstrucciones globales.
+     *
+     * Los nodos viven en un array contiguo enlazados por índices de 32 bits (sin punteros),
+     * y los libres se reciclan con una lista enlazada. El identificador de un proxy es el
+     * índice de su hoja, que no cambia con las rotaciones.
+     *
+     * Las consultas son const y pueden ejecutarse en paralelo mientras nadie modifique el árbol.
+     */
+    class CDynamicAABBTree {
+    public:
+        static constexpr uint32_t kNullNode = 0xFFFFFFFFu; ///< Índice nulo / proxy inválido.
+        static constexpr float kDisplacementMultiplier = 2.0f; ///< Predicción del movimiento en move().
+
+        /**
+         * @brief Constructor.
+         *
+         * @param margin Ampliación de la caja gruesa en cada dirección.
+         */
+        explicit CDynamicAABBTree(float margin = 0.1f) : margin(margin), root(kNullNode), freeList(kNullNode), leafCount(0) {}
+
+        /// @brief Reserva espacio para count proxies (2 * count - 1 nodos).
+        void reserve(size_t count) {
+            nodes.reserve(count * 2);
+        }
+
+        /// @brief Elimina todos los proxies.
+        void clear() {
+            nodes.clear();
+            root = kNullNode;
+            freeList = kNullNode;
+            leafCount = 0;
+        }
+
+        /**
+         * @brief Inserta un objeto.
+         *
+         * @param box Caja real del objeto.
+         * @param userData Valor libre asociado (normalmente el índice o id del objeto).
+         * @return Identificador del proxy.
+         */
+        uint32_t insert(const CAABB& box, uint32_t userData) {
+            uint32_t leaf = allocateNode();
+            Node& node = nodes[leaf];
+            node.box = box.inflated(margin);
+            node.userData = userData;
+            node.height = 0;
+            insertLeaf(leaf);
+            ++leafCount;
+            return leaf;
+        }
+
+        /**
+         * @brief Elimina un proxy.
+         *
+         * @return false si proxy no es una hoja válida.
+         */
+        bool remove(uint32_t proxy) {
+            if (!isValidLeaf(proxy)) {
+                return false;
+            }
+            removeLeaf(proxy);
+            freeNode(proxy);
+            --leafCount;
+            return true;
+        }
+
+        /**
+         * @brief Actualiza la caja de un objeto que se ha movido.
+         *
+         * Si la nueva caja sigue dentro de la gruesa no se hace nada. Si no, la hoja se
+         * reinserta con una caja gruesa nueva, ampliada además kDisplacementMultiplier veces
+         * el desplazamiento en su dirección (el objeto probablemente seguirá moviéndose así).
+         *
+         * @return true si la hoja se reinsertó.
+         */
+        bool move(uint32_t proxy, const CAABB& box, const CVector3& displacement = CVector3()) {
+            if (!isValidLeaf(proxy) || nodes[proxy].box.contains(box)) {
+                return false;
+            }
+            removeLeaf(proxy);
+            nodes[proxy].box = predictedBox(box, displacement);
+            insertLeaf(proxy);
+            return true;
+        }
+
+        /**
+         * @brief Cambia la caja de un proxy sin reinsertarlo: ajusta los ancestros (y los rota).
+         *
+         * Es más barato que move() para desplazamientos pequeños, pero la hoja conserva su
+         * posición en el árbol, así que tras muchos cambios grandes la calidad se degrada.
+         *
+         * @return false si proxy no es una hoja válida.
+         */
+        bool refit(uint32_t proxy, const CAABB& box, const CVector3& displacement = CVector3()) {
+            if (!isValidLeaf(proxy)) {
+                return false;
+            }
+            nodes[proxy].box = predictedBox(box, displacement);
+            fixUpwards(nodes[proxy].parent);
+            return true;
+        }
+
+        /// @brief Caja gruesa de un proxy.
+        const CAABB& fatAABB(uint32_t proxy) const { return nodes[proxy].box; }
+
+        /// @brief Valor asociado a un proxy.
+        uint32_t userData(uint32_t proxy) const { return nodes[proxy].userData; }
+
+        /// @brief Número de proxies.
+        size_t size() const { return leafCount; }
+
+        /// @brief Altura del árbol (0 si está vacío o tiene una sola hoja).
+        int height() const { return root == kNullNode ? 0 : nodes[root].height; }
+
+        /// @brief Caja de la raíz (vacía si no hay proxies).
+        CAABB bounds() const { return root == kNullNode ? CAABB() : nodes[root].box; }
+
+        /**
+         * @brief Suma de las áreas de los nodos internos dividida por la de la raíz.
+         *
+         * Es proporcional al coste esperado de una consulta (métrica SAH); menor es mejor.
+         */
+        float areaRatio() const {
+            if (root == kNullNode) {
+                return 0.0f;
+            }
+            float rootArea = nodes[root].box.surfaceArea();
+            if (rootArea <= 0.0f) {
+                return 0.0f;
+            }
+            double total = 0.0;
+            for (const Node& node : nodes) {
+                if (node.height > 0) {
+                    total += node.box.surfaceArea();
+                }
+            }
+            return static_cast<float>(total / rootArea);
+        }
+
+        /**
+         * @brief Llama a fn(proxy) por cada proxy cuya caja gruesa se solapa con box.
+         *
+         * fn devuelve bool: false detiene la consulta.
+         */
+        template<typename Fn>
+        void query(const CAABB& box, Fn&& fn) const {
+            TraversalStack stack;
+            stack.push(root);
+            while (!stack.empty()) {
+                uint32_t index = stack.pop();
+                if (index == kNullNode) {
+                    continue;
+                }
+                const Node& node = nodes[index];
+                if (!node.box.overlaps(box)) {
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    if (!fn(index)) {
+                        return;
+                    }
+                }
+                else {
+                    stack.push(node.child1);
+                    stack.push(node.child2);
+                }
+            }
+        }
+
+        /**
+         * @brief Llama a fn(proxy) por cada proxy cuya caja gruesa puede ser visible.
+         *
+         * Cuando un nodo queda entero dentro del frustum, sus hojas se aceptan sin más pruebas.
+         * fn devuelve bool: false detiene la consulta.
+         */
+        template<typename Fn>
+        void query(const CFrustum& frustum, Fn&& fn) const {
+            TraversalStack stack;
+            stack.push(root);
+            while (!stack.empty()) {
+                uint32_t index = stack.pop();
+                if (index == kNullNode) {
+                    continue;
+                }
+                const Node& node = nodes[index];
+                if (!frustum.intersects(node.box)) {
+                    continue;
+                }
+                if (!node.isLeaf() && frustum.contains(node.box)) {
+                    if (!reportSubtree(index, fn)) {
+                        return;
+                    }
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    if (!fn(index)) {
+                        return;
+                    }
+                }
+                else {
+                    stack.push(node.child1);
+                    stack.push(node.child2);
+                }
+            }
+        }
+
+        /**
+         * @brief Recorre los proxies que el rayo origin + t * direction (t en [0, maxT]) puede tocar.
+         *
+         * fn(proxy, maxT) prueba el objeto real y devuelve el nuevo límite: el parámetro del
+         * impacto para quedarse con el más cercano, maxT para seguir sin recortar o 0 para
+         * terminar. Los nodos se visitan de cerca a lejos, así que tras un impacto la mayor
+         * parte del árbol se descarta.
+         */
+        template<typename Fn>
+        void raycast(const CVector3& origin, const CVector3& direction, float maxT, Fn&& fn) const {
+            CVector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+            float tEnter = 0.0f;
+            if (root == kNullNode || !nodes[root].box.intersectsRay(origin, inverse, maxT, tEnter)) {
+                return;
+            }
+            TraversalStack stack;
+            stack.push(root);
+            while (!stack.empty() && maxT > 0.0f) {
+                uint32_t index = stack.pop();
+                const Node& node = nodes[index];
+                // Comprobar de nuevo: maxT puede haberse recortado desde que se apiló.
+                if (!node.box.intersectsRay(origin, inverse, maxT, tEnter)) {
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    float result = fn(index, maxT);
+                    maxT = result < maxT ? result : maxT;
+                    continue;
+                }
+                float t1 = 0.0f;
+                float t2 = 0.0f;
+                bool hit1 = nodes[node.child1].box.intersectsRay(origin, inverse, maxT, t1);
+                bool hit2 = nodes[node.child2].box.intersectsRay(origin, inverse, maxT, t2);
+                // El más cercano se apila el último para visitarlo primero.
+                if (hit1 && hit2) {
+                    stack.push(t1 <= t2 ? node.child2 : node.child1);
+                    stack.push(t1 <= t2 ? node.child1 : node.child2);
+                }
+                else if (hit1) {
+                    stack.push(node.child1);
+                }
+                else if (hit2) {
+                    stack.push(node.child2);
+                }
+            }
+        }
+
+        /**
+         * @brief Proxy más cercano a point (ramificación y poda).
+         *
+         * @param distanceSquared Invocable float(proxy) con la distancia al cuadrado exacta al
+         *                        objeto; debe ser >= la distancia a su caja gruesa.
+         * @param maxDistance Solo se consideran objetos a menos de esta distancia.
+         * @return El proxy más cercano o kNullNode si no hay ninguno dentro de maxDistance.
+         */
+        template<typename Fn>
+        uint32_t nearest(const CVector3& point, Fn&& distanceSquared, float maxDistance = INFINITY) const {
+            uint32_t best = kNullNode;
+            float bestDistance = maxDistance * maxDistance;
+            TraversalStack stack;
+            stack.push(root);
+            while (!stack.empty()) {
+                uint32_t index = stack.pop();
+                if (index == kNullNode) {
+                    continue;
+                }
+                const Node& node = nodes[index];
+                if (node.box.distanceSquared(point) >= bestDistance) {
+                    continue;
+                }
+                if (node.isLeaf()) {
+                    float distance = distanceSquared(index);
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        best = index;
+                    }
+                    continue;
+                }
+                float d1 = nodes[node.child1].box.distanceSquared(point);
+                float d2 = nodes[node.child2].box.distanceSquared(point);
+                stack.push(d1 <= d2 ? node.child2 : node.child1);
+                stack.push(d1 <= d2 ? node.child1 : node.child2);
+            }
+            return best;
+        }
+
+        /**
+         * @brief Llama a fn(proxyA, proxyB) una vez por cada par de proxies cuyas cajas gruesas
+         *        se solapan.
+         *
+         * Recorre el árbol contra sí mismo: dos subárboles cuyas cajas no se solapan no pueden
+         * aportar pares, así que el coste es proporcional a los pares y no a n^2.
+         */
+        template<typename Fn>
+        void findPairs(Fn&& fn) const {
+            if (root == kNullNode) {
+                return;
+            }
+            // Pila de pares de nodos pendientes; (a, a) significa "pares dentro de a".
+            std::vector<std::pair<uint32_t, uint32_t>> stack;
+            stack.reserve(64);
+            stack.emplace_back(root, root);
+            while (!stack.empty()) {
+                std::pair<uint32_t, uint32_t> item = stack.back();
+                stack.pop_back();
+                const Node& a = nodes[item.first];
+                if (item.first == item.second) {
+                    if (!a.isLeaf()) {
+                        stack.emplace_back(a.child1, a.child1);
+                        stack.emplace_back(a.child2, a.child2);
+                        stack.emplace_back(a.child1, a.child2);
+                    }
+                    continue;
+                }
+                const Node& b = nodes[item.second];
+                if (!a.box.overlaps(b.box)) {
+                    continue;
+                }
+                if (a.isLeaf() && b.isLeaf()) {
+                    fn(item.first < item.second ? item.first : item.second, item.first < item.second ? item.second : item.first);
+                }
+                else if (b.isLeaf() || (!a.isLeaf() && a.box.surfaceArea() >= b.box.surfaceArea())) {
+                    // Bajar por el nodo más grande.
+                    stack.emplace_back(a.child1, item.second);
+                    stack.emplace_back(a.child2, item.second);
+                }
+                else {
+                    stack.emplace_back(item.first, b.child1);
+                    stack.emplace_back(item.first, b.child2);
+                }
+            }
+        }
+
+        /**
+         * @brief Comprueba la estructura: enlaces, cajas que contienen a sus hijos, alturas y
+         *        número de hojas (para pruebas y depuración).
+         */
+        bool validate() const {
+            if (root == kNullNode) {
+                return leafCount == 0;
+            }
+            if (nodes[root].parent != kNullNode) {
+                return false;
+            }
+            size_t leaves = 0;
+            std::vector<uint32_t> stack(1, root);
+            while (!stack.empty()) {
+                uint32_t index = stack.back();
+                stack.pop_back();
+                const Node& node = nodes[index];
+                if (node.isLeaf()) {
+                    ++leaves;
+                    if (node.height != 0) {
+                        return false;
+                    }
+                    continue;
+                }
+                const Node& child1 = nodes[node.child1];
+                const Node& child2 = nodes[node.child2];
+                int expectedHeight = 1 + (child1.height > child2.height ? child1.height : child2.height);
+                if (child1.parent != index || child2.parent != index || node.height != expectedHeight ||
+                    !node.box.contains(child1.box) || !node.box.contains(child2.box)) {
+                    return false;
+                }
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+            return leaves == leafCount;
+        }
+
+    private:
+        /// Nodo del árbol (44 bytes). Las hojas tienen child1 == kNullNode.
+        struct Node {
+            CAABB box;         ///< Caja gruesa (hoja) o unión de los hijos (interno).
+            uint32_t parent;   ///< Padre, o siguiente nodo libre si está en la lista libre.
+            uint32_t child1;   ///< Primer hijo (kNullNode en las hojas).
+            uint32_t child2;   ///< Segundo hijo.
+            uint32_t userData; ///< Valor del usuario (solo hojas).
+            int32_t height;    ///< 0 en las hojas, -1 en los nodos libres.
+
+            bool isLeaf() const { return child1 == kNullNode; }
+        };
+
+        /// Pila de recorrido: 64 entradas en la pila del hilo y el heap solo si se desborda.
+        class TraversalStack {
+        public:
+            TraversalStack() : count(0) {}
+
+            void push(uint32_t index) {
+                if (count < kLocal) {
+                    local[count] = index;
+                }
+                else {
+                    overflow.push_back(index);
+                }
+                ++count;
+            }
+
+            uint32_t pop() {
+                --count;
+                if (count < kLocal) {
+                    return local[count];
+                }
+                uint32_t index = overflow.back();
+                overflow.pop_back();
+                return index;
+            }
+
+            bool empty() const { return count == 0; }
+
+        private:
+            static const size_t kLocal = 64;
+            uint32_t local[kLocal];
+            std::vector<uint32_t> overflow;
+            size_t count;
+        };
+
+        bool isValidLeaf(uint32_t proxy) const {
+            return proxy < nodes.size() && nodes[proxy].height == 0;
+        }
+
+        CAABB predictedBox(const CAABB& box, const CVector3& displacement) const {
+            CAABB fat = box.inflated(margin);
+            CVector3 d = displacement * kDisplacementMultiplier;
+            for (int axis = 0; axis < 3; ++axis) {
+                if (d[axis] < 0.0f) {
+                    fat.min[axis] += d[axis];
+                }
+                else {
+                    fat.max[axis] += d[axis];
+                }
+            }
+            return fat;
+        }
+
+        uint32_t allocateNode() {
+            uint32_t index;
+            if (freeList != kNullNode) {
+                index = freeList;
+                freeList = nodes[index].parent;
+            }
+            else {
+                index = static_cast<uint32_t>(nodes.size());
+                nodes.emplace_back();
+            }
+            Node& node = nodes[index];
+            node.parent = kNullNode;
+            node.child1 = kNullNode;
+            node.child2 = kNullNode;
+            node.userData = 0;
+            node.height = 0;
+            return index;
+        }
+
+        void freeNode(uint32_t index) {
+            nodes[index].parent = freeList;
+            nodes[index].height = -1;
+            freeList = index;
+        }
+
+        /// Coste de bajar a child con la hoja: área nueva del hijo (más la heredada).
+        float descentCost(uint32_t child, const CAABB& leafBox, float inheritance) const {
+            const Node& node = nodes[child];
+            float merged = node.box.merged(leafBox).surfaceArea();
+            return node.isLeaf() ? merged + inheritance : merged - node.box.surfaceArea() + inheritance;
+        }
+
+        void insertLeaf(uint32_t leaf) {
+            if (root == kNullNode) {
+                root = leaf;
+                nodes[leaf].parent = kNullNode;
+                return;
+            }
+
+            // Elegir el hermano descendiendo por el hijo que menos aumenta el área total.
+            const CAABB leafBox = nodes[leaf].box;
+            uint32_t index = root;
+            while (!nodes[index].isLeaf()) {
+                const Node& node = nodes[index];
+                float area = node.box.surfaceArea();
+                float combined = node.box.merged(leafBox).surfaceArea();
+                // Coste de crear aquí un padre nuevo para este nodo y la hoja.
+                float cost = 2.0f * combined;
+                // Aumento de área que heredan los ancestros si se baja más.
+                float inheritance = 2.0f * (combined - area);
+                float cost1 = descentCost(node.child1, leafBox, inheritance);
+                float cost2 = descentCost(node.child2, leafBox, inheritance);
+                if (cost < cost1 && cost < cost2) {
+                    break;
+                }
+                index = cost1 < cost2 ? node.child1 : node.child2;
+            }
+            uint32_t sibling = index;
+
+            uint32_t oldParent = nodes[sibling].parent;
+            uint32_t newParent = allocateNode();
+            Node& parentNode = nodes[newParent];
+            parentNode.parent = oldParent;
+            parentNode.box = nodes[sibling].box.merged(leafBox);
+            parentNode.height = nodes[sibling].height + 1;
+            parentNode.child1 = sibling;
+            parentNode.child2 = leaf;
+            nodes[sibling].parent = newParent;
+            nodes[leaf].parent = newParent;
+            if (oldParent == kNullNode) {
+                root = newParent;
+            }
+            else if (nodes[oldParent].child1 == sibling) {
+                nodes[oldParent].child1 = newParent;
+            }
+            else {
+                nodes[oldParent].child2 = newParent;
+            }
+            fixUpwards(oldParent);
+        }
+
+        void removeLeaf(uint32_t leaf) {
+            if (leaf == root) {
+                root = kNullNode;
+                return;
+            }
+            uint32_t parent = nodes[leaf].parent;
+            uint32_t grandParent = nodes[parent].parent;
+            uint32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+            if (grandParent == kNullNode) {
+                root = sibling;
+                nodes[sibling].parent = kNullNode;
+            }
+            else {
+                if (nodes[grandParent].child1 == parent) {
+                    nodes[grandParent].child1 = sibling;
+                }
+                else {
+                    nodes[grandParent].child2 = sibling;
+                }
+                nodes[sibling].parent = grandParent;
+            }
+            freeNode(parent);
+            fixUpwards(grandParent);
+        }
+
+        /// Recalcula caja y altura de index y sus ancestros, rotando cada uno.
+        void fixUpwards(uint32_t index) {
+            while (index != kNullNode) {
+                rotate(index);
+                refresh(index);
+                index = nodes[index].parent;
+            }
+        }
+
+        void refresh(uint32_t index) {
+            Node& node = nodes[index];
+            const Node& child1 = nodes[node.child1];
+            const Node& child2 = nodes[node.child2];
+            node.box = child1.box.merged(child2.box);
+            node.height = 1 + (child1.height > child2.height ? child1.height : child2.height);
+        }
+
+        /**
+         * Rotación por área: intercambia un hijo de index con un nieto del otro lado si eso
+         * reduce el área del hijo interno afectado (la caja de index no cambia).
+         */
+        void rotate(uint32_t index) {
+            const uint32_t children[2] = { nodes[index].child1, nodes[index].child2 };
+            float bestGain = 0.0f;
+            int bestSide = -1;       // Hijo de index que se mueve hacia abajo.
+            int bestGrandChild = -1; // Nieto (0 o 1) del otro hijo que sube.
+            for (int side = 0; side < 2; ++side) {
+                uint32_t moved = children[side];
+                const Node& other = nodes[children[1 - side]];
+                if (other.isLeaf()) {
+                    continue;
+                }
+                float otherArea = other.box.surfaceArea();
+                const uint32_t grandChildren[2] = { other.child1, other.child2 };
+                for (int g = 0; g < 2; ++g) {
+                    // Tras el intercambio, other contiene moved y el nieto que se queda.
+                    float newArea = nodes[moved].box.merged(nodes[grandChildren[1 - g]].box).surfaceArea();
+                    float gain = otherArea - newArea;
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        bestSide = side;
+                        bestGrandChild = g;
+                    }
+                }
+            }
+            if (bestSide < 0) {
+                return;
+            }
+
+            uint32_t moved = children[bestSide];
+            uint32_t otherIndex = children[1 - bestSide];
+            Node& other = nodes[otherIndex];
+            uint32_t raised = bestGrandChild == 0 ? other.child1 : other.child2;
+            if (bestGrandChild == 0) {
+                other.child1 = moved;
+            }
+            else {
+                other.child2 = moved;
+            }
+            nodes[moved].parent = otherIndex;
+            if (bestSide == 0) {
+                nodes[index].child1 = raised;
+            }
+            else {
+                nodes[index].child2 = raised;
+            }
+            nodes[raised].parent = index;
+            refresh(otherIndex);
+        }
+
+        /// Informa de todas las hojas bajo index (ya aceptadas). Devuelve false si fn pidió parar.
+        template<typename Fn>
+        bool reportSubtree(uint32_t index, Fn& fn) const {
+            TraversalStack stack;
+            stack.push(index);
+            while (!stack.empty()) {
+                uint32_t current = stack.pop();
+                const Node& node = nodes[current];
+                if (node.isLeaf()) {
+                    if (!fn(current)) {
+                        return false;
+                    }
+                }
+                else {
+                    stack.push(node.child1);
+                    stack.push(node.child2);
+                }
+            }
+            return true;
+        }
+
+        float margin;            ///< Ampliación de las cajas gruesas.
+        std::vector<Node> nodes; ///< Todos los nodos (incluidos los libres).
+        uint32_t root;           ///< Raíz o kNullNode.
+        uint32_t freeList;       ///< Primer nodo libre o kNullNode.
+        size_t leafCount;        ///< Proxies insertados.
+    };
+
+}
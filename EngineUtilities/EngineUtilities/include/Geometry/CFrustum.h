@@ -0,0 +1,172 @@
+/**
+ * @file CFrustum.h
+ * @brief Pirámide de visión (frustum) con planos extraídos de una matriz de vista-proyección.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include "CAABB.h"
+#include "CBoundingSphere.h"
+#include "../Matriz/Matriz4x4.h"
+#include "../Utilities/EngineMath.h"
+#include "../Vector/CVector3.h"
+#include "../Vector/CVector4.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CFrustum
+     * @brief Seis planos que delimitan el volumen visible de una cámara.
+     *
+     * Cada plano es un CVector4 (nx, ny, nz, d) normalizado con la normal hacia dentro: un
+     * punto p está en el lado visible si nx * px + ny * py + nz * pz + d >= 0, y ese valor es
+     * su distancia al plano.
+     *
+     * Las pruebas contra volúmenes son conservadoras: un objeto fuera del frustum pero cerca
+     * de una esquina puede darse por visible, nunca al revés.
+     */
+    class CFrustum {
+    public:
+        static const int kLeft = 0;       ///< Índice del plano izquierdo.
+        static const int kRight = 1;      ///< Índice del plano derecho.
+        static const int kBottom = 2;     ///< Índice del plano inferior.
+        static const int kTop = 3;        ///< Índice del plano superior.
+        static const int kNear = 4;       ///< Índice del plano cercano.
+        static const int kFar = 5;        ///< Índice del plano lejano.
+        static const int kPlaneCount = 6; ///< Número de planos.
+
+        CVector4 planes[kPlaneCount]; ///< Planos normalizados, con la normal hacia dentro.
+
+        /// @brief Constructor por defecto. Todos los planos aceptan cualquier punto.
+        CFrustum() {
+            for (int i = 0; i < kPlaneCount; ++i) {
+                planes[i] = CVector4(0.0f, 0.0f, 0.0f, 1.0f);
+            }
+        }
+
+        /**
+         * @brief Extrae los planos de una matriz de vista-proyección (método de Gribb y Hartmann).
+         *
+         * Con vectores columna, clip = viewProjection * (p, 1), y p es visible si
+         * -w <= x, y <= w y -w <= z <= w (o 0 <= z <= w). Cada desigualdad es un plano que
+         * es una suma o resta de la cuarta fila con otra, expresado en el espacio de p (mundo
+         * si la matriz incluye la vista, objeto si además incluye el modelo).
+         *
+         * @param viewProjection Proyección por vista (por modelo, si se quiere en espacio objeto).
+         * @param zeroToOneDepth true si la profundidad de recorte va de 0 a w (Direct3D,
+         *                       Vulkan); false si va de -w a w (OpenGL).
+         */
+        static CFrustum fromMatrix(const Matriz4x4& viewProjection, bool zeroToOneDepth = false) {
+            const double (*m)[4] = viewProjection.m;
+            double values[kPlaneCount][4];
+            for (int column = 0; column < 4; ++column) {
+                double w = m[3][column];
+                values[kLeft][column] = w + m[0][column];
+                values[kRight][column] = w - m[0][column];
+                values[kBottom][column] = w + m[1][column];
+                values[kTop][column] = w - m[1][column];
+                values[kNear][column] = zeroToOneDepth ? m[2][column] : w + m[2][column];
+                values[kFar][column] = w - m[2][column];
+            }
+            CFrustum frustum;
+            for (int i = 0; i < kPlaneCount; ++i) {
+                frustum.planes[i] = normalizedPlane(values[i]);
+            }
+            return frustum;
+        }
+
+        /// @brief Distancia con signo de point al plano index (positiva en el lado visible).
+        float distance(int index, const CVector3& point) const {
+            const CVector4& plane = planes[index];
+            return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+        }
+
+        /// @brief Indica si el punto está dentro del frustum (o en su borde).
+        bool contains(const CVector3& point) const {
+            for (int i = 0; i < kPlaneCount; ++i) {
+                if (distance(i, point) < 0.0f) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Indica si la esfera puede ser visible (no está por completo detrás de ningún plano).
+        bool intersects(const CBoundingSphere& sphere) const {
+            if (sphere.isEmpty()) {
+                return false;
+            }
+            for (int i = 0; i < kPlaneCount; ++i) {
+                if (distance(i, sphere.center) < -sphere.radius) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Indica si la caja puede ser visible.
+         *
+         * Para cada plano basta probar el vértice positivo: la esquina más adentrada según el
+         * signo de cada componente de la normal. Si queda detrás, toda la caja lo está.
+         */
+        bool intersects(const CAABB& box) const {
+            if (box.isEmpty()) {
+                return false;
+            }
+            for (int i = 0; i < kPlaneCount; ++i) {
+                if (!(distance(i, positiveVertex(i, box)) >= 0.0f)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Indica si la esfera está completamente dentro del frustum.
+        bool contains(const CBoundingSphere& sphere) const {
+            if (sphere.isEmpty()) {
+                return false;
+            }
+            for (int i = 0; i < kPlaneCount; ++i) {
+                if (distance(i, sphere.center) < sphere.radius) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Indica si la caja está completamente dentro del frustum (su vértice negativo lo está).
+        bool contains(const CAABB& box) const {
+            if (box.isEmpty()) {
+                return false;
+            }
+            for (int i = 0; i < kPlaneCount; ++i) {
+                const CVector4& plane = planes[i];
+                CVector3 negative(plane.x >= 0.0f ? box.min.x : box.max.x, plane.y >= 0.0f ? box.min.y : box.max.y,
+                    plane.z >= 0.0f ? box.min.z : box.max.z);
+                if (distance(i, negative) < 0.0f) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Esquina de box más adentrada respecto al plano index.
+        CVector3 positiveVertex(int index, const CAABB& box) const {
+            const CVector4& plane = planes[index];
+            return CVector3(plane.x >= 0.0f ? box.max.x : box.min.x, plane.y >= 0.0f ? box.max.y : box.min.y,
+                plane.z >= 0.0f ? box.max.z : box.min.z);
+        }
+
+    private:
+        /// Divide el plano por la longitud de su normal (en double) y lo convierte a float.
+        static CVector4 normalizedPlane(const double* p) {
+            double length = EngineUtilities::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+            double scale = length > 0.0 ? 1.0 / length : 0.0;
+            return CVector4(static_cast<float>(p[0] * scale), static_cast<float>(p[1] * scale),
+                static_cast<float>(p[2] * scale), static_cast<float>(p[3] * scale));
+        }
+    };
+
+}
@@ -0,0 +1,439 @@
+/**
+ * @file CKdTree.h
+ * @brief Árbol k-d implícito sobre nubes de puntos estáticas con consultas de vecinos por lotes.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CAABB.h"
+#include "NeighborHeap.h"
+#include "SpaceFillingCurves.h"
+#include "../Threading/CJobSystem.h"
+#include "../Utilities/Simd.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @brief out[i] = distancia al cuadrado de (xs[i], ys[i], zs[i]) a point, con SIMD.
+     *
+     * Es el núcleo de las hojas de CKdTree y de la búsqueda por fuerza bruta sobre arrays SoA.
+     */
+    inline void distanceSquaredBatch(const float* xs, const float* ys, const float* zs, size_t count,
+        const CVector3& point, float* out) {
+        const CVector3 p = point;
+        simdForEach(0, count, [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            Pack dx = Pack::load(xs + i) - Pack(p.x);
+            Pack dy = Pack::load(ys + i) - Pack(p.y);
+            Pack dz = Pack::load(zs + i) - Pack(p.z);
+            (dx * dx + dy * dy + dz * dz).store(out + i);
+        });
+    }
+
+    /**
+     * @class CKdTree
+     * @brief Árbol k-d sobre puntos que no cambian (muestras de navegación, sondas de luz).
+     *
+     * El árbol es implícito: no hay nodos. Cada rango [first, last) con más de kMaxLeafSize
+     * puntos se parte por su mediana middle = first + count / 2 en el eje de mayor extensión,
+     * así que los hijos son [first, middle) y [middle, last) y basta guardar el eje y el plano
+     * de cada corte en la posición middle, que no se repite entre nodos. Los puntos se guardan
+     * reordenados como tres arrays de float (SoA), de modo que cada hoja es un tramo contiguo
+     * que se mide con distanceSquaredBatch().
+     *
+     * La construcción reparte las medianas (std::nth_element) de los subárboles grandes entre
+     * los hilos de un CJobSystem, como CStaticBVH.
+     *
+     * Las consultas son const y pueden lanzarse desde varios hilos a la vez.
+     */
+    class CKdTree {
+    public:
+        static constexpr uint32_t kMaxLeafSize = 8;     ///< Puntos máximos por hoja.
+        static constexpr size_t kParallelGrain = 16384; ///< Puntos a partir de los que se reparte el trabajo.
+        static constexpr size_t kBatchGrain = 256;      ///< Consultas por trabajo en nearestBatch().
+
+        /// @brief Constructor. Crea un árbol vacío.
+        CKdTree() = default;
+
+        /**
+         * @brief Construye el árbol con count puntos.
+         *
+         * Los índices que devuelven las consultas son posiciones en points.
+         *
+         * @param jobs Sistema de trabajos para construir en paralelo (opcional).
+         */
+        void build(const CVector3* points, size_t count, CJobSystem* jobs = nullptr) {
+            std::vector<Entry> entries(count);
+            for (size_t i = 0; i < count; ++i) {
+                entries[i] = Entry{ points[i], static_cast<uint32_t>(i) };
+            }
+            splits.assign(count, Split{ 0.0f, 0 });
+            treeBounds = CAABB();
+            if (count > 0) {
+                treeBounds = buildNode(jobs, entries.data(), 0, count);
+            }
+            for (int axis = 0; axis < 3; ++axis) {
+                coords[axis].resize(count);
+            }
+            ids.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                coords[0][i] = entries[i].position.x;
+                coords[1][i] = entries[i].position.y;
+                coords[2][i] = entries[i].position.z;
+                ids[i] = entries[i].id;
+            }
+        }
+
+        /// @brief Número de puntos.
+        size_t size() const { return ids.size(); }
+
+        /// @brief Caja de todos los puntos (vacía si no hay ninguno).
+        const CAABB& bounds() const { return treeBounds; }
+
+        /**
+         * @brief Llama a fn(index, distanceSquared) por cada punto a distancia <= radius de center.
+         */
+        template<typename Fn>
+        void queryRadius(const CVector3& center, float radius, Fn&& fn) const {
+            if (ids.empty() || !(radius >= 0.0f)) {
+                return;
+            }
+            const float radiusSquared = radius * radius;
+            float distances[kMaxLeafSize];
+            Pending stack[kStackSize];
+            int top = 0;
+            uint32_t first = 0;
+            uint32_t last = static_cast<uint32_t>(ids.size());
+            float bound = 0.0f;
+            for (;;) {
+                if (bound <= radiusSquared) {
+                    uint32_t count = last - first;
+                    if (count > kMaxLeafSize) {
+                        uint32_t middle = first + count / 2;
+                        const Split& split = splits[middle];
+                        float diff = center[split.axis] - split.value;
+                        float farBound = std::max(bound, diff * diff);
+                        // Primero el lado de center; el otro queda pendiente con su cota.
+                        if (diff < 0.0f) {
+                            stack[top++] = Pending{ middle, last, farBound };
+                            last = middle;
+                        }
+                        else {
+                            stack[top++] = Pending{ first, middle, farBound };
+                            first = middle;
+                        }
+                        continue;
+                    }
+                    distanceSquaredBatch(coords[0].data() + first, coords[1].data() + first, coords[2].data() + first,
+                        count, center, distances);
+                    for (uint32_t i = 0; i < count; ++i) {
+                        if (distances[i] <= radiusSquared) {
+                            fn(ids[first + i], distances[i]);
+                        }
+                    }
+                }
+                if (top == 0) {
+                    return;
+                }
+                --top;
+                first = stack[top].first;
+                last = stack[top].last;
+                bound = stack[top].boundSquared;
+            }
+        }
+
+        /**
+         * @brief Añade a result los índices de los puntos a distancia <= radius de center.
+         *
+         * @return Número de índices añadidos.
+         */
+        size_t queryRadius(const CVector3& center, float radius, std::vector<uint32_t>& result) const {
+            size_t before = result.size();
+            queryRadius(center, radius, [&](uint32_t index, float) { result.push_back(index); });
+            return result.size() - before;
+        }
+
+        /**
+         * @brief Los k puntos más cercanos a point, de más cerca a más lejos.
+         *
+         * @param indices Destino de al menos k índices.
+         * @param distancesSquared Destino de al menos k distancias al cuadrado.
+         * @param maxDistance Solo se consideran puntos a distancia <= maxDistance.
+         * @return Número de vecinos encontrados (menos de k si no hay suficientes).
+         */
+        size_t nearest(const CVector3& point, size_t k, uint32_t* indices, float* distancesSquared,
+            float maxDistance = INFINITY) const {
+            size_t found = search(point, k, indices, distancesSquared, maxDistance * maxDistance);
+            detail::sortHeap(indices, distancesSquared, found);
+            return found;
+        }
+
+        /// @brief El punto más cercano a point, o UINT32_MAX si no hay ninguno a distancia <= maxDistance.
+        uint32_t nearest(const CVector3& point, float maxDistance = INFINITY) const {
+            uint32_t index = UINT32_MAX;
+            float distanceSquared = 0.0f;
+            nearest(point, 1, &index, &distanceSquared, maxDistance);
+            return index;
+        }
+
+        /**
+         * @brief Los k vecinos de cada una de count consultas.
+         *
+         * Aprovecha la coherencia entre consultas: se resuelven en el orden de su código de
+         * Morton dentro de bounds(), así que las consecutivas recorren los mismos cortes y
+         * hojas, que siguen en caché. Con consultas dispersas esto compensa la ordenación; si
+         * ya llegan en orden espacial (un agente que avanza), nearest() una a una es igual de
+         * rápido. Con jobs, los tramos de kBatchGrain consultas ordenadas se reparten entre
+         * los hilos. El resultado es el mismo que el de llamar a nearest() con cada consulta
+         * (salvo el orden entre empates).
+         *
+         * @param indices k índices por consulta (query * k + i); los huecos quedan a UINT32_MAX.
+         * @param distancesSquared k distancias por consulta; los huecos quedan a INFINITY.
+         */
+        void nearestBatch(const CVector3* queries, size_t count, size_t k, uint32_t* indices, float* distancesSquared,
+            CJobSystem* jobs = nullptr, float maxDistance = INFINITY) const {
+            if (count == 0 || k == 0) {
+                return;
+            }
+            std::vector<uint64_t> order(count);
+            CVector3 extent = treeBounds.isEmpty() ? CVector3() : treeBounds.size();
+            float scale[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                scale[axis] = extent[axis] > 0.0f ? 1023.0f / extent[axis] : 0.0f;
+            }
+            forBlocks(jobs, count, kParallelGrain, [&](size_t first, size_t last) {
+                for (size_t q = first; q < last; ++q) {
+                    order[q] = (static_cast<uint64_t>(mortonKey(queries[q], scale)) << 32) | q;
+                }
+            });
+            std::sort(order.begin(), order.end());
+
+            const float limitSquared = maxDistance * maxDistance;
+            forBlocks(jobs, count, kBatchGrain, [&](size_t first, size_t last) {
+                for (size_t slot = first; slot < last; ++slot) {
+                    size_t q = static_cast<size_t>(order[slot] & 0xFFFFFFFFu);
+                    uint32_t* resultIndices = indices + q * k;
+                    float* resultDistances = distancesSquared + q * k;
+                    size_t found = search(queries[q], k, resultIndices, resultDistances, limitSquared);
+                    detail::sortHeap(resultIndices, resultDistances, found);
+                    for (size_t i = found; i < k; ++i) {
+                        resultIndices[i] = UINT32_MAX;
+                        resultDistances[i] = INFINITY;
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Comprueba que cada corte deja a su izquierda coordenadas <= que el plano y a
+         *        su derecha >= (para pruebas y depuración).
+         */
+        bool validate() const {
+            if (ids.empty()) {
+                return treeBounds.isEmpty();
+            }
+            std::vector<uint8_t> seen(ids.size(), 0);
+            for (uint32_t id : ids) {
+                if (id >= ids.size() || seen[id]++ != 0) {
+                    return false;
+                }
+            }
+            std::vector<Pending> stack(1, Pending{ 0, static_cast<uint32_t>(ids.size()), 0.0f });
+            while (!stack.empty()) {
+                Pending range = stack.back();
+                stack.pop_back();
+                uint32_t count = range.last - range.first;
+                if (count <= kMaxLeafSize) {
+                    continue;
+                }
+                uint32_t middle = range.first + count / 2;
+                const Split& split = splits[middle];
+                if (split.axis > 2) {
+                    return false;
+                }
+                const float* values = coords[split.axis].data();
+                for (uint32_t i = range.first; i < range.last; ++i) {
+                    if (i < middle ? values[i] > split.value : values[i] < split.value) {
+                        return false;
+                    }
+                }
+                stack.push_back(Pending{ range.first, middle, 0.0f });
+                stack.push_back(Pending{ middle, range.last, 0.0f });
+            }
+            return true;
+        }
+
+    private:
+        /// Punto durante la construcción.
+        struct Entry {
+            CVector3 position;
+            uint32_t id;
+        };
+
+        /// Plano de corte de un nodo interno. Se guarda aparte porque los hijos reordenan sus
+        /// puntos y el de la mediana no se queda en su sitio.
+        struct Split {
+            float value;
+            uint32_t axis;
+        };
+
+        /// Rango pendiente de visitar con la menor distancia al cuadrado posible a sus puntos.
+        struct Pending {
+            uint32_t first;
+            uint32_t last;
+            float boundSquared;
+        };
+
+        static constexpr int kStackSize = 64; ///< Pila de recorrido (> profundidad máxima con 2^32 puntos).
+
+        /// Ejecuta fn(first, last) sobre [0, count), en paralelo si hay trabajos y el rango es grande.
+        template<typename Fn>
+        static void forBlocks(CJobSystem* jobs, size_t count, size_t grain, const Fn& fn) {
+            if (jobs == nullptr || count <= grain) {
+                fn(0, count);
+                return;
+            }
+            jobs->parallelFor(0, count, grain, fn);
+        }
+
+        /// Caja de entries[first, last), en paralelo por bloques si el rango es grande.
+        static CAABB rangeBounds(CJobSystem* jobs, const Entry* entries, size_t first, size_t last) {
+            size_t count = last - first;
+            if (jobs == nullptr || count <= kParallelGrain) {
+                CAABB box;
+                for (size_t i = first; i < last; ++i) {
+                    box.expand(entries[i].position);
+                }
+                return box;
+            }
+            size_t blocks = (count + kParallelGrain - 1) / kParallelGrain;
+            std::vector<CAABB> partial(blocks);
+            jobs->parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+                for (size_t block = firstBlock; block < lastBlock; ++block) {
+                    size_t blockFirst = first + block * kParallelGrain;
+                    size_t blockLast = std::min(blockFirst + kParallelGrain, last);
+                    for (size_t i = blockFirst; i < blockLast; ++i) {
+                        partial[block].expand(entries[i].position);
+                    }
+                }
+            });
+            CAABB box;
+            for (const CAABB& block : partial) {
+                box.expand(block);
+            }
+            return box;
+        }
+
+        /// Parte entries[first, last) por la mediana y sigue con los hijos; devuelve la caja del rango.
+        CAABB buildNode(CJobSystem* jobs, Entry* entries, size_t first, size_t last) {
+            CAABB box = rangeBounds(jobs, entries, first, last);
+            size_t count = last - first;
+            if (count <= kMaxLeafSize) {
+                return box;
+            }
+            CVector3 extent = box.size();
+            int axis = extent.x >= extent.y ? (extent.x >= extent.z ? 0 : 2) : (extent.y >= extent.z ? 1 : 2);
+            size_t middle = first + count / 2;
+            std::nth_element(entries + first, entries + middle, entries + last, [axis](const Entry& a, const Entry& b) {
+                return a.position[axis] < b.position[axis];
+            });
+            splits[middle] = Split{ entries[middle].position[axis], static_cast<uint32_t>(axis) };
+            if (jobs != nullptr && count > kParallelGrain) {
+                CJobCounter counter;
+                jobs->run([this, jobs, entries, first, middle]() {
+                    buildNode(jobs, entries, first, middle);
+                }, &counter);
+                buildNode(jobs, entries, middle, last);
+                jobs->wait(counter);
+            }
+            else {
+                buildNode(jobs, entries, first, middle);
+                buildNode(jobs, entries, middle, last);
+            }
+            return box;
+        }
+
+        /**
+         * Busca los k vecinos de point a distancia al cuadrado <= limitSquared y los deja en
+         * un montículo de máximos en indices y distances; devuelve cuántos hay.
+         */
+        size_t search(const CVector3& point, size_t k, uint32_t* indices, float* distances, float limitSquared) const {
+            if (k == 0 || ids.empty()) {
+                return 0;
+            }
+            const float* xs = coords[0].data();
+            const float* ys = coords[1].data();
+            const float* zs = coords[2].data();
+            float leafDistances[kMaxLeafSize];
+            Pending stack[kStackSize];
+            int top = 0;
+            uint32_t first = 0;
+            uint32_t last = static_cast<uint32_t>(ids.size());
+            size_t found = 0;
+            // Un punto entra si está a <= limitSquared mientras falten vecinos, y después si
+            // mejora al k-ésimo (la raíz del montículo).
+            float worst = limitSquared;
+            for (;;) {
+                uint32_t count = last - first;
+                if (count > kMaxLeafSize) {
+                    uint32_t middle = first + count / 2;
+                    const Split& split = splits[middle];
+                    float diff = point[split.axis] - split.value;
+                    if (diff < 0.0f) {
+                        stack[top++] = Pending{ middle, last, diff * diff };
+                        last = middle;
+                    }
+                    else {
+                        stack[top++] = Pending{ first, middle, diff * diff };
+                        first = middle;
+                    }
+                    continue;
+                }
+                distanceSquaredBatch(xs + first, ys + first, zs + first, count, point, leafDistances);
+                for (uint32_t i = 0; i < count; ++i) {
+                    float distanceSquared = leafDistances[i];
+                    if (found < k ? distanceSquared <= worst : distanceSquared < worst) {
+                        if (found == k) {
+                            detail::popHeap(indices, distances, found--);
+                        }
+                        detail::pushHeap(indices, distances, found++, ids[first + i], distanceSquared);
+                        if (found == k) {
+                            worst = distances[0];
+                        }
+                    }
+                }
+                // Sacar el siguiente rango que aún pueda tener algo más cerca que worst.
+                do {
+                    if (top == 0) {
+                        return found;
+                    }
+                    --top;
+                } while (stack[top].boundSquared > worst);
+                first = stack[top].first;
+                last = stack[top].last;
+            }
+        }
+
+        /// Código de Morton de 30 bits de point cuantizado a 1024 celdas por eje de bounds().
+        uint32_t mortonKey(const CVector3& point, const float* scale) const {
+            uint32_t cells[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                float cell = (point[axis] - treeBounds.min[axis]) * scale[axis];
+                cells[axis] = static_cast<uint32_t>(cell > 0.0f ? (cell < 1023.0f ? cell : 1023.0f) : 0.0f);
+            }
+            return static_cast<uint32_t>(mortonEncode3(cells[0], cells[1], cells[2]));
+        }
+
+        std::vector<float> coords[3];  ///< Coordenadas por eje en el orden del árbol.
+        std::vector<uint32_t> ids;     ///< Índice original de cada posición.
+        std::vector<Split> splits;     ///< Corte cuya mediana cae en cada posición (solo las de los nodos internos).
+        CAABB treeBounds;              ///< Caja de todos los puntos.
+    };
+
+}
@@ -0,0 +1,342 @@
+/**
+ * @file COBB.h
+ * @brief Caja orientada (OBB) con pruebas por ejes separadores y ajuste por covarianza.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "CAABB.h"
+#include "../Matriz/Matriz3x3.h"
+#include "../Utilities/EngineMath.h"
+#include "../Vector/CQuaternion.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class COBB
+     * @brief Caja orientada: centro, tres ejes ortonormales y semiextensiones a lo largo de ellos.
+     *
+     * La orientación se guarda ya convertida en ejes (las columnas de la matriz de rotación),
+     * que es lo que usan todas las pruebas. Las pruebas de solape siguen el teorema del eje
+     * separador (Ericson, Real-Time Collision Detection 4.4.1 y 5.2.9): dos convexos no se
+     * tocan si y solo si sus proyecciones sobre alguno de los ejes candidatos están separadas,
+     * y para cajas y triángulos basta con las normales de caras y los productos vectoriales de
+     * aristas. Las cajas que se tocan justo en el límite cuentan como solapadas.
+     */
+    class COBB {
+    public:
+        static constexpr float kParallelEpsilon = 1e-6f; ///< Se suma a |R| para que ejes de aristas paralelas (producto nulo) no separen por redondeo.
+        static constexpr int kMaxJacobiSweeps = 32;      ///< Rotaciones máximas al diagonalizar la covarianza.
+
+        CVector3 center;      ///< Centro.
+        CVector3 axes[3];     ///< Ejes locales x, y, z en el mundo (unitarios).
+        CVector3 halfExtents; ///< Semiextensiones a lo largo de cada eje.
+
+        /// @brief Constructor por defecto. Caja degenerada en el origen, alineada con los ejes.
+        COBB() : center(), halfExtents() {
+            axes[0] = CVector3(1.0f, 0.0f, 0.0f);
+            axes[1] = CVector3(0.0f, 1.0f, 0.0f);
+            axes[2] = CVector3(0.0f, 0.0f, 1.0f);
+        }
+
+        /// @brief Caja con la orientación de un cuaternión unitario.
+        COBB(const CVector3& center, const CQuaternion& rotation, const CVector3& halfExtents)
+            : center(center), halfExtents(halfExtents) {
+            axes[0] = rotation.rotate(CVector3(1.0f, 0.0f, 0.0f));
+            axes[1] = rotation.rotate(CVector3(0.0f, 1.0f, 0.0f));
+            axes[2] = rotation.rotate(CVector3(0.0f, 0.0f, 1.0f));
+        }
+
+        /// @brief Caja con la orientación de una matriz de rotación (sus columnas son los ejes).
+        COBB(const CVector3& center, const Matriz3x3& rotation, const CVector3& halfExtents)
+            : center(center), halfExtents(halfExtents) {
+            axes[0] = CVector3(static_cast<float>(rotation.m00), static_cast<float>(rotation.m10), static_cast<float>(rotation.m20));
+            axes[1] = CVector3(static_cast<float>(rotation.m01), static_cast<float>(rotation.m11), static_cast<float>(rotation.m21));
+            axes[2] = CVector3(static_cast<float>(rotation.m02), static_cast<float>(rotation.m12), static_cast<float>(rotation.m22));
+        }
+
+        /// @brief Caja orientada equivalente a una caja alineada (no vacía).
+        static COBB fromAABB(const CAABB& box) {
+            COBB result;
+            result.center = box.center();
+            result.halfExtents = box.extents();
+            return result;
+        }
+
+        /**
+         * @brief Caja que envuelve count puntos, orientada según su covarianza.
+         *
+         * Los ejes son los vectores propios de la matriz de covarianza (Jacobi, Ericson 4.3.4)
+         * y las extensiones salen de proyectar los puntos sobre ellos. Los puntos interiores
+         * pesan igual que los de la superficie y tuercen los ejes hacia donde hay más, así que
+         * conviene pasar solo los vértices de la envolvente. Con count 0 devuelve la caja por
+         * defecto.
+         */
+        static COBB fromPoints(const CVector3* points, size_t count) {
+            COBB result;
+            if (count == 0) {
+                return result;
+            }
+            double mean[3] = { 0.0, 0.0, 0.0 };
+            for (size_t i = 0; i < count; ++i) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    mean[axis] += points[i][axis];
+                }
+            }
+            for (int axis = 0; axis < 3; ++axis) {
+                mean[axis] /= static_cast<double>(count);
+            }
+            double covariance[3][3] = {};
+            for (size_t i = 0; i < count; ++i) {
+                double d[3] = { points[i].x - mean[0], points[i].y - mean[1], points[i].z - mean[2] };
+                for (int row = 0; row < 3; ++row) {
+                    for (int column = row; column < 3; ++column) {
+                        covariance[row][column] += d[row] * d[column];
+                    }
+                }
+            }
+            for (int row = 0; row < 3; ++row) {
+                for (int column = 0; column < row; ++column) {
+                    covariance[row][column] = covariance[column][row];
+                }
+            }
+
+            Matriz3x3 vectors = eigenvectors(covariance);
+            COBB oriented(CVector3(), vectors, CVector3());
+            // Reortonormalizar en float y dejar una base dextrógira.
+            result.axes[0] = oriented.axes[0].normalized();
+            result.axes[1] = (oriented.axes[1] - result.axes[0] * oriented.axes[1].dot(result.axes[0])).normalized();
+            result.axes[2] = result.axes[0].cross(result.axes[1]);
+
+            CVector3 minimum(INFINITY, INFINITY, INFINITY);
+            CVector3 maximum(-INFINITY, -INFINITY, -INFINITY);
+            for (size_t i = 0; i < count; ++i) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    float projection = points[i].dot(result.axes[axis]);
+                    minimum[axis] = projection < minimum[axis] ? projection : minimum[axis];
+                    maximum[axis] = projection > maximum[axis] ? projection : maximum[axis];
+                }
+            }
+            result.center = CVector3();
+            for (int axis = 0; axis < 3; ++axis) {
+                result.center += result.axes[axis] * ((minimum[axis] + maximum[axis]) * 0.5f);
+                result.halfExtents[axis] = (maximum[axis] - minimum[axis]) * 0.5f;
+            }
+            return result;
+        }
+
+        /// @brief Matriz de rotación cuyas columnas son los ejes.
+        Matriz3x3 rotation() const {
+            return Matriz3x3(
+                axes[0].x, axes[1].x, axes[2].x,
+                axes[0].y, axes[1].y, axes[2].y,
+                axes[0].z, axes[1].z, axes[2].z
+            );
+        }
+
+        /// @brief Volumen.
+        float volume() const {
+            return 8.0f * halfExtents.x * halfExtents.y * halfExtents.z;
+        }
+
+        /// @brief Las ocho esquinas (el bit i del índice elige el signo del eje i).
+        void corners(CVector3 out[8]) const {
+            for (int i = 0; i < 8; ++i) {
+                out[i] = center;
+                for (int axis = 0; axis < 3; ++axis) {
+                    out[i] += axes[axis] * ((i >> axis) & 1 ? halfExtents[axis] : -halfExtents[axis]);
+                }
+            }
+        }
+
+        /// @brief Caja alineada mínima que contiene a la caja orientada.
+        CAABB bounds() const {
+            CVector3 extent;
+            for (int world = 0; world < 3; ++world) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    extent[world] += absolute(axes[axis][world]) * halfExtents[axis];
+                }
+            }
+            return CAABB(center - extent, center + extent);
+        }
+
+        /// @brief Indica si un punto está dentro de la caja (o en su borde).
+        bool contains(const CVector3& point) const {
+            CVector3 d = point - center;
+            for (int axis = 0; axis < 3; ++axis) {
+                if (absolute(d.dot(axes[axis])) > halfExtents[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// @brief Punto de la caja más cercano a point.
+        CVector3 closestPoint(const CVector3& point) const {
+            CVector3 d = point - center;
+            CVector3 result = center;
+            for (int axis = 0; axis < 3; ++axis) {
+                float distance = d.dot(axes[axis]);
+                distance = distance > halfExtents[axis] ? halfExtents[axis] : distance;
+                distance = distance < -halfExtents[axis] ? -halfExtents[axis] : distance;
+                result += axes[axis] * distance;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Solape con otra caja orientada por los 15 ejes separadores.
+         *
+         * Todo se expresa en los ejes de esta caja: R[i][j] = axes[i] · other.axes[j] y t es
+         * la distancia entre centros. Primero los 6 ejes de caras, que descartan la mayoría de
+         * pares separados, y después los 9 productos de aristas.
+         */
+        bool overlaps(const COBB& other) const {
+            float R[3][3];
+            float absR[3][3];
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    R[i][j] = axes[i].dot(other.axes[j]);
+                    absR[i][j] = absolute(R[i][j]) + kParallelEpsilon;
+                }
+            }
+            CVector3 d = other.center - center;
+            float t[3] = { d.dot(axes[0]), d.dot(axes[1]), d.dot(axes[2]) };
+            const CVector3& a = halfExtents;
+            const CVector3& b = other.halfExtents;
+
+            for (int i = 0; i < 3; ++i) {
+                float rb = b.x * absR[i][0] + b.y * absR[i][1] + b.z * absR[i][2];
+                if (absolute(t[i]) > a[i] + rb) {
+                    return false;
+                }
+            }
+            for (int j = 0; j < 3; ++j) {
+                float ra = a.x * absR[0][j] + a.y * absR[1][j] + a.z * absR[2][j];
+                if (absolute(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + b[j]) {
+                    return false;
+                }
+            }
+            // Eje axes[i] x other.axes[j]; (i1, i2) y (j1, j2) son los otros dos índices.
+            for (int i = 0; i < 3; ++i) {
+                int i1 = (i + 1) % 3;
+                int i2 = (i + 2) % 3;
+                for (int j = 0; j < 3; ++j) {
+                    int j1 = (j + 1) % 3;
+                    int j2 = (j + 2) % 3;
+                    float ra = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+                    float rb = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+                    if (absolute(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Solape con el triángulo (v0, v1, v2) por los 13 ejes separadores.
+         *
+         * El triángulo pasa a los ejes de la caja, donde la prueba es la de caja alineada
+         * contra triángulo de Akenine-Möller: 9 productos de los ejes por las aristas, las 3
+         * caras de la caja y el plano del triángulo.
+         */
+        bool overlapsTriangle(const CVector3& v0, const CVector3& v1, const CVector3& v2) const {
+            CVector3 p[3];
+            const CVector3* world[3] = { &v0, &v1, &v2 };
+            for (int k = 0; k < 3; ++k) {
+                CVector3 d = *world[k] - center;
+                p[k] = CVector3(d.dot(axes[0]), d.dot(axes[1]), d.dot(axes[2]));
+            }
+            const CVector3& e = halfExtents;
+            CVector3 edges[3] = { p[1] - p[0], p[2] - p[1], p[0] - p[2] };
+
+            for (int i = 0; i < 3; ++i) {
+                int i1 = (i + 1) % 3;
+                int i2 = (i + 2) % 3;
+                for (const CVector3& f : edges) {
+                    // Eje unitario_i x f: componente i nula, (i1, i2) = (-f[i2], f[i1]).
+                    float a1 = -f[i2];
+                    float a2 = f[i1];
+                    float r = e[i1] * absolute(a1) + e[i2] * absolute(a2);
+                    float p0 = p[0][i1] * a1 + p[0][i2] * a2;
+                    float p1 = p[1][i1] * a1 + p[1][i2] * a2;
+                    float p2 = p[2][i1] * a1 + p[2][i2] * a2;
+                    if (minimumOf(p0, p1, p2) > r || maximumOf(p0, p1, p2) < -r) {
+                        return false;
+                    }
+                }
+            }
+            for (int axis = 0; axis < 3; ++axis) {
+                if (minimumOf(p[0][axis], p[1][axis], p[2][axis]) > e[axis] ||
+                    maximumOf(p[0][axis], p[1][axis], p[2][axis]) < -e[axis]) {
+                    return false;
+                }
+            }
+            CVector3 normal = edges[0].cross(edges[1]);
+            float r = e.x * absolute(normal.x) + e.y * absolute(normal.y) + e.z * absolute(normal.z);
+            return absolute(normal.dot(p[0])) <= r;
+        }
+
+    private:
+        static float absolute(float value) { return value < 0.0f ? -value : value; }
+        static float minimumOf(float a, float b, float c) {
+            float m = a < b ? a : b;
+            return m < c ? m : c;
+        }
+        static float maximumOf(float a, float b, float c) {
+            float m = a > b ? a : b;
+            return m > c ? m : c;
+        }
+
+        /// Vectores propios (columnas) de una matriz simétrica por rotaciones de Jacobi.
+        static Matriz3x3 eigenvectors(double a[3][3]) {
+            double v[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+            for (int sweep = 0; sweep < kMaxJacobiSweeps; ++sweep) {
+                // Anular el mayor elemento fuera de la diagonal.
+                int p = 0;
+                int q = 1;
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = i + 1; j < 3; ++j) {
+                        if (fabs(a[i][j]) > fabs(a[p][q])) {
+                            p = i;
+                            q = j;
+                        }
+                    }
+                }
+                double scale = fabs(a[0][0]) + fabs(a[1][1]) + fabs(a[2][2]);
+                if (fabs(a[p][q]) <= 1e-12 * scale) {
+                    break;
+                }
+                double r = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                double t = r >= 0.0 ? 1.0 / (r + EngineUtilities::sqrt(1.0 + r * r)) : -1.0 / (-r + EngineUtilities::sqrt(1.0 + r * r));
+                double c = 1.0 / EngineUtilities::sqrt(1.0 + t * t);
+                double s = t * c;
+                // a = J^T a J y v = v J, con J la rotación en el plano (p, q).
+                for (int k = 0; k < 3; ++k) {
+                    double akp = a[k][p];
+                    double akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    double apk = a[p][k];
+                    double aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    double vkp = v[k][p];
+                    double vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+            return Matriz3x3(v[0][0], v[0][1], v[0][2], v[1][0], v[1][1], v[1][2], v[2][0], v[2][1], v[2][2]);
+        }
+    };
+
+}
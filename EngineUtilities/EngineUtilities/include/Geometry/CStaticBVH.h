@@ -0,0 +1,547 @@
+/**
+ * @file CStaticBVH.h
+ * @brief Jerarquía de volúmenes estática sobre triángulos (SAH por cubetas) para consultas de rayos.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CAABB.h"
+#include "RayIntersection.h"
+#include "../Threading/CJobSystem.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CStaticBVH
+     * @brief BVH binaria sobre una malla de triángulos que no cambia (geometría de nivel).
+     *
+     * Se construye de arriba abajo: en cada nodo los centroides se reparten en kBins cubetas
+     * por eje y se elige el corte de menor coste SAH (área de los hijos por triángulos). Los
+     * nodos grandes se reparten entre los hilos de un CJobSystem: el recuento de cubetas
+     * por bloques y, tras partir, un subárbol por trabajo.
+     *
+     * Cada nodo ocupa 32 bytes (dos por línea de caché): la caja y un índice que, según
+     * count, es el primer triángulo de la hoja o el primero de los dos hijos, que siempre
+     * van juntos. Los triángulos se copian en el orden de las hojas como vértice y aristas,
+     * lo que necesita Möller-Trumbore.
+     *
+     * Las consultas son const y pueden lanzarse desde varios hilos a la vez.
+     */
+    class CStaticBVH {
+    public:
+        static constexpr int kBins = 16;            ///< Cubetas por eje al buscar el corte (como máximo).
+        static constexpr uint32_t kMaxLeafSize = 8; ///< Triángulos máximos por hoja.
+        static constexpr size_t kParallelGrain = 16384; ///< Triángulos a partir de los que se reparte el trabajo.
+
+        /// @brief Constructor. Crea una jerarquía vacía.
+        CStaticBVH() : maxDepth(0) {}
+
+        /**
+         * @brief Construye la jerarquía para una malla indexada.
+         *
+         * @param vertices Posiciones de los vértices.
+         * @param indices Tres índices por triángulo.
+         * @param triangleCount Número de triángulos.
+         * @param jobs Sistema de trabajos para construir en paralelo (opcional).
+         */
+        void build(const CVector3* vertices, const uint32_t* indices, size_t triangleCount, CJobSystem* jobs = nullptr) {
+            triangles.resize(triangleCount);
+            for (size_t i = 0; i < triangleCount; ++i) {
+                const CVector3& a = vertices[indices[3 * i]];
+                triangles[i] = Triangle{ a, vertices[indices[3 * i + 1]] - a, vertices[indices[3 * i + 2]] - a };
+            }
+            buildHierarchy(jobs);
+        }
+
+        /// @brief Construye la jerarquía para triángulos dados como tríos consecutivos de vértices.
+        void build(const CVector3* vertices, size_t triangleCount, CJobSystem* jobs = nullptr) {
+            triangles.resize(triangleCount);
+            for (size_t i = 0; i < triangleCount; ++i) {
+                const CVector3& a = vertices[3 * i];
+                triangles[i] = Triangle{ a, vertices[3 * i + 1] - a, vertices[3 * i + 2] - a };
+            }
+            buildHierarchy(jobs);
+        }
+
+        /// @brief Número de triángulos.
+        size_t triangleCount() const { return triangles.size(); }
+
+        /// @brief Número de nodos (sin contar el hueco del índice 1).
+        size_t nodeCount() const { return nodes.size() > 1 ? nodes.size() - 1 : nodes.size(); }
+
+        /// @brief Profundidad máxima de una hoja (0 si la raíz es hoja o está vacía).
+        int depth() const { return maxDepth; }
+
+        /// @brief Caja de toda la malla (vacía si no hay triángulos).
+        CAABB bounds() const { return nodes.empty() ? CAABB() : nodes[0].box(); }
+
+        /**
+         * @brief Impacto más cercano del rayo origin + t * direction con t en [0, maxT).
+         *
+         * Los triángulos se prueban por las dos caras. direction no necesita estar normalizada;
+         * t se mide en sus unidades.
+         *
+         * @return true si hay impacto; hit recibe el más cercano.
+         */
+        bool raycast(const CVector3& origin, const CVector3& direction, float maxT, CTriangleHit& hit) const {
+            return traverse<false>(origin, direction, maxT, hit);
+        }
+
+        /**
+         * @brief Indica si el rayo toca algún triángulo con t en [0, maxT).
+         *
+         * Termina con el primer impacto (rayos de sombra y visibilidad).
+         */
+        bool anyHit(const CVector3& origin, const CVector3& direction, float maxT) const {
+            CTriangleHit hit;
+            return traverse<true>(origin, direction, maxT, hit);
+        }
+
+        /**
+         * @brief Impacto más cercano a from del segmento [from, to).
+         *
+         * hit.t es la fracción del segmento, entre 0 y 1.
+         */
+        bool segmentcast(const CVector3& from, const CVector3& to, CTriangleHit& hit) const {
+            return traverse<false>(from, to - from, 1.0f, hit);
+        }
+
+        /// @brief Indica si algún triángulo corta el segmento [from, to) (línea de visión).
+        bool segmentBlocked(const CVector3& from, const CVector3& to) const {
+            CTriangleHit hit;
+            return traverse<true>(from, to - from, 1.0f, hit);
+        }
+
+        /**
+         * @brief Comprueba la estructura: cada caja contiene a sus hijos o triángulos y cada
+         *        triángulo está en una sola hoja (para pruebas y depuración).
+         */
+        bool validate() const {
+            if (nodes.empty()) {
+                return triangles.empty();
+            }
+            std::vector<uint8_t> seen(triangles.size(), 0);
+            std::vector<uint32_t> stack(1, 0);
+            while (!stack.empty()) {
+                const Node& node = nodes[stack.back()];
+                stack.pop_back();
+                CAABB box = node.box();
+                if (node.count > 0) {
+                    if (node.leftFirst + node.count > triangles.size()) {
+                        return false;
+                    }
+                    for (uint32_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                        if (seen[i]++ != 0 || !box.contains(triangleBox(triangles[i]))) {
+                            return false;
+                        }
+                    }
+                    continue;
+                }
+                if (node.leftFirst + 1 >= nodes.size() || !box.contains(nodes[node.leftFirst].box()) ||
+                    !box.contains(nodes[node.leftFirst + 1].box())) {
+                    return false;
+                }
+                stack.push_back(node.leftFirst);
+                stack.push_back(node.leftFirst + 1);
+            }
+            return std::find(seen.begin(), seen.end(), 0) == seen.end();
+        }
+
+    private:
+        /// Nodo de 32 bytes: hoja si count > 0 (triángulos [leftFirst, leftFirst + count)),
+        /// interno si no (hijos leftFirst y leftFirst + 1).
+        struct alignas(32) Node {
+            float minX, minY, minZ;
+            uint32_t leftFirst;
+            float maxX, maxY, maxZ;
+            uint32_t count;
+
+            CAABB box() const { return CAABB(CVector3(minX, minY, minZ), CVector3(maxX, maxY, maxZ)); }
+        };
+        static_assert(sizeof(Node) == 32, "CStaticBVH::Node debe ocupar 32 bytes");
+
+        /// Triángulo preparado para Möller-Trumbore.
+        struct Triangle {
+            CVector3 v0;    ///< Primer vértice.
+            CVector3 edge1; ///< v1 - v0.
+            CVector3 edge2; ///< v2 - v0.
+        };
+
+        /// Cubeta de la búsqueda SAH.
+        struct Bin {
+            CAABB box;
+            uint32_t count = 0;
+        };
+
+        /// Cubetas de los tres ejes.
+        struct BinSet {
+            Bin bins[3][kBins];
+        };
+
+        /// Caja de un rango de triángulos y de sus centroides.
+        struct RangeBounds {
+            CAABB box;
+            CAABB centroids;
+        };
+
+        static constexpr int kMaxSahDepth = 64;    ///< A partir de aquí se parte por la mitad.
+        static constexpr int kStackSize = 128;      ///< Pila de recorrido (> profundidad máxima).
+        static constexpr float kTraversalCost = 1.0f; ///< Coste de visitar un nodo relativo a un triángulo.
+
+        static CAABB triangleBox(const Triangle& triangle) {
+            CAABB box(triangle.v0, triangle.v0);
+            box.expand(triangle.v0 + triangle.edge1);
+            box.expand(triangle.v0 + triangle.edge2);
+            return box;
+        }
+
+        /// Amplía box con other sin comprobar si está vacía (min/max por componente ya lo resuelve).
+        static void grow(CAABB& box, const CAABB& other) {
+            box.min.x = other.min.x < box.min.x ? other.min.x : box.min.x;
+            box.min.y = other.min.y < box.min.y ? other.min.y : box.min.y;
+            box.min.z = other.min.z < box.min.z ? other.min.z : box.min.z;
+            box.max.x = other.max.x > box.max.x ? other.max.x : box.max.x;
+            box.max.y = other.max.y > box.max.y ? other.max.y : box.max.y;
+            box.max.z = other.max.z > box.max.z ? other.max.z : box.max.z;
+        }
+
+        /// Triángulo durante la construcción. Se reordenan los propios registros (no índices)
+        /// para que cada pasada lea la memoria en secuencia.
+        struct Primitive {
+            CAABB box;         ///< Caja del triángulo.
+            CVector3 centroid; ///< Centro de la caja.
+            uint32_t triangle; ///< Índice en la malla original.
+        };
+
+        /// Estado temporal de la construcción.
+        struct Builder {
+            CJobSystem* jobs;
+            std::vector<Primitive> primitives; ///< Acaban en el orden de las hojas.
+            std::atomic<uint32_t> nodeCount;
+            std::atomic<int> maxDepth;
+        };
+
+        /**
+         * Acumula fn(result, first, last) sobre [first, last). Con trabajos y rangos grandes,
+         * cada bloque de kParallelGrain acumula en su copia y merge(result, copia) las une.
+         */
+        template<typename Result, typename Fn, typename Merge>
+        static void reduceBlocks(CJobSystem* jobs, size_t first, size_t last, Result& result, const Fn& fn,
+            const Merge& merge) {
+            size_t count = last - first;
+            if (jobs == nullptr || count <= kParallelGrain) {
+                fn(result, first, last);
+                return;
+            }
+            size_t blocks = (count + kParallelGrain - 1) / kParallelGrain;
+            std::vector<Result> partial(blocks);
+            jobs->parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+                for (size_t block = firstBlock; block < lastBlock; ++block) {
+                    size_t blockFirst = first + block * kParallelGrain;
+                    fn(partial[block], blockFirst, std::min(blockFirst + kParallelGrain, last));
+                }
+            });
+            for (const Result& block : partial) {
+                merge(result, block);
+            }
+        }
+
+        void buildHierarchy(CJobSystem* jobs) {
+            nodes.clear();
+            maxDepth = 0;
+            size_t count = triangles.size();
+            if (count == 0) {
+                return;
+            }
+            Builder builder;
+            builder.jobs = jobs;
+            builder.primitives.resize(count);
+            // Los hermanos empiezan en índice par: el par comparte línea de caché (el nodo 1 no se usa).
+            builder.nodeCount.store(2, std::memory_order_relaxed);
+            builder.maxDepth.store(0, std::memory_order_relaxed);
+            int unused = 0;
+            reduceBlocks(jobs, 0, count, unused, [&](int&, size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    Primitive& primitive = builder.primitives[i];
+                    primitive.box = triangleBox(triangles[i]);
+                    primitive.centroid = primitive.box.center();
+                    primitive.triangle = static_cast<uint32_t>(i);
+                }
+            }, [](int&, int) {});
+
+            // Una hoja por triángulo como máximo: 2n - 1 nodos más el hueco del índice 1.
+            nodes.resize(2 * count);
+            buildNode(builder, 0, 0, count, 0);
+            uint32_t used = builder.nodeCount.load(std::memory_order_relaxed);
+            nodes.resize(used == 2 ? 1 : used);
+            maxDepth = builder.maxDepth.load(std::memory_order_relaxed);
+
+            // Copiar los triángulos en el orden de las hojas.
+            std::vector<Triangle> sorted(count);
+            triangleIds.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                triangleIds[i] = builder.primitives[i].triangle;
+                sorted[i] = triangles[triangleIds[i]];
+            }
+            triangles.swap(sorted);
+        }
+
+        void buildNode(Builder& builder, uint32_t nodeIndex, size_t first, size_t last, int depth) {
+            const Primitive* primitives = builder.primitives.data();
+            RangeBounds range;
+            reduceBlocks(builder.jobs, first, last, range, [&](RangeBounds& result, size_t blockFirst, size_t blockLast) {
+                for (size_t i = blockFirst; i < blockLast; ++i) {
+                    grow(result.box, primitives[i].box);
+                    result.centroids.expand(primitives[i].centroid);
+                }
+            }, [](RangeBounds& result, const RangeBounds& block) {
+                grow(result.box, block.box);
+                grow(result.centroids, block.centroids);
+            });
+
+            Node& node = nodes[nodeIndex];
+            node.minX = range.box.min.x;
+            node.minY = range.box.min.y;
+            node.minZ = range.box.min.z;
+            node.maxX = range.box.max.x;
+            node.maxY = range.box.max.y;
+            node.maxZ = range.box.max.z;
+            size_t count = last - first;
+
+            size_t middle = first;
+            if (depth < kMaxSahDepth) {
+                middle = partitionSah(builder, first, last, range);
+            }
+            else if (count > kMaxLeafSize) {
+                middle = first + count / 2;
+            }
+            if (middle == first || middle == last) {
+                if (count <= kMaxLeafSize) {
+                    node.leftFirst = static_cast<uint32_t>(first);
+                    node.count = static_cast<uint32_t>(count);
+                    int previous = builder.maxDepth.load(std::memory_order_relaxed);
+                    while (previous < depth && !builder.maxDepth.compare_exchange_weak(previous, depth)) {
+                    }
+                    return;
+                }
+                // Centroides coincidentes y demasiados triángulos: partir por la mitad.
+                middle = first + count / 2;
+            }
+
+            uint32_t children = builder.nodeCount.fetch_add(2, std::memory_order_relaxed);
+            node.leftFirst = children;
+            node.count = 0;
+            if (builder.jobs != nullptr && count > kParallelGrain) {
+                CJobCounter counter;
+                builder.jobs->run([this, &builder, children, first, middle, depth]() {
+                    buildNode(builder, children, first, middle, depth + 1);
+                }, &counter);
+                buildNode(builder, children + 1, middle, last, depth + 1);
+                builder.jobs->wait(counter);
+            }
+            else {
+                buildNode(builder, children, first, middle, depth + 1);
+                buildNode(builder, children + 1, middle, last, depth + 1);
+            }
+        }
+
+        /**
+         * Busca el corte SAH de menor coste y reordena [first, last) según él.
+         *
+         * @return Inicio de la mitad derecha, o first si conviene una hoja o no hay corte.
+         */
+        size_t partitionSah(Builder& builder, size_t first, size_t last, const RangeBounds& range) {
+            size_t count = last - first;
+            if (count <= 1) {
+                return first;
+            }
+            // Con pocos triángulos, más cubetas que triángulos solo encarecen el barrido.
+            const int binCount = count < static_cast<size_t>(kBins) ? static_cast<int>(count) : kBins;
+            CVector3 origin = range.centroids.min;
+            CVector3 extent = range.centroids.size();
+            float scale[3];
+            for (int axis = 0; axis < 3; ++axis) {
+                scale[axis] = extent[axis] > 0.0f ? binCount / extent[axis] : 0.0f;
+            }
+            auto binOf = [&](const CVector3& centroid, int axis) {
+                int bin = static_cast<int>((centroid[axis] - origin[axis]) * scale[axis]);
+                return bin < binCount - 1 ? bin : binCount - 1;
+            };
+
+            const Primitive* primitives = builder.primitives.data();
+            BinSet bins;
+            reduceBlocks(builder.jobs, first, last, bins, [&](BinSet& result, size_t blockFirst, size_t blockLast) {
+                for (size_t i = blockFirst; i < blockLast; ++i) {
+                    const Primitive& primitive = primitives[i];
+                    for (int axis = 0; axis < 3; ++axis) {
+                        Bin& bin = result.bins[axis][binOf(primitive.centroid, axis)];
+                        grow(bin.box, primitive.box);
+                        ++bin.count;
+                    }
+                }
+            }, [&](BinSet& result, const BinSet& block) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (int b = 0; b < binCount; ++b) {
+                        grow(result.bins[axis][b].box, block.bins[axis][b].box);
+                        result.bins[axis][b].count += block.bins[axis][b].count;
+                    }
+                }
+            });
+
+            // Coste de cortar tras cada cubeta: barrido desde la derecha y luego desde la izquierda.
+            float bestCost = INFINITY;
+            int bestAxis = -1;
+            int bestSplit = 0;
+            for (int axis = 0; axis < 3; ++axis) {
+                if (scale[axis] == 0.0f) {
+                    continue;
+                }
+                const Bin* axisBins = bins.bins[axis];
+                float rightCost[kBins];
+                CAABB rightBox;
+                uint32_t rightCount = 0;
+                for (int b = binCount - 1; b > 0; --b) {
+                    grow(rightBox, axisBins[b].box);
+                    rightCount += axisBins[b].count;
+                    rightCost[b] = rightBox.surfaceArea() * rightCount;
+                }
+                CAABB leftBox;
+                uint32_t leftCount = 0;
+                for (int b = 0; b < binCount - 1; ++b) {
+                    grow(leftBox, axisBins[b].box);
+                    leftCount += axisBins[b].count;
+                    if (leftCount == 0 || leftCount == count) {
+                        continue;
+                    }
+                    float cost = leftBox.surfaceArea() * leftCount + rightCost[b + 1];
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = b + 1;
+                    }
+                }
+            }
+            if (bestAxis < 0) {
+                return first;
+            }
+            float area = range.box.surfaceArea();
+            float splitCost = area > 0.0f ? kTraversalCost + bestCost / area : kTraversalCost;
+            if (count <= kMaxLeafSize && splitCost >= static_cast<float>(count)) {
+                return first;
+            }
+
+            Primitive* begin = builder.primitives.data() + first;
+            Primitive* end = builder.primitives.data() + last;
+            Primitive* split = std::partition(begin, end, [&](const Primitive& primitive) {
+                return binOf(primitive.centroid, bestAxis) < bestSplit;
+            });
+            return first + static_cast<size_t>(split - begin);
+        }
+
+        /// Prueba de franjas contra la caja de un nodo; tEnter recibe la entrada.
+        static bool hitsNode(const Node& node, const CVector3& origin, const CVector3& inverse, float maxT, float& tEnter) {
+            float tx1 = (node.minX - origin.x) * inverse.x;
+            float tx2 = (node.maxX - origin.x) * inverse.x;
+            float ty1 = (node.minY - origin.y) * inverse.y;
+            float ty2 = (node.maxY - origin.y) * inverse.y;
+            float tz1 = (node.minZ - origin.z) * inverse.z;
+            float tz2 = (node.maxZ - origin.z) * inverse.z;
+            float tMin = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.0f));
+            float tMax = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::min(std::max(tz1, tz2), maxT));
+            tEnter = tMin;
+            return tMin <= tMax;
+        }
+
+        /// Möller-Trumbore por las dos caras; acepta t en [0, maxT).
+        static bool hitsTriangle(const Triangle& triangle, const CVector3& origin, const CVector3& direction, float maxT,
+            float& t, float& u, float& v) {
+            return intersectRayTriangleEdges(origin, direction, triangle.v0, triangle.edge1, triangle.edge2, maxT, t, u, v);
+        }
+
+        /// Recorrido de cerca a lejos; con AnyHit termina en el primer impacto.
+        template<bool AnyHit>
+        bool traverse(const CVector3& origin, const CVector3& direction, float maxT, CTriangleHit& hit) const {
+            if (nodes.empty()) {
+                return false;
+            }
+            const CVector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+            const Node* nodeData = nodes.data();
+            const Triangle* triangleData = triangles.data();
+            float closest = maxT;
+            bool found = false;
+            float tEnter = 0.0f;
+            if (!hitsNode(nodeData[0], origin, inverse, closest, tEnter)) {
+                return false;
+            }
+
+            // Pila de nodos pendientes con su distancia de entrada.
+            uint32_t stack[kStackSize];
+            float stackT[kStackSize];
+            int top = 0;
+            uint32_t index = 0;
+            for (;;) {
+                const Node& node = nodeData[index];
+                if (node.count > 0) {
+                    for (uint32_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                        float t, u, v;
+                        if (hitsTriangle(triangleData[i], origin, direction, closest, t, u, v)) {
+                            found = true;
+                            closest = t;
+                            hit.t = t;
+                            hit.u = u;
+                            hit.v = v;
+                            hit.triangle = triangleIds[i];
+                            if (AnyHit) {
+                                return true;
+                            }
+                        }
+                    }
+                }
+                else {
+                    uint32_t near = node.leftFirst;
+                    uint32_t far = near + 1;
+                    float tNear = 0.0f;
+                    float tFar = 0.0f;
+                    bool hitNear = hitsNode(nodeData[near], origin, inverse, closest, tNear);
+                    bool hitFar = hitsNode(nodeData[far], origin, inverse, closest, tFar);
+                    if (hitNear && hitFar) {
+                        if (tFar < tNear) {
+                            std::swap(near, far);
+                            std::swap(tNear, tFar);
+                        }
+                        stack[top] = far;
+                        stackT[top] = tFar;
+                        ++top;
+                        index = near;
+                        continue;
+                    }
+                    if (hitNear || hitFar) {
+                        index = hitNear ? near : far;
+                        continue;
+                    }
+                }
+                // Sacar el siguiente nodo que siga por delante del impacto más cercano.
+                do {
+                    if (top == 0) {
+                        return found;
+                    }
+                    --top;
+                } while (stackT[top] > closest);
+                index = stack[top];
+            }
+        }
+
+        std::vector<Node> nodes;           ///< Nodos; la raíz es el 0.
+        std::vector<Triangle> triangles;   ///< Triángulos en el orden de las hojas.
+        std::vector<uint32_t> triangleIds; ///< Índice original de cada triángulo de triangles.
+        int maxDepth;                      ///< Profundidad máxima de una hoja.
+    };
+
+}
@@ -0,0 +1,129 @@
+/**
+ * @file ConvexShapes.h
+ * @brief Formas convexas descritas por su función de soporte (esfera, cápsula, caja y envolvente).
+ * @author Hannin Abarca
+ *
+ * Cada forma es un núcleo más un margen: la forma real es el núcleo engordado margin() en
+ * todas direcciones (la esfera es un punto con margen y la cápsula un segmento). GJK trabaja
+ * con los núcleos, que tienen aristas vivas y convergen en pocas iteraciones, y resta los
+ * márgenes al final.
+ *
+ * Todas ofrecen:
+ *  - supportCore(d): un punto del núcleo que maximiza d · p (d no necesita ser unitario).
+ *  - margin(): el radio que se añade al núcleo.
+ *  - center(): un punto de referencia cerca del centro, para la primera dirección de búsqueda.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "../Vector/CQuaternion.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @struct CSphereShape
+     * @brief Esfera: un punto con margen.
+     */
+    struct CSphereShape {
+        CVector3 position; ///< Centro.
+        float radius;      ///< Radio.
+
+        CSphereShape(const CVector3& position, float radius) : position(position), radius(radius) {}
+
+        CVector3 supportCore(const CVector3&) const { return position; }
+        float margin() const { return radius; }
+        CVector3 center() const { return position; }
+    };
+
+    /**
+     * @struct CCapsuleShape
+     * @brief Cápsula: el segmento [start, end] con margen radius.
+     */
+    struct CCapsuleShape {
+        CVector3 start; ///< Centro de una semiesfera.
+        CVector3 end;   ///< Centro de la otra.
+        float radius;   ///< Radio.
+
+        CCapsuleShape(const CVector3& start, const CVector3& end, float radius) : start(start), end(end), radius(radius) {}
+
+        CVector3 supportCore(const CVector3& direction) const {
+            return direction.dot(end - start) >= 0.0f ? end : start;
+        }
+        float margin() const { return radius; }
+        CVector3 center() const { return (start + end) * 0.5f; }
+    };
+
+    /**
+     * @struct CBoxShape
+     * @brief Caja orientada: centro, rotación y semiejes.
+     *
+     * La rotación se convierte una sola vez en los tres ejes de la caja, así el soporte son
+     * tres productos escalares y una suma con signo.
+     */
+    struct CBoxShape {
+        CVector3 position;    ///< Centro.
+        CVector3 axes[3];     ///< Ejes locales x, y, z en el mundo (unitarios).
+        CVector3 halfExtents; ///< Semiejes a lo largo de cada eje.
+
+        CBoxShape(const CVector3& position, const CQuaternion& rotation, const CVector3& halfExtents)
+            : position(position), halfExtents(halfExtents) {
+            axes[0] = rotation.rotate(CVector3(1.0f, 0.0f, 0.0f));
+            axes[1] = rotation.rotate(CVector3(0.0f, 1.0f, 0.0f));
+            axes[2] = rotation.rotate(CVector3(0.0f, 0.0f, 1.0f));
+        }
+
+        CVector3 supportCore(const CVector3& direction) const {
+            CVector3 result = position;
+            for (int axis = 0; axis < 3; ++axis) {
+                float extent = direction.dot(axes[axis]) >= 0.0f ? halfExtents[axis] : -halfExtents[axis];
+                result += axes[axis] * extent;
+            }
+            return result;
+        }
+        float margin() const { return 0.0f; }
+        CVector3 center() const { return position; }
+    };
+
+    /**
+     * @struct CConvexHullShape
+     * @brief Envolvente convexa de una nube de puntos locales, colocada con posición y rotación.
+     *
+     * No copia los puntos: varias instancias (el mismo casco en distintos sitios) comparten el
+     * array, que debe seguir vivo mientras se usen. El soporte recorre todos los puntos, así que
+     * conviene pasar solo los vértices de la envolvente.
+     */
+    struct CConvexHullShape {
+        const CVector3* points; ///< Puntos en espacio local.
+        size_t count;           ///< Número de puntos (al menos uno).
+        CVector3 position;      ///< Traslación al mundo.
+        CVector3 axes[3];       ///< Ejes locales en el mundo.
+
+        CConvexHullShape(const CVector3* points, size_t count, const CVector3& position, const CQuaternion& rotation)
+            : points(points), count(count), position(position) {
+            axes[0] = rotation.rotate(CVector3(1.0f, 0.0f, 0.0f));
+            axes[1] = rotation.rotate(CVector3(0.0f, 1.0f, 0.0f));
+            axes[2] = rotation.rotate(CVector3(0.0f, 0.0f, 1.0f));
+        }
+
+        CVector3 supportCore(const CVector3& direction) const {
+            // La dirección pasa a espacio local una vez; después, un producto escalar por punto.
+            CVector3 local(direction.dot(axes[0]), direction.dot(axes[1]), direction.dot(axes[2]));
+            size_t best = 0;
+            float bestDot = points[0].dot(local);
+            for (size_t i = 1; i < count; ++i) {
+                float value = points[i].dot(local);
+                if (value > bestDot) {
+                    bestDot = value;
+                    best = i;
+                }
+            }
+            const CVector3& p = points[best];
+            return position + axes[0] * p.x + axes[1] * p.y + axes[2] * p.z;
+        }
+        float margin() const { return 0.0f; }
+        CVector3 center() const { return position; }
+    };
+
+}
@@ -0,0 +1,152 @@
+/**
+ * @file FrustumCulling.h
+ * @brief Descarte por frustum de arrays SoA de esferas y cajas, con SIMD y en paralelo.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "BoundsBatch.h"
+#include "CFrustum.h"
+#include "../Threading/CJobSystem.h"
+#include "../Utilities/Simd.h"
+
+namespace EngineUtilities {
+
+    /// Objetos por bloque del descarte paralelo (múltiplo de 8 para no partir paquetes).
+    const size_t kCullGrain = 16384;
+
+    /**
+     * @brief Escribe en visible los índices de las esferas de [first, last) que pueden verse.
+     *
+     * Mismo criterio que CFrustum::intersects(const CBoundingSphere&). Los índices se
+     * escriben compactados y en orden creciente.
+     *
+     * @param visible Destino; debe tener espacio para last - first índices.
+     * @return Número de índices escritos.
+     */
+    inline size_t cullSpheres(const CFrustum& frustum, const CBoundingSphereArray& spheres, size_t first, size_t last,
+        uint32_t* visible) {
+        // Copias locales: las escrituras en visible no deben obligar a recargar los planos.
+        const CFrustum f = frustum;
+        const float* centers[3] = { spheres.center(0), spheres.center(1), spheres.center(2) };
+        const float* radii = spheres.radius();
+        size_t count = 0;
+        simdForEach(first, last, [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            Pack cx = Pack::load(centers[0] + i);
+            Pack cy = Pack::load(centers[1] + i);
+            Pack cz = Pack::load(centers[2] + i);
+            Pack radius = Pack::load(radii + i);
+            Pack negativeRadius = Pack(0.0f) - radius;
+            auto mask = radius >= Pack(0.0f);
+            for (int p = 0; p < CFrustum::kPlaneCount; ++p) {
+                const CVector4& plane = f.planes[p];
+                Pack distance = Pack(plane.x) * cx + Pack(plane.y) * cy + Pack(plane.z) * cz + Pack(plane.w);
+                mask = mask & (distance >= negativeRadius);
+            }
+            count += simdAppendIndices(simdBits(mask), Pack::kWidth, static_cast<uint32_t>(i), visible + count);
+        });
+        return count;
+    }
+
+    /**
+     * @brief Escribe en visible los índices de las cajas de [first, last) que pueden verse.
+     *
+     * Mismo criterio que CFrustum::intersects(const CAABB&): por cada plano se prueba el
+     * vértice positivo, que con SoA es solo elegir el array de min o de max de cada eje
+     * según el signo de la normal.
+     *
+     * @param visible Destino; debe tener espacio para last - first índices.
+     * @return Número de índices escritos.
+     */
+    inline size_t cullAABBs(const CFrustum& frustum, const CAABBArray& boxes, size_t first, size_t last,
+        uint32_t* visible) {
+        const CFrustum f = frustum;
+        // Arrays del vértice positivo de cada plano.
+        const float* positive[CFrustum::kPlaneCount][3];
+        for (int p = 0; p < CFrustum::kPlaneCount; ++p) {
+            for (int axis = 0; axis < 3; ++axis) {
+                positive[p][axis] = f.planes[p][axis] >= 0.0f ? boxes.max(axis) : boxes.min(axis);
+            }
+        }
+        size_t count = 0;
+        simdForEach(first, last, [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            // Las cajas vacías de CAABB() (min = +inf, max = -inf) dan distancia -inf o NaN y se descartan.
+            auto mask = Pack(0.0f) <= Pack(0.0f);
+            for (int p = 0; p < CFrustum::kPlaneCount; ++p) {
+                const CVector4& plane = f.planes[p];
+                Pack distance = Pack(plane.x) * Pack::load(positive[p][0] + i) + Pack(plane.y) * Pack::load(positive[p][1] + i) +
+                    Pack(plane.z) * Pack::load(positive[p][2] + i) + Pack(plane.w);
+                mask = mask & (distance >= Pack(0.0f));
+            }
+            count += simdAppendIndices(simdBits(mask), Pack::kWidth, static_cast<uint32_t>(i), visible + count);
+        });
+        return count;
+    }
+
+    /// @brief cullSpheres() sobre todo el array.
+    inline size_t cullSpheres(const CFrustum& frustum, const CBoundingSphereArray& spheres, uint32_t* visible) {
+        return cullSpheres(frustum, spheres, 0, spheres.size(), visible);
+    }
+
+    /// @brief cullAABBs() sobre todo el array.
+    inline size_t cullAABBs(const CFrustum& frustum, const CAABBArray& boxes, uint32_t* visible) {
+        return cullAABBs(frustum, boxes, 0, boxes.size(), visible);
+    }
+
+    /**
+     * @brief Ejecuta cull(first, last, destino) por bloques de grain objetos en paralelo y
+     *        compacta los resultados.
+     *
+     * Cada bloque escribe sus índices al principio de su propia zona de visible (sin
+     * sincronización entre hilos) y al final se desplazan en orden para dejarlos contiguos,
+     * de modo que el resultado es idéntico al de la versión en serie.
+     *
+     * @return Número total de índices.
+     */
+    template<typename Cull>
+    inline size_t parallelCullBlocks(CJobSystem& jobs, size_t count, uint32_t* visible, size_t grain, const Cull& cull) {
+        grain = grain < 8 ? 8 : (grain + 7) / 8 * 8;
+        size_t blocks = (count + grain - 1) / grain;
+        if (blocks <= 1) {
+            return cull(0, count, visible);
+        }
+        std::vector<size_t> counts(blocks);
+        jobs.parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+            for (size_t block = firstBlock; block < lastBlock; ++block) {
+                size_t first = block * grain;
+                size_t last = first + grain < count ? first + grain : count;
+                counts[block] = cull(first, last, visible + first);
+            }
+        });
+        size_t total = counts[0];
+        for (size_t block = 1; block < blocks; ++block) {
+            std::memmove(visible + total, visible + block * grain, counts[block] * sizeof(uint32_t));
+            total += counts[block];
+        }
+        return total;
+    }
+
+    /// @brief cullSpheres() repartido entre los hilos de jobs (mismo resultado que en serie).
+    inline size_t parallelCullSpheres(CJobSystem& jobs, const CFrustum& frustum, const CBoundingSphereArray& spheres,
+        uint32_t* visible, size_t grain = kCullGrain) {
+        return parallelCullBlocks(jobs, spheres.size(), visible, grain, [&](size_t first, size_t last, uint32_t* out) {
+            return cullSpheres(frustum, spheres, first, last, out);
+        });
+    }
+
+    /// @brief cullAABBs() repartido entre los hilos de jobs (mismo resultado que en serie).
+    inline size_t parallelCullAABBs(CJobSystem& jobs, const CFrustum& frustum, const CAABBArray& boxes,
+        uint32_t* visible, size_t grain = kCullGrain) {
+        return parallelCullBlocks(jobs, boxes.size(), visible, grain, [&](size_t first, size_t last, uint32_t* out) {
+            return cullAABBs(frustum, boxes, first, last, out);
+        });
+    }
+
+}
@@ -0,0 +1,746 @@
+/**
+ * @file GJK.h
+ * @brief Colisión entre formas convexas: GJK para distancia e intersección y EPA para la penetración.
+ * @author Hannin Abarca
+ *
+ * GJK busca el punto de la diferencia de Minkowski A - B más cercano al origen usando solo las
+ * funciones de soporte de las formas (ConvexShapes.h): si el origen queda dentro, los núcleos se
+ * cortan; si no, la distancia al origen es la distancia entre núcleos y basta restar los
+ * márgenes. Cuando los núcleos se cortan, EPA expande el último símplex de GJK hasta encontrar
+ * la cara de la diferencia más cercana al origen, que da la dirección y la profundidad mínimas
+ * para separarlas (más los márgenes).
+ *
+ * CGjkCache guarda entre fotogramas, para cada par, el eje del último resultado y las
+ * direcciones del último símplex: con movimiento coherente el eje suele seguir separando (una
+ * sola llamada de soporte) y, si no, el símplex reconstruido arranca cerca de la solución.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "ConvexShapes.h"
+#include "../Utilities/Simd.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @struct CGjkCache
+     * @brief Estado de un par de formas que se conserva entre consultas (arranque en caliente).
+     */
+    struct CGjkCache {
+        CVector3 separatingAxis;  ///< Último punto más cercano de A - B (cero si los núcleos se cortaban).
+        CVector3 directions[4];   ///< Direcciones de soporte de los vértices del último símplex.
+        int count = 0;            ///< Vértices del último símplex; 0 si la caché está vacía.
+
+        /// @brief Olvida el par (por ejemplo, cuando una de las formas se teletransporta).
+        void reset() { count = 0; }
+    };
+
+    /**
+     * @struct CGjkResult
+     * @brief Distancia o penetración entre dos formas.
+     *
+     * Si distance < 0, trasladar B en -distance * normal deja las formas en contacto.
+     */
+    struct CGjkResult {
+        bool intersecting = false; ///< Las formas se tocan o se cortan.
+        float distance = 0.0f;     ///< Distancia entre las formas; negativa, profundidad de penetración.
+        CVector3 normal;           ///< Dirección unitaria de A hacia B.
+        CVector3 pointA;           ///< Punto de A más cercano a B (o más hundido en B).
+        CVector3 pointB;           ///< Punto de B más cercano a A (o más hundido en A).
+        int iterations = 0;        ///< Llamadas de soporte, contando GJK y EPA.
+    };
+
+    /**
+     * @class CGjkSolver
+     * @brief GJK y EPA sobre cualquier par de formas con supportCore(), margin() y center().
+     *
+     * El símplex sigue a Ericson (Real-Time Collision Detection, 9.5): el punto más cercano de
+     * cada segmento, triángulo o tetraedro se busca por regiones de Voronoi y el símplex se
+     * reduce a la cara que lo contiene; los coeficientes baricéntricos dan los puntos testigo en
+     * A y en B. Los símplex degenerados (vértices repetidos, triángulos o tetraedros planos) se
+     * resuelven con sus caras. EPA conserva sus arrays entre llamadas; un solver por hilo.
+     */
+    class CGjkSolver {
+    public:
+        static constexpr int kMaxIterations = 64;        ///< Tope de iteraciones de GJK.
+        static constexpr int kMaxEpaIterations = 64;     ///< Tope de vértices que añade EPA.
+        static constexpr float kRelativeTolerance = 1e-5f; ///< GJK para si |v|² no puede bajar más de esta fracción.
+        static constexpr float kOverlapTolerance = 1e-12f; ///< |v|² por debajo de esto (relativo al símplex) es contacto.
+        static constexpr float kEpaTolerance = 1e-5f;    ///< Avance mínimo de EPA, relativo al tamaño del politopo.
+
+        /**
+         * @brief Indica si las formas se cortan, sin calcular distancia ni puntos.
+         *
+         * Sale en cuanto una dirección demuestra que están separadas más que la suma de
+         * márgenes, así que los pares lejanos cuestan una o dos llamadas de soporte.
+         */
+        template<typename ShapeA, typename ShapeB>
+        bool overlap(const ShapeA& a, const ShapeB& b, CGjkCache* cache = nullptr) {
+            int iterations = 0;
+            const float separation = a.margin() + b.margin();
+            Status status = solve(a, b, cache, true, separation, iterations);
+            if (status == kSeparated) {
+                return false;
+            }
+            return status == kOverlap || closest.lengthSquare() <= separation * separation;
+        }
+
+        /**
+         * @brief Distancia entre las formas con GJK.
+         *
+         * Rellena result por completo si los núcleos no se cortan (también las penetraciones
+         * menores que los márgenes). Si los núcleos se cortan solo marca intersecting; para la
+         * profundidad, contact().
+         * @return true si las formas se tocan o se cortan.
+         */
+        template<typename ShapeA, typename ShapeB>
+        bool distance(const ShapeA& a, const ShapeB& b, CGjkResult& result, CGjkCache* cache = nullptr) {
+            computeDistance(a, b, result, cache);
+            return result.intersecting;
+        }
+
+        /**
+         * @brief Distancia o penetración: GJK y, si los núcleos se cortan, EPA.
+         * @return true si las formas se tocan o se cortan.
+         */
+        template<typename ShapeA, typename ShapeB>
+        bool contact(const ShapeA& a, const ShapeB& b, CGjkResult& result, CGjkCache* cache = nullptr) {
+            if (computeDistance(a, b, result, cache) == kOverlap) {
+                penetration(a, b, result);
+                if (cache != nullptr) {
+                    // Si el par se separa, la normal de la penetración es un buen primer eje.
+                    cache->separatingAxis = result.normal * -1.0f;
+                }
+            }
+            return result.intersecting;
+        }
+
+    private:
+        enum Status {
+            kSeparated, ///< Una dirección demuestra que están separadas (solo con salida temprana).
+            kConverged, ///< closest es el punto de A - B (núcleos) más cercano al origen.
+            kOverlap    ///< El origen está dentro de A - B: los núcleos se cortan.
+        };
+
+        /// Punto de soporte de A - B en una dirección, con los puntos de A y B que lo forman.
+        struct Vertex {
+            CVector3 w;         ///< a - b.
+            CVector3 a;         ///< Soporte de A en direction.
+            CVector3 b;         ///< Soporte de B en -direction.
+            CVector3 direction; ///< Dirección que lo generó (para la caché).
+        };
+
+        /// Resultado de buscar el punto más cercano de un sub-símplex.
+        struct Reduction {
+            int indices[4] = {};
+            float lambda[4] = {};
+            int count = 0;
+            CVector3 point;
+        };
+
+        /// Cara triangular del politopo de EPA, con la normal hacia fuera.
+        struct Face {
+            uint32_t v[3] = {};
+            CVector3 normal;
+            float distance = FLT_MAX; ///< Distancia del origen al plano; FLT_MAX si la cara es degenerada.
+            bool alive = false;
+        };
+
+        static constexpr float kDegenerate = 1e-10f; ///< Seno² del ángulo bajo el que un triángulo o tetraedro es plano.
+
+        Vertex simplex[4];
+        float lambda[4] = {};
+        int count = 0;
+        CVector3 closest; ///< Punto más cercano al origen del símplex actual.
+
+        std::vector<Vertex> vertices;                    ///< Vértices del politopo de EPA.
+        std::vector<Face> faces;                         ///< Caras del politopo (las muertas se reutilizan).
+        std::vector<std::pair<uint32_t, uint32_t>> edges; ///< Horizonte de cada expansión.
+
+        static float squareRoot(float value) { return simdSqrt(CFloat1(value)).v; }
+
+        template<typename ShapeA, typename ShapeB>
+        static Vertex support(const ShapeA& a, const ShapeB& b, const CVector3& direction) {
+            Vertex vertex;
+            vertex.direction = direction;
+            vertex.a = a.supportCore(direction);
+            vertex.b = b.supportCore(direction * -1.0f);
+            vertex.w = vertex.a - vertex.b;
+            return vertex;
+        }
+
+        bool contains(const CVector3& w) const {
+            for (int i = 0; i < count; ++i) {
+                const CVector3& s = simplex[i].w;
+                if (s.x == w.x && s.y == w.y && s.z == w.z) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Arranca GJK (en caliente si hay caché) e itera. Con earlyOut, sale con kSeparated en
+         * cuanto la cota inferior de la distancia entre núcleos supera separation.
+         */
+        template<typename ShapeA, typename ShapeB>
+        Status solve(const ShapeA& a, const ShapeB& b, CGjkCache* cache, bool earlyOut, float separation, int& iterations) {
+            const bool warm = cache != nullptr && cache->count > 0;
+            if (earlyOut && warm) {
+                const CVector3& axis = cache->separatingAxis;
+                float axisSquared = axis.lengthSquare();
+                if (axisSquared > 0.0f) {
+                    Vertex vertex = support(a, b, axis * -1.0f);
+                    ++iterations;
+                    float projection = axis.dot(vertex.w);
+                    if (projection > 0.0f && projection * projection > separation * separation * axisSquared) {
+                        return kSeparated;
+                    }
+                }
+            }
+
+            count = 0;
+            if (warm) {
+                for (int i = 0; i < cache->count; ++i) {
+                    Vertex vertex = support(a, b, cache->directions[i]);
+                    ++iterations;
+                    if (!contains(vertex.w)) {
+                        simplex[count++] = vertex;
+                    }
+                }
+            }
+            else {
+                CVector3 direction = b.center() - a.center();
+                if (direction.lengthSquare() == 0.0f) {
+                    direction = CVector3(1.0f, 0.0f, 0.0f);
+                }
+                simplex[count++] = support(a, b, direction);
+                ++iterations;
+            }
+
+            Status status = iterate(a, b, earlyOut, separation, iterations);
+            if (cache != nullptr) {
+                cache->count = count;
+                for (int i = 0; i < count; ++i) {
+                    cache->directions[i] = simplex[i].direction;
+                }
+                cache->separatingAxis = status == kOverlap ? CVector3() : closest;
+            }
+            return status;
+        }
+
+        template<typename ShapeA, typename ShapeB>
+        Status iterate(const ShapeA& a, const ShapeB& b, bool earlyOut, float separation, int& iterations) {
+            if (!reduce()) {
+                return kOverlap;
+            }
+            float closestSquared = closest.lengthSquare();
+            for (int step = 0; step < kMaxIterations; ++step) {
+                float scaleSquared = 0.0f;
+                for (int i = 0; i < count; ++i) {
+                    scaleSquared = std::max(scaleSquared, simplex[i].w.lengthSquare());
+                }
+                if (closestSquared <= kOverlapTolerance * scaleSquared) {
+                    return kOverlap;
+                }
+                Vertex vertex = support(a, b, closest * -1.0f);
+                ++iterations;
+                float projection = closest.dot(vertex.w);
+                if (earlyOut && projection > 0.0f && projection * projection > separation * separation * closestSquared) {
+                    return kSeparated;
+                }
+                // Ni el nuevo vértice acerca v al origen lo bastante, ni es nuevo: v es el mínimo.
+                if (closestSquared - projection <= kRelativeTolerance * closestSquared || contains(vertex.w)) {
+                    return kConverged;
+                }
+                simplex[count++] = vertex;
+                if (!reduce()) {
+                    return kOverlap;
+                }
+                float reducedSquared = closest.lengthSquare();
+                if (reducedSquared >= closestSquared) {
+                    // Sin progreso por redondeo: el punto actual es tan bueno como el anterior.
+                    return kConverged;
+                }
+                closestSquared = reducedSquared;
+            }
+            return kConverged;
+        }
+
+        /// Reduce el símplex a la cara con el punto más cercano al origen; false si lo contiene.
+        bool reduce() {
+            Reduction reduction;
+            switch (count) {
+            case 1: reducePoint(0, reduction); break;
+            case 2: reduceSegment(0, 1, reduction); break;
+            case 3: reduceTriangle(0, 1, 2, reduction); break;
+            default:
+                if (!reduceTetrahedron(reduction)) {
+                    return false;
+                }
+                break;
+            }
+            Vertex kept[4];
+            for (int i = 0; i < reduction.count; ++i) {
+                kept[i] = simplex[reduction.indices[i]];
+            }
+            for (int i = 0; i < reduction.count; ++i) {
+                simplex[i] = kept[i];
+                lambda[i] = reduction.lambda[i];
+            }
+            count = reduction.count;
+            closest = reduction.point;
+            return true;
+        }
+
+        void reducePoint(int i, Reduction& reduction) const {
+            reduction.count = 1;
+            reduction.indices[0] = i;
+            reduction.lambda[0] = 1.0f;
+            reduction.point = simplex[i].w;
+        }
+
+        void reduceSegment(int i, int j, Reduction& reduction) const {
+            const CVector3& a = simplex[i].w;
+            CVector3 ab = simplex[j].w - a;
+            float t = -a.dot(ab);
+            float denominator = ab.lengthSquare();
+            if (t <= 0.0f) {
+                reducePoint(i, reduction);
+                return;
+            }
+            if (t >= denominator) {
+                reducePoint(j, reduction);
+                return;
+            }
+            t /= denominator;
+            reduction.count = 2;
+            reduction.indices[0] = i;
+            reduction.indices[1] = j;
+            reduction.lambda[0] = 1.0f - t;
+            reduction.lambda[1] = t;
+            reduction.point = a + ab * t;
+        }
+
+        /// Ericson 5.1.5 con el origen como punto de consulta.
+        void reduceTriangle(int i, int j, int k, Reduction& reduction) const {
+            const CVector3& a = simplex[i].w;
+            const CVector3& b = simplex[j].w;
+            const CVector3& c = simplex[k].w;
+            CVector3 ab = b - a;
+            CVector3 ac = c - a;
+            if (ab.cross(ac).lengthSquare() <= kDegenerate * ab.lengthSquare() * ac.lengthSquare()) {
+                int segments[3][2] = { { i, j }, { i, k }, { j, k } };
+                bestOfSegments(segments, reduction);
+                return;
+            }
+
+            float d1 = -ab.dot(a);
+            float d2 = -ac.dot(a);
+            if (d1 <= 0.0f && d2 <= 0.0f) {
+                reducePoint(i, reduction);
+                return;
+            }
+            float d3 = -ab.dot(b);
+            float d4 = -ac.dot(b);
+            if (d3 >= 0.0f && d4 <= d3) {
+                reducePoint(j, reduction);
+                return;
+            }
+            float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+                setEdge(i, j, d1 / (d1 - d3), reduction);
+                return;
+            }
+            float d5 = -ab.dot(c);
+            float d6 = -ac.dot(c);
+            if (d6 >= 0.0f && d5 <= d6) {
+                reducePoint(k, reduction);
+                return;
+            }
+            float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+                setEdge(i, k, d2 / (d2 - d6), reduction);
+                return;
+            }
+            float va = d3 * d6 - d5 * d4;
+            if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+                setEdge(j, k, (d4 - d3) / ((d4 - d3) + (d5 - d6)), reduction);
+                return;
+            }
+            float inverse = 1.0f / (va + vb + vc);
+            float v = vb * inverse;
+            float w = vc * inverse;
+            reduction.count = 3;
+            reduction.indices[0] = i;
+            reduction.indices[1] = j;
+            reduction.indices[2] = k;
+            reduction.lambda[0] = 1.0f - v - w;
+            reduction.lambda[1] = v;
+            reduction.lambda[2] = w;
+            // Dentro de la cara el punto se proyecta por la normal: con el origen muy cerca del
+            // plano, combinar los vértices con las baricéntricas pierde la dirección al redondear.
+            CVector3 normal = ab.cross(ac);
+            reduction.point = normal * (normal.dot(a) / normal.lengthSquare());
+        }
+
+        void setEdge(int i, int j, float t, Reduction& reduction) const {
+            reduction.count = 2;
+            reduction.indices[0] = i;
+            reduction.indices[1] = j;
+            reduction.lambda[0] = 1.0f - t;
+            reduction.lambda[1] = t;
+            reduction.point = simplex[i].w + (simplex[j].w - simplex[i].w) * t;
+        }
+
+        void bestOfSegments(const int (&segments)[3][2], Reduction& reduction) const {
+            float best = FLT_MAX;
+            for (const auto& segment : segments) {
+                Reduction candidate;
+                reduceSegment(segment[0], segment[1], candidate);
+                float distanceSquared = candidate.point.lengthSquare();
+                if (distanceSquared < best) {
+                    best = distanceSquared;
+                    reduction = candidate;
+                }
+            }
+        }
+
+        /// Ericson 5.1.6: solo se miran las caras que dejan el origen fuera.
+        bool reduceTetrahedron(Reduction& reduction) const {
+            static const int kFaces[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+            bool outside[4];
+            bool flat = false;
+            bool anyOutside = false;
+            for (int f = 0; f < 4; ++f) {
+                const CVector3& a = simplex[kFaces[f][0]].w;
+                CVector3 normal = (simplex[kFaces[f][1]].w - a).cross(simplex[kFaces[f][2]].w - a);
+                CVector3 toOpposite = simplex[kFaces[f][3]].w - a;
+                float signOpposite = normal.dot(toOpposite);
+                float signOrigin = -normal.dot(a);
+                flat = flat || signOpposite * signOpposite <= kDegenerate * normal.lengthSquare() * toOpposite.lengthSquare();
+                outside[f] = signOrigin * signOpposite < 0.0f;
+                anyOutside = anyOutside || outside[f];
+            }
+            if (!flat && !anyOutside) {
+                return false;
+            }
+            // Un tetraedro plano no separa dentro y fuera: se prueban todas sus caras.
+            float best = FLT_MAX;
+            for (int f = 0; f < 4; ++f) {
+                if (!flat && !outside[f]) {
+                    continue;
+                }
+                Reduction candidate;
+                reduceTriangle(kFaces[f][0], kFaces[f][1], kFaces[f][2], candidate);
+                float distanceSquared = candidate.point.lengthSquare();
+                if (distanceSquared < best) {
+                    best = distanceSquared;
+                    reduction = candidate;
+                }
+            }
+            return true;
+        }
+
+        void witnesses(CVector3& pointA, CVector3& pointB) const {
+            pointA = CVector3();
+            pointB = CVector3();
+            for (int i = 0; i < count; ++i) {
+                pointA += simplex[i].a * lambda[i];
+                pointB += simplex[i].b * lambda[i];
+            }
+        }
+
+        /// GJK sin salida temprana; rellena result salvo cuando los núcleos se cortan.
+        template<typename ShapeA, typename ShapeB>
+        Status computeDistance(const ShapeA& a, const ShapeB& b, CGjkResult& result, CGjkCache* cache) {
+            result = CGjkResult();
+            Status status = solve(a, b, cache, false, 0.0f, result.iterations);
+            if (status == kOverlap) {
+                result.intersecting = true;
+                return status;
+            }
+            CVector3 pointA;
+            CVector3 pointB;
+            witnesses(pointA, pointB);
+            float coreDistance = squareRoot(closest.lengthSquare());
+            // closest = pointA - pointB, así que la normal de A hacia B es -closest.
+            result.normal = closest * (-1.0f / coreDistance);
+            result.distance = coreDistance - a.margin() - b.margin();
+            result.pointA = pointA + result.normal * a.margin();
+            result.pointB = pointB - result.normal * b.margin();
+            result.intersecting = result.distance <= 0.0f;
+            return status;
+        }
+
+        /// EPA sobre los núcleos; los márgenes se suman a la profundidad al final.
+        template<typename ShapeA, typename ShapeB>
+        void penetration(const ShapeA& a, const ShapeB& b, CGjkResult& result) {
+            CVector3 pointA;
+            CVector3 pointB;
+            witnesses(pointA, pointB);
+            vertices.assign(simplex, simplex + count);
+            CVector3 flatNormal;
+            if (!inflate(a, b, result.iterations, flatNormal)) {
+                // A - B no tiene volumen (núcleos punto o segmento): la profundidad es solo la
+                // de los márgenes, en la dirección en la que la diferencia es plana.
+                if (!(flatNormal.lengthSquare() > 0.5f)) {
+                    // Sin dirección fiable (desbordamiento con formas enormes).
+                    axisPenetration(a, b, result);
+                    return;
+                }
+                setPenetration(a, b, flatNormal, 0.0f, pointA, pointB, result);
+                return;
+            }
+
+            float scaleSquared = 0.0f;
+            for (const Vertex& vertex : vertices) {
+                scaleSquared = std::max(scaleSquared, vertex.w.lengthSquare());
+            }
+            const float tolerance = kEpaTolerance * squareRoot(scaleSquared);
+            const CVector3& v0 = vertices[0].w;
+            if ((vertices[1].w - v0).cross(vertices[2].w - v0).dot(vertices[3].w - v0) > 0.0f) {
+                std::swap(vertices[1], vertices[2]);
+            }
+            faces.clear();
+            addFace(0, 1, 2);
+            addFace(0, 3, 1);
+            addFace(0, 2, 3);
+            addFace(1, 3, 2);
+
+            Face closestFace;
+            for (int step = 0; step < kMaxEpaIterations; ++step) {
+                int best = -1;
+                float bestDistance = FLT_MAX;
+                for (size_t f = 0; f < faces.size(); ++f) {
+                    if (faces[f].alive && faces[f].distance < bestDistance) {
+                        bestDistance = faces[f].distance;
+                        best = static_cast<int>(f);
+                    }
+                }
+                if (best < 0) {
+                    break;
+                }
+                closestFace = faces[best];
+                Vertex vertex = support(a, b, closestFace.normal);
+                ++result.iterations;
+                if (closestFace.normal.dot(vertex.w) - closestFace.distance <= tolerance) {
+                    break;
+                }
+
+                // Quitar las caras que ve el nuevo vértice y coser su horizonte a él.
+                const uint32_t index = static_cast<uint32_t>(vertices.size());
+                vertices.push_back(vertex);
+                edges.clear();
+                for (Face& face : faces) {
+                    if (face.alive && face.normal.dot(vertex.w - vertices[face.v[0]].w) > 0.0f) {
+                        face.alive = false;
+                        for (int e = 0; e < 3; ++e) {
+                            addEdge(face.v[e], face.v[(e + 1) % 3]);
+                        }
+                    }
+                }
+                for (const auto& edge : edges) {
+                    addFace(edge.first, edge.second, index);
+                }
+            }
+
+            // Si se agotan las iteraciones, closestFace es la mejor cara hallada hasta entonces.
+            if (closestFace.distance == FLT_MAX) {
+                // Ninguna cara tuvo normal válida: flatNormal no está definida aquí.
+                axisPenetration(a, b, result);
+                return;
+            }
+            // Puntos testigo: baricéntricas de la proyección del origen sobre la cara.
+            const Vertex& t0 = vertices[closestFace.v[0]];
+            const Vertex& t1 = vertices[closestFace.v[1]];
+            const Vertex& t2 = vertices[closestFace.v[2]];
+            CVector3 e1 = t1.w - t0.w;
+            CVector3 e2 = t2.w - t0.w;
+            CVector3 toPoint = closestFace.normal * closestFace.distance - t0.w;
+            float d11 = e1.dot(e1);
+            float d12 = e1.dot(e2);
+            float d22 = e2.dot(e2);
+            float dp1 = toPoint.dot(e1);
+            float dp2 = toPoint.dot(e2);
+            float inverse = 1.0f / (d11 * d22 - d12 * d12);
+            float v = (d22 * dp1 - d12 * dp2) * inverse;
+            float w = (d11 * dp2 - d12 * dp1) * inverse;
+            float u = 1.0f - v - w;
+            pointA = t0.a * u + t1.a * v + t2.a * w;
+            pointB = t0.b * u + t1.b * v + t2.b * w;
+            float depth = std::max(closestFace.distance, 0.0f);
+            setPenetration(a, b, closestFace.normal, depth, pointA, pointB, result);
+        }
+
+        /**
+         * Penetración aproximada cuando EPA no tiene ninguna cara con normal válida: de los seis
+         * semiejes, aquel en el que A - B llega antes a su borde desde el origen.
+         */
+        template<typename ShapeA, typename ShapeB>
+        void axisPenetration(const ShapeA& a, const ShapeB& b, CGjkResult& result) {
+            Vertex best;
+            CVector3 bestAxis;
+            float bestDepth = FLT_MAX;
+            for (int i = 0; i < 6; ++i) {
+                CVector3 axis;
+                axis[i / 2] = i % 2 == 0 ? 1.0f : -1.0f;
+                Vertex vertex = support(a, b, axis);
+                ++result.iterations;
+                float depth = axis.dot(vertex.w);
+                if (depth < bestDepth) {
+                    bestDepth = depth;
+                    bestAxis = axis;
+                    best = vertex;
+                }
+            }
+            setPenetration(a, b, bestAxis, std::max(bestDepth, 0.0f), best.a, best.b, result);
+        }
+
+        /**
+         * Completa el símplex de GJK hasta un tetraedro con volumen, buscando soportes fuera de
+         * su punto, recta o plano. Si A - B no tiene volumen, devuelve false y en flatNormal una
+         * dirección en la que su grosor es nulo (orientada de A hacia B).
+         */
+        template<typename ShapeA, typename ShapeB>
+        bool inflate(const ShapeA& a, const ShapeB& b, int& iterations, CVector3& flatNormal) {
+            static const CVector3 kAxes[3] = { CVector3(1.0f, 0.0f, 0.0f), CVector3(0.0f, 1.0f, 0.0f), CVector3(0.0f, 0.0f, 1.0f) };
+            CVector3 towardB = b.center() - a.center();
+            float scaleSquared = 0.0f;
+            for (const Vertex& vertex : vertices) {
+                scaleSquared = std::max(scaleSquared, vertex.w.lengthSquare());
+            }
+            auto accept = [&](const Vertex& vertex, float distanceSquared) {
+                scaleSquared = std::max(scaleSquared, vertex.w.lengthSquare());
+                if (distanceSquared <= kDegenerate * scaleSquared) {
+                    return false;
+                }
+                vertices.push_back(vertex);
+                return true;
+            };
+
+            if (vertices.size() == 1) {
+                for (int i = 0; i < 6 && vertices.size() == 1; ++i) {
+                    Vertex vertex = support(a, b, kAxes[i / 2] * (i % 2 == 0 ? 1.0f : -1.0f));
+                    ++iterations;
+                    accept(vertex, (vertex.w - vertices[0].w).lengthSquare());
+                }
+                if (vertices.size() == 1) {
+                    flatNormal = towardB.lengthSquare() > 0.0f ? towardB : kAxes[0];
+                    flatNormal = flatNormal * (1.0f / squareRoot(flatNormal.lengthSquare()));
+                    return false;
+                }
+            }
+            if (vertices.size() == 2) {
+                CVector3 edge = vertices[1].w - vertices[0].w;
+                int axis = 0;
+                for (int i = 1; i < 3; ++i) {
+                    if (edge[i] * edge[i] < edge[axis] * edge[axis]) {
+                        axis = i;
+                    }
+                }
+                CVector3 side = edge.cross(kAxes[axis]);
+                for (int i = 0; i < 4 && vertices.size() == 2; ++i) {
+                    Vertex vertex = support(a, b, side);
+                    ++iterations;
+                    CVector3 offset = (vertex.w - vertices[0].w).cross(edge);
+                    accept(vertex, offset.lengthSquare() / edge.lengthSquare());
+                    // Girar 90 grados alrededor de la arista (y renormalizar la escala).
+                    side = edge.cross(side);
+                    side = side * (1.0f / squareRoot(side.lengthSquare()));
+                }
+                if (vertices.size() == 2) {
+                    // Segmento: cualquier perpendicular vale; se prefiere la que apunta hacia B.
+                    CVector3 perpendicular = towardB - edge * (towardB.dot(edge) / edge.lengthSquare());
+                    flatNormal = perpendicular.lengthSquare() > kDegenerate * towardB.lengthSquare() && perpendicular.lengthSquare() > 0.0f
+                        ? perpendicular : side;
+                    flatNormal = flatNormal * (1.0f / squareRoot(flatNormal.lengthSquare()));
+                    return false;
+                }
+            }
+            if (vertices.size() == 3) {
+                CVector3 normal = (vertices[1].w - vertices[0].w).cross(vertices[2].w - vertices[0].w);
+                float normalSquared = normal.lengthSquare();
+                for (int i = 0; i < 2 && vertices.size() == 3; ++i) {
+                    Vertex vertex = support(a, b, normal * (i == 0 ? 1.0f : -1.0f));
+                    ++iterations;
+                    float offset = normal.dot(vertex.w - vertices[0].w);
+                    accept(vertex, offset * offset / normalSquared);
+                }
+                if (vertices.size() == 3) {
+                    flatNormal = normal;
+                    if (normalizeScaled(flatNormal) && flatNormal.dot(towardB) < 0.0f) {
+                        flatNormal = flatNormal * -1.0f;
+                    }
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void addFace(uint32_t i, uint32_t j, uint32_t k) {
+            Face face;
+            face.v[0] = i;
+            face.v[1] = j;
+            face.v[2] = k;
+            face.alive = true;
+            CVector3 normal = (vertices[j].w - vertices[i].w).cross(vertices[k].w - vertices[i].w);
+            if (normalizeScaled(normal)) {
+                face.normal = normal;
+                face.distance = face.normal.dot(vertices[i].w);
+            }
+            // Reutilizar el hueco de una cara muerta si lo hay.
+            for (Face& slot : faces) {
+                if (!slot.alive) {
+                    slot = face;
+                    return;
+                }
+            }
+            faces.push_back(face);
+        }
+
+        /**
+         * Normaliza v reescalándolo primero: con coordenadas de ~1e10 el cuadrado de un producto
+         * vectorial ya desborda y la normal saldría nula. Devuelve false si v es nulo o no finito.
+         */
+        static bool normalizeScaled(CVector3& v) {
+            float largest = std::max(std::fabs(v.x), std::max(std::fabs(v.y), std::fabs(v.z)));
+            if (!(largest >= FLT_MIN && largest <= FLT_MAX)) {
+                return false;
+            }
+            v = v * (1.0f / largest);
+            v = v * (1.0f / squareRoot(v.lengthSquare()));
+            return true;
+        }
+
+        /// Una arista compartida por dos caras visibles no es horizonte: se cancela.
+        void addEdge(uint32_t from, uint32_t to) {
+            for (size_t e = 0; e < edges.size(); ++e) {
+                if (edges[e].first == to && edges[e].second == from) {
+                    edges[e] = edges.back();
+                    edges.pop_back();
+                    return;
+                }
+            }
+            edges.emplace_back(from, to);
+        }
+
+        template<typename ShapeA, typename ShapeB>
+        static void setPenetration(const ShapeA& a, const ShapeB& b, const CVector3& normal, float coreDepth,
+            const CVector3& pointA, const CVector3& pointB, CGjkResult& result) {
+            result.intersecting = true;
+            result.normal = normal;
+            result.distance = -(coreDepth + a.margin() + b.margin());
+            result.pointA = pointA + normal * a.margin();
+            result.pointB = pointB - normal * b.margin();
+        }
+    };
+
+}
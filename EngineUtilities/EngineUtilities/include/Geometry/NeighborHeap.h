@@ -0,0 +1,76 @@
+/**
+ * @file NeighborHeap.h
+ * @brief Montículo de máximos por distancia para las búsquedas de los k vecinos más cercanos.
+ * @author Hannin Abarca
+ *
+ * Lo comparten CKdTree y TSpatialHashGrid: guardan los k mejores candidatos en dos arrays
+ * paralelos (índices y distancias al cuadrado) con el más lejano en la raíz, de modo que
+ * descartar el peor cuando llega uno mejor cuesta O(log k).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace EngineUtilities {
+
+    namespace detail {
+
+        /// Inserta en el montículo de máximos (por distancia) de size elementos.
+        inline void pushHeap(uint32_t* indices, float* distances, size_t size, uint32_t index, float distance) {
+            size_t child = size;
+            while (child > 0) {
+                size_t parent = (child - 1) / 2;
+                if (distances[parent] >= distance) {
+                    break;
+                }
+                indices[child] = indices[parent];
+                distances[child] = distances[parent];
+                child = parent;
+            }
+            indices[child] = index;
+            distances[child] = distance;
+        }
+
+        /// Mueve el máximo del montículo de size elementos a la posición size - 1.
+        inline void popHeap(uint32_t* indices, float* distances, size_t size) {
+            uint32_t topIndex = indices[0];
+            float topDistance = distances[0];
+            uint32_t lastIndex = indices[size - 1];
+            float lastDistance = distances[size - 1];
+            size_t heapSize = size - 1;
+            size_t parent = 0;
+            for (;;) {
+                size_t child = 2 * parent + 1;
+                if (child >= heapSize) {
+                    break;
+                }
+                if (child + 1 < heapSize && distances[child + 1] > distances[child]) {
+                    ++child;
+                }
+                if (distances[child] <= lastDistance) {
+                    break;
+                }
+                indices[parent] = indices[child];
+                distances[parent] = distances[child];
+                parent = child;
+            }
+            if (heapSize > 0) {
+                indices[parent] = lastIndex;
+                distances[parent] = lastDistance;
+            }
+            indices[size - 1] = topIndex;
+            distances[size - 1] = topDistance;
+        }
+
+        /// Ordenación por montículo: el mayor va al final en cada paso (queda de menor a mayor).
+        inline void sortHeap(uint32_t* indices, float* distances, size_t size) {
+            for (size_t heapSize = size; heapSize > 1; --heapSize) {
+                popHeap(indices, distances, heapSize);
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,607 @@
+/**
+ * @file RayIntersection.h
+ * @brief Intersección de rayos y segmentos con cajas, esferas, planos y triángulos, en escalar y por paquetes.
+ * @author Hannin Abarca
+ *
+ * Todas las funciones aceptan impactos con t en [0, maxT) sobre origin + t * direction (las
+ * de caja, en [0, maxT], como CAABB::intersectsRay) y no exigen una dirección normalizada.
+ * Los triángulos se prueban por las dos caras.
+ *
+ * Las versiones por paquetes prueban kWidth rayos a la vez (4 con SSE, 8 con AVX) contra una
+ * misma primitiva: TRayPacket carga los rayos de un CRayArray (SoA) y precalcula lo que no
+ * depende de la primitiva, de modo que un paquete se prueba contra muchas primitivas seguidas.
+ * Devuelven los bits de simdBits() de los carriles con impacto.
+ */
+
+#pragma once
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CAABB.h"
+#include "CBoundingSphere.h"
+#include "../Utilities/Simd.h"
+#include "../Vector/CVector3.h"
+#include "../Vector/CVector4.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @struct CTriangleHit
+     * @brief Resultado de una consulta de rayo contra triángulos.
+     */
+    struct CTriangleHit {
+        float t = 0.0f;        ///< Parámetro del impacto: origin + t * direction.
+        float u = 0.0f;        ///< Coordenada baricéntrica del vértice 1.
+        float v = 0.0f;        ///< Coordenada baricéntrica del vértice 2.
+        uint32_t triangle = 0; ///< Índice del triángulo en la malla original.
+    };
+
+    /// Factor de la salida de cada franja, 1 + 2 * gamma(3) (Ize, 2013): sin él, el redondeo
+    /// hace fallar a rayos que recorren una cara de la caja.
+    const float kSlabExitScale = 1.0000004f;
+
+    /// Determinante por debajo del cual Möller-Trumbore da el rayo por paralelo al triángulo.
+    const float kParallelDeterminant = 1e-12f;
+
+    /// Cota relativa del error de a * b - c * d en float (con o sin FMA); por debajo, el signo
+    /// de una función de arista no es fiable y el paquete repite el carril en escalar.
+    const float kEdgeFunctionError = 4.8e-7f;
+
+    /// Límite que acepta t = 1 en las pruebas de segmentos (el float siguiente a 1).
+    const float kSegmentEnd = 1.0f + FLT_EPSILON;
+
+    /**
+     * @brief Prueba de franjas de un rayo contra una caja.
+     *
+     * Los planos de entrada y salida de cada eje se eligen por el signo de la inversa. Así un
+     * eje con dirección 0 (inversa infinita) solo da NaN si el origen está sobre una cara, y el
+     * NaN se ignora: el rayo que recorre una cara cuenta como dentro.
+     *
+     * @param inverseDirection 1 / direction por componente.
+     * @param tEnter Recibe la entrada (0 si el origen está dentro).
+     * @param tExit Recibe la salida.
+     */
+    inline bool intersectRayAABB(const CVector3& origin, const CVector3& inverseDirection, const CAABB& box, float maxT,
+        float& tEnter, float& tExit) {
+        float tMin = 0.0f;
+        float tMax = maxT;
+        for (int axis = 0; axis < 3; ++axis) {
+            bool negative = inverseDirection[axis] < 0.0f;
+            float nearPlane = negative ? box.max[axis] : box.min[axis];
+            float farPlane = negative ? box.min[axis] : box.max[axis];
+            float tNear = (nearPlane - origin[axis]) * inverseDirection[axis];
+            float tFar = (farPlane - origin[axis]) * inverseDirection[axis] * kSlabExitScale;
+            tMin = tNear > tMin ? tNear : tMin;
+            tMax = tFar < tMax ? tFar : tMax;
+        }
+        tEnter = tMin;
+        tExit = tMax;
+        return tMin <= tMax;
+    }
+
+    /**
+     * @brief Primer punto de una esfera alcanzado por el rayo (la salida si el origen está dentro).
+     *
+     * El discriminante se calcula a partir del punto del rayo más cercano al centro (Haines y
+     * otros, Ray Tracing Gems, cap. 7), que no pierde precisión con esferas pequeñas y lejanas,
+     * y las raíces con la fórmula que evita restar dos valores parecidos.
+     */
+    inline bool intersectRaySphere(const CVector3& origin, const CVector3& direction, const CBoundingSphere& sphere,
+        float maxT, float& t) {
+        if (sphere.isEmpty()) {
+            return false;
+        }
+        CVector3 offset = origin - sphere.center;
+        float radiusSquared = sphere.radius * sphere.radius;
+        float a = direction.dot(direction);
+        float b = offset.dot(direction);
+        float c = offset.dot(offset) - radiusSquared;
+        CVector3 closest = offset - direction * (b / a);
+        float discriminant = a * (radiusSquared - closest.dot(closest));
+        if (!(discriminant >= 0.0f)) {
+            return false;
+        }
+        float root = simdSqrt(CFloat1(discriminant)).v;
+        float q = b >= 0.0f ? -b - root : root - b;
+        float t0 = c / q;
+        float t1 = q / a;
+        float tNear = t0 < t1 ? t0 : t1;
+        float tFar = t0 > t1 ? t0 : t1;
+        t = tNear >= 0.0f ? tNear : tFar;
+        return t >= 0.0f && t < maxT;
+    }
+
+    /**
+     * @brief Cruce del rayo con un plano (nx, ny, nz, d), por cualquiera de sus caras.
+     *
+     * Un rayo paralelo al plano no lo cruza, aunque esté contenido en él.
+     */
+    inline bool intersectRayPlane(const CVector3& origin, const CVector3& direction, const CVector4& plane, float maxT,
+        float& t) {
+        float denominator = plane.x * direction.x + plane.y * direction.y + plane.z * direction.z;
+        float distance = plane.x * origin.x + plane.y * origin.y + plane.z * origin.z + plane.w;
+        t = -distance / denominator;
+        return t >= 0.0f && t < maxT;
+    }
+
+    /**
+     * @brief Möller-Trumbore con el triángulo dado como vértice y aristas (edge1 = v1 - v0,
+     *        edge2 = v2 - v0), la forma que guarda CStaticBVH.
+     *
+     * @param u Recibe la coordenada baricéntrica de v1.
+     * @param v Recibe la coordenada baricéntrica de v2.
+     */
+    inline bool intersectRayTriangleEdges(const CVector3& origin, const CVector3& direction, const CVector3& v0,
+        const CVector3& edge1, const CVector3& edge2, float maxT, float& t, float& u, float& v) {
+        CVector3 p = direction.cross(edge2);
+        float det = edge1.dot(p);
+        if (det > -kParallelDeterminant && det < kParallelDeterminant) {
+            return false;
+        }
+        float inverseDet = 1.0f / det;
+        CVector3 s = origin - v0;
+        u = s.dot(p) * inverseDet;
+        if (u < 0.0f || u > 1.0f) {
+            return false;
+        }
+        CVector3 q = s.cross(edge1);
+        v = direction.dot(q) * inverseDet;
+        if (v < 0.0f || u + v > 1.0f) {
+            return false;
+        }
+        t = edge2.dot(q) * inverseDet;
+        return t >= 0.0f && t < maxT;
+    }
+
+    /**
+     * @brief Möller-Trumbore: rápido, pero un rayo que pasa justo por la arista común de dos
+     *        triángulos puede no tocar ninguno (véase intersectRayTriangleWatertight()).
+     */
+    inline bool intersectRayTriangle(const CVector3& origin, const CVector3& direction, const CVector3& v0,
+        const CVector3& v1, const CVector3& v2, float maxT, float& t, float& u, float& v) {
+        return intersectRayTriangleEdges(origin, direction, v0, v1 - v0, v2 - v0, maxT, t, u, v);
+    }
+
+    /**
+     * @struct CWatertightRay
+     * @brief Rayo preparado para la prueba estanca de Woop, Benthin y Wald (2013).
+     *
+     * El eje de mayor |dirección| pasa a ser z y una cizalla lleva la dirección a (0, 0, 1):
+     * los vértices se proyectan al plano xy de ese espacio y la prueba se reduce a los signos
+     * de tres funciones de arista 2D.
+     */
+    struct CWatertightRay {
+        CVector3 origin; ///< Origen del rayo.
+        int kx;          ///< Eje que hace de x.
+        int ky;          ///< Eje que hace de y.
+        int kz;          ///< Eje dominante de la dirección.
+        float shearX;    ///< direction[kx] / direction[kz].
+        float shearY;    ///< direction[ky] / direction[kz].
+        float shearZ;    ///< 1 / direction[kz].
+
+        /// @brief Prepara el rayo (una vez para todos los triángulos que se prueben con él).
+        CWatertightRay(const CVector3& origin, const CVector3& direction) : origin(origin) {
+            float ax = direction.x < 0.0f ? -direction.x : direction.x;
+            float ay = direction.y < 0.0f ? -direction.y : direction.y;
+            float az = direction.z < 0.0f ? -direction.z : direction.z;
+            kz = (ax >= ay && ax >= az) ? 0 : (ay >= az ? 1 : 2);
+            kx = kz == 2 ? 0 : kz + 1;
+            ky = kx == 2 ? 0 : kx + 1;
+            // Conservar el sentido de giro de los triángulos con una dirección negativa.
+            if (direction[kz] < 0.0f) {
+                int swap = kx;
+                kx = ky;
+                ky = swap;
+            }
+            shearX = direction[kx] / direction[kz];
+            shearY = direction[ky] / direction[kz];
+            shearZ = 1.0f / direction[kz];
+        }
+    };
+
+    /**
+     * @brief Prueba estanca: un rayo que pasa por una arista o un vértice compartidos toca al
+     *        menos uno de los triángulos que lo comparten, nunca se cuela entre ellos.
+     *
+     * Las funciones de arista se evalúan en double: los productos de dos float son exactos y
+     * la resta redondea una sola vez, así que el signo es exacto y la misma arista da el valor
+     * opuesto en los dos triángulos, con o sin FMA.
+     *
+     * @param u Recibe la coordenada baricéntrica de v1.
+     * @param v Recibe la coordenada baricéntrica de v2.
+     */
+    inline bool intersectRayTriangleWatertight(const CWatertightRay& ray, const CVector3& v0, const CVector3& v1,
+        const CVector3& v2, float maxT, float& t, float& u, float& v) {
+        CVector3 a = v0 - ray.origin;
+        CVector3 b = v1 - ray.origin;
+        CVector3 c = v2 - ray.origin;
+        float ax = a[ray.kx] - ray.shearX * a[ray.kz];
+        float ay = a[ray.ky] - ray.shearY * a[ray.kz];
+        float bx = b[ray.kx] - ray.shearX * b[ray.kz];
+        float by = b[ray.ky] - ray.shearY * b[ray.kz];
+        float cx = c[ray.kx] - ray.shearX * c[ray.kz];
+        float cy = c[ray.ky] - ray.shearY * c[ray.kz];
+        double edgeU = static_cast<double>(cx) * by - static_cast<double>(cy) * bx;
+        double edgeV = static_cast<double>(ax) * cy - static_cast<double>(ay) * cx;
+        double edgeW = static_cast<double>(bx) * ay - static_cast<double>(by) * ax;
+        if ((edgeU < 0.0 || edgeV < 0.0 || edgeW < 0.0) && (edgeU > 0.0 || edgeV > 0.0 || edgeW > 0.0)) {
+            return false;
+        }
+        double det = edgeU + edgeV + edgeW;
+        if (det == 0.0) {
+            return false;
+        }
+        double scaledT = edgeU * (ray.shearZ * a[ray.kz]) + edgeV * (ray.shearZ * b[ray.kz]) + edgeW * (ray.shearZ * c[ray.kz]);
+        double inverseDet = 1.0 / det;
+        t = static_cast<float>(scaledT * inverseDet);
+        if (!(t >= 0.0f && t < maxT)) {
+            return false;
+        }
+        u = static_cast<float>(edgeV * inverseDet);
+        v = static_cast<float>(edgeW * inverseDet);
+        return true;
+    }
+
+    /// @brief Prueba estanca preparando el rayo en la misma llamada.
+    inline bool intersectRayTriangleWatertight(const CVector3& origin, const CVector3& direction, const CVector3& v0,
+        const CVector3& v1, const CVector3& v2, float maxT, float& t, float& u, float& v) {
+        return intersectRayTriangleWatertight(CWatertightRay(origin, direction), v0, v1, v2, maxT, t, u, v);
+    }
+
+    /**
+     * @brief Segmento [start, end] contra una caja.
+     *
+     * @param t Recibe la entrada como fracción del segmento (0 si start está dentro).
+     */
+    inline bool intersectSegmentAABB(const CVector3& start, const CVector3& end, const CAABB& box, float& t) {
+        CVector3 direction = end - start;
+        CVector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        float tExit = 0.0f;
+        return intersectRayAABB(start, inverse, box, 1.0f, t, tExit);
+    }
+
+    /**
+     * @brief Segmento [start, end] contra un triángulo (prueba estanca, extremos incluidos).
+     *
+     * @param t Recibe el impacto como fracción del segmento.
+     */
+    inline bool intersectSegmentTriangle(const CVector3& start, const CVector3& end, const CVector3& v0,
+        const CVector3& v1, const CVector3& v2, float& t, float& u, float& v) {
+        return intersectRayTriangleWatertight(CWatertightRay(start, end - start), v0, v1, v2, kSegmentEnd, t, u, v);
+    }
+
+    /**
+     * @class CRayArray
+     * @brief Rayos guardados como siete arrays de float (origen y dirección por eje y maxT).
+     */
+    class CRayArray {
+    public:
+        /// @brief Número de rayos.
+        size_t size() const { return limits.size(); }
+
+        /// @brief Reserva espacio para count rayos.
+        void reserve(size_t count) {
+            for (int axis = 0; axis < 3; ++axis) {
+                origins[axis].reserve(count);
+                directions[axis].reserve(count);
+            }
+            limits.reserve(count);
+        }
+
+        /// @brief Elimina todos los rayos.
+        void clear() {
+            for (int axis = 0; axis < 3; ++axis) {
+                origins[axis].clear();
+                directions[axis].clear();
+            }
+            limits.clear();
+        }
+
+        /// @brief Añade un rayo al final.
+        void push(const CVector3& origin, const CVector3& direction, float maxT = INFINITY) {
+            for (int axis = 0; axis < 3; ++axis) {
+                origins[axis].push_back(origin[axis]);
+                directions[axis].push_back(direction[axis]);
+            }
+            limits.push_back(maxT);
+        }
+
+        /// @brief Rayo index.
+        void get(size_t index, CVector3& origin, CVector3& direction, float& maxT) const {
+            origin = CVector3(origins[0][index], origins[1][index], origins[2][index]);
+            direction = CVector3(directions[0][index], directions[1][index], directions[2][index]);
+            maxT = limits[index];
+        }
+
+        /// @brief Cambia el límite del rayo index.
+        void setMaxT(size_t index, float maxT) { limits[index] = maxT; }
+
+        /// @brief Coordenada axis de los orígenes de todos los rayos.
+        const float* origin(int axis) const { return origins[axis].data(); }
+
+        /// @brief Componente axis de las direcciones de todos los rayos.
+        const float* direction(int axis) const { return directions[axis].data(); }
+
+        /// @brief Límites de todos los rayos.
+        const float* maxT() const { return limits.data(); }
+
+    private:
+        std::vector<float> origins[3];
+        std::vector<float> directions[3];
+        std::vector<float> limits;
+    };
+
+    /**
+     * @struct TRayPacket
+     * @brief Pack::kWidth rayos consecutivos de un CRayArray, preparados para las pruebas por paquetes.
+     *
+     * Además de origen, dirección y maxT guarda las inversas con su signo (caras de entrada de
+     * la prueba de franjas) y, por carril, la permutación y la cizalla de CWatertightRay como
+     * tres filas de una matriz 3x3: con una fila de ceros, unos y -shear el producto da el
+     * mismo float que la versión escalar, sin elegir componentes carril a carril.
+     *
+     * maxT es público: quien busca el impacto más cercano lo recorta tras cada impacto.
+     */
+    template<typename Pack>
+    struct TRayPacket {
+        using Mask = typename Pack::Mask;
+
+        Pack origin[3];            ///< Orígenes por eje.
+        Pack direction[3];         ///< Direcciones por eje.
+        Pack inverse[3];           ///< 1 / direction.
+        Mask negative[3];          ///< inverse < 0: la entrada es la cara max del eje.
+        Pack maxT;                 ///< Límites de los rayos.
+        Pack inverseLengthSquared; ///< 1 / (direction · direction).
+        Pack shear[3][3];          ///< Filas de la permutación y la cizalla de cada carril.
+        const CRayArray* rays;     ///< Origen de los rayos (para repetir carriles en escalar).
+        size_t first;              ///< Índice del primer rayo del paquete.
+
+        /// @brief Carga los rayos [first, first + Pack::kWidth) de source.
+        TRayPacket(const CRayArray& source, size_t index) : rays(&source), first(index) {
+            for (int axis = 0; axis < 3; ++axis) {
+                origin[axis] = Pack::load(source.origin(axis) + index);
+                direction[axis] = Pack::load(source.direction(axis) + index);
+                inverse[axis] = Pack(1.0f) / direction[axis];
+                negative[axis] = inverse[axis] < Pack(0.0f);
+            }
+            maxT = Pack::load(source.maxT() + index);
+            inverseLengthSquared = Pack(1.0f) /
+                (direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+            float rows[3][3][Pack::kWidth] = {};
+            for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                CVector3 laneOrigin, laneDirection;
+                float laneMaxT = 0.0f;
+                source.get(index + lane, laneOrigin, laneDirection, laneMaxT);
+                CWatertightRay ray(laneOrigin, laneDirection);
+                rows[0][ray.kx][lane] = 1.0f;
+                rows[0][ray.kz][lane] = -ray.shearX;
+                rows[1][ray.ky][lane] = 1.0f;
+                rows[1][ray.kz][lane] = -ray.shearY;
+                rows[2][ray.kz][lane] = ray.shearZ;
+            }
+            for (int row = 0; row < 3; ++row) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    shear[row][axis] = Pack::load(rows[row][axis]);
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Prueba de franjas de un paquete contra una caja (igual que la versión escalar).
+     *
+     * @param tEnter Recibe la entrada de cada carril.
+     */
+    template<typename Pack>
+    inline int intersectRayAABB(const TRayPacket<Pack>& rays, const CAABB& box, Pack& tEnter) {
+        Pack tMin(0.0f);
+        Pack tMax = rays.maxT;
+        for (int axis = 0; axis < 3; ++axis) {
+            Pack lower(box.min[axis]);
+            Pack upper(box.max[axis]);
+            Pack tNear = (simdSelect(rays.negative[axis], upper, lower) - rays.origin[axis]) * rays.inverse[axis];
+            Pack tFar = (simdSelect(rays.negative[axis], lower, upper) - rays.origin[axis]) * rays.inverse[axis] *
+                Pack(kSlabExitScale);
+            // max y min devuelven el segundo operando con NaN: el NaN de una cara se ignora.
+            tMin = simdMax(tNear, tMin);
+            tMax = simdMin(tFar, tMax);
+        }
+        tEnter = tMin;
+        return simdBits(tMin <= tMax);
+    }
+
+    /// @brief Paquete contra una esfera (igual que la versión escalar).
+    template<typename Pack>
+    inline int intersectRaySphere(const TRayPacket<Pack>& rays, const CBoundingSphere& sphere, Pack& t) {
+        if (sphere.isEmpty()) {
+            return 0;
+        }
+        Pack zero(0.0f);
+        Pack radiusSquared(sphere.radius * sphere.radius);
+        Pack offsetX = rays.origin[0] - Pack(sphere.center.x);
+        Pack offsetY = rays.origin[1] - Pack(sphere.center.y);
+        Pack offsetZ = rays.origin[2] - Pack(sphere.center.z);
+        const Pack* d = rays.direction;
+        Pack a = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+        Pack b = offsetX * d[0] + offsetY * d[1] + offsetZ * d[2];
+        Pack scale = b * rays.inverseLengthSquared;
+        Pack closestX = offsetX - d[0] * scale;
+        Pack closestY = offsetY - d[1] * scale;
+        Pack closestZ = offsetZ - d[2] * scale;
+        Pack discriminant = a * (radiusSquared - (closestX * closestX + closestY * closestY + closestZ * closestZ));
+        auto valid = discriminant >= zero;
+        // La mayoría de los paquetes no tocan la esfera: ahorrar la raíz y las divisiones.
+        if (simdBits(valid) == 0) {
+            return 0;
+        }
+        Pack c = offsetX * offsetX + offsetY * offsetY + offsetZ * offsetZ - radiusSquared;
+        Pack root = simdSqrt(simdMax(discriminant, zero));
+        Pack q = simdSelect(b >= zero, zero - b - root, root - b);
+        Pack t0 = c / q;
+        Pack t1 = q * rays.inverseLengthSquared;
+        Pack tNear = simdMin(t0, t1);
+        Pack tFar = simdMax(t0, t1);
+        t = simdSelect(tNear >= zero, tNear, tFar);
+        return simdBits(valid & (t >= zero) & (t < rays.maxT));
+    }
+
+    /// @brief Paquete contra un plano (nx, ny, nz, d).
+    template<typename Pack>
+    inline int intersectRayPlane(const TRayPacket<Pack>& rays, const CVector4& plane, Pack& t) {
+        Pack nx(plane.x), ny(plane.y), nz(plane.z);
+        Pack denominator = nx * rays.direction[0] + ny * rays.direction[1] + nz * rays.direction[2];
+        Pack distance = nx * rays.origin[0] + ny * rays.origin[1] + nz * rays.origin[2] + Pack(plane.w);
+        t = (Pack(0.0f) - distance) / denominator;
+        return simdBits((t >= Pack(0.0f)) & (t < rays.maxT));
+    }
+
+    /// @brief Paquete contra un triángulo con Möller-Trumbore.
+    template<typename Pack>
+    inline int intersectRayTriangle(const TRayPacket<Pack>& rays, const CVector3& v0, const CVector3& v1,
+        const CVector3& v2, Pack& t, Pack& u, Pack& v) {
+        CVector3 edge1 = v1 - v0;
+        CVector3 edge2 = v2 - v0;
+        Pack e1x(edge1.x), e1y(edge1.y), e1z(edge1.z);
+        Pack e2x(edge2.x), e2y(edge2.y), e2z(edge2.z);
+        const Pack* d = rays.direction;
+        Pack px = d[1] * e2z - d[2] * e2y;
+        Pack py = d[2] * e2x - d[0] * e2z;
+        Pack pz = d[0] * e2y - d[1] * e2x;
+        Pack det = e1x * px + e1y * py + e1z * pz;
+        Pack inverseDet = Pack(1.0f) / det;
+        Pack sx = rays.origin[0] - Pack(v0.x);
+        Pack sy = rays.origin[1] - Pack(v0.y);
+        Pack sz = rays.origin[2] - Pack(v0.z);
+        u = (sx * px + sy * py + sz * pz) * inverseDet;
+        Pack qx = sy * e1z - sz * e1y;
+        Pack qy = sz * e1x - sx * e1z;
+        Pack qz = sx * e1y - sy * e1x;
+        v = (d[0] * qx + d[1] * qy + d[2] * qz) * inverseDet;
+        t = (e2x * qx + e2y * qy + e2z * qz) * inverseDet;
+        Pack zero(0.0f), one(1.0f);
+        auto mask = ((det >= Pack(kParallelDeterminant)) | (det <= Pack(-kParallelDeterminant))) &
+            (u >= zero) & (u <= one) & (v >= zero) & (u + v <= one) & (t >= zero) & (t < rays.maxT);
+        return simdBits(mask);
+    }
+
+    /**
+     * @brief Paquete contra un triángulo con la prueba estanca.
+     *
+     * Las funciones de arista se calculan en float; los carriles en los que alguna queda por
+     * debajo de su cota de error (el rayo roza una arista o un vértice) se repiten con la
+     * versión escalar en double, así que la decisión es la misma que la escalar.
+     */
+    template<typename Pack>
+    inline int intersectRayTriangleWatertight(const TRayPacket<Pack>& rays, const CVector3& v0, const CVector3& v1,
+        const CVector3& v2, Pack& t, Pack& u, Pack& v) {
+        Pack projected[3][3]; // [vértice][x, y, z del espacio cizallado]
+        const CVector3* vertices[3] = { &v0, &v1, &v2 };
+        for (int vertex = 0; vertex < 3; ++vertex) {
+            Pack rx = Pack(vertices[vertex]->x) - rays.origin[0];
+            Pack ry = Pack(vertices[vertex]->y) - rays.origin[1];
+            Pack rz = Pack(vertices[vertex]->z) - rays.origin[2];
+            for (int row = 0; row < 3; ++row) {
+                projected[vertex][row] = rays.shear[row][0] * rx + rays.shear[row][1] * ry + rays.shear[row][2] * rz;
+            }
+        }
+        const Pack* a = projected[0];
+        const Pack* b = projected[1];
+        const Pack* c = projected[2];
+        Pack products[6] = { c[0] * b[1], c[1] * b[0], a[0] * c[1], a[1] * c[0], b[0] * a[1], b[1] * a[0] };
+        Pack edgeU = products[0] - products[1];
+        Pack edgeV = products[2] - products[3];
+        Pack edgeW = products[4] - products[5];
+        Pack tolerance(kEdgeFunctionError);
+        auto doubtful = (simdAbs(edgeU) <= (simdAbs(products[0]) + simdAbs(products[1])) * tolerance) |
+            (simdAbs(edgeV) <= (simdAbs(products[2]) + simdAbs(products[3])) * tolerance) |
+            (simdAbs(edgeW) <= (simdAbs(products[4]) + simdAbs(products[5])) * tolerance);
+        Pack zero(0.0f);
+        auto inside = ((edgeU >= zero) & (edgeV >= zero) & (edgeW >= zero)) |
+            ((edgeU <= zero) & (edgeV <= zero) & (edgeW <= zero));
+        Pack det = edgeU + edgeV + edgeW;
+        Pack inverseDet = Pack(1.0f) / det;
+        t = (edgeU * a[2] + edgeV * b[2] + edgeW * c[2]) * inverseDet;
+        u = edgeV * inverseDet;
+        v = edgeW * inverseDet;
+        int bits = simdBits(inside & ((det > zero) | (det < zero)) & (t >= zero) & (t < rays.maxT));
+        int repeat = simdBits(doubtful);
+        if (repeat == 0) {
+            return bits;
+        }
+        float lanesT[Pack::kWidth], lanesU[Pack::kWidth], lanesV[Pack::kWidth], lanesMaxT[Pack::kWidth];
+        t.store(lanesT);
+        u.store(lanesU);
+        v.store(lanesV);
+        rays.maxT.store(lanesMaxT); // Puede estar recortado respecto al del CRayArray.
+        for (int lane = 0; lane < Pack::kWidth; ++lane) {
+            if ((repeat >> lane & 1) == 0) {
+                continue;
+            }
+            CVector3 origin, direction;
+            float maxT = 0.0f;
+            rays.rays->get(rays.first + lane, origin, direction, maxT);
+            bool hit = intersectRayTriangleWatertight(CWatertightRay(origin, direction), v0, v1, v2, lanesMaxT[lane],
+                lanesT[lane], lanesU[lane], lanesV[lane]);
+            bits = hit ? bits | (1 << lane) : bits & ~(1 << lane);
+        }
+        t = Pack::load(lanesT);
+        u = Pack::load(lanesU);
+        v = Pack::load(lanesV);
+        return bits;
+    }
+
+    /**
+     * @brief Impacto más cercano de cada rayo contra una lista de triángulos, por paquetes.
+     *
+     * Cada paquete de simdForEach() se prueba contra todos los triángulos con la prueba
+     * estanca, recortando el maxT de sus carriles con cada impacto. Sin estructura de
+     * aceleración: para mallas grandes, CStaticBVH.
+     *
+     * @param vertices Tres vértices consecutivos por triángulo.
+     * @param hits Un resultado por rayo; triangle = UINT32_MAX y t = maxT si no toca ninguno.
+     * @return Número de rayos con impacto.
+     */
+    inline size_t intersectTrianglesBatch(const CRayArray& rays, const CVector3* vertices, size_t triangleCount,
+        CTriangleHit* hits) {
+        size_t found = 0;
+        simdForEach(0, rays.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            TRayPacket<Pack> packet(rays, i);
+            float bestT[Pack::kWidth], bestU[Pack::kWidth] = {}, bestV[Pack::kWidth] = {};
+            uint32_t bestTriangle[Pack::kWidth];
+            packet.maxT.store(bestT);
+            for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                bestTriangle[lane] = UINT32_MAX;
+            }
+            for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+                const CVector3* corner = vertices + 3 * triangle;
+                Pack t, u, v;
+                int bits = intersectRayTriangleWatertight(packet, corner[0], corner[1], corner[2], t, u, v);
+                if (bits == 0) {
+                    continue;
+                }
+                float lanesT[Pack::kWidth], lanesU[Pack::kWidth], lanesV[Pack::kWidth];
+                t.store(lanesT);
+                u.store(lanesU);
+                v.store(lanesV);
+                for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                    if (bits >> lane & 1) {
+                        bestT[lane] = lanesT[lane];
+                        bestU[lane] = lanesU[lane];
+                        bestV[lane] = lanesV[lane];
+                        bestTriangle[lane] = static_cast<uint32_t>(triangle);
+                    }
+                }
+                packet.maxT = Pack::load(bestT);
+            }
+            for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                hits[i + lane] = CTriangleHit{ bestT[lane], bestU[lane], bestV[lane], bestTriangle[lane] };
+                found += bestTriangle[lane] != UINT32_MAX ? 1 : 0;
+            }
+        });
+        return found;
+    }
+
+}
@@ -0,0 +1,383 @@
+/**
+ * @file SpaceFillingCurves.h
+ * @brief Códigos de Morton y de Hilbert en 2D y 3D para ordenar puntos y objetos por cercanía.
+ * @author Hannin Abarca
+ *
+ * Un código de curva recorre una rejilla de 2^bits celdas por eje de modo que celdas cercanas
+ * reciben, casi siempre, códigos cercanos. Ordenar por código (véase CRadixSorter) deja juntos
+ * en memoria los elementos cercanos en el espacio antes de construir rejillas o BVH.
+ *
+ *  - Morton (orden Z): intercala los bits de las coordenadas. Es casi gratis de calcular, pero
+ *    da saltos largos entre cuadrantes.
+ *  - Hilbert: cada código consecutivo es una celda vecina, así que conserva mejor la
+ *    localidad, a cambio de un bucle por bit (algoritmo de Skilling sobre la forma traspuesta).
+ *
+ * Todos los códigos son de 64 bits: 2D usa 32 bits por eje y 3D, 21. Con BMI2
+ * (ENGINEUTILITIES_BMI2) el intercalado es una sola instrucción pdep/pext; las versiones
+ * *Portable() hacen lo mismo con máscaras y desplazamientos y dan el mismo resultado.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "CAABB.h"
+#include "../Threading/CJobSystem.h"
+#include "../Utilities/Simd.h"
+#include "../Vector/CVector2.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    const int kMortonBits2D = 32; ///< Bits por eje de los códigos 2D.
+    const int kMortonBits3D = 21; ///< Bits por eje de los códigos 3D.
+
+    /// Elementos por trabajo al calcular códigos en paralelo.
+    const size_t kSpatialCodeGrain = 16384;
+
+    /// @brief Intercala x e y (x en los bits pares) sin BMI2.
+    inline uint64_t mortonEncode2Portable(uint32_t x, uint32_t y) {
+        auto spread = [](uint64_t v) {
+            v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+            v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+            v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+            v = (v | (v << 2)) & 0x3333333333333333ull;
+            v = (v | (v << 1)) & 0x5555555555555555ull;
+            return v;
+        };
+        return spread(x) | (spread(y) << 1);
+    }
+
+    /// @brief Inversa de mortonEncode2Portable().
+    inline void mortonDecode2Portable(uint64_t code, uint32_t& x, uint32_t& y) {
+        auto compact = [](uint64_t v) {
+            v &= 0x5555555555555555ull;
+            v = (v | (v >> 1)) & 0x3333333333333333ull;
+            v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+            v = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+            v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+            v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+            return static_cast<uint32_t>(v);
+        };
+        x = compact(code);
+        y = compact(code >> 1);
+    }
+
+    /// @brief Intercala los 21 bits bajos de x, y y z (x en los bits 0, 3, 6...) sin BMI2.
+    inline uint64_t mortonEncode3Portable(uint32_t x, uint32_t y, uint32_t z) {
+        auto spread = [](uint64_t v) {
+            v &= 0x1FFFFF;
+            v = (v | (v << 32)) & 0x001F00000000FFFFull;
+            v = (v | (v << 16)) & 0x001F0000FF0000FFull;
+            v = (v | (v << 8)) & 0x100F00F00F00F00Full;
+            v = (v | (v << 4)) & 0x10C30C30C30C30C3ull;
+            v = (v | (v << 2)) & 0x1249249249249249ull;
+            return v;
+        };
+        return spread(x) | (spread(y) << 1) | (spread(z) << 2);
+    }
+
+    /// @brief Inversa de mortonEncode3Portable().
+    inline void mortonDecode3Portable(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z) {
+        auto compact = [](uint64_t v) {
+            v &= 0x1249249249249249ull;
+            v = (v | (v >> 2)) & 0x10C30C30C30C30C3ull;
+            v = (v | (v >> 4)) & 0x100F00F00F00F00Full;
+            v = (v | (v >> 8)) & 0x001F0000FF0000FFull;
+            v = (v | (v >> 16)) & 0x001F00000000FFFFull;
+            v = (v | (v >> 32)) & 0x00000000001FFFFFull;
+            return static_cast<uint32_t>(v);
+        };
+        x = compact(code);
+        y = compact(code >> 1);
+        z = compact(code >> 2);
+    }
+
+    /// @brief Código de Morton 2D de la celda (x, y).
+    inline uint64_t mortonEncode2(uint32_t x, uint32_t y) {
+#if defined(ENGINEUTILITIES_BMI2)
+        return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#else
+        return mortonEncode2Portable(x, y);
+#endif
+    }
+
+    /// @brief Celda (x, y) de un código de Morton 2D.
+    inline void mortonDecode2(uint64_t code, uint32_t& x, uint32_t& y) {
+#if defined(ENGINEUTILITIES_BMI2)
+        x = static_cast<uint32_t>(_pext_u64(code, 0x5555555555555555ull));
+        y = static_cast<uint32_t>(_pext_u64(code, 0xAAAAAAAAAAAAAAAAull));
+#else
+        mortonDecode2Portable(code, x, y);
+#endif
+    }
+
+    /// @brief Código de Morton 3D de la celda (x, y, z); solo cuentan los 21 bits bajos de cada eje.
+    inline uint64_t mortonEncode3(uint32_t x, uint32_t y, uint32_t z) {
+#if defined(ENGINEUTILITIES_BMI2)
+        return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) |
+            _pdep_u64(z, 0x4924924924924924ull);
+#else
+        return mortonEncode3Portable(x, y, z);
+#endif
+    }
+
+    /// @brief Celda (x, y, z) de un código de Morton 3D.
+    inline void mortonDecode3(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z) {
+#if defined(ENGINEUTILITIES_BMI2)
+        x = static_cast<uint32_t>(_pext_u64(code, 0x1249249249249249ull));
+        y = static_cast<uint32_t>(_pext_u64(code, 0x2492492492492492ull));
+        z = static_cast<uint32_t>(_pext_u64(code, 0x4924924924924924ull));
+#else
+        mortonDecode3Portable(code, x, y, z);
+#endif
+    }
+
+    /**
+     * @brief Pasa las coordenadas axes[0..Dimensions) de una celda a la forma traspuesta del
+     *        índice de Hilbert (Skilling, "Programming the Hilbert curve", 2004).
+     *
+     * Al intercalar la forma traspuesta con axes[0] como bit más alto de cada grupo sale el
+     * índice de Hilbert.
+     */
+    template<int Dimensions>
+    inline void hilbertAxesToTranspose(uint32_t* axes, int bits) {
+        const uint32_t top = 1u << (bits - 1);
+        // Deshacer las rotaciones y reflexiones de cada nivel, del más grueso al más fino.
+        for (uint32_t q = top; q > 1; q >>= 1) {
+            uint32_t p = q - 1;
+            for (int i = 0; i < Dimensions; ++i) {
+                // Sin saltos: con el bit q activo se invierte axes[0], si no se intercambian
+                // los bits bajos de axes[0] y axes[i] (con datos aleatorios el salto falla la mitad).
+                uint32_t set = 0u - ((axes[i] & q) != 0);
+                uint32_t t = (axes[0] ^ axes[i]) & p & ~set;
+                axes[0] ^= (p & set) | t;
+                axes[i] ^= t;
+            }
+        }
+        // Código Gray.
+        for (int i = 1; i < Dimensions; ++i) {
+            axes[i] ^= axes[i - 1];
+        }
+        uint32_t t = 0;
+        for (uint32_t q = top; q > 1; q >>= 1) {
+            t ^= (q - 1) & (0u - ((axes[Dimensions - 1] & q) != 0));
+        }
+        for (int i = 0; i < Dimensions; ++i) {
+            axes[i] ^= t;
+        }
+    }
+
+    /// @brief Inversa de hilbertAxesToTranspose().
+    template<int Dimensions>
+    inline void hilbertTransposeToAxes(uint32_t* axes, int bits) {
+        // Deshacer el código Gray: H ^ (H / 2).
+        uint32_t t = axes[Dimensions - 1] >> 1;
+        for (int i = Dimensions - 1; i > 0; --i) {
+            axes[i] ^= axes[i - 1];
+        }
+        axes[0] ^= t;
+        // Rehacer las rotaciones y reflexiones, del nivel más fino al más grueso.
+        const uint32_t end = bits >= 32 ? 0u : 1u << bits;
+        for (uint32_t q = 2; q != end; q <<= 1) {
+            uint32_t p = q - 1;
+            for (int i = Dimensions - 1; i >= 0; --i) {
+                uint32_t set = 0u - ((axes[i] & q) != 0);
+                uint32_t u = (axes[0] ^ axes[i]) & p & ~set;
+                axes[0] ^= (p & set) | u;
+                axes[i] ^= u;
+            }
+        }
+    }
+
+    /// @brief Índice de Hilbert 2D de la celda (x, y) en una rejilla de 2^32 x 2^32.
+    inline uint64_t hilbertEncode2(uint32_t x, uint32_t y) {
+        uint32_t axes[2] = { x, y };
+        hilbertAxesToTranspose<2>(axes, kMortonBits2D);
+        return mortonEncode2(axes[1], axes[0]);
+    }
+
+    /// @brief Celda (x, y) de un índice de Hilbert 2D.
+    inline void hilbertDecode2(uint64_t code, uint32_t& x, uint32_t& y) {
+        uint32_t axes[2];
+        mortonDecode2(code, axes[1], axes[0]);
+        hilbertTransposeToAxes<2>(axes, kMortonBits2D);
+        x = axes[0];
+        y = axes[1];
+    }
+
+    /// @brief Índice de Hilbert 3D de la celda (x, y, z) en una rejilla de 2^21 por eje.
+    inline uint64_t hilbertEncode3(uint32_t x, uint32_t y, uint32_t z) {
+        uint32_t axes[3] = { x & 0x1FFFFF, y & 0x1FFFFF, z & 0x1FFFFF };
+        hilbertAxesToTranspose<3>(axes, kMortonBits3D);
+        return mortonEncode3(axes[2], axes[1], axes[0]);
+    }
+
+    /// @brief Celda (x, y, z) de un índice de Hilbert 3D.
+    inline void hilbertDecode3(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z) {
+        uint32_t axes[3];
+        mortonDecode3(code, axes[2], axes[1], axes[0]);
+        hilbertTransposeToAxes<3>(axes, kMortonBits3D);
+        x = axes[0];
+        y = axes[1];
+        z = axes[2];
+    }
+
+    /**
+     * @class CSpatialQuantizer
+     * @brief Convierte posiciones dentro de una caja en celdas enteras de 2^bits por eje.
+     *
+     * Los puntos fuera de la caja van a la celda del borde más cercana. Se calcula en double:
+     * un float no distingue 2^32 celdas.
+     */
+    class CSpatialQuantizer {
+    public:
+        /// @brief Cuantizador 3D para la caja bounds (21 bits por eje).
+        explicit CSpatialQuantizer(const CAABB& bounds)
+            : CSpatialQuantizer(bounds.min.x, bounds.min.y, bounds.min.z, bounds.max.x, bounds.max.y, bounds.max.z,
+                kMortonBits3D) {}
+
+        /// @brief Cuantizador 2D para la caja [boundsMin, boundsMax] (32 bits por eje).
+        CSpatialQuantizer(const CVector2& boundsMin, const CVector2& boundsMax)
+            : CSpatialQuantizer(boundsMin.x, boundsMin.y, 0.0f, boundsMax.x, boundsMax.y, 0.0f, kMortonBits2D) {}
+
+        /// @brief Celdas de point (3D).
+        void cell(const CVector3& point, uint32_t& x, uint32_t& y, uint32_t& z) const {
+            x = axisCell(point.x, 0);
+            y = axisCell(point.y, 1);
+            z = axisCell(point.z, 2);
+        }
+
+        /// @brief Celdas de point (2D).
+        void cell(const CVector2& point, uint32_t& x, uint32_t& y) const {
+            x = axisCell(point.x, 0);
+            y = axisCell(point.y, 1);
+        }
+
+        /// @brief Centro de la celda (x, y, z) (3D).
+        CVector3 cellCenter(uint32_t x, uint32_t y, uint32_t z) const {
+            return CVector3(axisCenter(x, 0), axisCenter(y, 1), axisCenter(z, 2));
+        }
+
+        /// @brief Centro de la celda (x, y) (2D).
+        CVector2 cellCenter(uint32_t x, uint32_t y) const { return CVector2(axisCenter(x, 0), axisCenter(y, 1)); }
+
+    private:
+        CSpatialQuantizer(float minX, float minY, float minZ, float maxX, float maxY, float maxZ, int bits)
+            : maxCell(static_cast<double>((uint64_t(1) << bits) - 1)) {
+            const float mins[3] = { minX, minY, minZ };
+            const float maxs[3] = { maxX, maxY, maxZ };
+            for (int axis = 0; axis < 3; ++axis) {
+                origin[axis] = mins[axis];
+                double extent = static_cast<double>(maxs[axis]) - mins[axis];
+                // La celda maxCell termina justo en max; sin extensión todo cae en la celda 0.
+                scale[axis] = extent > 0.0 ? (maxCell + 1.0) / extent : 0.0;
+            }
+        }
+
+        uint32_t axisCell(float value, int axis) const {
+            double cell = (static_cast<double>(value) - origin[axis]) * scale[axis];
+            // Negado para que NaN también vaya a la celda 0.
+            if (!(cell > 0.0)) {
+                return 0;
+            }
+            return static_cast<uint32_t>(cell < maxCell ? cell : maxCell);
+        }
+
+        float axisCenter(uint32_t cell, int axis) const {
+            return scale[axis] > 0.0 ? static_cast<float>(origin[axis] + (cell + 0.5) / scale[axis]) :
+                static_cast<float>(origin[axis]);
+        }
+
+        double origin[3];
+        double scale[3];
+        double maxCell;
+    };
+
+    /// @brief Código de Morton de point cuantizado a bounds.
+    inline uint64_t mortonCode(const CVector3& point, const CAABB& bounds) {
+        uint32_t x, y, z;
+        CSpatialQuantizer(bounds).cell(point, x, y, z);
+        return mortonEncode3(x, y, z);
+    }
+
+    /// @brief Índice de Hilbert de point cuantizado a bounds.
+    inline uint64_t hilbertCode(const CVector3& point, const CAABB& bounds) {
+        uint32_t x, y, z;
+        CSpatialQuantizer(bounds).cell(point, x, y, z);
+        return hilbertEncode3(x, y, z);
+    }
+
+    /// @brief Código de Morton de point cuantizado a [boundsMin, boundsMax].
+    inline uint64_t mortonCode(const CVector2& point, const CVector2& boundsMin, const CVector2& boundsMax) {
+        uint32_t x, y;
+        CSpatialQuantizer(boundsMin, boundsMax).cell(point, x, y);
+        return mortonEncode2(x, y);
+    }
+
+    /// @brief Índice de Hilbert de point cuantizado a [boundsMin, boundsMax].
+    inline uint64_t hilbertCode(const CVector2& point, const CVector2& boundsMin, const CVector2& boundsMax) {
+        uint32_t x, y;
+        CSpatialQuantizer(boundsMin, boundsMax).cell(point, x, y);
+        return hilbertEncode2(x, y);
+    }
+
+    /// @brief codes[i] = mortonCode(points[i], bounds).
+    inline void mortonCodes(const CVector3* points, size_t count, const CAABB& bounds, uint64_t* codes) {
+        const CSpatialQuantizer quantizer(bounds);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t x, y, z;
+            quantizer.cell(points[i], x, y, z);
+            codes[i] = mortonEncode3(x, y, z);
+        }
+    }
+
+    /// @brief codes[i] = hilbertCode(points[i], bounds).
+    inline void hilbertCodes(const CVector3* points, size_t count, const CAABB& bounds, uint64_t* codes) {
+        const CSpatialQuantizer quantizer(bounds);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t x, y, z;
+            quantizer.cell(points[i], x, y, z);
+            codes[i] = hilbertEncode3(x, y, z);
+        }
+    }
+
+    /// @brief codes[i] = mortonCode(points[i], boundsMin, boundsMax).
+    inline void mortonCodes(const CVector2* points, size_t count, const CVector2& boundsMin, const CVector2& boundsMax,
+        uint64_t* codes) {
+        const CSpatialQuantizer quantizer(boundsMin, boundsMax);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t x, y;
+            quantizer.cell(points[i], x, y);
+            codes[i] = mortonEncode2(x, y);
+        }
+    }
+
+    /// @brief codes[i] = hilbertCode(points[i], boundsMin, boundsMax).
+    inline void hilbertCodes(const CVector2* points, size_t count, const CVector2& boundsMin, const CVector2& boundsMax,
+        uint64_t* codes) {
+        const CSpatialQuantizer quantizer(boundsMin, boundsMax);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t x, y;
+            quantizer.cell(points[i], x, y);
+            codes[i] = hilbertEncode2(x, y);
+        }
+    }
+
+    /// @brief mortonCodes() (3D) repartido entre los hilos de jobs.
+    inline void parallelMortonCodes(CJobSystem& jobs, const CVector3* points, size_t count, const CAABB& bounds,
+        uint64_t* codes, size_t grain = kSpatialCodeGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            mortonCodes(points + first, last - first, bounds, codes + first);
+        });
+    }
+
+    /// @brief hilbertCodes() (3D) repartido entre los hilos de jobs.
+    inline void parallelHilbertCodes(CJobSystem& jobs, const CVector3* points, size_t count, const CAABB& bounds,
+        uint64_t* codes, size_t grain = kSpatialCodeGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            hilbertCodes(points + first, last - first, bounds, codes + first);
+        });
+    }
+
+}
@@ -0,0 +1,775 @@
+/**
+ * @file TLooseTree.h
+ * @brief Octree y quadtree holgados con nodos de un pool, para escenas grandes y dispersas.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CAABB.h"
+#include "CFrustum.h"
+#include "../Memory/TObjectPool.h"
+#include "../Vector/CVector2.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class TLooseTree
+     * @brief Árbol holgado (loose octree / quadtree) de cajas sobre un mundo cúbico fijo.
+     *
+     * Cada nodo es una celda del mundo subdividida en 2^Dimensions hijos, pero su caja
+     * "holgada" mide el doble: la celda ampliada media celda por cada lado. Un objeto va al
+     * nodo más profundo cuya celda contiene su centro y cuya media celda es >= su mayor
+     * semiextensión, así que siempre cabe en la caja holgada. La profundidad sale
+     * directamente del tamaño del objeto y la celda de su centro, sin recorrer ni comparar
+     * cajas, y un objeto que se mueve solo cambia de nodo al cruzar una celda.
+     *
+     * Las celdas se identifican por coordenadas enteras a la máxima profundidad, por lo que
+     * la colocación es exacta incluso sobre los bordes. Los objetos fuera del mundo (o más
+     * grandes que él) quedan en la raíz, que no tiene caja y se visita siempre.
+     *
+     * Nodos y objetos salen de dos TObjectPool y solo existen en las ramas con objetos: al
+     * vaciarse vuelven al pool. Las cajas de los objetos de un nodo se guardan juntas en
+     * bloques de kChunkSize, así que una consulta lee memoria contigua y no salta por el
+     * array de objetos; la caja holgada de un hijo se calcula a partir del padre, sin
+     * cargar el hijo para descartarlo. El identificador de un objeto (proxy) no cambia al
+     * moverse.
+     *
+     * Las consultas son const y pueden ejecutarse en paralelo mientras nadie modifique el árbol.
+     *
+     * @tparam VectorT CVector2 (quadtree) o CVector3 (octree).
+     * @tparam Dimensions 2 o 3.
+     */
+    template<typename VectorT, int Dimensions>
+    class TLooseTree {
+        static_assert(Dimensions == 2 || Dimensions == 3, "TLooseTree solo admite 2 o 3 dimensiones");
+
+    public:
+        static constexpr uint32_t kNullProxy = 0xFFFFFFFFu; ///< Proxy inválido.
+        static constexpr int kMaxDepth = 16;                ///< Profundidad máxima admitida.
+        static constexpr int kChildren = 1 << Dimensions;   ///< Hijos por nodo.
+        static constexpr uint32_t kChunkSize = 8;           ///< Objetos por bloque de un nodo.
+
+        /**
+         * @brief Constructor.
+         *
+         * @param worldMin Esquina mínima del mundo.
+         * @param worldSize Lado del mundo (cubo o cuadrado).
+         * @param maxDepth Profundidad máxima (se limita a [0, kMaxDepth]); las celdas más
+         *                 pequeñas deberían ser del orden de las consultas habituales.
+         * @param nodesPerSlab Nodos (y bloques de objetos) que reserva cada pool al crecer.
+         */
+        TLooseTree(const VectorT& worldMin, float worldSize, int maxDepth = 8, size_t nodesPerSlab = 256)
+            : worldMin(worldMin), worldSize(worldSize),
+            maxDepth(maxDepth < 0 ? 0 : (maxDepth > kMaxDepth ? kMaxDepth : maxDepth)),
+            nodePool(nodesPerSlab, false), chunkPool(nodesPerSlab, false), root(nullptr), freeList(kNullProxy),
+            objectCount(0), liveNodes(0), liveChunks(0) {
+            inverseLeafSize = static_cast<float>(1u << this->maxDepth) / worldSize;
+            root = nodePool.create();
+            uint32_t coord[Dimensions] = {};
+            initNode(root, nullptr, 0, coord, worldMin, worldSize);
+        }
+
+        ~TLooseTree() {
+            destroySubtree(root);
+        }
+
+        // Prohibir la copia: los nodos pertenecen a los pools de este árbol.
+        TLooseTree(const TLooseTree&) = delete;
+        TLooseTree& operator=(const TLooseTree&) = delete;
+
+        /// @brief Reserva espacio para count objetos.
+        void reserve(size_t count) {
+            objects.reserve(count);
+        }
+
+        /// @brief Elimina todos los objetos y devuelve a los pools todos los nodos menos la raíz.
+        void clear() {
+            for (int child = 0; child < kChildren; ++child) {
+                destroySubtree(root->children[child]);
+                root->children[child] = nullptr;
+            }
+            destroyChunks(root);
+            root->objectCount = 0;
+            root->subtreeCount = 0;
+            objects.clear();
+            freeList = kNullProxy;
+            objectCount = 0;
+        }
+
+        /**
+         * @brief Inserta un objeto.
+         *
+         * @param min Esquina mínima de la caja del objeto.
+         * @param max Esquina máxima de la caja del objeto.
+         * @param userData Valor libre asociado (normalmente el índice o id del objeto).
+         * @return Identificador del proxy.
+         */
+        uint32_t insert(const VectorT& min, const VectorT& max, uint32_t userData) {
+            uint32_t proxy = freeList;
+            if (proxy != kNullProxy) {
+                freeList = objects[proxy].slot;
+            }
+            else {
+                proxy = static_cast<uint32_t>(objects.size());
+                objects.emplace_back();
+            }
+            objects[proxy].userData = userData;
+            uint32_t key[Dimensions];
+            int depth = targetDepth(min, max, key);
+            link(proxy, descend(root, depth, key), min, max);
+            ++objectCount;
+            return proxy;
+        }
+
+        /// @brief Inserta un objeto a partir de su CAABB (solo octree).
+        uint32_t insert(const CAABB& box, uint32_t userData) {
+            static_assert(Dimensions == 3, "Las cajas CAABB solo existen en 3D");
+            return insert(box.min, box.max, userData);
+        }
+
+        /**
+         * @brief Elimina un proxy.
+         *
+         * @return false si proxy no es un objeto válido.
+         */
+        bool remove(uint32_t proxy) {
+            if (!isValid(proxy)) {
+                return false;
+            }
+            Node* node = objects[proxy].node;
+            unlink(proxy);
+            prune(node);
+            objects[proxy].node = nullptr;
+            objects[proxy].slot = freeList;
+            freeList = proxy;
+            --objectCount;
+            return true;
+        }
+
+        /**
+         * @brief Cambia la caja de un objeto que se ha movido o ha cambiado de tamaño.
+         *
+         * Si el centro sigue en la misma celda y el tamaño pide la misma profundidad, solo se
+         * copia la caja. Si no, el objeto sube hasta el primer ancestro que lo contiene y baja
+         * desde ahí, sin pasar por la raíz.
+         *
+         * @return true si el objeto cambió de nodo.
+         */
+        bool update(uint32_t proxy, const VectorT& min, const VectorT& max) {
+            if (!isValid(proxy)) {
+                return false;
+            }
+            Object& object = objects[proxy];
+            uint32_t key[Dimensions];
+            int depth = targetDepth(min, max, key);
+            Node* node = object.node;
+            if (node->depth == depth && cellContains(node, key)) {
+                object.chunk->min[object.slot] = min;
+                object.chunk->max[object.slot] = max;
+                return false;
+            }
+            unlink(proxy);
+            Node* ancestor = node;
+            while (ancestor->depth > depth || !cellContains(ancestor, key)) {
+                ancestor = ancestor->parent;
+            }
+            link(proxy, descend(ancestor, depth, key), min, max);
+            // Después de enlazar: la rama nueva tiene objetos y no se poda.
+            prune(node);
+            return true;
+        }
+
+        /// @brief update() a partir de una CAABB (solo octree).
+        bool update(uint32_t proxy, const CAABB& box) {
+            static_assert(Dimensions == 3, "Las cajas CAABB solo existen en 3D");
+            return update(proxy, box.min, box.max);
+        }
+
+        /// @brief Esquina mínima de la caja de un proxy.
+        const VectorT& objectMin(uint32_t proxy) const { return objects[proxy].chunk->min[objects[proxy].slot]; }
+
+        /// @brief Esquina máxima de la caja de un proxy.
+        const VectorT& objectMax(uint32_t proxy) const { return objects[proxy].chunk->max[objects[proxy].slot]; }
+
+        /// @brief Valor asociado a un proxy.
+        uint32_t userData(uint32_t proxy) const { return objects[proxy].userData; }
+
+        /// @brief Número de objetos.
+        size_t size() const { return objectCount; }
+
+        /// @brief Número de nodos vivos (incluida la raíz).
+        size_t nodeCount() const { return liveNodes; }
+
+        /// @brief Profundidad máxima de los nodos.
+        int getMaxDepth() const { return maxDepth; }
+
+        /// @brief Bytes que ocupan los nodos y bloques vivos y el array de objetos.
+        size_t memoryUsage() const {
+            return liveNodes * sizeof(Node) + liveChunks * sizeof(Chunk) + objects.capacity() * sizeof(Object);
+        }
+
+        /**
+         * @brief Llama a fn(proxy) por cada objeto cuya caja se solapa con [min, max].
+         *
+         * fn devuelve bool: false detiene la consulta.
+         */
+        template<typename Fn>
+        void query(const VectorT& min, const VectorT& max, Fn&& fn) const {
+            traverse([&](const VectorT& boxMin, const VectorT& boxMax) { return boxOverlaps(boxMin, boxMax, min, max); },
+                fn);
+        }
+
+        /// @brief query() con una CAABB (solo octree).
+        template<typename Fn>
+        void query(const CAABB& box, Fn&& fn) const {
+            static_assert(Dimensions == 3, "Las cajas CAABB solo existen en 3D");
+            query(box.min, box.max, fn);
+        }
+
+        /**
+         * @brief Llama a fn(proxy) por cada objeto cuya caja toca la esfera (o círculo) dada.
+         *
+         * fn devuelve bool: false detiene la consulta.
+         */
+        template<typename Fn>
+        void querySphere(const VectorT& center, float radius, Fn&& fn) const {
+            const float radiusSquared = radius * radius;
+            traverse([&](const VectorT& boxMin, const VectorT& boxMax) {
+                return boxDistanceSquared(boxMin, boxMax, center) <= radiusSquared;
+            }, fn);
+        }
+
+        /**
+         * @brief Llama a fn(proxy) por cada objeto cuya caja puede ser visible (solo octree).
+         *
+         * Cuando la caja holgada de un nodo queda entera dentro del frustum, los objetos de su
+         * subárbol se aceptan sin más pruebas. fn devuelve bool: false detiene la consulta.
+         */
+        template<typename Fn>
+        void query(const CFrustum& frustum, Fn&& fn) const {
+            static_assert(Dimensions == 3, "El frustum solo existe en 3D");
+            const Node* stack[kStackSize];
+            int top = 0;
+            stack[top++] = root;
+            while (top > 0) {
+                const Node* node = stack[--top];
+                for (const Chunk* chunk = node->chunks; chunk != nullptr; chunk = chunk->next) {
+                    for (uint32_t i = 0; i < chunk->count; ++i) {
+                        if (frustum.intersects(CAABB(chunk->min[i], chunk->max[i])) && !fn(chunk->proxies[i])) {
+                            return;
+                        }
+                    }
+                }
+                for (int child = 0; child < kChildren; ++child) {
+                    const Node* next = node->children[child];
+                    if (next == nullptr) {
+                        continue;
+                    }
+                    CAABB loose;
+                    childBounds(node, child, loose.min, loose.max);
+                    if (!frustum.intersects(loose)) {
+                        continue;
+                    }
+                    if (frustum.contains(loose)) {
+                        if (!reportSubtree(next, fn)) {
+                            return;
+                        }
+                        continue;
+                    }
+                    stack[top++] = next;
+                }
+            }
+        }
+
+        /**
+         * @brief Recorre los objetos que el rayo origin + t * direction (t en [0, maxT]) puede tocar.
+         *
+         * fn(proxy, maxT) prueba el objeto real y devuelve el nuevo límite: el parámetro del
+         * impacto para quedarse con el más cercano, maxT para seguir sin recortar o 0 para
+         * terminar. Los hijos se visitan de cerca a lejos.
+         */
+        template<typename Fn>
+        void raycast(const VectorT& origin, const VectorT& direction, float maxT, Fn&& fn) const {
+            float inverse[Dimensions];
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                inverse[axis] = 1.0f / direction[axis];
+            }
+            struct Entry {
+                const Node* node;
+                float tEnter;
+            };
+            Entry stack[kStackSize];
+            int top = 0;
+            stack[top++] = { root, 0.0f };
+            float tEnter = 0.0f;
+            while (top > 0 && maxT > 0.0f) {
+                Entry entry = stack[--top];
+                // maxT puede haberse recortado desde que se apiló.
+                if (entry.tEnter > maxT) {
+                    continue;
+                }
+                const Node* node = entry.node;
+                for (const Chunk* chunk = node->chunks; chunk != nullptr; chunk = chunk->next) {
+                    for (uint32_t i = 0; i < chunk->count && maxT > 0.0f; ++i) {
+                        if (rayHitsBox(chunk->min[i], chunk->max[i], origin, inverse, maxT, tEnter)) {
+                            float result = fn(chunk->proxies[i], maxT);
+                            maxT = result < maxT ? result : maxT;
+                        }
+                    }
+                }
+                // Hijos alcanzados, ordenados de lejos a cerca para apilar el más cercano el último.
+                Entry hits[kChildren];
+                int hitCount = 0;
+                for (int child = 0; child < kChildren; ++child) {
+                    if (node->children[child] == nullptr) {
+                        continue;
+                    }
+                    VectorT looseMin;
+                    VectorT looseMax;
+                    childBounds(node, child, looseMin, looseMax);
+                    if (rayHitsBox(looseMin, looseMax, origin, inverse, maxT, tEnter)) {
+                        int slot = hitCount++;
+                        while (slot > 0 && hits[slot - 1].tEnter < tEnter) {
+                            hits[slot] = hits[slot - 1];
+                            --slot;
+                        }
+                        hits[slot] = { node->children[child], tEnter };
+                    }
+                }
+                for (int i = 0; i < hitCount; ++i) {
+                    stack[top++] = hits[i];
+                }
+            }
+        }
+
+        /**
+         * @brief Comprueba la estructura: enlaces, coordenadas de celda, bloques, contadores y
+         *        que cada objeto cabe en la caja holgada de su nodo (para pruebas y depuración).
+         */
+        bool validate() const {
+            size_t nodes = 0;
+            size_t chunks = 0;
+            size_t total = 0;
+            std::vector<const Node*> stack(1, root);
+            while (!stack.empty()) {
+                const Node* node = stack.back();
+                stack.pop_back();
+                ++nodes;
+                if (node != root && node->subtreeCount == 0) {
+                    return false;
+                }
+                VectorT looseMin;
+                VectorT looseMax;
+                looseBounds(node->cellMin, node->cellSize, looseMin, looseMax);
+                uint32_t listed = 0;
+                for (const Chunk* chunk = node->chunks; chunk != nullptr; chunk = chunk->next) {
+                    // Solo el primer bloque puede no estar lleno.
+                    if (chunk->count == 0 || (chunk != node->chunks && chunk->count != kChunkSize)) {
+                        return false;
+                    }
+                    for (uint32_t i = 0; i < chunk->count; ++i) {
+                        const Object& object = objects[chunk->proxies[i]];
+                        if (object.node != node || object.chunk != chunk || object.slot != i ||
+                            (node != root && !boxContains(looseMin, looseMax, chunk->min[i], chunk->max[i]))) {
+                            return false;
+                        }
+                    }
+                    listed += chunk->count;
+                    ++chunks;
+                }
+                uint32_t subtree = listed;
+                for (int child = 0; child < kChildren; ++child) {
+                    const Node* next = node->children[child];
+                    if (next == nullptr) {
+                        continue;
+                    }
+                    if (next->parent != node || next->depth != node->depth + 1 || next->childIndex != child) {
+                        return false;
+                    }
+                    for (int axis = 0; axis < Dimensions; ++axis) {
+                        if (next->coord[axis] != 2 * node->coord[axis] + ((child >> axis) & 1)) {
+                            return false;
+                        }
+                    }
+                    subtree += next->subtreeCount;
+                    stack.push_back(next);
+                }
+                if (listed != node->objectCount || subtree != node->subtreeCount) {
+                    return false;
+                }
+                total += listed;
+            }
+            return nodes == liveNodes && chunks == liveChunks && total == objectCount && root->subtreeCount == objectCount;
+        }
+
+    private:
+        static constexpr int kStackSize = kMaxDepth * (kChildren - 1) + kChildren; ///< Cota de la pila de recorrido.
+
+        /// Bloque de objetos de un nodo: cajas contiguas para las consultas.
+        struct Chunk {
+            Chunk* next;                    ///< Siguiente bloque del nodo (todos llenos).
+            uint32_t count;                 ///< Objetos en el bloque.
+            uint32_t proxies[kChunkSize];   ///< Proxy de cada objeto.
+            VectorT min[kChunkSize];        ///< Esquina mínima de cada caja.
+            VectorT max[kChunkSize];        ///< Esquina máxima de cada caja.
+        };
+
+        /// Nodo del árbol: una celda del mundo.
+        struct Node {
+            Node* parent;                    ///< Padre (nullptr en la raíz).
+            Node* children[kChildren];       ///< Hijos (nullptr si no existen).
+            Chunk* chunks;                   ///< Primer bloque de objetos (el único que puede no estar lleno).
+            VectorT cellMin;                 ///< Esquina mínima de la celda.
+            float cellSize;                  ///< Lado de la celda.
+            uint32_t coord[Dimensions];      ///< Coordenadas enteras de la celda a su profundidad.
+            uint32_t objectCount;            ///< Objetos en el nodo.
+            uint32_t subtreeCount;           ///< Objetos en el nodo y sus descendientes.
+            int depth;                       ///< 0 en la raíz.
+            int childIndex;                  ///< Posición en children del padre.
+        };
+
+        /// Objeto del árbol (o hueco libre si node == nullptr; slot enlaza entonces la lista libre).
+        struct Object {
+            Node* node;        ///< Nodo que lo contiene.
+            Chunk* chunk;      ///< Bloque con su caja.
+            uint32_t slot;     ///< Posición en el bloque.
+            uint32_t userData; ///< Valor del usuario.
+
+            Object() : node(nullptr), chunk(nullptr), slot(kNullProxy), userData(0) {}
+        };
+
+        bool isValid(uint32_t proxy) const {
+            return proxy < objects.size() && objects[proxy].node != nullptr;
+        }
+
+        /**
+         * Profundidad y celda (a la máxima profundidad) de la caja [min, max]. Las que no tienen
+         * el centro dentro del mundo devuelven 0.
+         */
+        int targetDepth(const VectorT& min, const VectorT& max, uint32_t* key) const {
+            float extent = 0.0f;
+            bool inside = true;
+            const float cells = static_cast<float>(1u << maxDepth);
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                float half = (max[axis] - min[axis]) * 0.5f;
+                extent = half > extent ? half : extent;
+                float scaled = ((min[axis] + half) - worldMin[axis]) * inverseLeafSize;
+                inside = inside && scaled >= 0.0f && scaled < cells;
+                key[axis] = inside ? static_cast<uint32_t>(scaled) : 0;
+            }
+            if (!inside) {
+                return 0;
+            }
+            // Bajar mientras la semiextensión quepa en media celda del nivel siguiente.
+            int depth = 0;
+            float halfCell = worldSize * 0.25f;
+            while (depth < maxDepth && extent <= halfCell) {
+                ++depth;
+                halfCell *= 0.5f;
+            }
+            return depth;
+        }
+
+        bool cellContains(const Node* node, const uint32_t* key) const {
+            if (node->depth == 0) {
+                return true;
+            }
+            int shift = maxDepth - node->depth;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                if ((key[axis] >> shift) != node->coord[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Caja holgada de una celda: ampliada media celda por cada lado, más un margen mínimo
+         * para los objetos justo en el límite (la celda del centro se calcula con otro redondeo).
+         */
+        static void looseBounds(const VectorT& cellMin, float cellSize, VectorT& looseMin, VectorT& looseMax) {
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                float margin = (cellSize + (cellMin[axis] < 0.0f ? -cellMin[axis] : cellMin[axis])) * 1e-5f;
+                looseMin[axis] = cellMin[axis] - 0.5f * cellSize - margin;
+                looseMax[axis] = cellMin[axis] + 1.5f * cellSize + margin;
+            }
+        }
+
+        /// Celda del hijo child de node (la misma aritmética al crearlo y al recorrer).
+        static void childCell(const Node* node, int child, VectorT& cellMin, float& cellSize) {
+            cellSize = node->cellSize * 0.5f;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                cellMin[axis] = node->cellMin[axis] + (((child >> axis) & 1) != 0 ? cellSize : 0.0f);
+            }
+        }
+
+        /// Caja holgada del hijo child de node, sin leer el hijo.
+        static void childBounds(const Node* node, int child, VectorT& looseMin, VectorT& looseMax) {
+            VectorT cellMin;
+            float cellSize = 0.0f;
+            childCell(node, child, cellMin, cellSize);
+            looseBounds(cellMin, cellSize, looseMin, looseMax);
+        }
+
+        /// Baja desde start (que contiene la celda key) hasta depth, creando los nodos que falten.
+        Node* descend(Node* start, int depth, const uint32_t* key) {
+            Node* node = start;
+            while (node->depth < depth) {
+                int shift = maxDepth - node->depth - 1;
+                int child = 0;
+                uint32_t coord[Dimensions];
+                for (int axis = 0; axis < Dimensions; ++axis) {
+                    uint32_t bit = (key[axis] >> shift) & 1u;
+                    child |= static_cast<int>(bit) << axis;
+                    coord[axis] = 2 * node->coord[axis] + bit;
+                }
+                if (node->children[child] == nullptr) {
+                    VectorT cellMin;
+                    float cellSize = 0.0f;
+                    childCell(node, child, cellMin, cellSize);
+                    Node* created = nodePool.create();
+                    initNode(created, node, child, coord, cellMin, cellSize);
+                    node->children[child] = created;
+                }
+                node = node->children[child];
+            }
+            return node;
+        }
+
+        void initNode(Node* node, Node* parent, int childIndex, const uint32_t* coord, const VectorT& cellMin, float cellSize) {
+            node->parent = parent;
+            for (int child = 0; child < kChildren; ++child) {
+                node->children[child] = nullptr;
+            }
+            node->chunks = nullptr;
+            node->cellMin = cellMin;
+            node->cellSize = cellSize;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                node->coord[axis] = coord[axis];
+            }
+            node->objectCount = 0;
+            node->subtreeCount = 0;
+            node->depth = parent != nullptr ? parent->depth + 1 : 0;
+            node->childIndex = childIndex;
+            ++liveNodes;
+        }
+
+        void destroyChunks(Node* node) {
+            while (node->chunks != nullptr) {
+                Chunk* next = node->chunks->next;
+                chunkPool.destroy(node->chunks);
+                --liveChunks;
+                node->chunks = next;
+            }
+        }
+
+        void destroySubtree(Node* node) {
+            if (node == nullptr) {
+                return;
+            }
+            for (int child = 0; child < kChildren; ++child) {
+                destroySubtree(node->children[child]);
+            }
+            destroyChunks(node);
+            nodePool.destroy(node);
+            --liveNodes;
+        }
+
+        /// Añade proxy al primer bloque de node y cuenta el objeto en toda la rama.
+        void link(uint32_t proxy, Node* node, const VectorT& min, const VectorT& max) {
+            Chunk* chunk = node->chunks;
+            if (chunk == nullptr || chunk->count == kChunkSize) {
+                chunk = chunkPool.create();
+                chunk->next = node->chunks;
+                chunk->count = 0;
+                node->chunks = chunk;
+                ++liveChunks;
+            }
+            uint32_t slot = chunk->count++;
+            chunk->proxies[slot] = proxy;
+            chunk->min[slot] = min;
+            chunk->max[slot] = max;
+            Object& object = objects[proxy];
+            object.node = node;
+            object.chunk = chunk;
+            object.slot = slot;
+            ++node->objectCount;
+            for (Node* branch = node; branch != nullptr; branch = branch->parent) {
+                ++branch->subtreeCount;
+            }
+        }
+
+        /**
+         * Quita proxy de su nodo: el último objeto del primer bloque ocupa su hueco, así que
+         * todos los bloques salvo el primero siguen llenos. Descuenta el objeto en toda la rama.
+         */
+        void unlink(uint32_t proxy) {
+            Object& object = objects[proxy];
+            Node* node = object.node;
+            Chunk* head = node->chunks;
+            uint32_t last = head->count - 1;
+            uint32_t moved = head->proxies[last];
+            if (moved != proxy) {
+                object.chunk->proxies[object.slot] = moved;
+                object.chunk->min[object.slot] = head->min[last];
+                object.chunk->max[object.slot] = head->max[last];
+                objects[moved].chunk = object.chunk;
+                objects[moved].slot = object.slot;
+            }
+            if (--head->count == 0) {
+                node->chunks = head->next;
+                chunkPool.destroy(head);
+                --liveChunks;
+            }
+            --node->objectCount;
+            for (Node* branch = node; branch != nullptr; branch = branch->parent) {
+                --branch->subtreeCount;
+            }
+        }
+
+        /// Devuelve al pool los nodos vacíos desde node hacia arriba.
+        void prune(Node* node) {
+            while (node != root && node->subtreeCount == 0) {
+                Node* parent = node->parent;
+                parent->children[node->childIndex] = nullptr;
+                nodePool.destroy(node);
+                --liveNodes;
+                node = parent;
+            }
+        }
+
+        /**
+         * Recorrido en profundidad: test(min, max) decide tanto si se entra en un hijo (con su
+         * caja holgada) como si se informa de un objeto. La raíz se visita siempre.
+         */
+        template<typename Test, typename Fn>
+        void traverse(const Test& test, Fn& fn) const {
+            const Node* stack[kStackSize];
+            int top = 0;
+            stack[top++] = root;
+            while (top > 0) {
+                const Node* node = stack[--top];
+                for (const Chunk* chunk = node->chunks; chunk != nullptr; chunk = chunk->next) {
+                    for (uint32_t i = 0; i < chunk->count; ++i) {
+                        if (test(chunk->min[i], chunk->max[i]) && !fn(chunk->proxies[i])) {
+                            return;
+                        }
+                    }
+                }
+                if (node->subtreeCount == node->objectCount) {
+                    continue;
+                }
+                for (int child = 0; child < kChildren; ++child) {
+                    if (node->children[child] == nullptr) {
+                        continue;
+                    }
+                    VectorT looseMin;
+                    VectorT looseMax;
+                    childBounds(node, child, looseMin, looseMax);
+                    if (test(looseMin, looseMax)) {
+                        stack[top++] = node->children[child];
+                    }
+                }
+            }
+        }
+
+        /// Informa de todos los objetos del subárbol de start sin probarlos.
+        template<typename Fn>
+        bool reportSubtree(const Node* start, Fn& fn) const {
+            const Node* stack[kStackSize];
+            int top = 0;
+            stack[top++] = start;
+            while (top > 0) {
+                const Node* node = stack[--top];
+                for (const Chunk* chunk = node->chunks; chunk != nullptr; chunk = chunk->next) {
+                    for (uint32_t i = 0; i < chunk->count; ++i) {
+                        if (!fn(chunk->proxies[i])) {
+                            return false;
+                        }
+                    }
+                }
+                for (int child = 0; child < kChildren; ++child) {
+                    if (node->children[child] != nullptr) {
+                        stack[top++] = node->children[child];
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Sin cortocircuito: en las consultas el resultado es impredecible y los saltos cuestan más
+        // que hacer todas las comparaciones.
+        static bool boxOverlaps(const VectorT& aMin, const VectorT& aMax, const VectorT& bMin, const VectorT& bMax) {
+            bool overlap = true;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                overlap &= (aMin[axis] <= bMax[axis]) & (bMin[axis] <= aMax[axis]);
+            }
+            return overlap;
+        }
+
+        static bool boxContains(const VectorT& min, const VectorT& max, const VectorT& innerMin, const VectorT& innerMax) {
+            bool inside = true;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                inside = inside && min[axis] <= innerMin[axis] && innerMax[axis] <= max[axis];
+            }
+            return inside;
+        }
+
+        static float boxDistanceSquared(const VectorT& min, const VectorT& max, const VectorT& point) {
+            float distanceSquared = 0.0f;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                float below = min[axis] - point[axis];
+                float above = point[axis] - max[axis];
+                float gap = below > above ? below : above;
+                gap = gap > 0.0f ? gap : 0.0f;
+                distanceSquared += gap * gap;
+            }
+            return distanceSquared;
+        }
+
+        /// Prueba de losas del rayo contra [min, max] con t en [0, maxT].
+        static bool rayHitsBox(const VectorT& min, const VectorT& max, const VectorT& origin, const float* inverse,
+            float maxT, float& tEnter) {
+            float tMin = 0.0f;
+            float tMax = maxT;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                float t1 = (min[axis] - origin[axis]) * inverse[axis];
+                float t2 = (max[axis] - origin[axis]) * inverse[axis];
+                if (t1 > t2) {
+                    float swap = t1;
+                    t1 = t2;
+                    t2 = swap;
+                }
+                tMin = t1 > tMin ? t1 : tMin;
+                tMax = t2 < tMax ? t2 : tMax;
+            }
+            tEnter = tMin;
+            return tMin <= tMax;
+        }
+
+        VectorT worldMin;              ///< Esquina mínima del mundo.
+        float worldSize;               ///< Lado del mundo.
+        int maxDepth;                  ///< Profundidad máxima de los nodos.
+        float inverseLeafSize;         ///< Celdas por unidad a la máxima profundidad.
+        TObjectPool<Node> nodePool;    ///< Memoria de los nodos.
+        TObjectPool<Chunk> chunkPool;  ///< Memoria de los bloques de objetos.
+        Node* root;                    ///< Raíz (siempre existe).
+        std::vector<Object> objects;   ///< Objetos indexados por proxy.
+        uint32_t freeList;             ///< Primer proxy libre.
+        size_t objectCount;            ///< Objetos vivos.
+        size_t liveNodes;              ///< Nodos vivos (incluida la raíz).
+        size_t liveChunks;             ///< Bloques de objetos vivos.
+    };
+
+    /// Octree holgado sobre cajas 3D.
+    using CLooseOctree = TLooseTree<CVector3, 3>;
+
+    /// Quadtree holgado sobre cajas 2D.
+    using CLooseQuadtree = TLooseTree<CVector2, 2>;
+
+}
@@ -0,0 +1,570 @@
+/**
+ * @file TSpatialHashGrid.h
+ * @brief Rejilla uniforme con tabla hash para búsquedas de vecinos en 2D y 3D.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "NeighborHeap.h"
+#include "../Threading/CJobSystem.h"
+#include "../Vector/CVector2.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class TSpatialHashGrid
+     * @brief Rejilla uniforme de celdas de lado cellSize sobre puntos, reconstruida entera
+     *        en cada build() (pensada para partículas y agentes que se mueven cada fotograma).
+     *
+     * Las celdas no se guardan: cada coordenada entera de celda se dispersa (hash) en una
+     * tabla de cubetas. build() es una ordenación por conteo: cuenta los puntos de cada
+     * cubeta, calcula los inicios con una suma prefija y coloca los índices. Todo vive en
+     * unos pocos arrays contiguos que se reutilizan entre reconstrucciones, sin reservas por
+     * celda. Las posiciones se copian en el mismo orden, así que los puntos de una celda
+     * están juntos en memoria durante las consultas.
+     *
+     * Dos celdas distintas pueden caer en la misma cubeta; las consultas comprueban la celda
+     * de cada punto, así que las colisiones solo cuestan tiempo.
+     *
+     * @tparam VectorT CVector2 o CVector3.
+     * @tparam Dimensions 2 o 3.
+     */
+    template<typename VectorT, int Dimensions>
+    class TSpatialHashGrid {
+        static_assert(Dimensions == 2 || Dimensions == 3, "TSpatialHashGrid solo admite 2 o 3 dimensiones");
+
+    public:
+        static constexpr size_t kParallelGrain = 16384; ///< Elementos por trabajo al reconstruir en paralelo.
+
+        /**
+         * @brief Constructor.
+         *
+         * @param cellSize Lado de las celdas; lo ideal es del orden del radio de búsqueda habitual.
+         */
+        explicit TSpatialHashGrid(float cellSize = 1.0f)
+            : cellSize(cellSize), inverseCellSize(1.0f / cellSize), tableMask(0), atomicCapacity(0) {}
+
+        /// @brief Lado de las celdas.
+        float getCellSize() const { return cellSize; }
+
+        /// @brief Número de puntos de la última reconstrucción.
+        size_t size() const { return sortedIds.size(); }
+
+        /// @brief Número de cubetas de la tabla.
+        size_t bucketCount() const { return cellStart.empty() ? 0 : cellStart.size() - 1; }
+
+        /**
+         * @brief Reconstruye la rejilla con count puntos.
+         *
+         * Los índices que devuelven las consultas son posiciones en points. Con jobs, cada fase
+         * se reparte entre los hilos y el resultado es idéntico al de la versión en serie.
+         */
+        void build(const VectorT* points, size_t count, CJobSystem* jobs = nullptr) {
+            size_t tableSize = 16;
+            while (tableSize < 2 * count) {
+                tableSize *= 2;
+            }
+            tableMask = static_cast<uint32_t>(tableSize - 1);
+            keys.resize(count);
+            cellStart.assign(tableSize + 1, 0);
+            sortedIds.resize(count);
+            sortedPositions.resize(count);
+
+            // Cubeta de cada punto y caja de celdas ocupadas.
+            occupied.clear();
+            reduceBlocks(jobs, count, occupied, [&](CellBox& result, size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    int cell[Dimensions];
+                    cellOf(points[i], cell);
+                    keys[i] = bucketOf(cell);
+                    result.include(cell);
+                }
+            }, [](CellBox& result, const CellBox& block) {
+                result.include(block.minCell);
+                result.include(block.maxCell);
+            });
+
+            // Sin hilos en el pool, los atómicos y la ordenación final solo añadirían coste.
+            if (jobs == nullptr || jobs->workerCount() == 0 || count <= kParallelGrain) {
+                sortSerial(count, tableSize);
+            }
+            else {
+                sortParallel(*jobs, count, tableSize);
+            }
+
+            forBlocks(jobs, count, [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    sortedPositions[i] = points[sortedIds[i]];
+                }
+            });
+        }
+
+        /**
+         * @brief Llama a fn(index, distanceSquared) por cada punto a distancia <= radius de center.
+         */
+        template<typename Fn>
+        void queryRadius(const VectorT& center, float radius, Fn&& fn) const {
+            if (sortedIds.empty() || !(radius >= 0.0f)) {
+                return;
+            }
+            int low[Dimensions];
+            int high[Dimensions];
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                low[axis] = std::max(cellCoordinate(center[axis] - radius), occupied.minCell[axis]);
+                high[axis] = std::min(cellCoordinate(center[axis] + radius), occupied.maxCell[axis]);
+                if (low[axis] > high[axis]) {
+                    return;
+                }
+            }
+            const float radiusSquared = radius * radius;
+            // Con más celdas que puntos (radio enorme o puntos muy dispersos) es más barato
+            // recorrerlos todos.
+            if (cellCount(low, high) > static_cast<double>(sortedIds.size())) {
+                for (size_t slot = 0; slot < sortedIds.size(); ++slot) {
+                    float distanceSquared = (sortedPositions[slot] - center).lengthSquare();
+                    if (distanceSquared <= radiusSquared) {
+                        fn(sortedIds[slot], distanceSquared);
+                    }
+                }
+                return;
+            }
+            forEachCellInBox(low, high, [&](const int* cell) {
+                visitCell(cell, [&](uint32_t slot) {
+                    float distanceSquared = (sortedPositions[slot] - center).lengthSquare();
+                    if (distanceSquared <= radiusSquared && inCell(slot, cell)) {
+                        fn(sortedIds[slot], distanceSquared);
+                    }
+                });
+            });
+        }
+
+        /**
+         * @brief Añade a result los índices de los puntos a distancia <= radius de center.
+         *
+         * @return Número de índices añadidos.
+         */
+        size_t queryRadius(const VectorT& center, float radius, std::vector<uint32_t>& result) const {
+            size_t before = result.size();
+            queryRadius(center, radius, [&](uint32_t index, float) { result.push_back(index); });
+            return result.size() - before;
+        }
+
+        /**
+         * @brief Los k puntos más cercanos a point, de más cerca a más lejos.
+         *
+         * Recorre anillos de celdas alrededor de la de point hasta que el anillo siguiente ya
+         * no puede contener nada más cerca que el k-ésimo encontrado.
+         *
+         * @param indices Destino de al menos k índices.
+         * @param distancesSquared Destino de al menos k distancias al cuadrado.
+         * @param maxDistance Solo se consideran puntos a distancia <= maxDistance.
+         * @return Número de vecinos encontrados (menos de k si no hay suficientes).
+         */
+        size_t nearest(const VectorT& point, size_t k, uint32_t* indices, float* distancesSquared,
+            float maxDistance = INFINITY) const {
+            if (k == 0 || sortedIds.empty()) {
+                return 0;
+            }
+            const float limitSquared = maxDistance * maxDistance;
+            // Centro y anillos en 64 bits: con celdas saturadas (±2^31) center ± ring no cabe en int.
+            int centerCell[Dimensions];
+            cellOf(point, centerCell);
+            int64_t center[Dimensions];
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                center[axis] = centerCell[axis];
+            }
+            size_t found = 0;
+            auto consider = [&](uint32_t slot, const int* cell) {
+                float distanceSquared = (sortedPositions[slot] - point).lengthSquare();
+                if (distanceSquared > limitSquared || (found == k && distanceSquared >= distancesSquared[0]) ||
+                    (cell != nullptr && !inCell(slot, cell))) {
+                    return;
+                }
+                if (found == k) {
+                    detail::popHeap(indices, distancesSquared, found--);
+                }
+                detail::pushHeap(indices, distancesSquared, found++, sortedIds[slot], distanceSquared);
+            };
+            // Los anillos anteriores a la caja de celdas ocupadas están vacíos.
+            int64_t firstRing = 0;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                firstRing = std::max(firstRing, occupied.minCell[axis] - center[axis]);
+                firstRing = std::max(firstRing, center[axis] - occupied.maxCell[axis]);
+            }
+            for (int64_t ring = firstRing; ; ++ring) {
+                // Si el cubo hasta este anillo tiene más celdas que puntos hay, se recorren todos.
+                if (ring > 0 && cubeCellCount(center, ring) > static_cast<double>(sortedIds.size())) {
+                    found = 0;
+                    for (uint32_t slot = 0; slot < sortedIds.size(); ++slot) {
+                        consider(slot, nullptr);
+                    }
+                    break;
+                }
+                visitRing(center, ring, [&](const int* cell) {
+                    visitCell(cell, [&](uint32_t slot) { consider(slot, cell); });
+                });
+                // Tras el anillo ring, todo punto no visitado está a más de ring * cellSize.
+                float covered = static_cast<float>(ring) * cellSize;
+                float coveredSquared = covered * covered;
+                if (coveredSquared >= limitSquared || (found == k && distancesSquared[0] <= coveredSquared) ||
+                    ringCoversOccupied(center, ring)) {
+                    break;
+                }
+            }
+            detail::sortHeap(indices, distancesSquared, found);
+            return found;
+        }
+
+        /// @brief El punto más cercano a point, o UINT32_MAX si no hay ninguno a distancia <= maxDistance.
+        uint32_t nearest(const VectorT& point, float maxDistance = INFINITY) const {
+            uint32_t index = UINT32_MAX;
+            float distanceSquared = 0.0f;
+            nearest(point, 1, &index, &distanceSquared, maxDistance);
+            return index;
+        }
+
+    private:
+        /// Caja de celdas ocupadas (vacía si min > max).
+        struct CellBox {
+            int minCell[Dimensions];
+            int maxCell[Dimensions];
+
+            CellBox() { clear(); }
+
+            void clear() {
+                for (int axis = 0; axis < Dimensions; ++axis) {
+                    minCell[axis] = INT32_MAX;
+                    maxCell[axis] = INT32_MIN;
+                }
+            }
+
+            void include(const int* cell) {
+                for (int axis = 0; axis < Dimensions; ++axis) {
+                    minCell[axis] = cell[axis] < minCell[axis] ? cell[axis] : minCell[axis];
+                    maxCell[axis] = cell[axis] > maxCell[axis] ? cell[axis] : maxCell[axis];
+                }
+            }
+        };
+
+        /**
+         * Coordenada entera de celda (redondeo hacia abajo también con negativos). Se satura a
+         * ±kCellLimit antes de convertir a int: fuera del rango de int (radios enormes o
+         * infinitos) la conversión no está definida. Un NaN acaba en kCellLimit.
+         */
+        int cellCoordinate(float value) const {
+            // Mayor float por debajo de 2^31; entero, así que el redondeo no lo desborda.
+            const float kCellLimit = 2147483520.0f;
+            float scaled = value * inverseCellSize;
+            scaled = scaled < kCellLimit ? scaled : kCellLimit;
+            scaled = scaled > -kCellLimit ? scaled : -kCellLimit;
+            int cell = static_cast<int>(scaled);
+            return scaled < static_cast<float>(cell) ? cell - 1 : cell;
+        }
+
+        void cellOf(const VectorT& point, int* cell) const {
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                cell[axis] = cellCoordinate(point[axis]);
+            }
+        }
+
+        uint32_t bucketOf(const int* cell) const {
+            uint32_t hash = static_cast<uint32_t>(cell[0]) * 73856093u ^ static_cast<uint32_t>(cell[1]) * 19349663u;
+            if constexpr (Dimensions == 3) {
+                hash ^= static_cast<uint32_t>(cell[2]) * 83492791u;
+            }
+            // Mezcla final: los bits bajos de los productos solo dependen de los bits bajos de
+            // las coordenadas.
+            hash ^= hash >> 16;
+            hash *= 0x45d9f3bu;
+            hash ^= hash >> 16;
+            return hash & tableMask;
+        }
+
+        /**
+         * Llama a fn(slot) por cada punto de la cubeta de cell. La cubeta puede mezclar celdas:
+         * quien llama comprueba inCell(slot, cell), después del filtro por distancia, que es
+         * más barato y descarta casi todo.
+         */
+        template<typename Fn>
+        void visitCell(const int* cell, Fn&& fn) const {
+            uint32_t bucket = bucketOf(cell);
+            uint32_t end = cellStart[bucket + 1];
+            for (uint32_t slot = cellStart[bucket]; slot < end; ++slot) {
+                fn(slot);
+            }
+        }
+
+        /// Indica si el punto en la posición slot de la tabla está en cell.
+        bool inCell(uint32_t slot, const int* cell) const {
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                if (cellCoordinate(sortedPositions[slot][axis]) != cell[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Llama a fn(cell) por cada celda de [low, high].
+        template<typename Fn>
+        static void forEachCellInBox(const int* low, const int* high, Fn&& fn) {
+            int cell[Dimensions];
+            if constexpr (Dimensions == 2) {
+                for (cell[1] = low[1]; cell[1] <= high[1]; ++cell[1]) {
+                    for (cell[0] = low[0]; cell[0] <= high[0]; ++cell[0]) {
+                        fn(cell);
+                    }
+                }
+            }
+            else {
+                for (cell[2] = low[2]; cell[2] <= high[2]; ++cell[2]) {
+                    for (cell[1] = low[1]; cell[1] <= high[1]; ++cell[1]) {
+                        for (cell[0] = low[0]; cell[0] <= high[0]; ++cell[0]) {
+                            fn(cell);
+                        }
+                    }
+                }
+            }
+        }
+
+        /// Llama a fn(cell) por cada celda ocupable a distancia de Chebyshev ring de center.
+        template<typename Fn>
+        void visitRing(const int64_t* center, int64_t ring, Fn&& fn) const {
+            int low[Dimensions];
+            int high[Dimensions];
+            if (!clampCube(center, ring, low, high)) {
+                return;
+            }
+            int cell[Dimensions];
+            // Las filas en el borde del anillo se recorren enteras; las interiores, solo sus extremos.
+            auto visitRow = [&](bool onShell) {
+                if (onShell) {
+                    for (cell[0] = low[0]; cell[0] <= high[0]; ++cell[0]) {
+                        fn(static_cast<const int*>(cell));
+                    }
+                    return;
+                }
+                if (center[0] - ring >= low[0]) {
+                    cell[0] = static_cast<int>(center[0] - ring);
+                    fn(static_cast<const int*>(cell));
+                }
+                if (ring > 0 && center[0] + ring <= high[0]) {
+                    cell[0] = static_cast<int>(center[0] + ring);
+                    fn(static_cast<const int*>(cell));
+                }
+            };
+            if constexpr (Dimensions == 2) {
+                for (cell[1] = low[1]; cell[1] <= high[1]; ++cell[1]) {
+                    visitRow(onShell(cell[1], center[1], ring));
+                }
+            }
+            else {
+                for (cell[2] = low[2]; cell[2] <= high[2]; ++cell[2]) {
+                    bool zShell = onShell(cell[2], center[2], ring);
+                    for (cell[1] = low[1]; cell[1] <= high[1]; ++cell[1]) {
+                        visitRow(zShell || onShell(cell[1], center[1], ring));
+                    }
+                }
+            }
+        }
+
+        /// Número de celdas de [low, high].
+        static double cellCount(const int* low, const int* high) {
+            double cells = 1.0;
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                cells *= static_cast<double>(high[axis]) - static_cast<double>(low[axis]) + 1.0;
+            }
+            return cells;
+        }
+
+        /// Indica si la coordenada cell está en el borde del anillo ring alrededor de center.
+        static bool onShell(int cell, int64_t center, int64_t ring) {
+            return cell - center == ring || center - cell == ring;
+        }
+
+        /**
+         * Recorta el cubo de radio ring alrededor de center a la caja de celdas ocupadas; el
+         * resultado cabe en int. Devuelve false si no se cortan.
+         */
+        bool clampCube(const int64_t* center, int64_t ring, int* low, int* high) const {
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                int64_t first = std::max<int64_t>(center[axis] - ring, occupied.minCell[axis]);
+                int64_t last = std::min<int64_t>(center[axis] + ring, occupied.maxCell[axis]);
+                if (first > last) {
+                    return false;
+                }
+                low[axis] = static_cast<int>(first);
+                high[axis] = static_cast<int>(last);
+            }
+            return true;
+        }
+
+        /// Celdas ocupables del cubo de radio ring alrededor de center (todos los anillos hasta ring).
+        double cubeCellCount(const int64_t* center, int64_t ring) const {
+            int low[Dimensions];
+            int high[Dimensions];
+            return clampCube(center, ring, low, high) ? cellCount(low, high) : 0.0;
+        }
+
+        /// Indica si el cubo de radio ring alrededor de center ya cubre todas las celdas ocupadas.
+        bool ringCoversOccupied(const int64_t* center, int64_t ring) const {
+            for (int axis = 0; axis < Dimensions; ++axis) {
+                if (center[axis] - ring > occupied.minCell[axis] || center[axis] + ring < occupied.maxCell[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// Ejecuta fn(first, last) sobre [0, count), en paralelo si hay trabajos y el rango es grande.
+        template<typename Fn>
+        static void forBlocks(CJobSystem* jobs, size_t count, const Fn& fn) {
+            if (jobs == nullptr || count <= kParallelGrain) {
+                fn(0, count);
+                return;
+            }
+            jobs->parallelFor(0, count, kParallelGrain, fn);
+        }
+
+        /**
+         * Acumula fn(result, first, last) sobre [0, count). En paralelo, cada bloque de
+         * kParallelGrain acumula en su copia y merge(result, copia) las une en orden.
+         */
+        template<typename Result, typename Fn, typename Merge>
+        static void reduceBlocks(CJobSystem* jobs, size_t count, Result& result, const Fn& fn, const Merge& merge) {
+            if (jobs == nullptr || count <= kParallelGrain) {
+                fn(result, 0, count);
+                return;
+            }
+            size_t blocks = (count + kParallelGrain - 1) / kParallelGrain;
+            std::vector<Result> partial(blocks);
+            jobs->parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+                for (size_t block = firstBlock; block < lastBlock; ++block) {
+                    size_t first = block * kParallelGrain;
+                    fn(partial[block], first, std::min(first + kParallelGrain, count));
+                }
+            });
+            for (const Result& block : partial) {
+                merge(result, block);
+            }
+        }
+
+        /// Ordenación por conteo estable (dentro de una cubeta, índices crecientes).
+        void sortSerial(size_t count, size_t tableSize) {
+            uint32_t* start = cellStart.data();
+            for (size_t i = 0; i < count; ++i) {
+                ++start[keys[i] + 1];
+            }
+            for (size_t bucket = 0; bucket < tableSize; ++bucket) {
+                start[bucket + 1] += start[bucket];
+            }
+            // start[b] sirve de cursor; al terminar apunta al inicio de b + 1, así que se desplaza.
+            for (size_t i = 0; i < count; ++i) {
+                sortedIds[start[keys[i]]++] = static_cast<uint32_t>(i);
+            }
+            std::memmove(start + 1, start, tableSize * sizeof(uint32_t));
+            start[0] = 0;
+        }
+
+        /**
+         * Misma ordenación con contadores atómicos: conteo y colocación en paralelo, suma prefija
+         * por bloques y, como la colocación no respeta el orden, cada cubeta se ordena al final.
+         */
+        void sortParallel(CJobSystem& jobs, size_t count, size_t tableSize) {
+            if (atomicCapacity < tableSize) {
+                atomicCounts.reset(new std::atomic<uint32_t>[tableSize]);
+                atomicCapacity = tableSize;
+            }
+            std::atomic<uint32_t>* counts = atomicCounts.get();
+            uint32_t* start = cellStart.data();
+            jobs.parallelFor(0, tableSize, kParallelGrain, [&](size_t first, size_t last) {
+                for (size_t bucket = first; bucket < last; ++bucket) {
+                    counts[bucket].store(0, std::memory_order_relaxed);
+                }
+            });
+            jobs.parallelFor(0, count, kParallelGrain, [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    counts[keys[i]].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+
+            // Suma prefija exclusiva: totales por bloque, desplazamientos en serie y bloques en paralelo.
+            size_t blocks = (tableSize + kParallelGrain - 1) / kParallelGrain;
+            std::vector<uint32_t> blockOffsets(blocks + 1, 0);
+            jobs.parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+                for (size_t block = firstBlock; block < lastBlock; ++block) {
+                    uint32_t total = 0;
+                    size_t end = std::min((block + 1) * kParallelGrain, tableSize);
+                    for (size_t bucket = block * kParallelGrain; bucket < end; ++bucket) {
+                        total += counts[bucket].load(std::memory_order_relaxed);
+                    }
+                    blockOffsets[block + 1] = total;
+                }
+            });
+            for (size_t block = 0; block < blocks; ++block) {
+                blockOffsets[block + 1] += blockOffsets[block];
+            }
+            jobs.parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+                for (size_t block = firstBlock; block < lastBlock; ++block) {
+                    uint32_t offset = blockOffsets[block];
+                    size_t end = std::min((block + 1) * kParallelGrain, tableSize);
+                    for (size_t bucket = block * kParallelGrain; bucket < end; ++bucket) {
+                        uint32_t bucketCount = counts[bucket].load(std::memory_order_relaxed);
+                        start[bucket] = offset;
+                        counts[bucket].store(offset, std::memory_order_relaxed);
+                        offset += bucketCount;
+                    }
+                }
+            });
+            start[tableSize] = static_cast<uint32_t>(count);
+
+            jobs.parallelFor(0, count, kParallelGrain, [&](size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    sortedIds[counts[keys[i]].fetch_add(1, std::memory_order_relaxed)] = static_cast<uint32_t>(i);
+                }
+            });
+            jobs.parallelFor(0, tableSize, kParallelGrain, [&](size_t first, size_t last) {
+                for (size_t bucket = first; bucket < last; ++bucket) {
+                    uint32_t* begin = sortedIds.data() + start[bucket];
+                    uint32_t* end = sortedIds.data() + start[bucket + 1];
+                    // Cubetas casi siempre de 0 a 3 elementos: inserción directa.
+                    for (uint32_t* it = begin + (begin != end ? 1 : 0); it < end; ++it) {
+                        uint32_t value = *it;
+                        uint32_t* hole = it;
+                        while (hole > begin && hole[-1] > value) {
+                            *hole = hole[-1];
+                            --hole;
+                        }
+                        *hole = value;
+                    }
+                }
+            });
+        }
+
+        float cellSize;                           ///< Lado de las celdas.
+        float inverseCellSize;                    ///< 1 / cellSize.
+        uint32_t tableMask;                       ///< Cubetas - 1 (potencia de dos).
+        CellBox occupied;                         ///< Celdas con algún punto.
+        std::vector<uint32_t> keys;               ///< Cubeta de cada punto de entrada.
+        std::vector<uint32_t> cellStart;          ///< Inicio de cada cubeta en sortedIds (más el final).
+        std::vector<uint32_t> sortedIds;          ///< Índices de los puntos agrupados por cubeta.
+        std::vector<VectorT> sortedPositions;     ///< Posiciones en el mismo orden que sortedIds.
+        std::unique_ptr<std::atomic<uint32_t>[]> atomicCounts; ///< Contadores de la reconstrucción paralela.
+        size_t atomicCapacity;                    ///< Tamaño de atomicCounts.
+    };
+
+    /// Rejilla hash sobre puntos 2D.
+    using CSpatialHashGrid2D = TSpatialHashGrid<CVector2, 2>;
+
+    /// Rejilla hash sobre puntos 3D.
+    using CSpatialHashGrid3D = TSpatialHashGrid<CVector3, 3>;
+
+}
@@ -92,7 +92,7 @@ namespace EngineUtilities {
             invOut[6] = -m_[0] * m_[6] * m_[15] + m_[0] * m_[7] * m_[14] + m_[4] * m_[2] * m_[15] - m_[4] * m_[3] * m_[14] - m_[12] * m_[2] * m_[7] + m_[12] * m_[3] * m_[6];
             invOut[7] = m_[0] * m_[6] * m_[11] - m_[0] * m_[7] * m_[10] - m_[4] * m_[2] * m_[11] + m_[4] * m_[3] * m_[10] + m_[8] * m_[2] * m_[7] - m_[8] * m_[3] * m_[6];
             invOut[8] = m_[4] * m_[9] * m_[15] - m_[4] * m_[11] * m_[13] - m_[8] * m_[5] * m_[15] + m_[8] * m_[7] * m_[13] + m_[12] * m_[5] * m_[11] - m_[12] * m_[7] * m_[9];
-            invOut[9] = -m_[0] * m_[9] * m_[15] + m_[0] * m_[11] * m_[13] + m_[8] * m_[1] * m_[15] - m_[8] * m_[3] * m_[13] + m_[12] * m_[1] * m_[11] - m_[12] * m_[3] * m_[9];
+            invOut[9] = -m_[0] * m_[9] * m_[15] + m_[0] * m_[11] * m_[13] + m_[8] * m_[1] * m_[15] - m_[8] * m_[3] * m_[13] - m_[12] * m_[1] * m_[11] + m_[12] * m_[3] * m_[9];
             invOut[10] = m_[0] * m_[5] * m_[15] - m_[0] * m_[7] * m_[13] - m_[4] * m_[1] * m_[15] + m_[4] * m_[3] * m_[13] + m_[12] * m_[1] * m_[7] - m_[12] * m_[3] * m_[5];
             invOut[11] = -m_[0] * m_[5] * m_[11] + m_[0] * m_[7] * m_[9] + m_[4] * m_[1] * m_[11] - m_[4] * m_[3] * m_[9] - m_[8] * m_[1] * m_[7] + m_[8] * m_[3] * m_[5];
             invOut[12] = -m_[4] * m_[9] * m_[14] + m_[4] * m_[10] * m_[13] + m_[8] * m_[5] * m_[14] - m_[8] * m_[6] * m_[13] - m_[12] * m_[5] * m_[10] + m_[12] * m_[6] * m_[9];
@@ -0,0 +1,325 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+namespace EngineUtilities {
+    /**
+     * @brief Clase CEpochManager: reclamación de memoria por épocas para datos leídos por muchos hilos.
+     *
+     * Los lectores marcan una sección crítica con CEpochGuard y, dentro de ella, pueden
+     * usar sin recuento de referencias cualquier objeto que hayan encontrado a través de
+     * un puntero atómico. El escritor que desengancha un objeto no lo borra, sino que lo
+     * entrega a retire(); el objeto se libera cuando la época global ha avanzado dos veces
+     * desde entonces, lo que garantiza que ningún lector que pudiera verlo sigue activo.
+     *
+     * Entrar y salir de una sección crítica solo escribe en el registro propio del hilo
+     * (una línea de caché que nadie más escribe), sin operaciones de
+     * lectura-modificación-escritura compartidas. El coste se traslada a los escritores:
+     * cada collectThreshold retiradas se intenta avanzar la época recorriendo los registros
+     * de los hilos y se liberan los objetos ya seguros.
+     *
+     * Cada hilo libera los objetos que él mismo retiró. Las secciones críticas pueden
+     * anidarse. Un lector que se queda mucho tiempo dentro de una sección impide avanzar
+     * la época y hace crecer las listas de objetos pendientes.
+     *
+     * Admite hasta kMaxThreads hilos vivos a la vez que usen cualquier CEpochManager; el
+     * siguiente hilo que entre aborta el proceso.
+     */
+    class CEpochManager
+    {
+    public:
+        static constexpr size_t kMaxThreads = 256; ///< Hilos vivos simultáneos admitidos.
+
+        /**
+         * @brief Constructor.
+         *
+         * @param collectThreshold Objetos retirados por un hilo entre dos intentos de liberación.
+         */
+        explicit CEpochManager(size_t collectThreshold = 64)
+            : collectThreshold(collectThreshold > 0 ? collectThreshold : 1),
+            globalEpoch(1),
+            records(new Record[kMaxThreads])
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Libera todos los objetos pendientes. Ningún hilo puede estar dentro de una sección
+         * crítica de este gestor.
+         */
+        ~CEpochManager()
+        {
+            for (size_t i = 0; i < kMaxThreads; ++i)
+            {
+                for (const Retired& retired : records[i].retired)
+                {
+                    retired.deleter(retired.object);
+                }
+            }
+            delete[] records;
+        }
+
+        // Prohibir la copia: los registros de los hilos pertenecen a este gestor.
+        CEpochManager(const CEpochManager&) = delete;
+        CEpochManager& operator=(const CEpochManager&) = delete;
+
+        /**
+         * @brief Entra en una sección crítica (normalmente a través de CEpochGuard).
+         */
+        void enter()
+        {
+            Record& record = localRecord();
+            if (record.depth++ == 0)
+            {
+                uint64_t epoch = globalEpoch.load(std::memory_order_relaxed);
+                record.state.store((epoch << 1) | 1, std::memory_order_release);
+                // El anuncio debe ser visible antes de leer cualquier puntero compartido.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        /**
+         * @brief Sale de la sección crítica abierta con enter().
+         */
+        void exit()
+        {
+            Record& record = localRecord();
+            assert(record.depth > 0);
+            if (--record.depth == 0)
+            {
+                record.state.store(0, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief Retira un objeto creado con new que ya no es accesible desde las estructuras compartidas.
+         *
+         * Se destruirá con delete cuando ningún lector pueda seguir usándolo. Puede llamarse
+         * dentro o fuera de una sección crítica.
+         *
+         * @param object Objeto desenganchado (puede ser nullptr).
+         */
+        template<typename T>
+        void retire(T* object)
+        {
+            if (object != nullptr)
+            {
+                retire(object, [](void* pointer) { delete static_cast<T*>(pointer); });
+            }
+        }
+
+        /**
+         * @brief Retira un objeto con un liberador propio (por ejemplo, TObjectPool::destroy).
+         *
+         * @param object Objeto desenganchado.
+         * @param deleter Función que lo libera.
+         */
+        void retire(void* object, void (*deleter)(void*))
+        {
+            Record& record = localRecord();
+            // El desenganche hecho por el llamador debe quedar ordenado antes de leer la época.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            record.retired.push_back(Retired{ object, deleter, globalEpoch.load(std::memory_order_acquire) });
+            if (record.retired.size() % collectThreshold == 0)
+            {
+                collect();
+            }
+        }
+
+        /**
+         * @brief Intenta avanzar la época y libera los objetos de este hilo que ya son seguros.
+         *
+         * @return Número de objetos liberados.
+         */
+        size_t collect()
+        {
+            tryAdvance();
+            uint64_t epoch = globalEpoch.load(std::memory_order_acquire);
+            std::vector<Retired>& retired = localRecord().retired;
+            size_t kept = 0;
+            for (size_t i = 0; i < retired.size(); ++i)
+            {
+                if (retired[i].epoch + 2 <= epoch)
+                {
+                    retired[i].deleter(retired[i].object);
+                }
+                else
+                {
+                    retired[kept++] = retired[i];
+                }
+            }
+            size_t freed = retired.size() - kept;
+            retired.resize(kept);
+            return freed;
+        }
+
+        /**
+         * @brief Número de objetos retirados por este hilo que aún no se han liberado.
+         */
+        size_t pendingCount()
+        {
+            return localRecord().retired.size();
+        }
+
+        /**
+         * @brief Época global actual.
+         */
+        uint64_t epoch() const
+        {
+            return globalEpoch.load(std::memory_order_acquire);
+        }
+
+    private:
+        /// Objeto retirado y época en la que se retiró.
+        struct Retired
+        {
+            void* object;
+            void (*deleter)(void*);
+            uint64_t epoch;
+        };
+
+        /// Estado de un hilo dentro de este gestor. Solo state lo leen otros hilos.
+        struct alignas(64) Record
+        {
+            std::atomic<uint64_t> state{ 0 }; ///< (época << 1) | 1 dentro de una sección crítica; 0 fuera.
+            unsigned depth = 0;               ///< Profundidad de anidamiento (solo el hilo propietario).
+            std::vector<Retired> retired;     ///< Objetos pendientes (solo el hilo propietario).
+        };
+
+        /// Índices de hilo compartidos por todos los gestores; se reutilizan al terminar un hilo.
+        struct ThreadIndices
+        {
+            std::mutex mutex;
+            std::vector<size_t> freeIndices;
+            std::atomic<size_t> used{ 0 }; ///< Índices repartidos alguna vez (límite del recorrido).
+        };
+
+        /// Asocia el hilo actual a un índice y lo devuelve al terminar el hilo.
+        struct ThreadSlot
+        {
+            size_t index;
+
+            ThreadSlot()
+            {
+                ThreadIndices& indices = getThreadIndices();
+                std::lock_guard<std::mutex> lock(indices.mutex);
+                if (!indices.freeIndices.empty())
+                {
+                    index = indices.freeIndices.back();
+                    indices.freeIndices.pop_back();
+                }
+                else
+                {
+                    index = indices.used.load(std::memory_order_relaxed);
+                    // Fallo duro también en Release: un índice más allá de la tabla
+                    // escribiría fuera de records[].
+                    if (index >= kMaxThreads)
+                    {
+                        std::fputs("CEpochManager: demasiados hilos vivos\n", stderr);
+                        std::abort();
+                    }
+                    indices.used.store(index + 1, std::memory_order_release);
+                }
+            }
+
+            ~ThreadSlot()
+            {
+                ThreadIndices& indices = getThreadIndices();
+                std::lock_guard<std::mutex> lock(indices.mutex);
+                indices.freeIndices.push_back(index);
+            }
+        };
+
+        static ThreadIndices& getThreadIndices()
+        {
+            static ThreadIndices* indices = new ThreadIndices();
+            return *indices;
+        }
+
+        Record& localRecord()
+        {
+            thread_local ThreadSlot slot;
+            return records[slot.index];
+        }
+
+        /// Avanza la época si todos los hilos activos la han observado.
+        bool tryAdvance()
+        {
+            uint64_t epoch = globalEpoch.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            size_t used = getThreadIndices().used.load(std::memory_order_acquire);
+            uint64_t current = (epoch << 1) | 1;
+            for (size_t i = 0; i < used; ++i)
+            {
+                uint64_t state = records[i].state.load(std::memory_order_acquire);
+                if (state != 0 && state != current)
+                {
+                    return false;
+                }
+            }
+            return globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+        }
+
+        const size_t collectThreshold;
+        alignas(64) std::atomic<uint64_t> globalEpoch; ///< Época global (solo crece).
+        Record* const records;                         ///< Un registro por índice de hilo.
+    };
+
+    /**
+     * @brief Sección crítica RAII de CEpochManager: mientras existe, los objetos leídos no se liberan.
+     */
+    class CEpochGuard
+    {
+    public:
+        explicit CEpochGuard(CEpochManager& manager) : manager(manager)
+        {
+            manager.enter();
+        }
+
+        ~CEpochGuard()
+        {
+            manager.exit();
+        }
+
+        CEpochGuard(const CEpochGuard&) = delete;
+        CEpochGuard& operator=(const CEpochGuard&) = delete;
+
+    private:
+        CEpochManager& manager;
+    };
+}
@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include "CLinearAllocator.h"
+
+namespace EngineUtilities {
+    /**
+   * @brief Clase CFrameAllocator: asignador por frame con doble búfer.
+   *
+   * Mantiene dos arenas lineales y alterna entre ellas en cada beginFrame(). Lo
+   * reservado durante un frame sigue siendo válido durante el frame siguiente (por
+   * ejemplo, para que el render consuma la lista de visibles del frame anterior) y se
+   * descarta automáticamente dos frames después.
+   */
+    class CFrameAllocator
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacityPerFrame Tamaño en bytes de cada una de las dos arenas.
+         */
+        explicit CFrameAllocator(size_t capacityPerFrame)
+            : arenas{ CLinearAllocator(capacityPerFrame), CLinearAllocator(capacityPerFrame) },
+            current(0)
+        {
+        }
+
+        /**
+         * @brief Inicia un nuevo frame.
+         *
+         * Cambia a la otra arena y descarta lo que se reservó en ella hace dos frames.
+         */
+        void beginFrame()
+        {
+            current ^= 1;
+            arenas[current].reset();
+        }
+
+        /**
+         * @brief Reserva memoria válida durante este frame y el siguiente.
+         *
+         * @param size Tamaño en bytes.
+         * @param alignment Alineación requerida (potencia de dos).
+         * @return Puntero a la memoria reservada, o nullptr si la arena del frame está llena.
+         */
+        void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            return arenas[current].allocate(size, alignment);
+        }
+
+        /**
+         * @brief Reserva memoria sin inicializar para count objetos de tipo T.
+         */
+        template<typename T>
+        T* allocateArray(size_t count)
+        {
+            return arenas[current].allocateArray<T>(count);
+        }
+
+        /**
+         * @brief Las asignaciones se liberan en bloque al reutilizar la arena.
+         */
+        void deallocate(void*, size_t) {}
+
+        /// @brief Arena del frame actual.
+        CLinearAllocator& currentFrame() { return arenas[current]; }
+
+        /// @brief Arena del frame anterior (sus datos siguen siendo válidos).
+        CLinearAllocator& previousFrame() { return arenas[current ^ 1]; }
+
+    private:
+        CLinearAllocator arenas[2]; ///< Arenas que se alternan en cada frame.
+        int current;                ///< Índice de la arena del frame actual.
+    };
+}
@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace EngineUtilities {
+    /**
+   * @brief Clase CLinearAllocator: asignador lineal (arena) de puntero incremental.
+   *
+   * Reserva un único bloque al construirse y atiende cada petición avanzando un
+   * desplazamiento, por lo que asignar cuesta unas pocas instrucciones y no hay
+   * fragmentación. Las asignaciones no se liberan individualmente: reset() descarta
+   * todas a la vez. Pensado para datos temporales (listas de culling, paletas de
+   * skinning) de tipos trivialmente destruibles como CVector3 o Matriz4x4.
+   *
+   * Si la petición no cabe, allocate() devuelve nullptr.
+   */
+    class CLinearAllocator
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Tamaño en bytes del bloque que gestiona la arena.
+         */
+        explicit CLinearAllocator(size_t capacity)
+            : buffer(static_cast<unsigned char*>(::operator new(capacity, std::align_val_t(kBufferAlignment)))),
+            capacityBytes(capacity),
+            offset(0),
+            peakOffset(0)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Devuelve el bloque al sistema. No llama a los destructores de los objetos creados.
+         */
+        ~CLinearAllocator()
+        {
+            ::operator delete(buffer, std::align_val_t(kBufferAlignment));
+        }
+
+        // Prohibir la copia: la arena es dueña exclusiva de su bloque.
+        CLinearAllocator(const CLinearAllocator&) = delete;
+        CLinearAllocator& operator=(const CLinearAllocator&) = delete;
+
+        /**
+         * @brief Reserva memoria dentro de la arena.
+         *
+         * @param size Tamaño en bytes.
+         * @param alignment Alineación requerida (potencia de dos).
+         * @return Puntero a la memoria reservada, o nullptr si no hay espacio suficiente.
+         */
+        void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+            uintptr_t current = base + offset;
+            uintptr_t aligned = (current + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+            size_t alignedOffset = static_cast<size_t>(aligned - base);
+            // Se compara con lo que queda en lugar de sumar: alignedOffset + size podría desbordar.
+            if (alignedOffset > capacityBytes || size > capacityBytes - alignedOffset)
+            {
+                return nullptr;
+            }
+            offset = alignedOffset + size;
+            if (offset > peakOffset)
+            {
+                peakOffset = offset;
+            }
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        /**
+         * @brief Reserva memoria sin inicializar para count objetos de tipo T.
+         *
+         * @param count Número de objetos.
+         * @return Puntero al primer elemento, o nullptr si no hay espacio suficiente (o si
+         *         sizeof(T) * count no cabe en size_t).
+         */
+        template<typename T>
+        T* allocateArray(size_t count)
+        {
+            if (count > SIZE_MAX / sizeof(T))
+            {
+                return nullptr;
+            }
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        /**
+         * @brief Construye un objeto dentro de la arena.
+         *
+         * El destructor del objeto no se llamará: úsese con tipos trivialmente destruibles.
+         *
+         * @param args Argumentos del constructor de T.
+         * @return Puntero al objeto, o nullptr si no hay espacio suficiente.
+         */
+        template<typename T, typename... Args>
+        T* create(Args&&... args)
+        {
+            void* memory = allocate(sizeof(T), alignof(T));
+            return memory != nullptr ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+        }
+
+        /**
+         * @brief Las asignaciones de una arena no se liberan individualmente.
+         *
+         * Existe para que la arena pueda usarse con TAllocatorAdapter.
+         */
+        void deallocate(void*, size_t) {}
+
+        /**
+         * @brief Descarta todas las asignaciones. El pico de uso se conserva.
+         */
+        void reset() { offset = 0; }
+
+        /// @brief Tamaño total de la arena en bytes.
+        size_t capacity() const { return capacityBytes; }
+
+        /// @brief Bytes en uso (incluido el relleno de alineación).
+        size_t used() const { return offset; }
+
+        /// @brief Bytes libres al final de la arena.
+        size_t remaining() const { return capacityBytes - offset; }
+
+        /// @brief Máximo de bytes usados desde la construcción.
+        size_t peak() const { return peakOffset; }
+
+        /**
+         * @brief Comprueba si un puntero pertenece al bloque de la arena.
+         */
+        bool owns(const void* ptr) const
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(ptr);
+            return bytes >= buffer && bytes < buffer + capacityBytes;
+        }
+
+    protected:
+        static constexpr size_t kBufferAlignment = 64; ///< Alineación del bloque (una línea de caché).
+
+        unsigned char* buffer; ///< Bloque gestionado.
+        size_t capacityBytes;  ///< Tamaño del bloque.
+        size_t offset;         ///< Desplazamiento de la siguiente asignación.
+        size_t peakOffset;     ///< Máximo desplazamiento alcanzado.
+    };
+}
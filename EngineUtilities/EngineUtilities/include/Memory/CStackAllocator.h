@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include "CLinearAllocator.h"
+
+namespace EngineUtilities {
+    /**
+   * @brief Clase CStackAllocator: asignador de pila con marcadores.
+   *
+   * Funciona como CLinearAllocator, pero permite guardar la posición actual con
+   * getMarker() y liberar después todo lo reservado a partir de ella con
+   * freeToMarker(). Scope hace lo mismo de forma automática al salir de un ámbito,
+   * lo que permite anidar datos temporales de distintas fases de un frame.
+   */
+    class CStackAllocator : public CLinearAllocator
+    {
+    public:
+        using Marker = size_t; ///< Posición guardada de la pila.
+
+        /**
+         * @brief Clase Scope: guarda un marcador y libera hasta él al destruirse.
+         */
+        class Scope
+        {
+        public:
+            explicit Scope(CStackAllocator& allocator)
+                : allocator(allocator), marker(allocator.getMarker())
+            {
+            }
+
+            ~Scope()
+            {
+                allocator.freeToMarker(marker);
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            CStackAllocator& allocator; ///< Pila a la que pertenece el ámbito.
+            Marker marker;              ///< Posición al entrar en el ámbito.
+        };
+
+        /**
+         * @brief Constructor.
+         *
+         * @param capacity Tamaño en bytes de la pila.
+         */
+        explicit CStackAllocator(size_t capacity) : CLinearAllocator(capacity) {}
+
+        /**
+         * @brief Obtener la posición actual de la pila.
+         */
+        Marker getMarker() const { return offset; }
+
+        /**
+         * @brief Libera todo lo reservado después del marcador.
+         *
+         * @param marker Marcador obtenido con getMarker() (ignorado si es posterior a la cima).
+         */
+        void freeToMarker(Marker marker)
+        {
+            if (marker <= offset)
+            {
+                offset = marker;
+            }
+        }
+
+        /**
+         * @brief Libera la asignación si es la última de la pila; en otro caso no hace nada.
+         *
+         * @param ptr Puntero devuelto por allocate().
+         * @param size Tamaño que se pidió en allocate().
+         */
+        void deallocate(void* ptr, size_t size)
+        {
+            unsigned char* bytes = static_cast<unsigned char*>(ptr);
+            if (bytes + size == buffer + offset)
+            {
+                offset = static_cast<size_t>(bytes - buffer);
+            }
+        }
+    };
+}
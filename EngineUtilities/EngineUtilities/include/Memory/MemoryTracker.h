@@ -0,0 +1,334 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+
+/**
+ * @brief Activa la instrumentación de memoria de los punteros inteligentes.
+ *
+ * Con valor 0 (por defecto) las macros EU_TRACK_* no generan código. Debe tener el mismo
+ * valor en todas las unidades de compilación que instancien los mismos tipos, por lo que
+ * conviene definirlo desde el sistema de compilación y no en el código.
+ */
+#ifndef ENGINEUTILITIES_MEMORY_TRACKING
+#define ENGINEUTILITIES_MEMORY_TRACKING 0
+#endif
+
+#if ENGINEUTILITIES_MEMORY_TRACKING
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+namespace EngineUtilities {
+    /**
+     * @brief Estadísticas de memoria agregadas de un tipo.
+     */
+    struct TypeMemoryStats
+    {
+        std::string typeName;   ///< Nombre del tipo.
+        uint64_t allocations;   ///< Objetos que pasaron a ser gestionados.
+        uint64_t frees;         ///< Objetos liberados (o cuya propiedad se cedió).
+        uint64_t liveObjects;   ///< Objetos gestionados en este momento.
+        int64_t liveBytes;      ///< Bytes gestionados en este momento.
+        int64_t peakBytes;      ///< Máximo de bytes gestionados a la vez.
+        uint64_t refIncrements; ///< Incrementos del recuento de referencias.
+        uint64_t refDecrements; ///< Decrementos del recuento de referencias.
+    };
+
+    /**
+   * @brief Clase MemoryTracker: contadores de memoria por tipo para TSharedPointer,
+   *        TUniquePtr y TStaticPtr.
+   *
+   * Los contadores de eventos (asignaciones, liberaciones y operaciones del recuento)
+   * son por hilo: cada hilo escribe solo en su propio bloque, sin instrucciones atómicas
+   * de lectura-modificación-escritura ni bloqueos, y snapshot() los suma bajo demanda.
+   * Los bytes vivos y el pico se mantienen en un contador atómico por tipo, ya que el
+   * pico necesita una vista global.
+   *
+   * Solo existe si ENGINEUTILITIES_MEMORY_TRACKING vale 1; en otro caso las macros
+   * EU_TRACK_* se eliminan por completo.
+   */
+    class MemoryTracker
+    {
+    public:
+        static constexpr size_t kMaxTypes = 256; ///< Tipos distintos que se registran (el último agrupa el resto).
+
+        /**
+         * @brief Registra que un objeto de tipo T pasa a estar gestionado.
+         *
+         * @param bytes Bytes del objeto.
+         */
+        template<typename T>
+        static void onAllocate(size_t bytes)
+        {
+            size_t type = typeIndex<T>();
+            increment(type, kAllocations);
+            TypeEntry& entry = types()[type];
+            int64_t live = entry.liveBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed)
+                + static_cast<int64_t>(bytes);
+            int64_t peak = entry.peakBytes.load(std::memory_order_relaxed);
+            while (live > peak &&
+                !entry.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /**
+         * @brief Registra que un objeto de tipo T deja de estar gestionado.
+         *
+         * @param bytes Bytes del objeto.
+         */
+        template<typename T>
+        static void onFree(size_t bytes)
+        {
+            size_t type = typeIndex<T>();
+            increment(type, kFrees);
+            types()[type].liveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+        }
+
+        /// @brief Registra un incremento del recuento de referencias de un TSharedPointer<T>.
+        template<typename T>
+        static void onRefIncrement()
+        {
+            increment(typeIndex<T>(), kRefIncrements);
+        }
+
+        /// @brief Registra un decremento del recuento de referencias de un TSharedPointer<T>.
+        template<typename T>
+        static void onRefDecrement()
+        {
+            increment(typeIndex<T>(), kRefDecrements);
+        }
+
+        /**
+         * @brief Suma los contadores de todos los hilos.
+         *
+         * Los valores son coherentes por contador, pero no forman una foto atómica del
+         * conjunto si otros hilos siguen trabajando.
+         *
+         * @return Estadísticas de cada tipo registrado.
+         */
+        static std::vector<TypeMemoryStats> snapshot()
+        {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            std::vector<TypeMemoryStats> result;
+            for (size_t type = 0; type < registry.typeCount; ++type)
+            {
+                uint64_t totals[kCounterCount] = {};
+                for (ThreadCounters* counters : registry.threads)
+                {
+                    for (size_t c = 0; c < kCounterCount; ++c)
+                    {
+                        totals[c] += counters->values[type][c].load(std::memory_order_relaxed);
+                    }
+                }
+
+                const TypeEntry& entry = types()[type];
+                TypeMemoryStats stats;
+                stats.typeName = entry.name;
+                stats.allocations = totals[kAllocations];
+                stats.frees = totals[kFrees];
+                stats.liveObjects = totals[kAllocations] >= totals[kFrees] ? totals[kAllocations] - totals[kFrees] : 0;
+                stats.liveBytes = entry.liveBytes.load(std::memory_order_relaxed);
+                stats.peakBytes = entry.peakBytes.load(std::memory_order_relaxed);
+                stats.refIncrements = totals[kRefIncrements];
+                stats.refDecrements = totals[kRefDecrements];
+                result.push_back(stats);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Escribe una tabla con las estadísticas de cada tipo.
+         *
+         * @param os Flujo de salida.
+         */
+        static void report(std::ostream& os)
+        {
+            os << "=== MemoryTracker ===\n";
+            for (const TypeMemoryStats& stats : snapshot())
+            {
+                os << stats.typeName
+                    << ": asignaciones=" << stats.allocations
+                    << " liberaciones=" << stats.frees
+                    << " vivos=" << stats.liveObjects
+                    << " bytesVivos=" << stats.liveBytes
+                    << " picoBytes=" << stats.peakBytes
+                    << " ref++=" << stats.refIncrements
+                    << " ref--=" << stats.refDecrements << "\n";
+            }
+        }
+
+    private:
+        enum Counter
+        {
+            kAllocations,
+            kFrees,
+            kRefIncrements,
+            kRefDecrements,
+            kCounterCount
+        };
+
+        /// Contadores de un hilo: solo su hilo propietario los escribe.
+        struct ThreadCounters
+        {
+            std::atomic<uint64_t> values[kMaxTypes][kCounterCount] = {};
+            bool owned = false; ///< true mientras un hilo vivo lo usa (protegido por Registry::mutex).
+        };
+
+        /// Datos globales de un tipo.
+        struct TypeEntry
+        {
+            std::string name;
+            std::atomic<int64_t> liveBytes{ 0 };
+            std::atomic<int64_t> peakBytes{ 0 };
+        };
+
+        struct Registry
+        {
+            std::mutex mutex;
+            std::vector<ThreadCounters*> threads; ///< Bloques de todos los hilos (nunca se liberan).
+            size_t typeCount = 0;
+        };
+
+        /// Asocia el hilo actual a un bloque de contadores y lo libera al terminar el hilo.
+        struct ThreadSlot
+        {
+            ThreadCounters* counters;
+
+            ThreadSlot() : counters(acquireCounters()) {}
+
+            ~ThreadSlot()
+            {
+                // El bloque conserva sus valores: otro hilo puede reutilizarlo y seguir sumando.
+                Registry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                counters->owned = false;
+            }
+        };
+
+        static Registry& getRegistry()
+        {
+            static Registry* registry = new Registry();
+            return *registry;
+        }
+
+        static TypeEntry* types()
+        {
+            static TypeEntry* entries = new TypeEntry[kMaxTypes];
+            return entries;
+        }
+
+        static ThreadCounters* acquireCounters()
+        {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (ThreadCounters* counters : registry.threads)
+            {
+                if (!counters->owned)
+                {
+                    counters->owned = true;
+                    return counters;
+                }
+            }
+            ThreadCounters* counters = new ThreadCounters();
+            counters->owned = true;
+            registry.threads.push_back(counters);
+            return counters;
+        }
+
+        static void increment(size_t type, Counter counter)
+        {
+            thread_local ThreadSlot slot;
+            std::atomic<uint64_t>& value = slot.counters->values[type][counter];
+            value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        template<typename T>
+        static size_t typeIndex()
+        {
+            static const size_t index = registerType(typeid(T).name());
+            return index;
+        }
+
+        static size_t registerType(const char* mangledName)
+        {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            if (registry.typeCount == kMaxTypes)
+            {
+                return kMaxTypes - 1;
+            }
+            size_t index = registry.typeCount++;
+            types()[index].name = index == kMaxTypes - 1 ? std::string("<otros tipos>") : demangle(mangledName);
+            return index;
+        }
+
+        static std::string demangle(const char* mangledName)
+        {
+#if defined(__GNUG__)
+            int status = 0;
+            char* readable = abi::__cxa_demangle(mangledName, nullptr, nullptr, &status);
+            if (status == 0 && readable != nullptr)
+            {
+                std::string result(readable);
+                std::free(readable);
+                return result;
+            }
+#endif
+            return std::string(mangledName);
+        }
+    };
+}
+
+#define EU_TRACK_ALLOCATE(T, bytes) ::EngineUtilities::MemoryTracker::onAllocate<T>(bytes)
+#define EU_TRACK_FREE(T, bytes) ::EngineUtilities::MemoryTracker::onFree<T>(bytes)
+#define EU_TRACK_REF_INCREMENT(T) ::EngineUtilities::MemoryTracker::onRefIncrement<T>()
+#define EU_TRACK_REF_DECREMENT(T) ::EngineUtilities::MemoryTracker::onRefDecrement<T>()
+
+#else
+
+#define EU_TRACK_ALLOCATE(T, bytes) ((void)0)
+#define EU_TRACK_FREE(T, bytes) ((void)0)
+#define EU_TRACK_REF_INCREMENT(T) ((void)0)
+#define EU_TRACK_REF_DECREMENT(T) ((void)0)
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace EngineUtilities {
+    /**
+   * @brief Clase TAllocatorAdapter: adapta un asignador del motor a la interfaz de los
+   *        contenedores estándar.
+   *
+   * Arena puede ser cualquier asignador con allocate(size, alignment) y
+   * deallocate(ptr, size), como CLinearAllocator, CStackAllocator o CFrameAllocator.
+   * El adaptador solo guarda un puntero a la arena, por lo que copiarlo es gratuito y
+   * todas las copias comparten la misma memoria.
+   *
+   * Los contenedores estándar esperan una excepción cuando no hay memoria, así que
+   * allocate() lanza std::bad_alloc si la arena está llena.
+   *
+   * @code
+   * CFrameAllocator frame(1 << 20);
+   * std::vector<CVector3, TAllocatorAdapter<CVector3, CFrameAllocator>> visible{
+   *     TAllocatorAdapter<CVector3, CFrameAllocator>(frame) };
+   * @endcode
+   */
+    template<typename T, typename Arena>
+    class TAllocatorAdapter
+    {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = TAllocatorAdapter<U, Arena>;
+        };
+
+        /**
+         * @brief Constructor.
+         *
+         * @param arena Asignador del que se toma la memoria (debe sobrevivir al contenedor).
+         */
+        explicit TAllocatorAdapter(Arena& arena) noexcept : arena(&arena) {}
+
+        /// Conversión entre adaptadores de distinto tipo sobre la misma arena.
+        template<typename U>
+        TAllocatorAdapter(const TAllocatorAdapter<U, Arena>& other) noexcept : arena(other.getArena()) {}
+
+        /**
+         * @brief Reserva memoria para count objetos de tipo T.
+         *
+         * Lanza std::bad_alloc si la arena no tiene espacio o si sizeof(T) * count no cabe
+         * en size_t.
+         */
+        T* allocate(size_t count)
+        {
+            if (count > SIZE_MAX / sizeof(T))
+            {
+                throw std::bad_alloc();
+            }
+            void* memory = arena->allocate(sizeof(T) * count, alignof(T));
+            if (memory == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(memory);
+        }
+
+        /**
+         * @brief Devuelve la memoria a la arena (normalmente no hace nada).
+         */
+        void deallocate(T* ptr, size_t count) noexcept
+        {
+            arena->deallocate(ptr, sizeof(T) * count);
+        }
+
+        /// @brief Arena sobre la que trabaja el adaptador.
+        Arena* getArena() const noexcept { return arena; }
+
+        template<typename U>
+        bool operator==(const TAllocatorAdapter<U, Arena>& other) const noexcept
+        {
+            return arena == other.getArena();
+        }
+
+        template<typename U>
+        bool operator!=(const TAllocatorAdapter<U, Arena>& other) const noexcept
+        {
+            return arena != other.getArena();
+        }
+
+    private:
+        Arena* arena; ///< Asignador del que se toma la memoria.
+    };
+}
@@ -0,0 +1,467 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Roberto Charreton
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * In addition, any project or software that uses this library or class must include
+ * the following acknowledgment in the credits:
+ *
+ * "This project uses software developed by Roberto Charreton and Attribute Overload."
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+*/
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "TSharedPointer.h"
+#include "TUniquePtr.h"
+
+namespace EngineUtilities {
+    /**
+   * @brief Clase TObjectPool: pool de objetos de tamaño fijo para el tipo T.
+   *
+   * Reserva la memoria en bloques (slabs) de objectsPerSlab huecos y la recicla con una
+   * lista libre intrusiva, por lo que crear y destruir objetos no pasa por el heap global
+   * salvo cuando el pool necesita un bloque nuevo. La memoria de los bloques solo se
+   * devuelve al destruir el pool.
+   *
+   * Con las cachés por hilo activadas, cada hilo trabaja sobre su propia caché (una de
+   * kCacheCount, alineadas a línea de caché) protegida por un spinlock que prácticamente
+   * nunca se disputa; la lista central con su mutex solo se usa para rellenar o vaciar las
+   * cachés por lotes.
+   *
+   * El pool debe sobrevivir a todos los objetos que entrega. Los objetos que sigan vivos al
+   * destruir el pool no se destruyen.
+   */
+    template<typename T>
+    class TObjectPool
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param objectsPerSlab Número de huecos que se reservan cada vez que el pool crece.
+         * @param useThreadCaches true para activar las cachés por hilo.
+         */
+        explicit TObjectPool(size_t objectsPerSlab = 256, bool useThreadCaches = true)
+            : objectsPerSlab(objectsPerSlab > 0 ? objectsPerSlab : 1),
+            useThreadCaches(useThreadCaches),
+            freeList(nullptr),
+            totalSlots(0)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         *
+         * Devuelve todos los bloques al sistema.
+         */
+        ~TObjectPool()
+        {
+            for (Node* slab : slabs)
+            {
+                ::operator delete(slab, std::align_val_t(alignof(Node)));
+            }
+        }
+
+        // Prohibir la copia: los objetos entregados apuntan a la memoria de este pool.
+        TObjectPool(const TObjectPool<T>&) = delete;
+        TObjectPool<T>& operator=(const TObjectPool<T>&) = delete;
+
+        /**
+         * @brief Construye un objeto dentro del pool.
+         *
+         * @tparam Args Tipos de los argumentos del constructor de T.
+         * @param args Argumentos del constructor de T.
+         * @return Puntero al nuevo objeto.
+         *
+         * Si el constructor de T lanza, el hueco vuelve al pool antes de propagar la excepción.
+         */
+        template<typename... Args>
+        T* create(Args&&... args)
+        {
+            void* slot = allocate();
+            try
+            {
+                return new (slot) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                deallocate(slot);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Destruye un objeto creado con create() y devuelve su hueco al pool.
+         *
+         * @param object Objeto a destruir (puede ser nullptr).
+         */
+        void destroy(T* object)
+        {
+            if (object != nullptr)
+            {
+                object->~T();
+                deallocate(object);
+            }
+        }
+
+        /**
+         * @brief Reserva un hueco sin construir el objeto.
+         *
+         * @return Puntero a memoria con tamaño y alineación suficientes para un T.
+         */
+        void* allocate()
+        {
+            if (!useThreadCaches)
+            {
+                std::lock_guard<std::mutex> lock(centralMutex);
+                if (freeList == nullptr)
+                {
+                    growLocked();
+                }
+                Node* node = freeList;
+                freeList = node->next;
+                return node;
+            }
+
+            ThreadCache& cache = localCache();
+            std::lock_guard<SpinLock> lock(cache.lock);
+            if (cache.head == nullptr)
+            {
+                refill(cache);
+            }
+            Node* node = cache.head;
+            cache.head = node->next;
+            --cache.count;
+            return node;
+        }
+
+        /**
+         * @brief Devuelve al pool un hueco obtenido con allocate().
+         *
+         * @param slot Hueco a devolver (el objeto ya debe estar destruido).
+         */
+        void deallocate(void* slot)
+        {
+            Node* node = static_cast<Node*>(slot);
+            if (!useThreadCaches)
+            {
+                std::lock_guard<std::mutex> lock(centralMutex);
+                node->next = freeList;
+                freeList = node;
+                return;
+            }
+
+            ThreadCache& cache = localCache();
+            std::lock_guard<SpinLock> lock(cache.lock);
+            node->next = cache.head;
+            cache.head = node;
+            if (++cache.count > kCacheLimit)
+            {
+                flush(cache);
+            }
+        }
+
+        /**
+         * @brief Número total de huecos reservados por el pool.
+         */
+        size_t capacity()
+        {
+            std::lock_guard<std::mutex> lock(centralMutex);
+            return totalSlots;
+        }
+
+        /**
+         * @brief Número de huecos libres (lista central más cachés por hilo).
+         *
+         * Recorre la lista central: pensado para diagnóstico y pruebas. Solo es exacto si
+         * ningún otro hilo usa el pool a la vez.
+         */
+        size_t freeCount()
+        {
+            size_t count = 0;
+            {
+                std::lock_guard<std::mutex> lock(centralMutex);
+                for (Node* node = freeList; node != nullptr; node = node->next)
+                {
+                    ++count;
+                }
+            }
+            for (ThreadCache& cache : caches)
+            {
+                std::lock_guard<SpinLock> lock(cache.lock);
+                count += cache.count;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Número de bloques reservados por el pool.
+         */
+        size_t slabCount()
+        {
+            std::lock_guard<std::mutex> lock(centralMutex);
+            return slabs.size();
+        }
+
+    private:
+        /// Hueco del pool: mientras está libre guarda el enlace de la lista libre.
+        union Node
+        {
+            Node* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        /// Spinlock mínimo para las cachés por hilo (casi nunca disputado).
+        class SpinLock
+        {
+        public:
+            void lock()
+            {
+                while (locked.exchange(true, std::memory_order_acquire))
+                {
+                    while (locked.load(std::memory_order_relaxed))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            void unlock()
+            {
+                locked.store(false, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<bool> locked{ false };
+        };
+
+        /// Caché de huecos libres de un hilo, alineada para evitar compartir líneas de caché.
+        struct alignas(64) ThreadCache
+        {
+            SpinLock lock;
+            Node* head = nullptr;
+            size_t count = 0;
+        };
+
+        static constexpr size_t kCacheCount = 16; ///< Número de cachés por hilo.
+        static constexpr size_t kCacheBatch = 32; ///< Huecos que se mueven entre caché y lista central.
+        static constexpr size_t kCacheLimit = 64; ///< Huecos a partir de los cuales una caché se vacía.
+
+        /// Índice estable de la caché del hilo actual (asignación rotatoria).
+        static size_t threadCacheIndex()
+        {
+            static std::atomic<size_t> nextIndex{ 0 };
+            thread_local size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed) % kCacheCount;
+            return index;
+        }
+
+        ThreadCache& localCache()
+        {
+            return caches[threadCacheIndex()];
+        }
+
+        /// Reserva un bloque nuevo y lo encadena a la lista central. Requiere centralMutex.
+        void growLocked()
+        {
+            Node* slab = static_cast<Node*>(
+                ::operator new(sizeof(Node) * objectsPerSlab, std::align_val_t(alignof(Node))));
+            slabs.push_back(slab);
+            for (size_t i = 0; i + 1 < objectsPerSlab; ++i)
+            {
+                slab[i].next = &slab[i + 1];
+            }
+            slab[objectsPerSlab - 1].next = freeList;
+            freeList = slab;
+            totalSlots += objectsPerSlab;
+        }
+
+        /// Mueve hasta kCacheBatch huecos de la lista central a la caché. Requiere cache.lock.
+        void refill(ThreadCache& cache)
+        {
+            std::lock_guard<std::mutex> lock(centralMutex);
+            for (size_t i = 0; i < kCacheBatch; ++i)
+            {
+                if (freeList == nullptr)
+                {
+                    if (i > 0)
+                    {
+                        break;
+                    }
+                    growLocked();
+                }
+                Node* node = freeList;
+                freeList = node->next;
+                node->next = cache.head;
+                cache.head = node;
+                ++cache.count;
+            }
+        }
+
+        /// Devuelve kCacheBatch huecos de la caché a la lista central. Requiere cache.lock.
+        void flush(ThreadCache& cache)
+        {
+            std::lock_guard<std::mutex> lock(centralMutex);
+            for (size_t i = 0; i < kCacheBatch; ++i)
+            {
+                Node* node = cache.head;
+                cache.head = node->next;
+                node->next = freeList;
+                freeList = node;
+            }
+            cache.count -= kCacheBatch;
+        }
+
+        const size_t objectsPerSlab; ///< Huecos por bloque.
+        const bool useThreadCaches;  ///< true si se usan las cachés por hilo.
+
+        std::mutex centralMutex;   ///< Protege la lista central y los bloques.
+        Node* freeList;            ///< Lista central de huecos libres.
+        std::vector<Node*> slabs;  ///< Bloques reservados.
+        size_t totalSlots;         ///< Huecos reservados en total.
+
+        ThreadCache caches[kCacheCount]; ///< Cachés por hilo.
+    };
+
+    /**
+     * @brief Liberador de TUniquePtr que devuelve el objeto a su TObjectPool.
+     */
+    template<typename T>
+    class TPoolDeleter
+    {
+    public:
+        TPoolDeleter() : pool(nullptr) {}
+
+        /**
+         * @param pool Pool del que procede el objeto.
+         */
+        explicit TPoolDeleter(TObjectPool<T>* pool) : pool(pool) {}
+
+        void operator()(T* ptr) const { pool->destroy(ptr); }
+
+    private:
+        TObjectPool<T>* pool; ///< Pool del que procede el objeto.
+    };
+
+    /**
+     * @brief Pool compartido de los bloques de control de los TSharedPointer creados desde un pool.
+     *
+     * Nunca se destruye, para que los punteros que sobreviven a los estáticos sigan siendo válidos.
+     */
+    inline TObjectPool<SharedControlBlock>& SharedControlBlockPool()
+    {
+        static TObjectPool<SharedControlBlock>* pool = new TObjectPool<SharedControlBlock>(1024);
+        return *pool;
+    }
+
+    /**
+     * @brief Liberador de los bloques de control de MakeShared(pool, ...): devuelve el objeto
+     *        a su pool y el bloque a SharedControlBlockPool().
+     */
+    template<typename T>
+    void DestroyPooledControlBlock(SharedControlBlock* block)
+    {
+        EU_TRACK_FREE(T, sizeof(T));
+        static_cast<TObjectPool<T>*>(block->context)->destroy(static_cast<T*>(block->object));
+        SharedControlBlockPool().deallocate(block);
+    }
+
+    /**
+     * @brief Función de utilidad para crear un TSharedPointer cuyo objeto procede de un pool.
+     *
+     * Tanto el objeto como el bloque de control se toman de pools, por lo que no se accede
+     * al heap global mientras haya huecos libres.
+     *
+     * @tparam T Tipo del objeto gestionado.
+     * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
+     * @param pool Pool del que se toma el objeto (debe sobrevivir al puntero).
+     * @param args Argumentos del constructor del objeto gestionado.
+     * @return Un objeto TSharedPointer gestionando un nuevo objeto de tipo T.
+     *
+     * Si no se puede reservar el bloque de control, el objeto se destruye y vuelve al pool
+     * antes de propagar la excepción.
+     */
+    template<typename T, typename... Args>
+    TSharedPointer<T> MakeShared(TObjectPool<T>& pool, Args&&... args)
+    {
+        T* object = pool.create(std::forward<Args>(args)...);
+        SharedControlBlock* block = nullptr;
+        try
+        {
+            block = static_cast<SharedControlBlock*>(SharedControlBlockPool().allocate());
+        }
+        catch (...)
+        {
+            pool.destroy(object);
+            throw;
+        }
+        block->refCount = 0;
+        block->object = object;
+        block->context = &pool;
+        block->destroy = &DestroyPooledControlBlock<T>;
+        EU_TRACK_ALLOCATE(T, sizeof(T));
+        // El constructor incrementa el recuento a 1.
+        return TSharedPointer<T>(object, &block->refCount);
+    }
+
+    /**
+     * @brief Función de utilidad para crear un TUniquePtr cuyo objeto procede de un pool.
+     *
+     * @tparam T Tipo del objeto gestionado.
+     * @tparam Args Tipos de los argumentos del constructor del objeto gestionado.
+     * @param pool Pool del que se toma el objeto (debe sobrevivir al puntero).
+     * @param args Argumentos del constructor del objeto gestionado.
+     * @return Un TUniquePtr que devuelve el objeto al pool al liberarlo.
+     */
+    template<typename T, typename... Args>
+    TUniquePtr<T, TPoolDeleter<T>> MakeUnique(TObjectPool<T>& pool, Args&&... args)
+    {
+        return TUniquePtr<T, TPoolDeleter<T>>(pool.create(std::forward<Args>(args)...), TPoolDeleter<T>(&pool));
+    }
+
+    /*
+    // Ejemplo de uso de TObjectPool
+    struct Particle
+    {
+      Particle(float x, float y, float z) : position(x, y, z) {}
+      CVector3 position;
+    };
+
+    int main()
+    {
+      TObjectPool<Particle> pool(512);
+
+      // Crear y destruir directamente
+      Particle* p = pool.create(1.0f, 2.0f, 3.0f);
+      pool.destroy(p);
+
+      // Punteros inteligentes que devuelven el objeto al pool
+      TSharedPointer<Particle> shared = MakeShared(pool, 0.0f, 1.0f, 0.0f);
+      TUniquePtr<Particle, TPoolDeleter<Particle>> unique = MakeUnique(pool, 4.0f, 5.0f, 6.0f);
+
+      return 0;
+    } // Los punteros se liberan antes que el pool
+    */
+}
@@ -27,8 +27,73 @@
  * SOFTWARE.
 */
 #pragma once
+#include "MemoryTracker.h"
 
 namespace EngineUtilities {
+	template<typename T>
+	class TWeakPointer;
+	template<typename T>
+	class TObjectPool;
+
+	/**
+	 * @brief Bloque de control compartido por todas las copias de un TSharedPointer.
+	 *
+	 * refCount es el primer miembro, de modo que el puntero int* que guardan TSharedPointer
+	 * y TWeakPointer es tambin la direccin del bloque completo. destroy libera el objeto
+	 * y el propio bloque, lo que permite que cada origen de memoria (new, TObjectPool, ...)
+	 * devuelva el objeto con su liberador correspondiente.
+	 *
+	 * Los bloques de MakeShared(pool, ...) se reciclan: tras liberarse, la misma direccin
+	 * puede pasar a ser el bloque de otro objeto (vase TWeakPointer).
+	 */
+	struct SharedControlBlock
+	{
+		int refCount;                               ///< Recuento de referencias.
+		void* object;                               ///< Objeto gestionado, con su tipo original.
+		void* context;                              ///< Dato del liberador (p. ej. el pool de origen).
+		void (*destroy)(SharedControlBlock* block); ///< Libera el objeto y el bloque.
+	};
+
+	/**
+	 * @brief Liberador de los bloques creados con new: destruye el objeto y el bloque con delete.
+	 */
+	template<typename T>
+	void DestroyHeapControlBlock(SharedControlBlock* block)
+	{
+		EU_TRACK_FREE(T, sizeof(T));
+		delete static_cast<T*>(block->object);
+		delete block;
+	}
+
+	/**
+	 * @brief Crea en el heap el bloque de control de un objeto creado con new.
+	 *
+	 * @param object Objeto que se va a gestionar.
+	 * @return Puntero al recuento de referencias del nuevo bloque (inicializado a 1).
+	 */
+	template<typename T>
+	int* NewHeapControlBlock(T* object)
+	{
+		SharedControlBlock* block = new SharedControlBlock{ 1, object, nullptr, &DestroyHeapControlBlock<T> };
+		EU_TRACK_ALLOCATE(T, sizeof(T));
+		EU_TRACK_REF_INCREMENT(T); // La referencia inicial.
+		return &block->refCount;
+	}
+
+	/**
+	 * @brief Disminuye el recuento de referencias y libera objeto y bloque al llegar a cero.
+	 *
+	 * @param refCount Puntero al recuento de referencias (puede ser nullptr).
+	 */
+	inline void ReleaseSharedReference(int* refCount)
+	{
+		if (refCount && --(*refCount) == 0)
+		{
+			SharedControlBlock* block = reinterpret_cast<SharedControlBlock*>(refCount);
+			block->destroy(block);
+		}
+	}
+
 	/**
 	 * @brief Clase TSharedPointer para manejar la gestin de memoria compartida.
 	 *
@@ -52,21 +117,7 @@ namespace EngineUtilities {
 		 *
 		 * @param rawPtr Puntero crudo al objeto que se va a gestionar.
 		 */
-		explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(new int(1)) {}
-
-		/**
-		 * @brief Constructor desde un puntero crudo y un recuento de referencias.
-		 *
-		 * @param rawPtr Puntero crudo al objeto gestionado.
-		 * @param existingRefCount Puntero al recuento de referencias existente.
-		 */
-		TSharedPointer(T* rawPtr, int* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
-		{
-			if (refCount)
-			{
-				++(*refCount);
-			}
-		}
+		explicit TSharedPointer(T* rawPtr) : ptr(rawPtr), refCount(NewHeapControlBlock(rawPtr)) {}
 
 		/**
 		 * @brief Constructor de copia.
@@ -81,6 +132,7 @@ namespace EngineUtilities {
 			if (refCount)
 			{
 				++(*refCount);
+				EU_TRACK_REF_INCREMENT(T);
 			}
 		}
 
@@ -112,17 +164,14 @@ namespace EngineUtilities {
 			if (this != &other)
 			{
 				// Disminuir el recuento de referencias del objeto actual
-				if (refCount && --(*refCount) == 0)
-				{
-					delete ptr;
-					delete refCount;
-				}
+				releaseReference();
 				// Copiar datos del otro puntero compartido
 				ptr = other.ptr;
 				refCount = other.refCount;
 				if (refCount)
 				{
 					++(*refCount);
+					EU_TRACK_REF_INCREMENT(T);
 				}
 			}
 			return *this;
@@ -142,11 +191,7 @@ namespace EngineUtilities {
 			if (this != &other)
 			{
 				// Liberar el objeto actual
-				if (refCount && --(*refCount) == 0)
-				{
-					delete ptr;
-					delete refCount;
-				}
+				releaseReference();
 				// Transferir los datos del otro puntero compartido
 				ptr = other.ptr;
 				refCount = other.refCount;
@@ -159,7 +204,10 @@ namespace EngineUtilities {
 		template<typename U>
 		TSharedPointer(const TSharedPointer<U>& other)
 			: ptr(other.ptr), refCount(other.refCount) {
-			if (refCount) ++(*refCount);
+			if (refCount) {
+				++(*refCount);
+				EU_TRACK_REF_INCREMENT(T);
+			}
 		}
 
 		/**
@@ -170,11 +218,7 @@ namespace EngineUtilities {
 		 */
 		~TSharedPointer()
 		{
-			if (refCount && --(*refCount) == 0)
-			{
-				delete ptr;
-				delete refCount;
-			}
+			releaseReference();
 		}
 
 		/**
@@ -241,11 +285,7 @@ namespace EngineUtilities {
 		void reset(T* newPtr = nullptr)
 		{
 			// Disminuir el recuento de referencias del objeto actual
-			if (refCount && --(*refCount) == 0)
-			{
-				delete ptr;
-				delete refCount;
-			}
+			releaseReference();
 
 			// Si newPtr es nullptr, asignar nullptr al puntero y recuento de referencias
 			if (newPtr == nullptr)
@@ -257,7 +297,7 @@ namespace EngineUtilities {
 			{
 				// Asignar nuevo objeto y manejar el recuento de referencias
 				ptr = newPtr;
-				refCount = new int(1);
+				refCount = NewHeapControlBlock(newPtr);
 			}
 		}
 
@@ -276,6 +316,43 @@ namespace EngineUtilities {
 			}
 		}
 
+	private:
+		// Solo estas piezas construyen desde un recuento existente: garantizan que es el de un
+		// SharedControlBlock vivo.
+		template<typename U>
+		friend class TSharedPointer;
+		template<typename U>
+		friend class TWeakPointer;
+		template<typename U, typename... Args>
+		friend TSharedPointer<U> MakeShared(TObjectPool<U>& pool, Args&&... args);
+
+		/**
+		 * @brief Constructor desde un puntero crudo y un recuento de referencias.
+		 *
+		 * Privado: ReleaseSharedReference() trata el recuento como el primer miembro de un
+		 * SharedControlBlock, as que un int cualquiera (p. ej. creado con new) no vale.
+		 *
+		 * @param rawPtr Puntero crudo al objeto gestionado.
+		 * @param existingRefCount refCount de un SharedControlBlock vivo (o nullptr).
+		 */
+		TSharedPointer(T* rawPtr, int* existingRefCount) : ptr(rawPtr), refCount(existingRefCount)
+		{
+			if (refCount)
+			{
+				++(*refCount);
+				EU_TRACK_REF_INCREMENT(T);
+			}
+		}
+
+		/// Libera la referencia actual, registrndola en MemoryTracker si est activo.
+		void releaseReference()
+		{
+			if (refCount)
+			{
+				EU_TRACK_REF_DECREMENT(T);
+			}
+			ReleaseSharedReference(refCount);
+		}
 	};
 
 	/**
@@ -27,61 +27,179 @@
  * SOFTWARE.
 */
 #pragma once
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "MemoryTracker.h"
+
 namespace EngineUtilities {
+    /**
+     * @brief Registro del orden de destruccin de las instancias de TStaticPtr.
+     *
+     * Cada tipo que instala una instancia en TStaticPtr se registra aqu una sola vez.
+     * shutdownAll() destruye las instancias en orden inverso al de registro, de modo que
+     * un servicio creado despus de sus dependencias se libera antes que ellas. Si no se
+     * llama explcitamente, las instancias pendientes se liberan al terminar el programa.
+     */
+    class StaticPtrRegistry
+    {
+    public:
+        using ShutdownFn = void(*)();
+
+        /**
+         * @brief Registra la funcin de destruccin de un tipo.
+         *
+         * @param fn Funcin que libera la instancia esttica del tipo.
+         */
+        static void registerShutdown(ShutdownFn fn)
+        {
+            State& state = getState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.entries.push_back(fn);
+        }
+
+        /**
+         * @brief Destruye todas las instancias registradas en orden inverso (LIFO).
+         *
+         * Las funciones se ejecutan fuera del bloqueo, por lo que el destructor de un
+         * servicio puede consultar otros TStaticPtr sin provocar un interbloqueo.
+         */
+        static void shutdownAll()
+        {
+            std::vector<ShutdownFn> pending;
+            {
+                State& state = getState();
+                std::lock_guard<std::mutex> lock(state.mutex);
+                pending.swap(state.entries);
+            }
+            for (auto it = pending.rbegin(); it != pending.rend(); ++it)
+            {
+                (*it)();
+            }
+        }
+
+    private:
+        struct State
+        {
+            std::mutex mutex;
+            std::vector<ShutdownFn> entries;
+
+            ~State()
+            {
+                for (auto it = entries.rbegin(); it != entries.rend(); ++it)
+                {
+                    (*it)();
+                }
+            }
+        };
+
+        static State& getState()
+        {
+            static State state;
+            return state;
+        }
+    };
+
     /**
    * @brief Clase TStaticPtr para manejo de un puntero esttico.
    *
-   * La clase TStaticPtr gestiona un nico objeto esttico y proporciona mtodos
-   * para acceder al objeto, verificar si el puntero es nulo y realizar operaciones
-   * bsicas de manejo de memoria.
+   * La clase TStaticPtr gestiona un nico objeto esttico por tipo y funciona como
+   * localizador de servicios. La instancia se publica con un puntero atmico: get()
+   * es una nica carga con semntica acquire (sin bloqueos, wait-free) y getOrCreate()
+   * crea la instancia de forma perezosa exactamente una vez mediante doble
+   * comprobacin. El bloqueo solo se toma en el camino lento (creacin, reset y
+   * destruccin), nunca en cada acceso.
+   *
+   * reset() y shutdown() liberan la instancia anterior de inmediato, por lo que solo
+   * deben llamarse cuando ningn otro hilo conserva el puntero devuelto por get().
    */
     template<typename T>
     class TStaticPtr
     {
     public:
+        static_assert(std::atomic<T*>::is_always_lock_free,
+            "TStaticPtr requiere un puntero atmico sin bloqueos.");
+
         /**
-         * @brief Inicializa el puntero esttico al objeto.
+         * @brief Constructor por defecto.
          *
-         * Inicializa el puntero esttico a nullptr.
+         * No instala ni posee ninguna instancia.
          */
-        TStaticPtr() = default;
+        TStaticPtr() : owner(false) {}
 
         /**
          * @brief Constructor que toma un puntero crudo.
          *
+         * Instala el objeto como instancia esttica. Este TStaticPtr pasa a ser su
+         * propietario y la libera al destruirse.
+         *
          * @param rawPtr Puntero crudo al objeto que se va a gestionar.
          */
-        explicit TStaticPtr(T* rawPtr)
+        explicit TStaticPtr(T* rawPtr) : owner(true)
         {
-            if (instance != nullptr)
-            {
-                delete instance;
-            }
-            instance = rawPtr;
+            reset(rawPtr);
         }
 
         /**
          * @brief Destructor.
          *
-         * Libera la memoria del objeto gestionado si es la ltima instancia.
+         * Libera la instancia solo si este TStaticPtr la instal.
          */
         ~TStaticPtr()
         {
-            if (instance != nullptr)
+            if (owner)
             {
-                delete instance;
-                instance = nullptr;
+                reset();
             }
         }
 
+        // Prohibir la copia: la propiedad de la instancia no se comparte.
+        TStaticPtr(const TStaticPtr<T>&) = delete;
+        TStaticPtr<T>& operator=(const TStaticPtr<T>&) = delete;
+
         /**
          * @brief Obtener el puntero crudo.
          *
-         * @return Puntero crudo al objeto gestionado.
+         * Camino rpido sin bloqueos: una carga atmica con semntica acquire.
+         *
+         * @return Puntero crudo al objeto gestionado, o nullptr si no existe.
          */
         static T* get()
         {
-            return instance;
+            return instance.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Obtener la instancia, crendola la primera vez que se solicita.
+         *
+         * Si la instancia ya existe se devuelve sin tomar ningn bloqueo. En caso
+         * contrario un nico hilo la construye con los argumentos indicados; el resto
+         * espera y recibe la misma instancia.
+         *
+         * @tparam Args Tipos de los argumentos del constructor de T.
+         * @param args Argumentos del constructor de T (solo se usan si se crea la instancia).
+         * @return Puntero a la instancia esttica.
+         */
+        template<typename... Args>
+        static T* getOrCreate(Args&&... args)
+        {
+            T* current = instance.load(std::memory_order_acquire);
+            if (current != nullptr)
+            {
+                return current;
+            }
+
+            std::lock_guard<std::mutex> lock(initMutex);
+            current = instance.load(std::memory_order_relaxed);
+            if (current == nullptr)
+            {
+                current = new T(std::forward<Args>(args)...);
+                instance.store(current, std::memory_order_release);
+                EU_TRACK_ALLOCATE(T, sizeof(T));
+                registerShutdown();
+            }
+            return current;
         }
 
         /**
@@ -91,7 +209,7 @@ namespace EngineUtilities {
          */
         static bool isNull()
         {
-            return instance == nullptr;
+            return get() == nullptr;
         }
 
         /**
@@ -103,22 +221,65 @@ namespace EngineUtilities {
          */
         static void reset(T* rawPtr = nullptr)
         {
-            if (instance != nullptr)
+            T* oldPtr;
+            {
+                std::lock_guard<std::mutex> lock(initMutex);
+                oldPtr = instance.exchange(rawPtr, std::memory_order_acq_rel);
+                if (rawPtr != nullptr)
+                {
+                    EU_TRACK_ALLOCATE(T, sizeof(T));
+                    registerShutdown();
+                }
+            }
+            if (oldPtr != nullptr)
             {
-                delete instance;
+                EU_TRACK_FREE(T, sizeof(T));
             }
-            instance = rawPtr;
+            delete oldPtr;
+        }
+
+        /**
+         * @brief Liberar la instancia esttica.
+         *
+         * Equivalente a reset(); StaticPtrRegistry la invoca en orden inverso al de creacin.
+         */
+        static void shutdown()
+        {
+            reset();
         }
 
     private:
-        static T* instance; ///< Puntero esttico al objeto gestionado.
+        /**
+         * @brief Registra el tipo en StaticPtrRegistry si an no tiene una destruccin pendiente.
+         *
+         * Debe llamarse con initMutex tomado.
+         */
+        static void registerShutdown()
+        {
+            if (!registered)
+            {
+                registered = true;
+                StaticPtrRegistry::registerShutdown(&TStaticPtr<T>::shutdownFromRegistry);
+            }
+        }
+
+        static void shutdownFromRegistry()
+        {
+            {
+                std::lock_guard<std::mutex> lock(initMutex);
+                registered = false;
+            }
+            reset();
+        }
+
+        inline static std::atomic<T*> instance{ nullptr }; ///< Puntero esttico al objeto gestionado.
+        inline static std::mutex initMutex;                ///< Protege la creacin, el reset y el registro.
+        inline static bool registered = false;             ///< true si hay una destruccin pendiente en el registro.
+
+        bool owner; ///< true si este objeto instal la instancia y debe liberarla.
     };
 
     /*
-    // Inicializar el puntero esttico
-    template<typename T>
-    T* TStaticPtr<T>::instance = nullptr;
-
     // Ejemplo de uso de TStaticPtr
     class MyClass
     {
@@ -145,9 +306,9 @@ namespace EngineUtilities {
     int main()
     {
       {
-        // Crear un TStaticPtr usando un puntero crudo
-        TStaticPtr<MyClass>::reset(new MyClass(10));
-        TStaticPtr<MyClass>::get()->display(); // Output: Value: 10
+        // Crear la instancia de forma perezosa (solo se construye una vez)
+        TStaticPtr<MyClass>::getOrCreate(10)->display(); // Output: Value: 10
+        TStaticPtr<MyClass>::getOrCreate(99)->display(); // Output: Value: 10
 
         // Comprobar si el puntero no es nulo
         if (!TStaticPtr<MyClass>::isNull())
@@ -159,15 +320,15 @@ namespace EngineUtilities {
         TStaticPtr<MyClass>::reset(new MyClass(20));
         TStaticPtr<MyClass>::get()->display(); // Output: Value: 20
 
-        // Reiniciar con nullptr
-        TStaticPtr<MyClass>::reset();
+        // Liberar todas las instancias en orden inverso al de creacin
+        StaticPtrRegistry::shutdownAll();
         if (TStaticPtr<MyClass>::isNull())
         {
-          std::cout << "TStaticPtr is null after reset" << std::endl;
+          std::cout << "TStaticPtr is null after shutdown" << std::endl;
         }
       }
 
       return 0;
     }
     */
-}
\ No newline at end of file
+}
@@ -27,17 +27,36 @@
  * SOFTWARE.
 */
 #pragma once
+#include <utility>
+#include "MemoryTracker.h"
 
 namespace EngineUtilities {
+    /**
+     * @brief Liberador por defecto de TUniquePtr: destruye el objeto con delete.
+     */
+    template<typename T>
+    struct TDefaultDelete
+    {
+        TDefaultDelete() = default;
+
+        /// Permite convertir el liberador de un tipo derivado U al de su base T.
+        template<typename U>
+        TDefaultDelete(const TDefaultDelete<U>&) {}
+
+        void operator()(T* ptr) const { delete ptr; }
+    };
+
     /**
    * @brief Clase TUniquePtr para manejo exclusivo de memoria.
    *
    * La clase TUniquePtr gestiona la memoria de un objeto de tipo T y garantiza
    * que solo una instancia de TUniquePtr puede poseer y gestionar el objeto en
-   * cualquier momento.
+   * cualquier momento. El objeto se libera con Deleter, lo que permite devolverlo
+   * a su origen (por ejemplo, un TObjectPool) en lugar de usar delete. Un liberador
+   * sin estado no aumenta el tamao del puntero.
    */
-    template<typename T>
-    class TUniquePtr
+    template<typename T, typename Deleter = TDefaultDelete<T>>
+    class TUniquePtr : private Deleter
     {
     public:
         /**
@@ -45,14 +64,28 @@ namespace EngineUtilities {
          *
          * Inicializa el puntero a nullptr.
          */
-        TUniquePtr() : ptr(nullptr) {}
+        TUniquePtr() : Deleter(), ptr(nullptr) {}
 
         /**
          * @brief Constructor que toma un puntero crudo.
          *
          * @param rawPtr Puntero crudo al objeto que se va a gestionar.
          */
-        explicit TUniquePtr(T* rawPtr) : ptr(rawPtr) {}
+        explicit TUniquePtr(T* rawPtr) : Deleter(), ptr(rawPtr)
+        {
+            trackAdopted();
+        }
+
+        /**
+         * @brief Constructor que toma un puntero crudo y su liberador.
+         *
+         * @param rawPtr Puntero crudo al objeto que se va a gestionar.
+         * @param deleter Liberador que se usar para destruir el objeto.
+         */
+        TUniquePtr(T* rawPtr, const Deleter& deleter) : Deleter(deleter), ptr(rawPtr)
+        {
+            trackAdopted();
+        }
 
         /**
          * @brief Constructor de movimiento.
@@ -61,7 +94,8 @@ namespace EngineUtilities {
          *
          * @param other Otro objeto TUniquePtr del mismo tipo T.
          */
-        TUniquePtr(TUniquePtr<T>&& other) noexcept : ptr(other.ptr)
+        TUniquePtr(TUniquePtr<T, Deleter>&& other) noexcept
+            : Deleter(std::move(other.getDeleter())), ptr(other.ptr)
         {
             other.ptr = nullptr;
         }
@@ -75,14 +109,15 @@ namespace EngineUtilities {
          * @param other Otro objeto TUniquePtr del mismo tipo T.
          * @return Referencia al objeto TUniquePtr actual.
          */
-        TUniquePtr<T>& operator=(TUniquePtr<T>&& other) noexcept
+        TUniquePtr<T, Deleter>& operator=(TUniquePtr<T, Deleter>&& other) noexcept
         {
             if (this != &other)
             {
                 // Liberar el objeto actual
-                delete ptr;
+                destroyObject();
 
                 // Transferir los datos del otro puntero exclusivo
+                getDeleter() = std::move(other.getDeleter());
                 ptr = other.ptr;
                 other.ptr = nullptr;
             }
@@ -96,16 +131,17 @@ namespace EngineUtilities {
          */
         ~TUniquePtr()
         {
-            delete ptr;
+            destroyObject();
         }
 
         // Prohibir la copia de TUniquePtr
-        TUniquePtr(const TUniquePtr<T>&) = delete;
-        TUniquePtr<T>& operator=(const TUniquePtr<T>&) = delete;
+        TUniquePtr(const TUniquePtr<T, Deleter>&) = delete;
+        TUniquePtr<T, Deleter>& operator=(const TUniquePtr<T, Deleter>&) = delete;
 
-        template<typename U>
-        TUniquePtr(TUniquePtr<U>&& other) noexcept
-            : ptr(static_cast<T*>(other.release())) {
+        template<typename U, typename E>
+        TUniquePtr(TUniquePtr<U, E>&& other) noexcept
+            : Deleter(std::move(other.getDeleter())), ptr(static_cast<T*>(other.release())) {
+            trackAdopted();
         }
 
 
@@ -139,6 +175,10 @@ namespace EngineUtilities {
          */
         T* release()
         {
+            if (ptr != nullptr)
+            {
+                EU_TRACK_FREE(T, sizeof(T));
+            }
             T* oldPtr = ptr;
             ptr = nullptr;
             return oldPtr;
@@ -153,10 +193,25 @@ namespace EngineUtilities {
          */
         void reset(T* rawPtr = nullptr)
         {
-            delete ptr;
+            destroyObject();
             ptr = rawPtr;
+            trackAdopted();
         }
 
+        /**
+         * @brief Obtener el liberador usado para destruir el objeto.
+         *
+         * @return Referencia al liberador.
+         */
+        Deleter& getDeleter() { return *this; }
+
+        /**
+         * @brief Obtener el liberador usado para destruir el objeto.
+         *
+         * @return Referencia constante al liberador.
+         */
+        const Deleter& getDeleter() const { return *this; }
+
         /**
          * @brief Verificar si el puntero es nulo.
          *
@@ -167,6 +222,25 @@ namespace EngineUtilities {
             return ptr == nullptr;
         }
     private:
+        /// Libera el objeto gestionado con el liberador, si existe.
+        void destroyObject()
+        {
+            if (ptr != nullptr)
+            {
+                EU_TRACK_FREE(T, sizeof(T));
+                getDeleter()(ptr);
+            }
+        }
+
+        /// Registra en MemoryTracker el objeto que acaba de pasar a ser gestionado.
+        void trackAdopted()
+        {
+            if (ptr != nullptr)
+            {
+                EU_TRACK_ALLOCATE(T, sizeof(T));
+            }
+        }
+
         T* ptr; ///< Puntero al objeto gestionado.
     };
 
@@ -36,6 +36,13 @@ namespace EngineUtilities {
 		 * La clase TWeakPointer proporciona una manera de observar un objeto gestionado por un TSharedPointer
 		 * sin tener influencia sobre el recuento de referencias del objeto. Permite acceder al objeto solo si
 		 * an existe.
+		 *
+		 * El puntero dbil no mantiene vivo el bloque de control: lock() solo es fiable mientras
+		 * quede algn TSharedPointer al objeto. Despus, con bloques del heap lee memoria
+		 * liberada, y con bloques de MakeShared(pool, ...), que se reciclan, puede encontrar el
+		 * bloque de otro objeto y devolver un TSharedPointer al objeto destruido que aade una
+		 * referencia al objeto ajeno. No debe llamarse a lock() sobre un puntero dbil que
+		 * pueda haber sobrevivido a todos sus TSharedPointer.
 		 */
 	template<typename T>
 	class TWeakPointer
@@ -59,6 +66,8 @@ namespace EngineUtilities {
 		 * @brief Convertir TWeakPointer a TSharedPointer.
 		 *
 		 * @return Un TSharedPointer al objeto gestionado, o nullptr si el objeto ha sido destruido.
+		 *
+		 * Ver la advertencia de la clase sobre los bloques reciclados.
 		 */
 		TSharedPointer<T> lock() const
 		{
@@ -0,0 +1,525 @@
+/**
+ * @file CTransformHierarchy.h
+ * @brief Jerarquía de transformaciones en arrays SoA ordenados por niveles, con marcas de cambio.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Containers/TSlotMap.h"
+#include "../Matriz/Matriz4x4.h"
+#include "../Threading/CJobSystem.h"
+#include "../Utilities/Simd.h"
+#include "../Vector/CQuaternion.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /// Nodos por trabajo en la actualización paralela de un nivel.
+    const size_t kTransformGrain = 4096;
+
+    /**
+     * @struct CAffineTransform
+     * @brief Matriz afín 3x4 en float (la cuarta fila es implícitamente 0 0 0 1).
+     *
+     * Cada fila ocupa un registro SSE; la transformación completa son 48 bytes frente a los
+     * 128 de un Matriz4x4.
+     */
+    struct alignas(16) CAffineTransform {
+        float m[3][4]; ///< Filas de la matriz.
+
+        /// @brief Convierte a Matriz4x4 (double).
+        Matriz4x4 toMatrix() const {
+            return Matriz4x4(
+                m[0][0], m[0][1], m[0][2], m[0][3],
+                m[1][0], m[1][1], m[1][2], m[1][3],
+                m[2][0], m[2][1], m[2][2], m[2][3],
+                0.0, 0.0, 0.0, 1.0);
+        }
+
+        /// @brief Transforma un punto (con traslación).
+        CVector3 transformPoint(const CVector3& p) const {
+            return CVector3(
+                m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3],
+                m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3],
+                m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3]);
+        }
+    };
+
+    /**
+     * @class CTransformHierarchy
+     * @brief Jerarquía padre-hijo de transformaciones locales (posición, rotación, escala).
+     *
+     * Los nodos se guardan en arrays separados por atributo (SoA) ordenados en anchura: los
+     * nodos de cada nivel son contiguos, cada padre precede a sus hijos y los hermanos van
+     * juntos. Así update() recorre los arrays una sola vez de principio a fin, la matriz del
+     * padre ya está calculada (y normalmente en caché) cuando se procesa el hijo y cada nivel
+     * puede repartirse entre hilos sin dependencias internas.
+     *
+     * Cambiar una transformación local marca el nodo; update() propaga la marca a los
+     * descendientes durante el mismo recorrido y solo recompone las matrices de los
+     * subárboles modificados. Si no hubo cambios, update() no hace nada.
+     *
+     * Los nodos se referencian con handles generacionales (un TSlotMap traduce handle a
+     * posición), que siguen siendo válidos aunque el orden interno cambie. Crear, destruir
+     * o cambiar de padre un nodo reordena los arrays (O(n)) en el siguiente update(), así que
+     * conviene agrupar los cambios estructurales.
+     *
+     * Las rotaciones deben estar normalizadas. Las matrices de mundo solo son válidas después
+     * de update().
+     */
+    class CTransformHierarchy {
+    public:
+        using Handle = SlotHandle32;
+
+        static constexpr uint32_t kNoParent = 0xFFFFFFFFu; ///< Índice de padre de las raíces.
+
+        CTransformHierarchy() : orderDirty(false), changed(false) {}
+
+        /// @brief Reserva memoria para count nodos.
+        void reserve(size_t count) {
+            indices.reserve(count);
+            handles.reserve(count);
+            parents.reserve(count);
+            positions.reserve(count);
+            rotations.reserve(count);
+            scales.reserve(count);
+            worlds.reserve(count);
+            dirty.reserve(count);
+        }
+
+        /**
+         * @brief Crea un nodo.
+         *
+         * @param parent Padre del nodo (handle nulo para crear una raíz).
+         * @return Handle del nodo, o un handle nulo si parent no es válido.
+         */
+        Handle create(Handle parent = Handle(), const CVector3& position = CVector3(0.0f, 0.0f, 0.0f),
+            const CQuaternion& rotation = CQuaternion::identity(), const CVector3& scale = CVector3(1.0f, 1.0f, 1.0f)) {
+            uint32_t parentIndex = kNoParent;
+            if (!parent.isNull()) {
+                const uint32_t* found = indices.get(parent);
+                if (found == nullptr) {
+                    return Handle();
+                }
+                parentIndex = *found;
+            }
+            uint32_t index = static_cast<uint32_t>(handles.size());
+            Handle handle = indices.insert(index);
+            handles.push_back(handle);
+            parents.push_back(parentIndex);
+            positions.push_back(position);
+            rotations.push_back(rotation);
+            scales.push_back(scale);
+            worlds.push_back(CAffineTransform());
+            dirty.push_back(1);
+            changed = true;
+            orderDirty = true;
+            return handle;
+        }
+
+        /**
+         * @brief Destruye un nodo y todos sus descendientes. O(n).
+         *
+         * @return false si node no es válido.
+         */
+        bool destroy(Handle node) {
+            if (!indices.contains(node)) {
+                return false;
+            }
+            if (orderDirty) {
+                rebuildOrder();
+            }
+            size_t count = handles.size();
+            uint32_t first = *indices.get(node);
+
+            // En orden de anchura los descendientes van detrás y después de su padre.
+            std::vector<uint8_t> removed(count, 0);
+            removed[first] = 1;
+            for (size_t i = first + 1; i < count; ++i) {
+                removed[i] = parents[i] != kNoParent && removed[parents[i]];
+            }
+
+            std::vector<uint32_t> newIndex(count, kNoParent);
+            uint32_t write = 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (removed[i]) {
+                    indices.erase(handles[i]);
+                    continue;
+                }
+                newIndex[i] = write;
+                handles[write] = handles[i];
+                parents[write] = parents[i] == kNoParent ? kNoParent : newIndex[parents[i]];
+                positions[write] = positions[i];
+                rotations[write] = rotations[i];
+                scales[write] = scales[i];
+                worlds[write] = worlds[i];
+                dirty[write] = dirty[i];
+                *indices.get(handles[write]) = write;
+                ++write;
+            }
+            resizeArrays(write);
+            // El orden sigue siendo válido, pero los niveles pueden haber cambiado de tamaño.
+            orderDirty = true;
+            return true;
+        }
+
+        /**
+         * @brief Cambia el padre de un nodo (handle nulo para convertirlo en raíz).
+         *
+         * La transformación local se conserva, así que la de mundo cambia.
+         *
+         * @return false si algún handle no es válido o si parent es node o un descendiente suyo.
+         */
+        bool setParent(Handle node, Handle parent) {
+            const uint32_t* found = indices.get(node);
+            if (found == nullptr) {
+                return false;
+            }
+            uint32_t index = *found;
+            uint32_t parentIndex = kNoParent;
+            if (!parent.isNull()) {
+                const uint32_t* foundParent = indices.get(parent);
+                if (foundParent == nullptr) {
+                    return false;
+                }
+                parentIndex = *foundParent;
+                for (uint32_t ancestor = parentIndex; ancestor != kNoParent; ancestor = parents[ancestor]) {
+                    if (ancestor == index) {
+                        return false;
+                    }
+                }
+            }
+            parents[index] = parentIndex;
+            markDirty(index);
+            orderDirty = true;
+            return true;
+        }
+
+        /// @brief Indica si node referencia un nodo vivo.
+        bool contains(Handle node) const { return indices.contains(node); }
+
+        /// @brief Padre de node (nulo si es raíz o node no es válido).
+        Handle parent(Handle node) const {
+            const uint32_t* found = indices.get(node);
+            if (found == nullptr || parents[*found] == kNoParent) {
+                return Handle();
+            }
+            return handles[parents[*found]];
+        }
+
+        /// @brief Cambia la posición local. Devuelve false si node no es válido.
+        bool setLocalPosition(Handle node, const CVector3& position) {
+            const uint32_t* found = indices.get(node);
+            if (found == nullptr) {
+                return false;
+            }
+            positions[*found] = position;
+            markDirty(*found);
+            return true;
+        }
+
+        /// @brief Cambia la rotación local (normalizada). Devuelve false si node no es válido.
+        bool setLocalRotation(Handle node, const CQuaternion& rotation) {
+            const uint32_t* found = indices.get(node);
+            if (found == nullptr) {
+                return false;
+            }
+            rotations[*found] = rotation;
+            markDirty(*found);
+            return true;
+        }
+
+        /// @brief Cambia la escala local. Devuelve false si node no es válido.
+        bool setLocalScale(Handle node, const CVector3& scale) {
+            const uint32_t* found = indices.get(node);
+            if (found == nullptr) {
+                return false;
+            }
+            scales[*found] = scale;
+            markDirty(*found);
+            return true;
+        }
+
+        /// @brief Posición local (cero si node no es válido).
+        CVector3 localPosition(Handle node) const {
+            const uint32_t* found = indices.get(node);
+            return found != nullptr ? positions[*found] : CVector3(0.0f, 0.0f, 0.0f);
+        }
+
+        /// @brief Rotación local (identidad si node no es válido).
+        CQuaternion localRotation(Handle node) const {
+            const uint32_t* found = indices.get(node);
+            return found != nullptr ? rotations[*found] : CQuaternion::identity();
+        }
+
+        /// @brief Escala local (uno si node no es válido).
+        CVector3 localScale(Handle node) const {
+            const uint32_t* found = indices.get(node);
+            return found != nullptr ? scales[*found] : CVector3(1.0f, 1.0f, 1.0f);
+        }
+
+        /// @brief Transformación de mundo calculada en el último update() (nullptr si node no es válido).
+        const CAffineTransform* world(Handle node) const {
+            const uint32_t* found = indices.get(node);
+            return found != nullptr ? &worlds[*found] : nullptr;
+        }
+
+        /// @brief Matriz de mundo del último update() (identidad si node no es válido).
+        Matriz4x4 worldMatrix(Handle node) const {
+            const CAffineTransform* transform = world(node);
+            return transform != nullptr ? transform->toMatrix() : Matriz4x4();
+        }
+
+        /**
+         * @brief Recalcula las matrices de mundo de los subárboles modificados.
+         *
+         * @return Número de matrices recalculadas.
+         */
+        size_t update() {
+            if (!prepareUpdate()) {
+                return 0;
+            }
+            size_t recomputed = updateRange(0, handles.size());
+            finishUpdate();
+            return recomputed;
+        }
+
+        /**
+         * @brief Como update(), repartiendo entre los hilos de jobs los niveles con más de grain nodos.
+         *
+         * Los niveles se procesan en orden; dentro de un nivel los nodos son independientes.
+         */
+        size_t update(CJobSystem& jobs, size_t grain = kTransformGrain) {
+            if (!prepareUpdate()) {
+                return 0;
+            }
+            size_t recomputed = 0;
+            for (size_t level = 0; level + 1 < levelOffsets.size(); ++level) {
+                size_t first = levelOffsets[level];
+                size_t last = levelOffsets[level + 1];
+                if (last - first <= grain) {
+                    recomputed += updateRange(first, last);
+                    continue;
+                }
+                std::atomic<size_t> count{ 0 };
+                jobs.parallelFor(first, last, grain, [this, &count](size_t begin, size_t end) {
+                    count.fetch_add(updateRange(begin, end), std::memory_order_relaxed);
+                });
+                recomputed += count.load(std::memory_order_relaxed);
+            }
+            finishUpdate();
+            return recomputed;
+        }
+
+        /// @brief Número de nodos.
+        size_t size() const { return handles.size(); }
+
+        /// @brief Número de niveles (profundidad máxima + 1) tras el último reordenamiento.
+        size_t levelCount() const { return levelOffsets.empty() ? 0 : levelOffsets.size() - 1; }
+
+        /// @brief Posición de node en los arrays internos (kNoParent si no es válido).
+        uint32_t indexOf(Handle node) const {
+            const uint32_t* found = indices.get(node);
+            return found != nullptr ? *found : kNoParent;
+        }
+
+        /// @brief Array de transformaciones de mundo en el orden interno (size() elementos).
+        const CAffineTransform* worldData() const { return worlds.data(); }
+
+        /// @brief Array de índices de padre en el orden interno (kNoParent para las raíces).
+        const uint32_t* parentData() const { return parents.data(); }
+
+    private:
+        void markDirty(uint32_t index) {
+            dirty[index] = 1;
+            changed = true;
+        }
+
+        void resizeArrays(size_t count) {
+            handles.resize(count);
+            parents.resize(count);
+            positions.resize(count);
+            rotations.resize(count);
+            scales.resize(count);
+            worlds.resize(count);
+            dirty.resize(count);
+        }
+
+        /// Reordena si hace falta; devuelve false si no hay nada que recalcular.
+        bool prepareUpdate() {
+            if (orderDirty) {
+                rebuildOrder();
+            }
+            return changed;
+        }
+
+        void finishUpdate() {
+            std::fill(dirty.begin(), dirty.end(), static_cast<uint8_t>(0));
+            changed = false;
+        }
+
+        /// Ordena los nodos en anchura (raíces en su orden actual, hermanos juntos). O(n).
+        void rebuildOrder() {
+            size_t count = handles.size();
+
+            // Listas de hijos por ordenación por conteo del índice del padre.
+            std::vector<uint32_t> childStart(count + 1, 0);
+            for (size_t i = 0; i < count; ++i) {
+                if (parents[i] != kNoParent) {
+                    ++childStart[parents[i] + 1];
+                }
+            }
+            for (size_t i = 0; i < count; ++i) {
+                childStart[i + 1] += childStart[i];
+            }
+            std::vector<uint32_t> children(childStart[count]);
+            std::vector<uint32_t> cursor(childStart.begin(), childStart.end() - 1);
+            for (size_t i = 0; i < count; ++i) {
+                if (parents[i] != kNoParent) {
+                    children[cursor[parents[i]]++] = static_cast<uint32_t>(i);
+                }
+            }
+
+            std::vector<uint32_t> order;
+            order.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                if (parents[i] == kNoParent) {
+                    order.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            levelOffsets.assign(1, 0);
+            for (size_t levelBegin = 0; levelBegin < order.size(); ) {
+                size_t levelEnd = order.size();
+                levelOffsets.push_back(levelEnd);
+                for (size_t k = levelBegin; k < levelEnd; ++k) {
+                    uint32_t node = order[k];
+                    for (uint32_t c = childStart[node]; c < childStart[node + 1]; ++c) {
+                        order.push_back(children[c]);
+                    }
+                }
+                levelBegin = levelEnd;
+            }
+
+            std::vector<uint32_t> newIndex(count);
+            for (size_t k = 0; k < count; ++k) {
+                newIndex[order[k]] = static_cast<uint32_t>(k);
+            }
+            permute(handles, order);
+            permute(positions, order);
+            permute(rotations, order);
+            permute(scales, order);
+            permute(worlds, order);
+            permute(dirty, order);
+            std::vector<uint32_t> newParents(count);
+            for (size_t k = 0; k < count; ++k) {
+                uint32_t oldParent = parents[order[k]];
+                newParents[k] = oldParent == kNoParent ? kNoParent : newIndex[oldParent];
+                *indices.get(handles[k]) = static_cast<uint32_t>(k);
+            }
+            parents.swap(newParents);
+            orderDirty = false;
+        }
+
+        template<typename T>
+        static void permute(std::vector<T>& values, const std::vector<uint32_t>& order) {
+            std::vector<T> sorted;
+            sorted.reserve(values.size());
+            for (uint32_t index : order) {
+                sorted.push_back(values[index]);
+            }
+            values.swap(sorted);
+        }
+
+        /// Propaga las marcas y recompone los nodos marcados de [first, last).
+        size_t updateRange(size_t first, size_t last) {
+            size_t recomputed = 0;
+            for (size_t i = first; i < last; ++i) {
+                uint32_t parentIndex = parents[i];
+                if (parentIndex != kNoParent && dirty[parentIndex]) {
+                    dirty[i] = 1;
+                }
+                if (dirty[i]) {
+                    compose(i, parentIndex);
+                    ++recomputed;
+                }
+            }
+            return recomputed;
+        }
+
+        /// worlds[i] = worlds[parent] * T * R * S.
+        void compose(size_t i, uint32_t parentIndex) {
+            const CQuaternion& q = rotations[i];
+            const CVector3& s = scales[i];
+            const CVector3& t = positions[i];
+            float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+            float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+            float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+            CAffineTransform local;
+            local.m[0][0] = (1.0f - 2.0f * (yy + zz)) * s.x;
+            local.m[0][1] = 2.0f * (xy - wz) * s.y;
+            local.m[0][2] = 2.0f * (xz + wy) * s.z;
+            local.m[0][3] = t.x;
+            local.m[1][0] = 2.0f * (xy + wz) * s.x;
+            local.m[1][1] = (1.0f - 2.0f * (xx + zz)) * s.y;
+            local.m[1][2] = 2.0f * (yz - wx) * s.z;
+            local.m[1][3] = t.y;
+            local.m[2][0] = 2.0f * (xz - wy) * s.x;
+            local.m[2][1] = 2.0f * (yz + wx) * s.y;
+            local.m[2][2] = (1.0f - 2.0f * (xx + yy)) * s.z;
+            local.m[2][3] = t.z;
+
+            if (parentIndex == kNoParent) {
+                worlds[i] = local;
+                return;
+            }
+            const CAffineTransform& p = worlds[parentIndex];
+            CAffineTransform& out = worlds[i];
+#if defined(ENGINEUTILITIES_SSE)
+            // Cada fila del resultado es una combinación de las filas de local más la
+            // traslación del padre: tres multiplicaciones y sumas de 4 floats por fila.
+            const __m128 l0 = _mm_load_ps(local.m[0]);
+            const __m128 l1 = _mm_load_ps(local.m[1]);
+            const __m128 l2 = _mm_load_ps(local.m[2]);
+            const __m128 translationMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+            for (int row = 0; row < 3; ++row) {
+                const __m128 pr = _mm_load_ps(p.m[row]);
+                __m128 result = _mm_and_ps(pr, translationMask);
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(pr, pr, _MM_SHUFFLE(0, 0, 0, 0)), l0));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(pr, pr, _MM_SHUFFLE(1, 1, 1, 1)), l1));
+                result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(pr, pr, _MM_SHUFFLE(2, 2, 2, 2)), l2));
+                _mm_store_ps(out.m[row], result);
+            }
+#else
+            for (int row = 0; row < 3; ++row) {
+                for (int column = 0; column < 4; ++column) {
+                    float value = column == 3 ? p.m[row][3] : 0.0f;
+                    value += p.m[row][0] * local.m[0][column];
+                    value += p.m[row][1] * local.m[1][column];
+                    value += p.m[row][2] * local.m[2][column];
+                    out.m[row][column] = value;
+                }
+            }
+#endif
+        }
+
+        TSlotMap<uint32_t, Handle> indices;     ///< Handle -> posición en los arrays.
+        std::vector<Handle> handles;             ///< Handle de cada posición.
+        std::vector<uint32_t> parents;           ///< Posición del padre (kNoParent en las raíces).
+        std::vector<CVector3> positions;         ///< Posiciones locales.
+        std::vector<CQuaternion> rotations;      ///< Rotaciones locales.
+        std::vector<CVector3> scales;            ///< Escalas locales.
+        std::vector<CAffineTransform> worlds;    ///< Transformaciones de mundo.
+        std::vector<uint8_t> dirty;              ///< Marcas de cambio pendientes.
+        std::vector<size_t> levelOffsets;        ///< Inicio de cada nivel (y total al final).
+        bool orderDirty;                         ///< La estructura cambió desde el último orden.
+        bool changed;                            ///< Hay marcas pendientes.
+    };
+
+}
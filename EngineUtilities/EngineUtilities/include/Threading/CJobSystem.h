@@ -0,0 +1,494 @@
+/**
+ * @file CJobSystem.h
+ * @brief Sistema de trabajos con robo de trabajo, contadores de dependencias y parallelFor.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "TWorkStealingDeque.h"
+#include "../Memory/TObjectPool.h"
+#include "../Utilities/Profiler.h"
+
+namespace EngineUtilities {
+
+    class CJobCounter;
+
+    /**
+     * @class CJob
+     * @brief Trabajo encolado en un CJobSystem (uso interno).
+     *
+     * Guarda el invocable dentro del propio objeto, sin asignaciones adicionales.
+     */
+    class CJob {
+    public:
+        static constexpr size_t kStorageBytes = 64; ///< Tamaño máximo de las capturas del invocable.
+
+        /// Ejecuta el invocable (si run es true) y lo destruye.
+        void (*invoke)(CJob& job, bool run) = nullptr;
+        CJobCounter* counter = nullptr; ///< Contador que se decrementa al terminar.
+        alignas(16) unsigned char storage[kStorageBytes];
+    };
+
+    /**
+     * @class CJobCounter
+     * @brief Cuenta los trabajos pendientes de un grupo y encadena los que dependen de él.
+     *
+     * CJobSystem::run() lo incrementa y cada trabajo lo decrementa al terminar;
+     * CJobSystem::wait() espera a que llegue a cero y CJobSystem::runAfter() encola un
+     * trabajo cuando llegue a cero.
+     *
+     * Un contador puede reutilizarse después de que wait() devuelva, pero no debe recibir
+     * trabajos nuevos mientras otro hilo está esperando a que termine.
+     */
+    class CJobCounter {
+    public:
+        CJobCounter() : value(0) {}
+
+        CJobCounter(const CJobCounter&) = delete;
+        CJobCounter& operator=(const CJobCounter&) = delete;
+
+        /// @brief Indica si no quedan trabajos pendientes.
+        bool isDone() const { return value.load(std::memory_order_acquire) == 0; }
+
+        /// @brief Trabajos pendientes (aproximado mientras haya hilos trabajando).
+        int pending() const { return std::max(0, value.load(std::memory_order_acquire)); }
+
+    private:
+        friend class CJobSystem;
+
+        static constexpr int kCompleting = -1; ///< El último trabajo está encolando las continuaciones.
+
+        std::atomic<int> value;           ///< Trabajos pendientes, o kCompleting.
+        std::mutex mutex;                 ///< Protege continuations.
+        std::vector<CJob*> continuations; ///< Trabajos encolados con runAfter().
+    };
+
+    /**
+     * @class CJobSystem
+     * @brief Pool de hilos con una cola de Chase-Lev por hilo y robo de trabajo.
+     *
+     * Cada hilo del pool encola los trabajos que crea en su propia cola y, cuando se queda
+     * sin trabajo, roba los más antiguos de las colas de los demás. El hilo que construye el
+     * sistema también tiene cola propia y participa mientras espera en wait() o parallelFor();
+     * el resto de hilos externos encolan en una cola compartida con mutex.
+     *
+     * Los trabajos se crean en un TObjectPool con cachés por hilo, así que encolar un
+     * trabajo no pasa por el heap global. Los hilos sin trabajo duermen en una variable de
+     * condición y se despiertan al encolar.
+     *
+     * Todos los contadores deben haber terminado antes de destruir el sistema; los trabajos
+     * que sigan en las colas se descartan sin ejecutarse.
+     */
+    class CJobSystem {
+    public:
+        /**
+         * @brief Constructor. Arranca los hilos del pool.
+         *
+         * @param workerThreads Hilos del pool, sin contar el que construye el sistema.
+         */
+        explicit CJobSystem(unsigned workerThreads = defaultWorkerCount())
+            : jobPool(256), running(true), sleepingWorkers(0), injectedCount(0) {
+            workers.reserve(workerThreads + 1);
+            for (unsigned i = 0; i <= workerThreads; ++i) {
+                workers.push_back(new Worker());
+            }
+
+            // El hilo que construye el sistema usa la cola 0.
+            ThreadBinding& binding = threadBinding();
+            if (binding.system == nullptr) {
+                binding.system = this;
+                binding.index = 0;
+                ownerBound = true;
+            }
+            else {
+                ownerBound = false;
+            }
+
+            for (unsigned i = 1; i <= workerThreads; ++i) {
+                workers[i]->thread = std::thread([this, i]() { workerLoop(i); });
+            }
+        }
+
+        /// @brief Destructor. Detiene los hilos y descarta los trabajos no ejecutados.
+        ~CJobSystem() {
+            {
+                std::lock_guard<std::mutex> lock(sleepMutex);
+                running.store(false, std::memory_order_release);
+            }
+            sleepCondition.notify_all();
+            for (size_t i = 1; i < workers.size(); ++i) {
+                workers[i]->thread.join();
+            }
+
+            CJob* job = nullptr;
+            for (Worker* worker : workers) {
+                while (worker->deque.pop(job)) {
+                    discard(job);
+                }
+                delete worker;
+            }
+            for (CJob* injected : injectedJobs) {
+                discard(injected);
+            }
+            if (ownerBound) {
+                threadBinding().system = nullptr;
+            }
+        }
+
+        CJobSystem(const CJobSystem&) = delete;
+        CJobSystem& operator=(const CJobSystem&) = delete;
+
+        /// @brief Hilos recomendados para el pool: uno menos que los núcleos (el llamador es el otro).
+        static unsigned defaultWorkerCount() {
+            unsigned cores = std::thread::hardware_concurrency();
+            return cores > 1 ? cores - 1 : 0;
+        }
+
+        /// @brief Hilos del pool (sin contar el que construyó el sistema).
+        unsigned workerCount() const { return static_cast<unsigned>(workers.size() - 1); }
+
+        /// @brief Hilos que ejecutan trabajos mientras el llamador espera (pool + llamador).
+        unsigned concurrency() const { return static_cast<unsigned>(workers.size()); }
+
+        /**
+         * @brief Encola un trabajo.
+         *
+         * @param fn Invocable sin argumentos; sus capturas deben caber en CJob::kStorageBytes.
+         * @param counter Contador que se incrementa ahora y se decrementa al terminar (opcional).
+         */
+        template<typename Fn>
+        void run(Fn&& fn, CJobCounter* counter = nullptr) {
+            if (counter != nullptr) {
+                increment(*counter);
+            }
+            schedule(makeJob(std::forward<Fn>(fn), counter));
+        }
+
+        /**
+         * @brief Encola un trabajo cuando dependency llegue a cero.
+         *
+         * @param dependency Contador del que depende el trabajo.
+         * @param fn Invocable sin argumentos; sus capturas deben caber en CJob::kStorageBytes.
+         * @param counter Contador que se incrementa ahora y se decrementa al terminar (opcional).
+         */
+        template<typename Fn>
+        void runAfter(CJobCounter& dependency, Fn&& fn, CJobCounter* counter = nullptr) {
+            if (counter != nullptr) {
+                increment(*counter);
+            }
+            CJob* job = makeJob(std::forward<Fn>(fn), counter);
+            for (;;) {
+                int value = dependency.value.load(std::memory_order_acquire);
+                if (value == CJobCounter::kCompleting) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(dependency.mutex);
+                value = dependency.value.load(std::memory_order_acquire);
+                if (value == CJobCounter::kCompleting) {
+                    continue;
+                }
+                if (value > 0) {
+                    dependency.continuations.push_back(job);
+                    return;
+                }
+                break;
+            }
+            schedule(job);
+        }
+
+        /**
+         * @brief Suma a counter una operación pendiente sin encolar ningún trabajo.
+         *
+         * Para operaciones asíncronas (por ejemplo, corrutinas) que terminan fuera del trabajo
+         * que las empezó. Cada llamada debe emparejarse con completePending().
+         */
+        void addPending(CJobCounter& counter) {
+            increment(counter);
+        }
+
+        /**
+         * @brief Marca como terminada una operación de addPending(); si era la última, encola
+         *        las continuaciones de counter.
+         */
+        void completePending(CJobCounter& counter) {
+            finish(counter);
+        }
+
+        /**
+         * @brief Espera a que counter llegue a cero ejecutando trabajos mientras tanto.
+         */
+        void wait(CJobCounter& counter) {
+            EU_PROFILE_ZONE("CJobSystem::wait");
+            int index = currentIndex();
+            unsigned spins = 0;
+            while (counter.value.load(std::memory_order_acquire) != 0) {
+                CJob* job = nullptr;
+                if (findJob(index, job)) {
+                    execute(job);
+                    spins = 0;
+                }
+                else if (++spins > 16) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        /**
+         * @brief Ejecuta fn(first, last) sobre subrangos de [begin, end) y espera a que terminen.
+         *
+         * El rango se divide por mitades: cada hilo encola la mitad superior y sigue con la
+         * inferior hasta llegar a grain elementos, así los ladrones se llevan siempre los
+         * trozos más grandes. El llamador procesa el primer trozo.
+         *
+         * @param grain Elementos mínimos por llamada a fn (el coste de un trabajo debe
+         *              amortizarse: del orden de microsegundos).
+         * @param fn Invocable con la firma void(size_t first, size_t last).
+         */
+        template<typename Fn>
+        void parallelFor(size_t begin, size_t end, size_t grain, const Fn& fn) {
+            if (end <= begin) {
+                return;
+            }
+            CJobCounter counter;
+            splitRange(begin, end, std::max<size_t>(grain, 1), fn, counter);
+            wait(counter);
+        }
+
+    private:
+        struct Worker {
+            TWorkStealingDeque<CJob*> deque;
+            std::thread thread;
+        };
+
+        /// Sistema y cola asociados al hilo actual.
+        struct ThreadBinding {
+            CJobSystem* system = nullptr;
+            unsigned index = 0;
+        };
+
+        static ThreadBinding& threadBinding() {
+            thread_local ThreadBinding binding;
+            return binding;
+        }
+
+        /// Cola del hilo actual en este sistema, o -1 si es un hilo externo.
+        int currentIndex() const {
+            const ThreadBinding& binding = threadBinding();
+            return binding.system == this ? static_cast<int>(binding.index) : -1;
+        }
+
+        template<typename Fn>
+        CJob* makeJob(Fn&& fn, CJobCounter* counter) {
+            using Callable = typename std::decay<Fn>::type;
+            static_assert(sizeof(Callable) <= CJob::kStorageBytes,
+                "Las capturas del trabajo no caben en CJob: captura por referencia o por puntero");
+            static_assert(alignof(Callable) <= 16, "Alineación de las capturas no soportada");
+
+            CJob* job = jobPool.create();
+            new (job->storage) Callable(std::forward<Fn>(fn));
+            job->counter = counter;
+            job->invoke = [](CJob& self, bool run) {
+                Callable* callable = std::launder(reinterpret_cast<Callable*>(self.storage));
+                if (run) {
+                    (*callable)();
+                }
+                callable->~Callable();
+            };
+            return job;
+        }
+
+        template<typename Fn>
+        void splitRange(size_t begin, size_t end, size_t grain, const Fn& fn, CJobCounter& counter) {
+            while (end - begin > grain) {
+                size_t middle = begin + (end - begin) / 2;
+                run([this, middle, end, grain, &fn, &counter]() {
+                    splitRange(middle, end, grain, fn, counter);
+                }, &counter);
+                end = middle;
+            }
+            fn(begin, end);
+        }
+
+        void schedule(CJob* job) {
+            int index = currentIndex();
+            if (index >= 0) {
+                workers[index]->deque.push(job);
+            }
+            else {
+                std::lock_guard<std::mutex> lock(injectedMutex);
+                injectedJobs.push_back(job);
+                injectedCount.store(injectedJobs.size(), std::memory_order_relaxed);
+            }
+            wakeWorker();
+        }
+
+        void wakeWorker() {
+            // Pareja de la comprobación de hasWork() al dormir: uno de los dos ve al otro.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepingWorkers.load(std::memory_order_relaxed) > 0) {
+                { std::lock_guard<std::mutex> lock(sleepMutex); }
+                sleepCondition.notify_one();
+            }
+        }
+
+        bool findJob(int index, CJob*& job) {
+            if (index >= 0 && workers[index]->deque.pop(job)) {
+                return true;
+            }
+            if (injectedCount.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(injectedMutex);
+                if (!injectedJobs.empty()) {
+                    job = injectedJobs.front();
+                    injectedJobs.pop_front();
+                    injectedCount.store(injectedJobs.size(), std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            // Robar empezando por el siguiente hilo para repartir la presión entre víctimas.
+            size_t count = workers.size();
+            size_t start = index >= 0 ? static_cast<size_t>(index) + 1 : 0;
+            for (size_t i = 0; i < count; ++i) {
+                size_t victim = (start + i) % count;
+                if (static_cast<int>(victim) != index && workers[victim]->deque.steal(job)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool hasWork() const {
+            if (injectedCount.load(std::memory_order_relaxed) > 0) {
+                return true;
+            }
+            for (const Worker* worker : workers) {
+                if (!worker->deque.empty()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void execute(CJob* job) {
+            {
+                EU_PROFILE_ZONE("CJob");
+                job->invoke(*job, true);
+            }
+            CJobCounter* counter = job->counter;
+            jobPool.destroy(job);
+            if (counter != nullptr) {
+                finish(*counter);
+            }
+        }
+
+        void discard(CJob* job) {
+            job->invoke(*job, false);
+            jobPool.destroy(job);
+        }
+
+        /**
+         * Suma un trabajo pendiente. Si el último trabajo está encolando las continuaciones
+         * (kCompleting), espera a que finish() deje el contador en cero: un fetch_add llevaría
+         * -1 a 0 y el store(0) de finish() borraría el incremento.
+         */
+        void increment(CJobCounter& counter) {
+            int value = counter.value.load(std::memory_order_relaxed);
+            for (;;) {
+                if (value == CJobCounter::kCompleting) {
+                    std::this_thread::yield();
+                    value = counter.value.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (counter.value.compare_exchange_weak(value, value + 1,
+                    std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+        }
+
+        /// Decrementa el contador; el último trabajo encola las continuaciones.
+        void finish(CJobCounter& counter) {
+            int value = counter.value.load(std::memory_order_relaxed);
+            for (;;) {
+                if (value == 1) {
+                    if (counter.value.compare_exchange_weak(value, CJobCounter::kCompleting,
+                        std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (counter.value.compare_exchange_weak(value, value - 1,
+                    std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+
+            std::vector<CJob*> ready;
+            {
+                std::lock_guard<std::mutex> lock(counter.mutex);
+                ready.swap(counter.continuations);
+            }
+            // A partir de aquí wait() puede devolver y el contador dejar de existir.
+            counter.value.store(0, std::memory_order_release);
+            for (CJob* job : ready) {
+                schedule(job);
+            }
+        }
+
+        void workerLoop(unsigned index) {
+            ThreadBinding& binding = threadBinding();
+            binding.system = this;
+            binding.index = index;
+            EU_PROFILE_THREAD_NAME("CJobSystem worker");
+
+            unsigned idle = 0;
+            while (running.load(std::memory_order_acquire)) {
+                CJob* job = nullptr;
+                if (findJob(static_cast<int>(index), job)) {
+                    execute(job);
+                    idle = 0;
+                    continue;
+                }
+                if (++idle < 64) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (running.load(std::memory_order_acquire) && !hasWork()) {
+                    sleepCondition.wait(lock);
+                }
+                sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+                idle = 0;
+            }
+        }
+
+        std::vector<Worker*> workers;         ///< Colas por hilo; la 0 es la del hilo creador.
+        TObjectPool<CJob> jobPool;            ///< Trabajos en vuelo.
+        std::atomic<bool> running;
+        bool ownerBound;                      ///< El hilo creador quedó asociado a la cola 0.
+
+        std::mutex sleepMutex;
+        std::condition_variable sleepCondition;
+        std::atomic<int> sleepingWorkers;
+
+        std::mutex injectedMutex;             ///< Protege injectedJobs.
+        std::deque<CJob*> injectedJobs;       ///< Trabajos encolados desde hilos externos.
+        std::atomic<size_t> injectedCount;
+    };
+
+}
@@ -0,0 +1,146 @@
+/**
+ * @file ParallelBatch.h
+ * @brief Operaciones por lotes sobre arrays de CVector3 y Matriz4x4, en serie y en paralelo.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "CJobSystem.h"
+#include "../Matriz/Matriz4x4.h"
+#include "../Vector/CVector3.h"
+
+namespace EngineUtilities {
+
+    /// Elementos por trabajo en las operaciones de vectores (unos microsegundos de trabajo).
+    const size_t kBatchVectorGrain = 4096;
+
+    /// Elementos por trabajo en las operaciones de matrices.
+    const size_t kBatchMatrixGrain = 256;
+
+    /**
+     * @brief output[i] = matrix * (input[i], 1), sin división perspectiva.
+     *
+     * La matriz se convierte una vez a float; input y output pueden ser el mismo array.
+     */
+    inline void transformPoints(const Matriz4x4& matrix, const CVector3* input, CVector3* output, size_t count) {
+        float m[3][4];
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                m[row][column] = static_cast<float>(matrix.m[row][column]);
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const CVector3 p = input[i];
+            output[i] = CVector3(
+                m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3],
+                m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3],
+                m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3]);
+        }
+    }
+
+    /**
+     * @brief output[i] = matrix * (input[i], 0): rota y escala direcciones sin trasladarlas.
+     */
+    inline void transformDirections(const Matriz4x4& matrix, const CVector3* input, CVector3* output, size_t count) {
+        float m[3][3];
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 3; ++column) {
+                m[row][column] = static_cast<float>(matrix.m[row][column]);
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const CVector3 d = input[i];
+            output[i] = CVector3(
+                m[0][0] * d.x + m[0][1] * d.y + m[0][2] * d.z,
+                m[1][0] * d.x + m[1][1] * d.y + m[1][2] * d.z,
+                m[2][0] * d.x + m[2][1] * d.y + m[2][2] * d.z);
+        }
+    }
+
+    /**
+     * @brief output[i] = left[i] * right[i] (por ejemplo, mundo del padre por local).
+     */
+    inline void multiplyMatrices(const Matriz4x4* left, const Matriz4x4* right, Matriz4x4* output, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            output[i] = left[i] * right[i];
+        }
+    }
+
+    /**
+     * @brief output[i] = left * right[i] (por ejemplo, vista-proyección por mundo).
+     */
+    inline void multiplyMatrices(const Matriz4x4& left, const Matriz4x4* right, Matriz4x4* output, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            output[i] = left * right[i];
+        }
+    }
+
+    /**
+     * @brief positions[i] += velocities[i] * deltaTime.
+     */
+    inline void integrate(CVector3* positions, const CVector3* velocities, float deltaTime, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            positions[i] += velocities[i] * deltaTime;
+        }
+    }
+
+    /**
+     * @brief Normaliza cada vector (los de longitud cero quedan a cero).
+     */
+    inline void normalizeVectors(CVector3* vectors, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            vectors[i] = vectors[i].normalized();
+        }
+    }
+
+    /// @brief transformPoints() repartido entre los hilos de jobs.
+    inline void parallelTransformPoints(CJobSystem& jobs, const Matriz4x4& matrix, const CVector3* input,
+        CVector3* output, size_t count, size_t grain = kBatchVectorGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            transformPoints(matrix, input + first, output + first, last - first);
+        });
+    }
+
+    /// @brief transformDirections() repartido entre los hilos de jobs.
+    inline void parallelTransformDirections(CJobSystem& jobs, const Matriz4x4& matrix, const CVector3* input,
+        CVector3* output, size_t count, size_t grain = kBatchVectorGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            transformDirections(matrix, input + first, output + first, last - first);
+        });
+    }
+
+    /// @brief multiplyMatrices() elemento a elemento repartido entre los hilos de jobs.
+    inline void parallelMultiplyMatrices(CJobSystem& jobs, const Matriz4x4* left, const Matriz4x4* right,
+        Matriz4x4* output, size_t count, size_t grain = kBatchMatrixGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            multiplyMatrices(left + first, right + first, output + first, last - first);
+        });
+    }
+
+    /// @brief multiplyMatrices() con matriz izquierda común repartido entre los hilos de jobs.
+    inline void parallelMultiplyMatrices(CJobSystem& jobs, const Matriz4x4& left, const Matriz4x4* right,
+        Matriz4x4* output, size_t count, size_t grain = kBatchMatrixGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            multiplyMatrices(left, right + first, output + first, last - first);
+        });
+    }
+
+    /// @brief integrate() repartido entre los hilos de jobs.
+    inline void parallelIntegrate(CJobSystem& jobs, CVector3* positions, const CVector3* velocities,
+        float deltaTime, size_t count, size_t grain = kBatchVectorGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            integrate(positions + first, velocities + first, deltaTime, last - first);
+        });
+    }
+
+    /// @brief normalizeVectors() repartido entre los hilos de jobs.
+    inline void parallelNormalizeVectors(CJobSystem& jobs, CVector3* vectors, size_t count,
+        size_t grain = kBatchVectorGrain) {
+        jobs.parallelFor(0, count, grain, [&](size_t first, size_t last) {
+            normalizeVectors(vectors + first, last - first);
+        });
+    }
+
+}
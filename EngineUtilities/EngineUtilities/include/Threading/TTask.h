@@ -0,0 +1,400 @@
+/**
+ * @file TTask.h
+ * @brief Tareas asíncronas con corrutinas de C++20 sobre CJobSystem.
+ * @author Hannin Abarca
+ *
+ * Requiere C++20. El resto de la biblioteca sigue compilando con C++17; solo los objetivos
+ * que incluyen esta cabecera necesitan el estándar nuevo.
+ */
+
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+#error "TTask.h requiere C++20 (corrutinas)"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "CJobSystem.h"
+
+namespace EngineUtilities {
+
+    template<typename T>
+    class TTask;
+
+    /**
+     * @class CCancellationToken
+     * @brief Vista de solo lectura de una petición de cancelación.
+     *
+     * La cancelación es cooperativa: la tarea consulta el token (directamente o al volver de
+     * CTaskScheduler::schedule(token)) y decide cómo terminar. Un token construido por
+     * defecto nunca se cancela.
+     */
+    class CCancellationToken {
+    public:
+        CCancellationToken() = default;
+
+        /// @brief Indica si se ha pedido la cancelación.
+        bool isCancelled() const { return flag != nullptr && flag->load(std::memory_order_acquire); }
+
+    private:
+        friend class CCancellationSource;
+
+        explicit CCancellationToken(std::shared_ptr<std::atomic<bool>> flag) : flag(std::move(flag)) {}
+
+        std::shared_ptr<std::atomic<bool>> flag;
+    };
+
+    /**
+     * @class CCancellationSource
+     * @brief Origen de una cancelación: reparte tokens y los marca todos con cancel().
+     *
+     * El indicador se comparte con std::shared_ptr porque los tokens viajan entre hilos
+     * (el recuento de TSharedPointer no es atómico).
+     */
+    class CCancellationSource {
+    public:
+        CCancellationSource() : flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+        /// @brief Pide la cancelación a todas las tareas que tengan un token de este origen.
+        void cancel() { flag->store(true, std::memory_order_release); }
+
+        /// @brief Indica si ya se llamó a cancel().
+        bool isCancelled() const { return flag->load(std::memory_order_acquire); }
+
+        /// @brief Token asociado a este origen.
+        CCancellationToken token() const { return CCancellationToken(flag); }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> flag;
+    };
+
+    /**
+     * @class CTaskPromiseBase
+     * @brief Parte común de las promesas de TTask (uso interno).
+     *
+     * Las tareas empiezan suspendidas y, al terminar, continúan directamente con la corrutina
+     * que las esperaba (transferencia simétrica: sin pasar por la cola ni crecer la pila).
+     * Las excepciones no se propagan: la biblioteca no las usa y terminan el programa.
+     */
+    class CTaskPromiseBase {
+    public:
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                std::coroutine_handle<> continuation = handle.promise().continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        std::coroutine_handle<> continuation; ///< Corrutina que espera el resultado.
+    };
+
+    /// Promesa de TTask<T>: guarda el valor devuelto con co_return (uso interno).
+    template<typename T>
+    class TTaskPromise : public CTaskPromiseBase {
+    public:
+        TTask<T> get_return_object() noexcept;
+
+        template<typename U>
+        void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+        std::optional<T> value;
+    };
+
+    /// Promesa de TTask<void> (uso interno).
+    template<>
+    class TTaskPromise<void> : public CTaskPromiseBase {
+    public:
+        TTask<void> get_return_object() noexcept;
+
+        void return_void() noexcept {}
+    };
+
+    /**
+     * @class TTask
+     * @brief Corrutina perezosa que produce un T.
+     *
+     * El cuerpo no empieza hasta que otra corrutina hace co_await sobre la tarea (y entonces
+     * se ejecuta en el mismo hilo hasta su primera suspensión) o hasta que se entrega a
+     * CTaskScheduler::spawn() o syncWait(). Esperar una tarea encadena la continuación:
+     * al terminar, la tarea reanuda directamente a quien la esperaba.
+     *
+     * Es de solo movimiento y destruye la corrutina al destruirse. Una tarea iniciada debe
+     * esperarse hasta que termine; destruir una tarea no iniciada simplemente descarta su
+     * trabajo.
+     *
+     * @tparam T Tipo del resultado (void si no devuelve nada).
+     */
+    template<typename T = void>
+    class TTask {
+    public:
+        using promise_type = TTaskPromise<T>;
+
+        TTask() noexcept = default;
+
+        explicit TTask(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+        TTask(TTask&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+        TTask& operator=(TTask&& other) noexcept {
+            if (this != &other) {
+                if (handle) {
+                    handle.destroy();
+                }
+                handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+
+        ~TTask() {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        TTask(const TTask&) = delete;
+        TTask& operator=(const TTask&) = delete;
+
+        /// @brief Indica si la tarea tiene una corrutina asociada.
+        bool valid() const { return static_cast<bool>(handle); }
+
+        /// @brief Indica si la corrutina ya terminó.
+        bool isDone() const { return handle && handle.done(); }
+
+        /**
+         * @brief Inicia la tarea (si no había empezado) y suspende al llamador hasta que termine.
+         *
+         * @return El valor de co_return.
+         */
+        auto operator co_await() && noexcept {
+            struct Awaiter {
+                std::coroutine_handle<promise_type> handle;
+
+                bool await_ready() noexcept { return handle.done(); }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                T await_resume() {
+                    if constexpr (!std::is_void<T>::value) {
+                        return std::move(*handle.promise().value);
+                    }
+                }
+            };
+            return Awaiter{ handle };
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    template<typename T>
+    TTask<T> TTaskPromise<T>::get_return_object() noexcept {
+        return TTask<T>(std::coroutine_handle<TTaskPromise<T>>::from_promise(*this));
+    }
+
+    inline TTask<void> TTaskPromise<void>::get_return_object() noexcept {
+        return TTask<void>(std::coroutine_handle<TTaskPromise<void>>::from_promise(*this));
+    }
+
+    /**
+     * @class CDetachedTask
+     * @brief Corrutina impaciente que se destruye sola al terminar (uso interno).
+     */
+    class CDetachedTask {
+    public:
+        struct promise_type {
+            CDetachedTask get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    /**
+     * @class CTaskScheduler
+     * @brief Ejecuta tareas TTask sobre los hilos de un CJobSystem.
+     *
+     * - co_await schedule() traslada la corrutina a un trabajo del pool (el hilo actual
+     *   queda libre para otra cosa).
+     * - co_await wait(counter) reanuda la corrutina cuando terminen los trabajos de un
+     *   CJobCounter, sin bloquear ningún hilo (usa CJobSystem::runAfter()).
+     * - spawn() lanza una tarea raíz y la cuenta en un CJobCounter; whenAll() lanza varias
+     *   en paralelo y espera a todas; syncWait() bloquea (ayudando al pool) hasta obtener
+     *   el resultado.
+     *
+     * Las corrutinas solo ocupan un hilo mientras se ejecutan: una tarea suspendida en
+     * wait() no retiene ningún hilo del pool.
+     */
+    class CTaskScheduler {
+    public:
+        explicit CTaskScheduler(CJobSystem& jobs) : jobs(jobs) {}
+
+        CTaskScheduler(const CTaskScheduler&) = delete;
+        CTaskScheduler& operator=(const CTaskScheduler&) = delete;
+
+        /// @brief Sistema de trabajos que ejecuta las tareas.
+        CJobSystem& jobSystem() { return jobs; }
+
+        /**
+         * @brief Awaitable que continúa la corrutina como un trabajo del pool.
+         */
+        auto schedule() {
+            struct Awaiter {
+                CJobSystem& jobs;
+
+                bool await_ready() noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle) { jobs.run([handle]() { handle.resume(); }); }
+                void await_resume() noexcept {}
+            };
+            return Awaiter{ jobs };
+        }
+
+        /**
+         * @brief Como schedule(), pero co_await devuelve false si token se canceló mientras
+         *        la corrutina esperaba turno (la tarea debe terminar cuanto antes).
+         */
+        auto schedule(CCancellationToken token) {
+            struct Awaiter {
+                CJobSystem& jobs;
+                CCancellationToken token;
+
+                bool await_ready() noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle) { jobs.run([handle]() { handle.resume(); }); }
+                bool await_resume() const noexcept { return !token.isCancelled(); }
+            };
+            return Awaiter{ jobs, std::move(token) };
+        }
+
+        /**
+         * @brief Awaitable que reanuda la corrutina cuando counter llegue a cero.
+         *
+         * La corrutina continúa en el hilo que termine el último trabajo, o en el actual si
+         * el contador ya estaba a cero.
+         */
+        auto wait(CJobCounter& counter) {
+            struct Awaiter {
+                CJobSystem& jobs;
+                CJobCounter& counter;
+
+                bool await_ready() const noexcept { return counter.isDone(); }
+                void await_suspend(std::coroutine_handle<> handle) {
+                    jobs.runAfter(counter, [handle]() { handle.resume(); });
+                }
+                void await_resume() noexcept {}
+            };
+            return Awaiter{ jobs, counter };
+        }
+
+        /**
+         * @brief Lanza una tarea en el pool sin esperarla; counter sigue pendiente hasta que termine.
+         *
+         * El resultado, si lo hay, se descarta. Espera con CJobSystem::wait(counter) desde un
+         * hilo o con co_await wait(counter) desde otra corrutina.
+         */
+        template<typename T>
+        void spawn(TTask<T> task, CJobCounter& counter) {
+            jobs.addPending(counter);
+            runDetached(std::move(task), static_cast<std::optional<T>*>(nullptr), counter);
+        }
+
+        /// @brief Versión de spawn() para tareas sin resultado.
+        void spawn(TTask<void> task, CJobCounter& counter) {
+            jobs.addPending(counter);
+            runDetached(std::move(task), counter);
+        }
+
+        /**
+         * @brief Ejecuta la tarea en el pool y espera su resultado ejecutando trabajos mientras tanto.
+         *
+         * Pensado para el hilo principal o para pruebas; dentro de una corrutina usa co_await.
+         */
+        template<typename T>
+        T syncWait(TTask<T> task) {
+            CJobCounter counter;
+            if constexpr (std::is_void<T>::value) {
+                spawn(std::move(task), counter);
+                jobs.wait(counter);
+            }
+            else {
+                std::optional<T> result;
+                jobs.addPending(counter);
+                runDetached(std::move(task), &result, counter);
+                jobs.wait(counter);
+                return std::move(*result);
+            }
+        }
+
+        /**
+         * @brief Tarea que ejecuta todas las tareas en paralelo y devuelve sus resultados en orden.
+         */
+        template<typename T>
+        TTask<std::vector<T>> whenAll(std::vector<TTask<T>> tasks) {
+            std::vector<std::optional<T>> slots(tasks.size());
+            CJobCounter counter;
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                jobs.addPending(counter);
+                runDetached(std::move(tasks[i]), &slots[i], counter);
+            }
+            co_await wait(counter);
+
+            std::vector<T> results;
+            results.reserve(slots.size());
+            for (std::optional<T>& slot : slots) {
+                results.push_back(std::move(*slot));
+            }
+            co_return results;
+        }
+
+        /// @brief Versión de whenAll() para tareas sin resultado.
+        TTask<void> whenAll(std::vector<TTask<void>> tasks) {
+            CJobCounter counter;
+            for (TTask<void>& task : tasks) {
+                spawn(std::move(task), counter);
+            }
+            co_await wait(counter);
+        }
+
+    private:
+        /// Salta al pool, ejecuta la tarea, guarda el resultado y completa el contador.
+        template<typename T>
+        CDetachedTask runDetached(TTask<T> task, std::optional<T>* result, CJobCounter& counter) {
+            co_await schedule();
+            if (result != nullptr) {
+                result->emplace(co_await std::move(task));
+            }
+            else {
+                co_await std::move(task);
+            }
+            // A partir de aquí quien espera counter puede continuar; no tocar nada más.
+            jobs.completePending(counter);
+        }
+
+        CDetachedTask runDetached(TTask<void> task, CJobCounter& counter) {
+            co_await schedule();
+            co_await std::move(task);
+            jobs.completePending(counter);
+        }
+
+        CJobSystem& jobs;
+    };
+
+}
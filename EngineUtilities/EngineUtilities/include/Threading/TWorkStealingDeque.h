@@ -0,0 +1,157 @@
+/**
+ * @file TWorkStealingDeque.h
+ * @brief Cola doble de Chase-Lev para el robo de trabajo entre hilos.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EngineUtilities {
+
+    /**
+     * @class TWorkStealingDeque
+     * @brief Cola doble sin bloqueos de Chase-Lev (con el modelo de memoria de Lê et al., 2013).
+     *
+     * Un único hilo propietario inserta y extrae por el extremo inferior (LIFO, el trabajo
+     * más reciente y con la caché más caliente); el resto de hilos roban por el superior
+     * (FIFO, el trabajo más antiguo y normalmente más grande). Solo el robo y la extracción
+     * del último elemento usan una operación compare-exchange.
+     *
+     * El array circular crece al llenarse. Los arrays antiguos se conservan hasta destruir
+     * la cola porque un ladrón puede seguir leyéndolos.
+     *
+     * @tparam T Tipo trivialmente copiable de los elementos (normalmente un puntero).
+     */
+    template<typename T>
+    class TWorkStealingDeque {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param initialCapacity Capacidad inicial (se redondea a potencia de dos).
+         */
+        explicit TWorkStealingDeque(size_t initialCapacity = 1024) : top(0), bottom(0) {
+            size_t capacity = 2;
+            while (capacity < initialCapacity) {
+                capacity <<= 1;
+            }
+            Ring* ring = new Ring(capacity);
+            rings.push_back(ring);
+            current.store(ring, std::memory_order_relaxed);
+        }
+
+        ~TWorkStealingDeque() {
+            for (Ring* ring : rings) {
+                delete ring;
+            }
+        }
+
+        TWorkStealingDeque(const TWorkStealingDeque&) = delete;
+        TWorkStealingDeque& operator=(const TWorkStealingDeque&) = delete;
+
+        /**
+         * @brief Inserta un elemento por abajo. Solo el hilo propietario.
+         */
+        void push(T item) {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_acquire);
+            Ring* ring = current.load(std::memory_order_relaxed);
+            if (b - t > static_cast<int64_t>(ring->mask)) {
+                ring = grow(ring, t, b);
+            }
+            ring->at(b).store(item, std::memory_order_relaxed);
+            // Publica el elemento (y lo que apunta) a los ladrones que lean bottom.
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Extrae el elemento insertado más recientemente. Solo el hilo propietario.
+         *
+         * @return true si había un elemento (y se escribió en item).
+         */
+        bool pop(T& item) {
+            int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            Ring* ring = current.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                // Vacía.
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+            item = ring->at(b).load(std::memory_order_relaxed);
+            if (t == b) {
+                // Último elemento: competir con los ladrones.
+                bool won = top.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Roba el elemento más antiguo. Cualquier hilo.
+         *
+         * @return true si se robó un elemento; false si estaba vacía o se perdió la carrera.
+         */
+        bool steal(T& item) {
+            int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return false;
+            }
+            Ring* ring = current.load(std::memory_order_acquire);
+            item = ring->at(t).load(std::memory_order_relaxed);
+            return top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        /// @brief Número aproximado de elementos (exacto solo sin concurrencia).
+        size_t size() const {
+            int64_t b = bottom.load(std::memory_order_relaxed);
+            int64_t t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<size_t>(b - t) : 0;
+        }
+
+        /// @brief Indica si la cola parece vacía.
+        bool empty() const { return size() == 0; }
+
+    private:
+        /// Array circular de capacidad potencia de dos.
+        struct Ring {
+            explicit Ring(size_t capacity) : mask(capacity - 1), items(new std::atomic<T>[capacity]) {}
+            ~Ring() { delete[] items; }
+
+            std::atomic<T>& at(int64_t index) { return items[static_cast<size_t>(index) & mask]; }
+
+            size_t mask;
+            std::atomic<T>* items;
+        };
+
+        /// Duplica la capacidad copiando los elementos vivos. Solo el hilo propietario.
+        Ring* grow(Ring* ring, int64_t t, int64_t b) {
+            Ring* bigger = new Ring((ring->mask + 1) * 2);
+            for (int64_t i = t; i < b; ++i) {
+                bigger->at(i).store(ring->at(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            rings.push_back(bigger);
+            current.store(bigger, std::memory_order_release);
+            return bigger;
+        }
+
+        alignas(64) std::atomic<int64_t> top;    ///< Extremo de robo (lo modifican los ladrones).
+        alignas(64) std::atomic<int64_t> bottom; ///< Extremo del propietario.
+        std::atomic<Ring*> current;              ///< Array en uso.
+        std::vector<Ring*> rings;                ///< Todos los arrays creados (solo el propietario).
+    };
+
+}
@@ -0,0 +1,145 @@
+/**
+ * @file CRadixSorter.h
+ * @brief Ordenación radix estable de claves de 64 bits (códigos de Morton o Hilbert) con valores.
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "../Threading/CJobSystem.h"
+
+namespace EngineUtilities {
+
+    /**
+     * @class CRadixSorter
+     * @brief Ordenación LSD por dígitos de 8 bits, en serie o repartida entre hilos.
+     *
+     * Cada pasada cuenta los dígitos, calcula dónde empieza cada uno con una suma prefija y
+     * reparte claves y valores a un array auxiliar. En paralelo, el array se divide en bloques
+     * de kParallelGrain: cada bloque cuenta sus dígitos, la suma prefija recorre los dígitos y
+     * dentro de cada uno los bloques en orden, y cada bloque reparte sus elementos en su propio
+     * tramo de salida; así el resultado es estable e idéntico al de la versión en serie.
+     *
+     * Las pasadas cuyo dígito es el mismo en todas las claves se saltan (los bits altos de
+     * códigos de pocas celdas). Los arrays auxiliares se conservan entre llamadas.
+     */
+    class CRadixSorter {
+    public:
+        static constexpr int kDigitBits = 8;                 ///< Bits por pasada.
+        static constexpr int kBuckets = 1 << kDigitBits;     ///< Dígitos distintos por pasada.
+        static constexpr size_t kParallelGrain = 65536;      ///< Elementos por bloque en paralelo.
+
+        /**
+         * @brief Ordena keys[0, count) de menor a mayor y permuta values igual.
+         *
+         * @param values Valores que acompañan a cada clave (índices, normalmente); puede ser nullptr.
+         * @param keyBits Solo se ordena por los keyBits bits bajos (63 para códigos 3D).
+         * @param jobs Sistema de trabajos para repartir cada pasada (opcional).
+         */
+        void sort(uint64_t* keys, uint32_t* values, size_t count, int keyBits = 64, CJobSystem* jobs = nullptr) {
+            if (count < 2) {
+                return;
+            }
+            keyBits = std::min(std::max(keyBits, 0), 64);
+            const int passes = (keyBits + kDigitBits - 1) / kDigitBits;
+            const bool parallel = jobs != nullptr && jobs->workerCount() > 0 && count > kParallelGrain;
+            const size_t blocks = parallel ? (count + kParallelGrain - 1) / kParallelGrain : 1;
+            const size_t blockSize = parallel ? kParallelGrain : count;
+            keyScratch.resize(count);
+            if (values != nullptr) {
+                valueScratch.resize(count);
+            }
+            counts.resize(blocks * kBuckets);
+
+            uint64_t* sourceKeys = keys;
+            uint64_t* targetKeys = keyScratch.data();
+            uint32_t* sourceValues = values;
+            uint32_t* targetValues = values != nullptr ? valueScratch.data() : nullptr;
+            auto forEachBlock = [&](const auto& fn) {
+                if (!parallel) {
+                    fn(0);
+                    return;
+                }
+                jobs->parallelFor(0, blocks, 1, [&](size_t firstBlock, size_t lastBlock) {
+                    for (size_t block = firstBlock; block < lastBlock; ++block) {
+                        fn(block);
+                    }
+                });
+            };
+
+            for (int pass = 0; pass < passes; ++pass) {
+                const int shift = pass * kDigitBits;
+                // La última pasada solo mira los bits que quedan hasta keyBits.
+                const uint64_t digitMask = keyBits - shift >= kDigitBits ? kBuckets - 1 : (1u << (keyBits - shift)) - 1;
+                forEachBlock([&](size_t block) {
+                    uint32_t* blockCounts = counts.data() + block * kBuckets;
+                    std::fill(blockCounts, blockCounts + kBuckets, 0u);
+                    size_t last = std::min(count, (block + 1) * blockSize);
+                    for (size_t i = block * blockSize; i < last; ++i) {
+                        ++blockCounts[(sourceKeys[i] >> shift) & digitMask];
+                    }
+                });
+                // Convertir los recuentos en posiciones de salida: dígito a dígito y, dentro de
+                // cada dígito, bloque a bloque.
+                size_t offset = 0;
+                bool trivial = false;
+                for (int digit = 0; digit < kBuckets && !trivial; ++digit) {
+                    size_t digitTotal = 0;
+                    for (size_t block = 0; block < blocks; ++block) {
+                        uint32_t& slot = counts[block * kBuckets + digit];
+                        uint32_t blockCount = slot;
+                        slot = static_cast<uint32_t>(offset + digitTotal);
+                        digitTotal += blockCount;
+                    }
+                    trivial = digitTotal == count;
+                    offset += digitTotal;
+                }
+                if (trivial) {
+                    continue;
+                }
+                forEachBlock([&](size_t block) {
+                    uint32_t* blockOffsets = counts.data() + block * kBuckets;
+                    size_t last = std::min(count, (block + 1) * blockSize);
+                    for (size_t i = block * blockSize; i < last; ++i) {
+                        uint32_t position = blockOffsets[(sourceKeys[i] >> shift) & digitMask]++;
+                        targetKeys[position] = sourceKeys[i];
+                        if (sourceValues != nullptr) {
+                            targetValues[position] = sourceValues[i];
+                        }
+                    }
+                });
+                std::swap(sourceKeys, targetKeys);
+                std::swap(sourceValues, targetValues);
+            }
+            // Tras un número impar de pasadas el resultado está en los arrays auxiliares.
+            if (sourceKeys != keys) {
+                std::memcpy(keys, sourceKeys, count * sizeof(uint64_t));
+                if (values != nullptr) {
+                    std::memcpy(values, sourceValues, count * sizeof(uint32_t));
+                }
+            }
+        }
+
+        /// @brief Ordena keys y permuta values igual (deben tener el mismo tamaño).
+        void sort(std::vector<uint64_t>& keys, std::vector<uint32_t>& values, int keyBits = 64, CJobSystem* jobs = nullptr) {
+            sort(keys.data(), values.data(), keys.size(), keyBits, jobs);
+        }
+
+        /// @brief Bytes reservados por los arrays auxiliares.
+        size_t memoryUsage() const {
+            return keyScratch.capacity() * sizeof(uint64_t) + valueScratch.capacity() * sizeof(uint32_t) +
+                counts.capacity() * sizeof(uint32_t);
+        }
+
+    private:
+        std::vector<uint64_t> keyScratch;   ///< Destino de las pasadas impares.
+        std::vector<uint32_t> valueScratch; ///< Valores que acompañan a keyScratch.
+        std::vector<uint32_t> counts;       ///< kBuckets recuentos (y luego posiciones) por bloque.
+    };
+
+}
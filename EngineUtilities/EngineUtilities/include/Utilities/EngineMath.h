@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include <cmath> // Solo para las constantes NAN e INFINITY.
+#include <cstdint>
+#include <cstring>
+
 namespace EngineUtilities {
 
     // Constantes Matemticas
@@ -45,13 +49,26 @@ namespace EngineUtilities {
     // Funciones Avanzadas
     inline double sqrt(double x) {
         if (x < 0.0) return NAN;
-        double guess = x / 2.0;
-        for (int i = 0; i < 20; ++i)
-            guess = (guess + x / guess) / 2.0;
+        if (x == 0.0 || x == INFINITY) return x;
+        // Estimacin inicial dividiendo el exponente entre dos (error < 6%), de modo que
+        // Newton converge en pocas iteraciones en todo el rango de double.
+        uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        bits = (bits >> 1) + (uint64_t(1023) << 51);
+        double guess;
+        std::memcpy(&guess, &bits, sizeof(guess));
+        // Tras el primer paso las iteraciones decrecen hacia la raz: parar cuando dejan de hacerlo.
+        for (int i = 0; i < 64; ++i) {
+            double next = (guess + x / guess) / 2.0;
+            if (i > 0 && next >= guess) break;
+            guess = next;
+        }
         return guess;
     }
 
     inline double exp(double x) {
+        // La serie alterna de signo con x < 0 y pierde precisin por cancelacin.
+        if (x < 0.0) return 1.0 / exp(-x);
         double result = 1.0, term = 1.0;
         int n = 1;
         while (fabs(term) > EPSILON) {
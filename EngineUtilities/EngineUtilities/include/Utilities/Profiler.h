@@ -0,0 +1,403 @@
+/**
+ * @file Profiler.h
+ * @brief Zonas de perfilado con ámbito y exportación a Chrome trace (chrome://tracing, Perfetto).
+ * @author Hannin Abarca
+ */
+
+#pragma once
+
+/**
+ * @brief Activa las zonas de perfilado.
+ *
+ * Con valor 0 (por defecto) las macros EU_PROFILE_* no generan código. Igual que
+ * ENGINEUTILITIES_MEMORY_TRACKING, conviene definirlo desde el sistema de compilación
+ * para que valga lo mismo en todas las unidades que compartan funciones en línea.
+ */
+#ifndef ENGINEUTILITIES_PROFILING
+#define ENGINEUTILITIES_PROFILING 0
+#endif
+
+/// Eventos que guarda el buffer circular de cada hilo (potencia de dos).
+#ifndef ENGINEUTILITIES_PROFILING_BUFFER_EVENTS
+#define ENGINEUTILITIES_PROFILING_BUFFER_EVENTS 65536
+#endif
+
+#if ENGINEUTILITIES_PROFILING
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ENGINEUTILITIES_PROFILING_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define ENGINEUTILITIES_PROFILING_RDTSC 1
+#else
+#define ENGINEUTILITIES_PROFILING_RDTSC 0
+#endif
+
+namespace EngineUtilities {
+
+    /**
+     * @brief Zona registrada, tal como la devuelve Profiler::collect().
+     */
+    struct ProfileEvent {
+        const char* name;  ///< Nombre de la zona (cadena estática).
+        uint64_t start;    ///< Marca de tiempo de entrada, en ticks de Profiler::now().
+        uint64_t end;      ///< Marca de tiempo de salida, en ticks de Profiler::now().
+        uint32_t threadId; ///< Identificador del hilo que la registró (desde 1).
+    };
+
+    /**
+     * @class Profiler
+     * @brief Registro de zonas de tiempo por hilo con exportación a Chrome trace-event JSON.
+     *
+     * Cada hilo escribe sus zonas en su propio buffer circular: registrar una zona son dos
+     * lecturas del contador de tiempo y cuatro escrituras, sin bloqueos ni instrucciones
+     * atómicas de lectura-modificación-escritura. Cada buffer conserva las
+     * kBufferEvents - 1 zonas más recientes; las anteriores se sobrescriben y
+     * droppedEvents() las cuenta.
+     *
+     * Las marcas de tiempo salen de rdtsc en x86 y de std::chrono::steady_clock en otras
+     * plataformas; la conversión a microsegundos se calibra contra steady_clock al exportar.
+     *
+     * collect() y writeChromeTrace() pueden llamarse con otros hilos registrando zonas:
+     * las que se sobrescriben durante la copia se descartan en lugar de exportarse a medias.
+     *
+     * Solo existe si ENGINEUTILITIES_PROFILING vale 1.
+     */
+    class Profiler {
+    public:
+        static constexpr size_t kBufferEvents = ENGINEUTILITIES_PROFILING_BUFFER_EVENTS;
+        static_assert((kBufferEvents & (kBufferEvents - 1)) == 0 && kBufferEvents > 0,
+            "ENGINEUTILITIES_PROFILING_BUFFER_EVENTS debe ser una potencia de dos");
+
+        /// @brief Marca de tiempo actual en ticks (ciclos de TSC o nanosegundos).
+        static uint64_t now() {
+#if ENGINEUTILITIES_PROFILING_RDTSC
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        /**
+         * @brief Registra una zona ya medida en el buffer del hilo actual.
+         *
+         * @param name Nombre con duración estática (literal o __func__); no se copia.
+         */
+        static void record(const char* name, uint64_t start, uint64_t end) {
+            write(threadBuffer(), name, start, end);
+        }
+
+        /**
+         * @brief Asigna un nombre al hilo actual en la traza exportada.
+         *
+         * @param name Nombre del hilo (se copia).
+         */
+        static void setThreadName(const char* name) {
+            ThreadBuffer* buffer = threadBuffer();
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            buffer->name = name;
+        }
+
+        /**
+         * @brief Copia las zonas pendientes de todos los hilos, ordenadas por inicio.
+         *
+         * No las consume: una segunda llamada las vuelve a devolver hasta clear().
+         */
+        static std::vector<ProfileEvent> collect() {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            std::vector<ProfileEvent> events;
+            for (ThreadBuffer* buffer : registry.threads) {
+                uint64_t head = buffer->head.load(std::memory_order_acquire);
+                uint64_t first = std::max(buffer->consumed, oldestIndex(head));
+                size_t copiedFrom = events.size();
+                for (uint64_t index = first; index < head; ++index) {
+                    const EventSlot& slot = buffer->slots[index & kIndexMask];
+                    ProfileEvent event;
+                    event.name = slot.name.load(std::memory_order_relaxed);
+                    event.start = slot.start.load(std::memory_order_relaxed);
+                    event.end = slot.end.load(std::memory_order_relaxed);
+                    event.threadId = buffer->id;
+                    events.push_back(event);
+                }
+
+                // Descartar las zonas que el hilo sobrescribió mientras se copiaban.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                uint64_t valid = oldestIndex(buffer->head.load(std::memory_order_relaxed));
+                if (valid > first) {
+                    size_t discard = static_cast<size_t>(std::min(valid, head) - first);
+                    events.erase(events.begin() + copiedFrom, events.begin() + copiedFrom + discard);
+                }
+            }
+
+            std::sort(events.begin(), events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+                return a.start < b.start;
+            });
+            return events;
+        }
+
+        /**
+         * @brief Zonas sobrescritas antes de ser exportadas o descartadas con clear().
+         */
+        static uint64_t droppedEvents() {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            uint64_t dropped = 0;
+            for (ThreadBuffer* buffer : registry.threads) {
+                uint64_t oldest = oldestIndex(buffer->head.load(std::memory_order_acquire));
+                dropped += oldest > buffer->consumed ? oldest - buffer->consumed : 0;
+            }
+            return dropped;
+        }
+
+        /// @brief Descarta todas las zonas registradas hasta ahora.
+        static void clear() {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (ThreadBuffer* buffer : registry.threads) {
+                buffer->consumed = buffer->head.load(std::memory_order_acquire);
+            }
+        }
+
+        /**
+         * @brief Ticks de now() por microsegundo.
+         *
+         * Con rdtsc se mide contra steady_clock desde el primer uso del perfilador (al menos
+         * 10 ms, esperando si hace falta); sin rdtsc los ticks ya son nanosegundos.
+         */
+        static double ticksPerMicrosecond() {
+#if ENGINEUTILITIES_PROFILING_RDTSC
+            const Registry& registry = getRegistry();
+            std::chrono::steady_clock::time_point until = registry.originTime + std::chrono::milliseconds(10);
+            while (std::chrono::steady_clock::now() < until) {
+            }
+            uint64_t ticks = now();
+            double micros = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - registry.originTime).count();
+            return static_cast<double>(ticks - registry.originTicks) / micros;
+#else
+            return 1000.0;
+#endif
+        }
+
+        /**
+         * @brief Escribe las zonas pendientes en formato Chrome trace-event JSON.
+         *
+         * Cada zona es un evento completo ("ph":"X") con inicio y duración en microsegundos
+         * desde el primer uso del perfilador; cada hilo con nombre añade un evento de metadatos.
+         */
+        static void writeChromeTrace(std::ostream& os) {
+            std::vector<ProfileEvent> events = collect();
+            double ticksPerUs = ticksPerMicrosecond();
+            uint64_t origin = getRegistry().originTicks;
+
+            os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            bool first = true;
+            {
+                Registry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (const ThreadBuffer* buffer : registry.threads) {
+                    if (buffer->name.empty()) {
+                        continue;
+                    }
+                    os << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                        << buffer->id << ",\"args\":{\"name\":";
+                    writeJsonString(os, buffer->name.c_str());
+                    os << "}}";
+                    first = false;
+                }
+            }
+
+            char numbers[96];
+            for (const ProfileEvent& event : events) {
+                os << (first ? "\n" : ",\n") << "{\"name\":";
+                writeJsonString(os, event.name);
+                double ts = static_cast<double>(static_cast<int64_t>(event.start - origin)) / ticksPerUs;
+                double dur = static_cast<double>(event.end - event.start) / ticksPerUs;
+                std::snprintf(numbers, sizeof(numbers), ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    static_cast<unsigned>(event.threadId), ts, dur);
+                os << numbers;
+                first = false;
+            }
+            os << "\n]}\n";
+        }
+
+        /**
+         * @brief Escribe la traza en un archivo.
+         *
+         * @return false si no se pudo abrir el archivo.
+         */
+        static bool writeChromeTrace(const std::string& path) {
+            std::ofstream file(path.c_str(), std::ios::out | std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+            writeChromeTrace(file);
+            return static_cast<bool>(file);
+        }
+
+    private:
+        friend class ProfileZone;
+
+        static constexpr uint64_t kIndexMask = kBufferEvents - 1;
+
+        /// Zona en el buffer; atómica para que collect() pueda leer mientras el hilo escribe.
+        struct EventSlot {
+            std::atomic<const char*> name{ nullptr };
+            std::atomic<uint64_t> start{ 0 };
+            std::atomic<uint64_t> end{ 0 };
+        };
+
+        /// Buffer circular de un hilo: solo su hilo propietario escribe en slots y head.
+        struct ThreadBuffer {
+            std::atomic<uint64_t> head{ 0 }; ///< Zonas escritas desde la creación del buffer.
+            uint64_t consumed = 0;           ///< Primera zona no descartada (protegido por Registry::mutex).
+            uint32_t id = 0;                 ///< Identificador del hilo en la traza.
+            bool owned = false;              ///< true mientras un hilo vivo lo usa (protegido por Registry::mutex).
+            std::string name;                ///< Nombre del hilo (protegido por Registry::mutex).
+            EventSlot slots[kBufferEvents];
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<ThreadBuffer*> threads; ///< Buffers de todos los hilos (nunca se liberan).
+            uint64_t originTicks = now();       ///< Origen de tiempos de la traza.
+            std::chrono::steady_clock::time_point originTime = std::chrono::steady_clock::now();
+        };
+
+        /// Asocia el hilo actual a un buffer y lo libera al terminar el hilo.
+        struct ThreadSlot {
+            ThreadBuffer* buffer;
+
+            ThreadSlot() : buffer(acquireBuffer()) {}
+
+            ~ThreadSlot() {
+                // Las zonas se conservan hasta exportarlas; otro hilo puede reutilizar el buffer.
+                Registry& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                buffer->owned = false;
+                buffer->name.clear();
+            }
+        };
+
+        static Registry& getRegistry() {
+            static Registry* registry = new Registry();
+            return *registry;
+        }
+
+        static ThreadBuffer* acquireBuffer() {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (ThreadBuffer* buffer : registry.threads) {
+                if (!buffer->owned) {
+                    buffer->owned = true;
+                    return buffer;
+                }
+            }
+            ThreadBuffer* buffer = new ThreadBuffer();
+            buffer->id = static_cast<uint32_t>(registry.threads.size() + 1);
+            buffer->owned = true;
+            registry.threads.push_back(buffer);
+            return buffer;
+        }
+
+        static ThreadBuffer* threadBuffer() {
+            thread_local ThreadSlot slot;
+            return slot.buffer;
+        }
+
+        static void write(ThreadBuffer* buffer, const char* name, uint64_t start, uint64_t end) {
+            uint64_t index = buffer->head.load(std::memory_order_relaxed);
+            EventSlot& slot = buffer->slots[index & kIndexMask];
+            slot.name.store(name, std::memory_order_relaxed);
+            slot.start.store(start, std::memory_order_relaxed);
+            slot.end.store(end, std::memory_order_relaxed);
+            buffer->head.store(index + 1, std::memory_order_release);
+        }
+
+        /**
+         * Índice de la zona más antigua que sigue en un buffer con head zonas escritas.
+         * Se conservan kBufferEvents - 1 zonas: el slot restante es el que el hilo puede
+         * estar sobrescribiendo, y así collect() nunca exporta una zona a medio escribir.
+         */
+        static uint64_t oldestIndex(uint64_t head) {
+            return head >= kBufferEvents ? head - kBufferEvents + 1 : 0;
+        }
+
+        static void writeJsonString(std::ostream& os, const char* text) {
+            os << '"';
+            for (const char* c = text != nullptr ? text : ""; *c != '\0'; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    os << '\\' << *c;
+                }
+                else if (static_cast<unsigned char>(*c) < 0x20) {
+                    os << ' ';
+                }
+                else {
+                    os << *c;
+                }
+            }
+            os << '"';
+        }
+    };
+
+    /**
+     * @class ProfileZone
+     * @brief Mide el tiempo entre su construcción y su destrucción y lo registra como zona.
+     *
+     * Se usa a través de EU_PROFILE_ZONE / EU_PROFILE_FUNCTION.
+     */
+    class ProfileZone {
+    public:
+        /// @param name Nombre con duración estática (literal o __func__).
+        explicit ProfileZone(const char* name)
+            : buffer(Profiler::threadBuffer()), name(name), start(Profiler::now()) {}
+
+        ~ProfileZone() {
+            Profiler::write(buffer, name, start, Profiler::now());
+        }
+
+        ProfileZone(const ProfileZone&) = delete;
+        ProfileZone& operator=(const ProfileZone&) = delete;
+
+    private:
+        Profiler::ThreadBuffer* buffer;
+        const char* name;
+        uint64_t start;
+    };
+
+}
+
+#define EU_PROFILE_CONCAT_IMPL(a, b) a##b
+#define EU_PROFILE_CONCAT(a, b) EU_PROFILE_CONCAT_IMPL(a, b)
+
+/// Registra el resto del ámbito actual como una zona llamada name.
+#define EU_PROFILE_ZONE(name) ::EngineUtilities::ProfileZone EU_PROFILE_CONCAT(euProfileZone, __LINE__)(name)
+/// Registra el resto de la función actual como una zona con su nombre.
+#define EU_PROFILE_FUNCTION() EU_PROFILE_ZONE(__func__)
+/// Nombra el hilo actual en la traza exportada.
+#define EU_PROFILE_THREAD_NAME(name) ::EngineUtilities::Profiler::setThreadName(name)
+
+#else
+
+#define EU_PROFILE_ZONE(name) ((void)0)
+#define EU_PROFILE_FUNCTION() ((void)0)
+#define EU_PROFILE_THREAD_NAME(name) ((void)0)
+
+#endif
@@ -0,0 +1,260 @@
+/**
+ * @file Simd.h
+ * @brief Detección de las extensiones SIMD con las que se compila EngineUtilities.
+ * @author Hannin Abarca
+ *
+ * Las rutas vectoriales de la biblioteca se eligen en tiempo de compilación (véase la
+ * opción ENGINEUTILITIES_ISA de CMake) y siempre tienen una versión escalar equivalente.
+ * Definir ENGINEUTILITIES_NO_SIMD fuerza la versión escalar.
+ *
+ *  - ENGINEUTILITIES_SSE: SSE2 (siempre disponible en x86-64).
+ *  - ENGINEUTILITIES_AVX: AVX (registros de 8 float).
+ *  - ENGINEUTILITIES_AVX2: AVX2 y FMA.
+ *  - ENGINEUTILITIES_BMI2: pdep y pext (códigos de Morton); viene con AVX2.
+ *
+ * Los núcleos por lotes se escriben una sola vez sobre los paquetes CFloat1 (escalar),
+ * CFloat4 (SSE) y CFloat8 (AVX), que comparten operadores y funciones simd*(), y se
+ * recorren con simdForEach(): el paquete más ancho disponible y después los restos con
+ * los más estrechos. Las comparaciones son ordenadas (falsas con NaN), como las escalares.
+ */
+
+#pragma once
+
+#if !defined(ENGINEUTILITIES_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINEUTILITIES_SSE 1
+#endif
+#if defined(__AVX__)
+#define ENGINEUTILITIES_AVX 1
+#endif
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define ENGINEUTILITIES_AVX2 1
+#endif
+// MSVC no define __BMI2__: /arch:AVX2 lo implica (todas las CPU con AVX2 tienen BMI2).
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define ENGINEUTILITIES_BMI2 1
+#endif
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "EngineMath.h"
+
+#if defined(ENGINEUTILITIES_SSE)
+#include <immintrin.h>
+#endif
+
+namespace EngineUtilities {
+
+    /// @brief Nombre de la ruta SIMD más ancha compilada (para informes de benchmarks).
+    inline const char* simdLevelName() {
+#if defined(ENGINEUTILITIES_AVX2)
+        return "AVX2+FMA";
+#elif defined(ENGINEUTILITIES_AVX)
+        return "AVX";
+#elif defined(ENGINEUTILITIES_SSE)
+        return "SSE2";
+#else
+        return "escalar";
+#endif
+    }
+
+    /**
+     * @struct CFloat1
+     * @brief Paquete de un solo float: la versión escalar de los núcleos por lotes.
+     */
+    struct CFloat1 {
+        static const int kWidth = 1; ///< Elementos por paquete.
+        using Mask = bool;           ///< Resultado de las comparaciones.
+
+        float v;
+
+        CFloat1() : v(0.0f) {}
+        explicit CFloat1(float value) : v(value) {}
+
+        /// @brief Carga kWidth floats consecutivos.
+        static CFloat1 load(const float* p) { return CFloat1(p[0]); }
+
+        /// @brief Guarda kWidth floats consecutivos.
+        void store(float* p) const { p[0] = v; }
+    };
+
+    inline CFloat1 operator+(CFloat1 a, CFloat1 b) { return CFloat1(a.v + b.v); }
+    inline CFloat1 operator-(CFloat1 a, CFloat1 b) { return CFloat1(a.v - b.v); }
+    inline CFloat1 operator*(CFloat1 a, CFloat1 b) { return CFloat1(a.v * b.v); }
+    inline CFloat1 operator/(CFloat1 a, CFloat1 b) { return CFloat1(a.v / b.v); }
+    inline bool operator<=(CFloat1 a, CFloat1 b) { return a.v <= b.v; }
+    inline bool operator>=(CFloat1 a, CFloat1 b) { return a.v >= b.v; }
+    inline bool operator<(CFloat1 a, CFloat1 b) { return a.v < b.v; }
+    inline bool operator>(CFloat1 a, CFloat1 b) { return a.v > b.v; }
+    inline CFloat1 simdMin(CFloat1 a, CFloat1 b) { return CFloat1(a.v < b.v ? a.v : b.v); }
+    inline CFloat1 simdMax(CFloat1 a, CFloat1 b) { return CFloat1(a.v > b.v ? a.v : b.v); }
+    inline CFloat1 simdAbs(CFloat1 a) { return CFloat1(a.v < 0.0f ? -a.v : a.v); }
+    /// @brief Raíz cuadrada (NaN con valores negativos).
+    inline CFloat1 simdSqrt(CFloat1 a) {
+#if defined(ENGINEUTILITIES_SSE)
+        return CFloat1(_mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(a.v))));
+#else
+        return CFloat1(static_cast<float>(EngineUtilities::sqrt(a.v)));
+#endif
+    }
+    /// @brief mask ? a : b por elemento.
+    inline CFloat1 simdSelect(bool mask, CFloat1 a, CFloat1 b) { return mask ? a : b; }
+    /// @brief Bit i = resultado de la comparación en el elemento i.
+    inline int simdBits(bool mask) { return mask ? 1 : 0; }
+
+#if defined(ENGINEUTILITIES_SSE)
+    /// @brief Máscara de comparación de CFloat4 (cada elemento, todo unos o todo ceros).
+    struct CMask4 {
+        __m128 v;
+    };
+
+    /**
+     * @struct CFloat4
+     * @brief Paquete de 4 float en un registro SSE.
+     */
+    struct CFloat4 {
+        static const int kWidth = 4;
+        using Mask = CMask4;
+
+        __m128 v;
+
+        CFloat4() : v(_mm_setzero_ps()) {}
+        explicit CFloat4(__m128 value) : v(value) {}
+        explicit CFloat4(float value) : v(_mm_set1_ps(value)) {}
+
+        static CFloat4 load(const float* p) { return CFloat4(_mm_loadu_ps(p)); }
+        void store(float* p) const { _mm_storeu_ps(p, v); }
+    };
+
+    inline CFloat4 operator+(CFloat4 a, CFloat4 b) { return CFloat4(_mm_add_ps(a.v, b.v)); }
+    inline CFloat4 operator-(CFloat4 a, CFloat4 b) { return CFloat4(_mm_sub_ps(a.v, b.v)); }
+    inline CFloat4 operator*(CFloat4 a, CFloat4 b) { return CFloat4(_mm_mul_ps(a.v, b.v)); }
+    inline CFloat4 operator/(CFloat4 a, CFloat4 b) { return CFloat4(_mm_div_ps(a.v, b.v)); }
+    inline CMask4 operator<=(CFloat4 a, CFloat4 b) { return CMask4{ _mm_cmple_ps(a.v, b.v) }; }
+    inline CMask4 operator>=(CFloat4 a, CFloat4 b) { return CMask4{ _mm_cmpge_ps(a.v, b.v) }; }
+    inline CMask4 operator<(CFloat4 a, CFloat4 b) { return CMask4{ _mm_cmplt_ps(a.v, b.v) }; }
+    inline CMask4 operator>(CFloat4 a, CFloat4 b) { return CMask4{ _mm_cmpgt_ps(a.v, b.v) }; }
+    inline CMask4 operator&(CMask4 a, CMask4 b) { return CMask4{ _mm_and_ps(a.v, b.v) }; }
+    inline CMask4 operator|(CMask4 a, CMask4 b) { return CMask4{ _mm_or_ps(a.v, b.v) }; }
+    // minps(a, b) es a < b ? a : b, igual que la versión escalar (también con NaN).
+    inline CFloat4 simdMin(CFloat4 a, CFloat4 b) { return CFloat4(_mm_min_ps(a.v, b.v)); }
+    inline CFloat4 simdMax(CFloat4 a, CFloat4 b) { return CFloat4(_mm_max_ps(a.v, b.v)); }
+    inline CFloat4 simdAbs(CFloat4 a) { return CFloat4(_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v)); }
+    inline CFloat4 simdSqrt(CFloat4 a) { return CFloat4(_mm_sqrt_ps(a.v)); }
+    inline CFloat4 simdSelect(CMask4 mask, CFloat4 a, CFloat4 b) {
+        return CFloat4(_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)));
+    }
+    inline int simdBits(CMask4 mask) { return _mm_movemask_ps(mask.v); }
+#endif
+
+#if defined(ENGINEUTILITIES_AVX)
+    /// @brief Máscara de comparación de CFloat8.
+    struct CMask8 {
+        __m256 v;
+    };
+
+    /**
+     * @struct CFloat8
+     * @brief Paquete de 8 float en un registro AVX.
+     */
+    struct CFloat8 {
+        static const int kWidth = 8;
+        using Mask = CMask8;
+
+        __m256 v;
+
+        CFloat8() : v(_mm256_setzero_ps()) {}
+        explicit CFloat8(__m256 value) : v(value) {}
+        explicit CFloat8(float value) : v(_mm256_set1_ps(value)) {}
+
+        static CFloat8 load(const float* p) { return CFloat8(_mm256_loadu_ps(p)); }
+        void store(float* p) const { _mm256_storeu_ps(p, v); }
+    };
+
+    inline CFloat8 operator+(CFloat8 a, CFloat8 b) { return CFloat8(_mm256_add_ps(a.v, b.v)); }
+    inline CFloat8 operator-(CFloat8 a, CFloat8 b) { return CFloat8(_mm256_sub_ps(a.v, b.v)); }
+    inline CFloat8 operator*(CFloat8 a, CFloat8 b) { return CFloat8(_mm256_mul_ps(a.v, b.v)); }
+    inline CFloat8 operator/(CFloat8 a, CFloat8 b) { return CFloat8(_mm256_div_ps(a.v, b.v)); }
+    inline CMask8 operator<=(CFloat8 a, CFloat8 b) { return CMask8{ _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+    inline CMask8 operator>=(CFloat8 a, CFloat8 b) { return CMask8{ _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+    inline CMask8 operator<(CFloat8 a, CFloat8 b) { return CMask8{ _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+    inline CMask8 operator>(CFloat8 a, CFloat8 b) { return CMask8{ _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+    inline CMask8 operator&(CMask8 a, CMask8 b) { return CMask8{ _mm256_and_ps(a.v, b.v) }; }
+    inline CMask8 operator|(CMask8 a, CMask8 b) { return CMask8{ _mm256_or_ps(a.v, b.v) }; }
+    inline CFloat8 simdMin(CFloat8 a, CFloat8 b) { return CFloat8(_mm256_min_ps(a.v, b.v)); }
+    inline CFloat8 simdMax(CFloat8 a, CFloat8 b) { return CFloat8(_mm256_max_ps(a.v, b.v)); }
+    inline CFloat8 simdAbs(CFloat8 a) { return CFloat8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v)); }
+    inline CFloat8 simdSqrt(CFloat8 a) { return CFloat8(_mm256_sqrt_ps(a.v)); }
+    inline CFloat8 simdSelect(CMask8 mask, CFloat8 a, CFloat8 b) {
+        return CFloat8(_mm256_blendv_ps(b.v, a.v, mask.v));
+    }
+    inline int simdBits(CMask8 mask) { return _mm256_movemask_ps(mask.v); }
+#endif
+
+    /**
+     * @brief Recorre [first, last) llamando a fn(CFloatN(), i) por cada paquete.
+     *
+     * Primero con el paquete más ancho compilado y los restos con los más estrechos; fn
+     * debe ser una lambda genérica que procese los elementos [i, i + CFloatN::kWidth).
+     */
+    template<typename Fn>
+    inline void simdForEach(size_t first, size_t last, Fn&& fn) {
+        size_t i = first;
+#if defined(ENGINEUTILITIES_AVX)
+        for (; i + CFloat8::kWidth <= last; i += CFloat8::kWidth) {
+            fn(CFloat8(), i);
+        }
+#endif
+#if defined(ENGINEUTILITIES_SSE)
+        for (; i + CFloat4::kWidth <= last; i += CFloat4::kWidth) {
+            fn(CFloat4(), i);
+        }
+#endif
+        for (; i < last; ++i) {
+            fn(CFloat1(), i);
+        }
+    }
+
+    /**
+     * @brief Escribe un byte 0/1 por elemento a partir de los bits de una máscara.
+     *
+     * Los paquetes de 4 u 8 elementos se escriben de 4 en 4 bytes con una sola escritura
+     * (las rutas SIMD solo existen en x86, que es little-endian).
+     *
+     * @return Número de bits activos.
+     */
+    inline size_t simdStoreFlags(int bits, int width, uint8_t* flags) {
+        if (width == 1) {
+            flags[0] = static_cast<uint8_t>(bits & 1);
+            return static_cast<size_t>(bits & 1);
+        }
+        size_t count = 0;
+        for (int lane = 0; lane < width; lane += 4) {
+            uint32_t nibble = static_cast<uint32_t>(bits >> lane) & 15u;
+            uint32_t bytes = (nibble & 1u) | ((nibble & 2u) << 7) | ((nibble & 4u) << 14) | ((nibble & 8u) << 21);
+            std::memcpy(flags + lane, &bytes, sizeof(bytes));
+            count += (bytes * 0x01010101u) >> 24;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Añade a indices (compactados) base + lane por cada bit activo de la máscara.
+     *
+     * Escribe todos los carriles sin saltos y solo avanza con los activos, así que puede
+     * escribir una posición más allá del último índice añadido (nunca más allá de base + width).
+     *
+     * @return Número de índices escritos.
+     */
+    inline size_t simdAppendIndices(int bits, int width, uint32_t base, uint32_t* indices) {
+        size_t count = 0;
+        for (int lane = 0; lane < width; ++lane) {
+            indices[count] = base + static_cast<uint32_t>(lane);
+            count += static_cast<size_t>((bits >> lane) & 1);
+        }
+        return count;
+    }
+
+}
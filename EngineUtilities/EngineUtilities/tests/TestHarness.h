@@ -0,0 +1,85 @@
+/**
+ * @file TestHarness.h
+ * @brief Comprobaciones mínimas para las pruebas automáticas de EngineUtilities.
+ * @author Hannin Abarca
+ *
+ * Cada fallo se imprime con su archivo y línea y se cuenta; TestMain devuelve un código
+ * distinto de cero si alguna comprobación falla, de modo que ctest marca la suite.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace Test {
+
+    /// Comprobaciones ejecutadas y fallidas en el proceso.
+    struct Counters {
+        int checks = 0;
+        int failures = 0;
+    };
+
+    inline Counters& counters() {
+        static Counters instance;
+        return instance;
+    }
+
+    /**
+     * @brief Registra el resultado de una comprobación e imprime los fallos.
+     *
+     * @return ok, para poder abortar una prueba que depende de la comprobación.
+     */
+    inline bool check(bool ok, const char* expression, const char* file, int line) {
+        ++counters().checks;
+        if (!ok) {
+            ++counters().failures;
+            std::printf("  FALLO %s:%d: %s\n", file, line, expression);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Comprueba que |actual - expected| <= tolerance e imprime ambos valores si no.
+     */
+    inline bool checkNear(double actual, double expected, double tolerance, const char* expression,
+        const char* file, int line) {
+        bool ok = std::fabs(actual - expected) <= tolerance;
+        if (!check(ok, expression, file, line)) {
+            std::printf("        obtenido %.17g, esperado %.17g (tolerancia %g)\n", actual, expected, tolerance);
+        }
+        return ok;
+    }
+
+    /**
+     * @brief Distancia en ULP (valores double representables) entre a y b.
+     *
+     * Devuelve INT64_MAX si alguno es NaN o si tienen distinto signo y no son ceros.
+     */
+    inline int64_t ulpDistance(double a, double b) {
+        if (a != a || b != b) {
+            return INT64_MAX;
+        }
+        if (a == b) {
+            return 0;
+        }
+        if ((a < 0.0) != (b < 0.0)) {
+            return INT64_MAX;
+        }
+        int64_t ia;
+        int64_t ib;
+        std::memcpy(&ia, &a, sizeof(ia));
+        std::memcpy(&ib, &b, sizeof(ib));
+        return ia > ib ? ia - ib : ib - ia;
+    }
+
+}
+
+/// Comprueba una condición y sigue ejecutando la prueba aunque falle.
+#define EU_CHECK(expression) ::Test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+
+/// Comprueba que dos valores numéricos coinciden dentro de una tolerancia absoluta.
+#define EU_CHECK_NEAR(actual, expected, tolerance) \
+    ::Test::checkNear((actual), (expected), (tolerance), #actual " ~ " #expected, __FILE__, __LINE__)
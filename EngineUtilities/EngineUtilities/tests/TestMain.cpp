@@ -0,0 +1,106 @@
+/**
+ * @file TestMain.cpp
+ * @brief Punto de entrada de las pruebas automáticas de EngineUtilities.
+ * @author Hannin Abarca
+ *
+ * A diferencia del menú de src/, no pide datos al usuario. Sin argumentos ejecuta todas
+ * las suites; con un nombre de suite ejecuta solo esa (así las registra ctest).
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "TestHarness.h"
+
+// Declaraciones de las suites
+
+void testEngineMath();    ///< Precisión de EngineMath frente a referencias de alta precisión.
+void testVectors();       ///< Identidades de CVector2, CVector3 y CVector4.
+void testCQuaternion();   ///< Identidades de CQuaternion.
+void testMatrices();      ///< Identidades de Matriz2x2, Matriz3x3 y Matriz4x4.
+void testSmartPointers(); ///< TSharedPointer, TWeakPointer, TUniquePtr y TStaticPtr.
+void testAllocators();    ///< TObjectPool y asignadores temporales.
+void testTSlotMap();      ///< Handles generacionales de TSlotMap.
+void testMemoryTracker(); ///< Contadores de MemoryTracker.
+void testProfiler();      ///< Zonas de perfilado y exportación a Chrome trace.
+void testJobSystem();     ///< Robo de trabajo, contadores, parallelFor y lotes paralelos.
+void testQueues();        ///< Colas sin bloqueos SPSC y MPMC.
+void testEpochReclamation(); ///< Reclamación de memoria por épocas.
+void testTasks();         ///< Tareas con corrutinas sobre CJobSystem (C++20).
+void testTransformHierarchy(); ///< Jerarquía de transformaciones con marcas de cambio.
+void testBounds();        ///< Cajas y esferas envolventes y sus pruebas por lotes.
+void testFrustum();       ///< Planos del frustum y descarte por lotes.
+void testDynamicAABBTree(); ///< Árbol dinámico de cajas frente a fuerza bruta.
+void testStaticBVH();      ///< BVH estática de triángulos frente a fuerza bruta.
+void testSpatialHashGrid(); ///< Rejilla hash uniforme 2D y 3D frente a fuerza bruta.
+void testLooseTree();     ///< Octree y quadtree holgados frente a fuerza bruta.
+void testKdTree();        ///< Árbol k-d: vecinos, radio y lotes frente a fuerza bruta.
+void testSpaceFillingCurves(); ///< Códigos de Morton y Hilbert y ordenación radix.
+void testRayIntersection();    ///< Rayos y segmentos contra cajas, esferas, planos y triángulos.
+void testGJK();                ///< GJK y EPA entre esferas, cápsulas, cajas y envolventes.
+void testOBB();                ///< Cajas orientadas: ejes separadores, ajuste y lotes frente a GJK.
+
+namespace {
+
+    /// Suite de pruebas seleccionable por nombre.
+    struct Suite {
+        const char* name;
+        void (*run)();
+    };
+
+    const Suite kSuites[] = {
+        { "EngineMath", testEngineMath },
+        { "Vectors", testVectors },
+        { "CQuaternion", testCQuaternion },
+        { "Matrices", testMatrices },
+        { "SmartPointers", testSmartPointers },
+        { "Allocators", testAllocators },
+        { "TSlotMap", testTSlotMap },
+        { "MemoryTracker", testMemoryTracker },
+        { "Profiler", testProfiler },
+        { "JobSystem", testJobSystem },
+        { "Queues", testQueues },
+        { "EpochReclamation", testEpochReclamation },
+        { "Tasks", testTasks },
+        { "TransformHierarchy", testTransformHierarchy },
+        { "Bounds", testBounds },
+        { "Frustum", testFrustum },
+        { "DynamicAABBTree", testDynamicAABBTree },
+        { "StaticBVH", testStaticBVH },
+        { "SpatialHashGrid", testSpatialHashGrid },
+        { "LooseTree", testLooseTree },
+        { "KdTree", testKdTree },
+        { "SpaceFillingCurves", testSpaceFillingCurves },
+        { "RayIntersection", testRayIntersection },
+        { "GJK", testGJK },
+        { "OBB", testOBB },
+    };
+
+}
+
+/**
+ * @brief Ejecuta las suites seleccionadas e informa de los fallos.
+ * @return 0 si todas las comprobaciones pasan, 1 si alguna falla o la suite no existe.
+ */
+int main(int argc, char** argv) {
+    const char* only = argc > 1 ? argv[1] : nullptr;
+    bool found = false;
+
+    for (const Suite& suite : kSuites) {
+        if (only != nullptr && std::strcmp(only, suite.name) != 0) {
+            continue;
+        }
+        found = true;
+        int failuresBefore = Test::counters().failures;
+        std::printf("=== %s ===\n", suite.name);
+        suite.run();
+        std::printf("  %s\n", Test::counters().failures == failuresBefore ? "OK" : "CON FALLOS");
+    }
+
+    if (!found) {
+        std::printf("Suite desconocida: %s\n", only);
+        return 1;
+    }
+
+    std::printf("\n%d comprobaciones, %d fallos\n", Test::counters().checks, Test::counters().failures);
+    return Test::counters().failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+/**
+ * @file testAllocators.cpp
+ * @brief Pruebas de TObjectPool, CLinearAllocator, CStackAllocator y CFrameAllocator.
+ * @author Hannin Abarca
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Memory/CFrameAllocator.h"
+#include "../include/Memory/CStackAllocator.h"
+#include "../include/Memory/TAllocatorAdapter.h"
+#include "../include/Memory/TObjectPool.h"
+
+namespace {
+
+    using EngineUtilities::CFrameAllocator;
+    using EngineUtilities::CLinearAllocator;
+    using EngineUtilities::CStackAllocator;
+    using EngineUtilities::TAllocatorAdapter;
+    using EngineUtilities::TObjectPool;
+
+    struct PoolItem {
+        // Atómico: los hilos de la prueba de concurrencia crean y destruyen a la vez.
+        static std::atomic<int> alive;
+        double payload[3];
+        explicit PoolItem(double v = 0.0) : payload{ v, v, v } { ++alive; }
+        ~PoolItem() { --alive; }
+    };
+    std::atomic<int> PoolItem::alive{ 0 };
+
+    /// Su constructor lanza con valores negativos.
+    struct ThrowingItem {
+        double value;
+        explicit ThrowingItem(double v) : value(v) {
+            if (v < 0.0) {
+                throw std::runtime_error("ThrowingItem");
+            }
+        }
+    };
+
+    bool isAligned(const void* ptr, size_t alignment) {
+        return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+    }
+
+    void testObjectPool() {
+        TObjectPool<PoolItem> pool(8);
+        std::set<PoolItem*> distinct;
+        std::vector<PoolItem*> items;
+        for (int i = 0; i < 20; ++i) {
+            items.push_back(pool.create(i));
+            distinct.insert(items.back());
+        }
+        EU_CHECK(distinct.size() == 20);
+        EU_CHECK(pool.capacity() >= 20);
+        for (PoolItem* item : items) {
+            pool.destroy(item);
+        }
+        EU_CHECK(PoolItem::alive == 0);
+
+        {
+            EngineUtilities::TSharedPointer<PoolItem> shared = EngineUtilities::MakeShared(pool, 1.0);
+            EngineUtilities::TSharedPointer<PoolItem> copy = shared;
+            auto unique = EngineUtilities::MakeUnique(pool, 2.0);
+            EU_CHECK(PoolItem::alive == 2);
+            EU_CHECK(unique->payload[0] == 2.0);
+        }
+        EU_CHECK(PoolItem::alive == 0);
+
+        // Un constructor que lanza devuelve el hueco: el siguiente create() lo reutiliza.
+        TObjectPool<ThrowingItem> throwingPool(4);
+        ThrowingItem* first = throwingPool.create(1.0);
+        throwingPool.destroy(first);
+        bool thrown = false;
+        for (int i = 0; i < 16; ++i) {
+            try {
+                throwingPool.create(-1.0);
+            }
+            catch (const std::runtime_error&) {
+                thrown = true;
+            }
+        }
+        ThrowingItem* reused = throwingPool.create(2.0);
+        EU_CHECK(thrown && reused == first && throwingPool.capacity() == 4);
+        thrown = false;
+        try {
+            EngineUtilities::MakeShared(throwingPool, -1.0);
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        EU_CHECK(thrown && throwingPool.capacity() == 4);
+        throwingPool.destroy(reused);
+
+        EU_CHECK(throwingPool.freeCount() == throwingPool.capacity());
+
+        // Crear y destruir desde varios hilos no debe perder ni duplicar huecos: al terminar
+        // vuelven a estar libres todos, como antes de empezar (aunque el pool haya crecido).
+        EU_CHECK(pool.freeCount() == pool.capacity());
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&pool]() {
+                std::vector<PoolItem*> local;
+                for (int round = 0; round < 50; ++round) {
+                    for (int i = 0; i < 40; ++i) {
+                        local.push_back(pool.create());
+                    }
+                    for (PoolItem* item : local) {
+                        pool.destroy(item);
+                    }
+                    local.clear();
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        EU_CHECK(PoolItem::alive == 0);
+        EU_CHECK(pool.freeCount() == pool.capacity());
+    }
+
+    void testLinear() {
+        CLinearAllocator arena(1024);
+        void* a = arena.allocate(10, 1);
+        void* b = arena.allocate(16, 64);
+        EU_CHECK(a != nullptr && b != nullptr);
+        EU_CHECK(isAligned(b, 64));
+        EU_CHECK(arena.owns(a) && arena.owns(b));
+        EU_CHECK(arena.allocate(4096) == nullptr);
+
+        size_t used = arena.used();
+        arena.reset();
+        EU_CHECK(arena.used() == 0);
+        EU_CHECK(arena.peak() == used);
+        EU_CHECK(arena.allocate(10, 1) == a);
+
+        // Tamaños cuya suma con el desplazamiento o cuyo producto por sizeof(T) desbordan.
+        EU_CHECK(arena.allocate(SIZE_MAX - 8) == nullptr);
+        EU_CHECK(arena.allocate(SIZE_MAX) == nullptr);
+        void* next = arena.allocate(16);
+        EU_CHECK(next != nullptr && next != a);
+        EU_CHECK(arena.allocateArray<uint64_t>(SIZE_MAX / 8 + 2) == nullptr);
+        EU_CHECK(arena.allocateArray<uint64_t>(SIZE_MAX / 4) == nullptr);
+        // Con la arena casi llena, la alineación llega justo al final.
+        arena.reset();
+        arena.allocate(1020, 1);
+        EU_CHECK(arena.allocate(4, 64) == nullptr);
+        EU_CHECK(arena.used() == 1020);
+
+        TAllocatorAdapter<uint64_t, CLinearAllocator> adapter(arena);
+        bool thrown = false;
+        try {
+            adapter.allocate(SIZE_MAX / 8 + 2);
+        }
+        catch (const std::bad_alloc&) {
+            thrown = true;
+        }
+        EU_CHECK(thrown && arena.used() == 1020);
+    }
+
+    void testStack() {
+        CStackAllocator stack(1024);
+        stack.allocate(32);
+        CStackAllocator::Marker marker = stack.getMarker();
+        {
+            CStackAllocator::Scope scope(stack);
+            stack.allocate(100);
+            EU_CHECK(stack.getMarker() > marker);
+        }
+        EU_CHECK(stack.getMarker() == marker);
+
+        void* top = stack.allocate(48, 16);
+        stack.deallocate(top, 48);
+        EU_CHECK(stack.allocate(48, 16) == top);
+    }
+
+    void testFrame() {
+        CFrameAllocator frames(256);
+        int* first = frames.allocateArray<int>(4);
+        first[0] = 42;
+        frames.beginFrame();
+        int* second = frames.allocateArray<int>(4);
+        EU_CHECK(second != first);
+        EU_CHECK(first[0] == 42); // El frame anterior sigue siendo válido.
+        frames.beginFrame();
+        EU_CHECK(frames.allocateArray<int>(4) == first);
+
+        CLinearAllocator arena(4096);
+        std::vector<int, TAllocatorAdapter<int, CLinearAllocator>> values{ TAllocatorAdapter<int, CLinearAllocator>(arena) };
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        EU_CHECK(arena.owns(values.data()));
+        EU_CHECK(values[99] == 99);
+    }
+
+}
+
+/**
+ * @brief Reutilización de memoria, alineación y límites de los asignadores.
+ */
+void testAllocators() {
+    testObjectPool();
+    testLinear();
+    testStack();
+    testFrame();
+}
@@ -0,0 +1,227 @@
+/**
+ * @file testBounds.cpp
+ * @brief Pruebas de CAABB, CBoundingSphere y sus pruebas por lotes sobre arrays SoA.
+ * @author Hannin Abarca
+ */
+
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/BoundsBatch.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CAABBArray;
+    using EngineUtilities::CBoundingSphere;
+    using EngineUtilities::CBoundingSphereArray;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+
+    CVector3 transformPoint(const Matriz4x4& m, const CVector3& p) {
+        return CVector3(
+            static_cast<float>(m.m[0][0] * p.x + m.m[0][1] * p.y + m.m[0][2] * p.z + m.m[0][3]),
+            static_cast<float>(m.m[1][0] * p.x + m.m[1][1] * p.y + m.m[1][2] * p.z + m.m[1][3]),
+            static_cast<float>(m.m[2][0] * p.x + m.m[2][1] * p.y + m.m[2][2] * p.z + m.m[2][3]));
+    }
+
+    bool nearVector(const CVector3& a, const CVector3& b, float tolerance) {
+        return std::fabs(a.x - b.x) <= tolerance && std::fabs(a.y - b.y) <= tolerance && std::fabs(a.z - b.z) <= tolerance;
+    }
+
+    void testAABB() {
+        CAABB empty;
+        EU_CHECK(empty.isEmpty());
+        EU_CHECK(empty.volume() == 0.0f && empty.surfaceArea() == 0.0f);
+
+        CAABB box(CVector3(-1.0f, 0.0f, 2.0f), CVector3(3.0f, 2.0f, 4.0f));
+        EU_CHECK(!box.isEmpty());
+        EU_CHECK(box.center() == CVector3(1.0f, 1.0f, 3.0f));
+        EU_CHECK(box.extents() == CVector3(2.0f, 1.0f, 1.0f));
+        EU_CHECK_NEAR(box.volume(), 16.0, 1e-6);
+        EU_CHECK_NEAR(box.surfaceArea(), 2.0 * (8.0 + 4.0 + 8.0), 1e-6);
+
+        // La caja vacía es neutra para merge y no se solapa ni contiene nada.
+        EU_CHECK(box.merged(empty).min == box.min && empty.merged(box).max == box.max);
+        EU_CHECK(!empty.overlaps(box) && !box.overlaps(empty));
+        EU_CHECK(!box.contains(empty) && !empty.contains(box.center()));
+
+        CAABB other = CAABB::fromCenterExtents(CVector3(5.0f, 1.0f, 3.0f), CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(!box.overlaps(other));
+        EU_CHECK(box.inflated(1.0f).overlaps(other));
+        CAABB merged = box.merged(other);
+        EU_CHECK(merged.min == CVector3(-1.0f, 0.0f, 2.0f) && merged.max == CVector3(6.0f, 2.0f, 4.0f));
+        EU_CHECK(merged.contains(box) && merged.contains(other) && !box.contains(merged));
+
+        // Tocarse cuenta como solapamiento y el borde está dentro.
+        CAABB touching(CVector3(3.0f, 0.0f, 2.0f), CVector3(4.0f, 1.0f, 3.0f));
+        EU_CHECK(box.overlaps(touching) && touching.overlaps(box));
+        EU_CHECK(box.contains(CVector3(3.0f, 2.0f, 4.0f)) && !box.contains(CVector3(3.1f, 2.0f, 4.0f)));
+        EU_CHECK(box.closestPoint(CVector3(10.0f, 1.0f, 0.0f)) == CVector3(3.0f, 1.0f, 2.0f));
+        EU_CHECK_NEAR(box.distanceSquared(CVector3(10.0f, 1.0f, 0.0f)), 49.0 + 4.0, 1e-4);
+        EU_CHECK(box.distanceSquared(box.center()) == 0.0f);
+
+        CVector3 points[] = { CVector3(1.0f, -2.0f, 0.5f), CVector3(-3.0f, 4.0f, 0.0f), CVector3(0.0f, 0.0f, 7.0f) };
+        CAABB fitted = CAABB::fromPoints(points, 3);
+        EU_CHECK(fitted.min == CVector3(-3.0f, -2.0f, 0.0f) && fitted.max == CVector3(1.0f, 4.0f, 7.0f));
+        EU_CHECK(CAABB::fromPoints(points, 0).isEmpty());
+    }
+
+    void testAABBTransform() {
+        // Arvo da exactamente la caja de las ocho esquinas transformadas.
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<double> dist(-3.0, 3.0);
+        for (int trial = 0; trial < 50; ++trial) {
+            Matriz4x4 matrix = Matriz4x4::Translate(dist(rng), dist(rng), dist(rng)) * Matriz4x4::RotateZ(dist(rng)) *
+                Matriz4x4::Scale(dist(rng), dist(rng), dist(rng));
+            matrix.m[0][2] = dist(rng);
+            matrix.m[2][0] = dist(rng);
+            CVector3 a(static_cast<float>(dist(rng)), static_cast<float>(dist(rng)), static_cast<float>(dist(rng)));
+            CAABB box(a, a + CVector3(1.0f, 2.0f, 0.5f));
+
+            CAABB expected;
+            for (int corner = 0; corner < 8; ++corner) {
+                CVector3 p((corner & 1) ? box.max.x : box.min.x, (corner & 2) ? box.max.y : box.min.y,
+                    (corner & 4) ? box.max.z : box.min.z);
+                expected.expand(transformPoint(matrix, p));
+            }
+            CAABB result = box.transformed(matrix);
+            EU_CHECK(nearVector(result.min, expected.min, 1e-4f) && nearVector(result.max, expected.max, 1e-4f));
+        }
+        EU_CHECK(CAABB().transformed(Matriz4x4::Translate(1.0, 2.0, 3.0)).isEmpty());
+    }
+
+    void testSphere() {
+        CBoundingSphere empty;
+        EU_CHECK(empty.isEmpty() && empty.toAABB().isEmpty());
+
+        CBoundingSphere a(CVector3(0.0f, 0.0f, 0.0f), 2.0f);
+        CBoundingSphere b(CVector3(5.0f, 0.0f, 0.0f), 1.0f);
+        EU_CHECK(!a.overlaps(b) && !a.overlaps(empty));
+        EU_CHECK(a.overlaps(CBoundingSphere(CVector3(3.0f, 0.0f, 0.0f), 1.0f)));
+        CBoundingSphere merged = a.merged(b);
+        EU_CHECK_NEAR(merged.radius, 4.0, 1e-5);
+        EU_CHECK(merged.center == CVector3(2.0f, 0.0f, 0.0f));
+        EU_CHECK(a.merged(CBoundingSphere(CVector3(0.5f, 0.0f, 0.0f), 1.0f)).radius == 2.0f);
+        EU_CHECK(empty.merged(b).center == b.center && b.merged(empty).radius == b.radius);
+
+        EU_CHECK(a.contains(CVector3(0.0f, 2.0f, 0.0f)) && !a.contains(CVector3(1.5f, 1.5f, 0.0f)));
+        EU_CHECK(a.contains(CBoundingSphere(CVector3(1.0f, 0.0f, 0.0f), 1.0f)));
+        EU_CHECK(!a.contains(CBoundingSphere(CVector3(1.5f, 0.0f, 0.0f), 1.0f)));
+        EU_CHECK(a.contains(CAABB(CVector3(-1.0f, -1.0f, -1.0f), CVector3(1.0f, 1.0f, 1.0f))));
+        EU_CHECK(!a.contains(CAABB(CVector3(-1.0f, -1.0f, -1.0f), CVector3(1.5f, 1.0f, 1.0f))));
+
+        // Esfera contra caja: la distancia se mide al punto más cercano de la caja.
+        CAABB box(CVector3(2.5f, -1.0f, -1.0f), CVector3(4.0f, 1.0f, 1.0f));
+        EU_CHECK(!a.overlaps(box) && a.overlaps(box.inflated(0.6f)));
+        EU_CHECK(!CBoundingSphere(CVector3(3.4f, 2.0f, 2.0f), 1.0f).overlaps(box));
+
+        // La escala no uniforme agranda el radio por el mayor factor.
+        CBoundingSphere moved = b.transformed(Matriz4x4::Translate(0.0, 1.0, 0.0) * Matriz4x4::Scale(1.0, 3.0, 2.0));
+        EU_CHECK(moved.center == CVector3(5.0f, 1.0f, 0.0f));
+        EU_CHECK_NEAR(moved.radius, 3.0, 1e-5);
+
+        // Ritter: todos los puntos quedan dentro y el radio no se aleja mucho del óptimo.
+        std::mt19937 rng(4);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+        std::vector<CVector3> points(500);
+        for (CVector3& point : points) {
+            point = CVector3(dist(rng), dist(rng), dist(rng)).normalized() * 5.0f + CVector3(1.0f, 2.0f, 3.0f);
+        }
+        CBoundingSphere fitted = CBoundingSphere::fromPoints(points.data(), points.size());
+        bool allInside = true;
+        for (const CVector3& point : points) {
+            allInside = allInside && (point - fitted.center).length() <= fitted.radius * 1.0001f;
+        }
+        EU_CHECK(allInside);
+        EU_CHECK(fitted.radius >= 4.99f && fitted.radius < 5.0f * 1.2f);
+        EU_CHECK(CBoundingSphere::fromAABB(box).contains(box.min));
+    }
+
+    CAABB randomBox(std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> size(0.0f, 8.0f);
+        CVector3 min(position(rng), position(rng), position(rng));
+        return CAABB(min, min + CVector3(size(rng), size(rng), size(rng)));
+    }
+
+    void testBatch() {
+        // Un tamaño que no es múltiplo de 8 ni de 4 ejercita todos los anchos de paquete.
+        const size_t count = 1003;
+        std::mt19937 rng(8);
+        std::uniform_real_distribution<float> radius(0.0f, 6.0f);
+        CAABBArray boxes;
+        CBoundingSphereArray spheres;
+        boxes.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            boxes.push(i % 97 == 0 ? CAABB() : randomBox(rng));
+            CAABB box = randomBox(rng);
+            spheres.push(i % 89 == 0 ? CBoundingSphere() : CBoundingSphere(box.min, radius(rng)));
+        }
+        EU_CHECK(boxes.size() == count && spheres.size() == count);
+        boxes.set(5, CAABB(CVector3(1.0f, 1.0f, 1.0f), CVector3(2.0f, 2.0f, 2.0f)));
+        EU_CHECK(boxes.get(5).max == CVector3(2.0f, 2.0f, 2.0f));
+
+        std::vector<uint8_t> flags(count);
+        for (int trial = 0; trial < 20; ++trial) {
+            CAABB query = randomBox(rng).inflated(static_cast<float>(trial) * 2.0f);
+            CBoundingSphere sphereQuery(query.center(), static_cast<float>(trial));
+
+            size_t hits = EngineUtilities::overlapBatch(boxes, query, flags.data());
+            size_t expected = 0;
+            bool same = true;
+            for (size_t i = 0; i < count; ++i) {
+                bool overlap = boxes.get(i).overlaps(query);
+                expected += overlap ? 1 : 0;
+                same = same && flags[i] == (overlap ? 1 : 0);
+            }
+            EU_CHECK(same && hits == expected);
+
+            hits = EngineUtilities::containedBatch(boxes, query, flags.data());
+            expected = 0;
+            same = true;
+            for (size_t i = 0; i < count; ++i) {
+                bool contained = query.contains(boxes.get(i));
+                expected += contained ? 1 : 0;
+                same = same && flags[i] == (contained ? 1 : 0);
+            }
+            EU_CHECK(same && hits == expected);
+
+            hits = EngineUtilities::overlapBatch(spheres, sphereQuery, flags.data());
+            expected = 0;
+            same = true;
+            for (size_t i = 0; i < count; ++i) {
+                bool overlap = spheres.get(i).overlaps(sphereQuery);
+                expected += overlap ? 1 : 0;
+                same = same && flags[i] == (overlap ? 1 : 0);
+            }
+            EU_CHECK(same && hits == expected);
+
+            hits = EngineUtilities::overlapBatch(spheres, query, flags.data());
+            expected = 0;
+            same = true;
+            for (size_t i = 0; i < count; ++i) {
+                bool overlap = spheres.get(i).overlaps(query);
+                expected += overlap ? 1 : 0;
+                same = same && flags[i] == (overlap ? 1 : 0);
+            }
+            EU_CHECK(same && hits == expected);
+        }
+
+        // Consultas vacías: nada se solapa.
+        EU_CHECK(EngineUtilities::overlapBatch(boxes, CAABB(), flags.data()) == 0);
+        EU_CHECK(EngineUtilities::overlapBatch(spheres, CAABB(), flags.data()) == 0);
+        EU_CHECK(EngineUtilities::overlapBatch(spheres, CBoundingSphere(), flags.data()) == 0);
+    }
+
+}
+
+/**
+ * @brief Pruebas de CAABB, CBoundingSphere y BoundsBatch.h.
+ */
+void testBounds() {
+    testAABB();
+    testAABBTransform();
+    testSphere();
+    testBatch();
+}
@@ -0,0 +1,92 @@
+/**
+ * @file testCQuaternion.cpp
+ * @brief Identidades de CQuaternion: producto, conjugado, rotación y slerp.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <random>
+#include "TestHarness.h"
+#include "../include/Vector/CQuaternion.h"
+
+namespace {
+
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CVector3;
+
+    const int kSamples = 1000; ///< Rotaciones aleatorias por identidad.
+
+    CQuaternion randomRotation(std::mt19937& rng) {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        CVector3 axis(dist(rng), dist(rng), dist(rng) + 2.0f);
+        return CQuaternion::fromAxisAngle(axis.normalized(), dist(rng) * 3.0f);
+    }
+
+    float vectorDifference(const CVector3& a, const CVector3& b) {
+        return (a - b).length();
+    }
+
+}
+
+/**
+ * @brief Comprueba el álgebra de cuaterniones sobre rotaciones aleatorias y casos con
+ *        resultado conocido.
+ */
+void testCQuaternion() {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+    float unitLength = 0.0f, conjugateNorm = 0.0f, preservesLength = 0.0f, preservesDot = 0.0f;
+    float composition = 0.0f, inverseRotation = 0.0f, slerpEnds = 0.0f, slerpUnit = 0.0f;
+    for (int i = 0; i < kSamples; ++i) {
+        CQuaternion p = randomRotation(rng);
+        CQuaternion q = randomRotation(rng);
+        CVector3 a(dist(rng), dist(rng), dist(rng));
+        CVector3 b(dist(rng), dist(rng), dist(rng));
+        float scale = a.length() + 1.0f;
+
+        unitLength = std::fmax(unitLength, std::fabs(q.length() - 1.0f));
+        // q * q* = (0, 0, 0, |q|^2).
+        CQuaternion norm = q * q.conjugate();
+        conjugateNorm = std::fmax(conjugateNorm, std::fabs(norm.w - q.lengthSquare()) +
+            std::fabs(norm.x) + std::fabs(norm.y) + std::fabs(norm.z));
+
+        CVector3 ra = q.rotate(a);
+        preservesLength = std::fmax(preservesLength, std::fabs(ra.length() - a.length()) / scale);
+        preservesDot = std::fmax(preservesDot, std::fabs(ra.dot(q.rotate(b)) - a.dot(b)) / (scale * (b.length() + 1.0f)));
+        composition = std::fmax(composition, vectorDifference((p * q).rotate(a), p.rotate(q.rotate(a))) / scale);
+        inverseRotation = std::fmax(inverseRotation, vectorDifference(q.conjugate().rotate(ra), a) / scale);
+
+        float t = (dist(rng) + 10.0f) / 20.0f;
+        CQuaternion start = CQuaternion::slerp(p, q, 0.0f);
+        CQuaternion end = CQuaternion::slerp(p, q, 1.0f);
+        // slerp puede devolver -q, que representa la misma rotación.
+        float endError = std::fmin((end - q).length(), (end + q).length());
+        slerpEnds = std::fmax(slerpEnds, std::fmax((start - p).length(), endError));
+        slerpUnit = std::fmax(slerpUnit, std::fabs(CQuaternion::slerp(p, q, t).length() - 1.0f));
+    }
+
+    EU_CHECK_NEAR(unitLength, 0.0, 1e-6);
+    EU_CHECK_NEAR(conjugateNorm, 0.0, 1e-6);
+    EU_CHECK_NEAR(preservesLength, 0.0, 1e-5);
+    EU_CHECK_NEAR(preservesDot, 0.0, 1e-4);
+    EU_CHECK_NEAR(composition, 0.0, 1e-5);
+    EU_CHECK_NEAR(inverseRotation, 0.0, 1e-5);
+    EU_CHECK_NEAR(slerpEnds, 0.0, 1e-4);
+    EU_CHECK_NEAR(slerpUnit, 0.0, 1e-6);
+
+    // Casos conocidos.
+    CVector3 x(1.0f, 0.0f, 0.0f), y(0.0f, 1.0f, 0.0f), z(0.0f, 0.0f, 1.0f);
+    const float halfPi = static_cast<float>(EngineUtilities::PI / 2.0);
+    EU_CHECK(CQuaternion::fromAxisAngle(z, halfPi).rotate(x) == y);
+    EU_CHECK(CQuaternion::fromAxisAngle(x, halfPi).rotate(y) == z);
+    EU_CHECK(CQuaternion::fromAxisAngle(y, halfPi).rotate(z) == x);
+    EU_CHECK(CQuaternion::identity().rotate(CVector3(1.0f, 2.0f, 3.0f)) == CVector3(1.0f, 2.0f, 3.0f));
+    EU_CHECK(CQuaternion::identity() * CQuaternion(1.0f, 2.0f, 3.0f, 4.0f) == CQuaternion(1.0f, 2.0f, 3.0f, 4.0f));
+    EU_CHECK(CQuaternion(1.0f, 2.0f, 3.0f, 4.0f).normalized().length() - 1.0f < 1e-6f);
+    EU_CHECK(CQuaternion::zero().lengthSquare() == 0.0f);
+
+    // Slerp a mitad de camino entre identidad y 90 grados sobre z es una rotación de 45 grados.
+    CQuaternion half = CQuaternion::slerp(CQuaternion::identity(), CQuaternion::fromAxisAngle(z, halfPi), 0.5f);
+    EU_CHECK(half == CQuaternion::fromAxisAngle(z, halfPi * 0.5f));
+}
@@ -0,0 +1,244 @@
+/**
+ * @file testDynamicAABBTree.cpp
+ * @brief Pruebas de CDynamicAABBTree frente a búsquedas por fuerza bruta.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/CDynamicAABBTree.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CDynamicAABBTree;
+    using EngineUtilities::CFrustum;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+
+    const float kMargin = 0.25f;
+
+    /// Escena aleatoria: cajas reales, el árbol y el proxy de cada caja.
+    struct Scene {
+        std::vector<CAABB> boxes;
+        std::vector<uint32_t> proxies;
+        CDynamicAABBTree tree;
+
+        Scene() : tree(kMargin) {}
+
+        /// Cajas gruesas tal como las ve el árbol (para la fuerza bruta).
+        CAABB fat(size_t i) const { return tree.fatAABB(proxies[i]); }
+    };
+
+    CAABB randomBox(std::mt19937& rng, float range) {
+        std::uniform_real_distribution<float> position(-range, range);
+        std::uniform_real_distribution<float> size(0.1f, 3.0f);
+        return CAABB::fromCenterExtents(CVector3(position(rng), position(rng), position(rng)),
+            CVector3(size(rng), size(rng), size(rng)));
+    }
+
+    void fillScene(Scene& scene, size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        for (size_t i = 0; i < count; ++i) {
+            scene.boxes.push_back(randomBox(rng, 40.0f));
+            scene.proxies.push_back(scene.tree.insert(scene.boxes.back(), static_cast<uint32_t>(i)));
+        }
+    }
+
+    /// Parámetro del primer impacto del rayo con la caja real (o maxT si no la toca).
+    float rayHit(const CAABB& box, const CVector3& origin, const CVector3& direction, float maxT) {
+        CVector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        float t = 0.0f;
+        return box.intersectsRay(origin, inverse, maxT, t) ? t : maxT;
+    }
+
+    void testStructure() {
+        CDynamicAABBTree empty;
+        EU_CHECK(empty.size() == 0 && empty.height() == 0 && empty.validate() && empty.bounds().isEmpty());
+
+        Scene scene;
+        fillScene(scene, 2000, 1);
+        EU_CHECK(scene.tree.size() == 2000 && scene.tree.validate());
+        EU_CHECK(scene.tree.userData(scene.proxies[77]) == 77);
+        EU_CHECK(scene.tree.fatAABB(scene.proxies[5]).contains(scene.boxes[5]));
+        // Las rotaciones mantienen el árbol poco profundo (log2(2000) ~ 11).
+        EU_CHECK(scene.tree.height() < 40);
+        EU_CHECK(scene.tree.areaRatio() > 1.0f);
+
+        // Mover dentro de la caja gruesa no reinserta; fuera, sí.
+        CAABB small = CAABB::fromCenterExtents(scene.boxes[3].center() + CVector3(0.1f, 0.0f, 0.0f), scene.boxes[3].extents());
+        EU_CHECK(!scene.tree.move(scene.proxies[3], small));
+        CAABB far = CAABB::fromCenterExtents(CVector3(100.0f, 0.0f, 0.0f), CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(scene.tree.move(scene.proxies[3], far, CVector3(2.0f, 0.0f, 0.0f)));
+        // La caja gruesa se alarga en la dirección del movimiento.
+        EU_CHECK_NEAR(scene.tree.fatAABB(scene.proxies[3]).max.x, 101.0f + kMargin + 4.0f, 1e-4);
+        EU_CHECK_NEAR(scene.tree.fatAABB(scene.proxies[3]).min.x, 99.0f - kMargin, 1e-4);
+        EU_CHECK(scene.tree.validate());
+
+        // Movimientos, ajustes y bajas aleatorias mantienen la estructura.
+        std::mt19937 rng(2);
+        for (int step = 0; step < 3000; ++step) {
+            size_t i = rng() % scene.boxes.size();
+            scene.boxes[i] = randomBox(rng, 40.0f);
+            if (step % 2 == 0) {
+                scene.tree.move(scene.proxies[i], scene.boxes[i]);
+            }
+            else {
+                scene.tree.refit(scene.proxies[i], scene.boxes[i]);
+            }
+        }
+        EU_CHECK(scene.tree.validate());
+        bool removed = true;
+        for (size_t i = 0; i < 1000; ++i) {
+            removed = scene.tree.remove(scene.proxies[i]) && removed;
+        }
+        EU_CHECK(removed);
+        EU_CHECK(!scene.tree.remove(scene.proxies[0]));
+        EU_CHECK(!scene.tree.remove(CDynamicAABBTree::kNullNode));
+        EU_CHECK(scene.tree.size() == 1000 && scene.tree.validate());
+
+        // Los nodos libres se reutilizan.
+        uint32_t reused = scene.tree.insert(far, 5);
+        EU_CHECK(reused < 4000 && scene.tree.userData(reused) == 5 && scene.tree.validate());
+
+        scene.tree.clear();
+        EU_CHECK(scene.tree.size() == 0 && scene.tree.validate());
+    }
+
+    void testQueries() {
+        Scene scene;
+        fillScene(scene, 1500, 3);
+        std::mt19937 rng(4);
+
+        // Solapamiento con cajas.
+        bool same = true;
+        for (int q = 0; q < 50; ++q) {
+            CAABB query = randomBox(rng, 40.0f).inflated(4.0f);
+            std::vector<uint32_t> found;
+            scene.tree.query(query, [&](uint32_t proxy) {
+                found.push_back(scene.tree.userData(proxy));
+                return true;
+            });
+            std::vector<uint32_t> expected;
+            for (size_t i = 0; i < scene.boxes.size(); ++i) {
+                if (scene.fat(i).overlaps(query)) {
+                    expected.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            std::sort(found.begin(), found.end());
+            same = same && found == expected;
+        }
+        EU_CHECK(same);
+
+        // fn puede detener la consulta.
+        int reported = 0;
+        scene.tree.query(scene.tree.bounds(), [&](uint32_t) { return ++reported < 3; });
+        EU_CHECK(reported == 3);
+
+        // Rayos: el impacto más cercano con las cajas reales coincide.
+        same = true;
+        for (int q = 0; q < 200; ++q) {
+            CVector3 origin(std::uniform_real_distribution<float>(-60.0f, 60.0f)(rng), 0.0f, -60.0f);
+            CVector3 direction = (randomBox(rng, 30.0f).center() - origin).normalized();
+            if (q % 10 == 0) {
+                direction = CVector3(0.0f, 0.0f, 1.0f);
+            }
+            float expected = 200.0f;
+            for (const CAABB& box : scene.boxes) {
+                expected = std::min(expected, rayHit(box, origin, direction, 200.0f));
+            }
+            float closest = 200.0f;
+            scene.tree.raycast(origin, direction, 200.0f, [&](uint32_t proxy, float maxT) {
+                float t = rayHit(scene.boxes[scene.tree.userData(proxy)], origin, direction, maxT);
+                closest = std::min(closest, t);
+                return t;
+            });
+            same = same && closest == expected;
+        }
+        EU_CHECK(same);
+
+        // Frustum: mismo conjunto que probar cada caja gruesa.
+        double f = 1.0 / EngineUtilities::tan(0.6);
+        Matriz4x4 projection(
+            f, 0.0, 0.0, 0.0,
+            0.0, f, 0.0, 0.0,
+            0.0, 0.0, -101.0 / 99.0, -200.0 / 99.0,
+            0.0, 0.0, -1.0, 0.0);
+        CFrustum frustum = CFrustum::fromMatrix(projection * Matriz4x4::Translate(0.0, 0.0, -45.0));
+        std::vector<uint32_t> visible;
+        scene.tree.query(frustum, [&](uint32_t proxy) {
+            visible.push_back(scene.tree.userData(proxy));
+            return true;
+        });
+        std::vector<uint32_t> expectedVisible;
+        for (size_t i = 0; i < scene.boxes.size(); ++i) {
+            if (frustum.intersects(scene.fat(i))) {
+                expectedVisible.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        std::sort(visible.begin(), visible.end());
+        EU_CHECK(!expectedVisible.empty() && visible == expectedVisible);
+
+        // Más cercano a un punto (distancia a la caja real).
+        same = true;
+        for (int q = 0; q < 100; ++q) {
+            CVector3 point = randomBox(rng, 50.0f).center();
+            float expected = INFINITY;
+            for (const CAABB& box : scene.boxes) {
+                expected = std::min(expected, box.distanceSquared(point));
+            }
+            uint32_t best = scene.tree.nearest(point, [&](uint32_t proxy) {
+                return scene.boxes[scene.tree.userData(proxy)].distanceSquared(point);
+            });
+            same = same && best != CDynamicAABBTree::kNullNode &&
+                scene.boxes[scene.tree.userData(best)].distanceSquared(point) == expected;
+        }
+        EU_CHECK(same);
+        uint32_t none = scene.tree.nearest(CVector3(500.0f, 0.0f, 0.0f), [&](uint32_t proxy) {
+            return scene.boxes[scene.tree.userData(proxy)].distanceSquared(CVector3(500.0f, 0.0f, 0.0f));
+        }, 10.0f);
+        EU_CHECK(none == CDynamicAABBTree::kNullNode);
+    }
+
+    void testPairs() {
+        Scene scene;
+        fillScene(scene, 600, 5);
+        // Algunas bajas y movimientos para probar un árbol no recién construido.
+        std::mt19937 rng(6);
+        for (int step = 0; step < 600; ++step) {
+            size_t i = rng() % scene.boxes.size();
+            scene.boxes[i] = randomBox(rng, 40.0f);
+            scene.tree.move(scene.proxies[i], scene.boxes[i]);
+        }
+
+        std::vector<std::pair<uint32_t, uint32_t>> pairs;
+        scene.tree.findPairs([&](uint32_t a, uint32_t b) {
+            uint32_t i = scene.tree.userData(a);
+            uint32_t j = scene.tree.userData(b);
+            pairs.emplace_back(std::min(i, j), std::max(i, j));
+        });
+        std::vector<std::pair<uint32_t, uint32_t>> expected;
+        for (uint32_t i = 0; i < scene.boxes.size(); ++i) {
+            for (uint32_t j = i + 1; j < scene.boxes.size(); ++j) {
+                if (scene.fat(i).overlaps(scene.fat(j))) {
+                    expected.emplace_back(i, j);
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        EU_CHECK(!expected.empty() && pairs == expected);
+    }
+
+}
+
+/**
+ * @brief Pruebas de CDynamicAABBTree.
+ */
+void testDynamicAABBTree() {
+    testStructure();
+    testQueries();
+    testPairs();
+}
@@ -0,0 +1,140 @@
+/**
+ * @file testEngineMath.cpp
+ * @brief Precisión de EngineMath frente a referencias en long double.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include "TestHarness.h"
+#include "../include/Utilities/EngineMath.h"
+
+namespace {
+
+    namespace EM = EngineUtilities;
+
+    const long double kPi = 3.141592653589793238462643383279502884L;
+    const int kSamples = 10001; ///< Puntos evaluados por función, repartidos uniformemente.
+
+    /**
+     * @brief Función a comparar con su referencia en un intervalo.
+     *
+     * Un punto es válido si cumple cualquiera de los tres límites: ULP, error absoluto o
+     * error relativo. Las funciones basadas en series (sin, exp, log...) se detienen
+     * cuando el término es menor que EPSILON, por lo que su límite es absoluto o relativo;
+     * las de cálculo directo deben quedar a pocos ULP.
+     */
+    struct AccuracyCase {
+        const char* name;
+        double lo;
+        double hi;
+        double (*function)(double);
+        long double (*reference)(long double);
+        int64_t maxUlp;
+        double maxAbs;
+        double maxRel;
+    };
+
+    const AccuracyCase kCases[] = {
+        { "sqrt", 0.0, 1e6, [](double x) { return EM::sqrt(x); }, [](long double x) { return std::sqrt(x); }, 1, 0.0, 0.0 },
+        { "sqrt (pequenos)", 1e-300, 1e-290, [](double x) { return EM::sqrt(x); }, [](long double x) { return std::sqrt(x); }, 1, 0.0, 0.0 },
+        { "exp", -20.0, 20.0, [](double x) { return EM::exp(x); }, [](long double x) { return std::exp(x); }, 0, 0.0, 1e-7 },
+        { "log", 0.01, 100.0, [](double x) { return EM::log(x); }, [](long double x) { return std::log(x); }, 0, 2e-6, 0.0 },
+        { "log10", 0.01, 100.0, [](double x) { return EM::log10(x); }, [](long double x) { return std::log10(x); }, 0, 1e-6, 0.0 },
+        { "power(x, 2.5)", 0.1, 10.0, [](double x) { return EM::power(x, 2.5); }, [](long double x) { return std::pow(x, 2.5L); }, 0, 0.0, 1e-5 },
+        { "sin", -10.0, 10.0, [](double x) { return EM::sin(x); }, [](long double x) { return std::sin(x); }, 0, 2e-7, 0.0 },
+        { "cos", -10.0, 10.0, [](double x) { return EM::cos(x); }, [](long double x) { return std::cos(x); }, 0, 2e-7, 0.0 },
+        { "tan", -1.5, 1.5, [](double x) { return EM::tan(x); }, [](long double x) { return std::tan(x); }, 0, 2e-7, 1e-6 },
+        { "asin", -0.99, 0.99, [](double x) { return EM::asin(x); }, [](long double x) { return std::asin(x); }, 0, 1e-4, 0.0 },
+        { "acos", -0.99, 0.99, [](double x) { return EM::acos(x); }, [](long double x) { return std::acos(x); }, 0, 1e-4, 0.0 },
+        { "atan", -0.99, 0.99, [](double x) { return EM::atan(x); }, [](long double x) { return std::atan(x); }, 0, 2e-6, 0.0 },
+        { "sinh", -5.0, 5.0, [](double x) { return EM::sinh(x); }, [](long double x) { return std::sinh(x); }, 0, 1e-6, 1e-6 },
+        { "cosh", -5.0, 5.0, [](double x) { return EM::cosh(x); }, [](long double x) { return std::cosh(x); }, 0, 0.0, 1e-6 },
+        { "tanh", -5.0, 5.0, [](double x) { return EM::tanh(x); }, [](long double x) { return std::tanh(x); }, 0, 1e-6, 0.0 },
+        { "radians", -720.0, 720.0, [](double x) { return EM::radians(x); }, [](long double x) { return x * kPi / 180.0L; }, 2, 0.0, 0.0 },
+        { "degrees", -7.0, 7.0, [](double x) { return EM::degrees(x); }, [](long double x) { return x * 180.0L / kPi; }, 2, 0.0, 0.0 },
+        { "circleArea", 0.0, 100.0, [](double x) { return EM::circleArea(x); }, [](long double x) { return kPi * x * x; }, 3, 0.0, 0.0 },
+        { "circleCircumference", 0.0, 100.0, [](double x) { return EM::circleCircumference(x); }, [](long double x) { return 2.0L * kPi * x; }, 2, 0.0, 0.0 },
+        { "distance", -100.0, 100.0, [](double x) { return EM::distance(1.0, -2.0, x, 2.0 * x); },
+            [](long double x) { return std::sqrt((x - 1.0L) * (x - 1.0L) + (2.0L * x + 2.0L) * (2.0L * x + 2.0L)); }, 2, 0.0, 0.0 },
+    };
+
+    void checkAccuracy(const AccuracyCase& test) {
+        double maxAbs = 0.0;
+        double maxRel = 0.0;
+        int64_t maxUlp = 0;
+        int failures = 0;
+        double firstFailure = 0.0;
+
+        for (int i = 0; i < kSamples; ++i) {
+            double x = test.lo + (test.hi - test.lo) * i / (kSamples - 1);
+            double value = test.function(x);
+            long double reference = test.reference(x);
+            double absError = static_cast<double>(std::fabs(value - reference));
+            double relError = reference != 0.0L ? static_cast<double>(absError / std::fabs(reference)) : absError;
+            int64_t ulps = Test::ulpDistance(value, static_cast<double>(reference));
+
+            maxAbs = absError > maxAbs ? absError : maxAbs;
+            maxRel = relError > maxRel ? relError : maxRel;
+            maxUlp = ulps > maxUlp ? ulps : maxUlp;
+            if (ulps > test.maxUlp && absError > test.maxAbs && relError > test.maxRel) {
+                if (failures++ == 0) {
+                    firstFailure = x;
+                }
+            }
+        }
+
+        std::printf("  %-20s abs %.2e  rel %.2e  ULP %lld\n", test.name, maxAbs, maxRel, static_cast<long long>(maxUlp));
+        if (!EU_CHECK(failures == 0)) {
+            std::printf("        %s: %d puntos fuera de tolerancia (primero en x = %.17g)\n", test.name, failures, firstFailure);
+        }
+    }
+
+    void testExactFunctions() {
+        EU_CHECK(EM::abs(-3.5) == 3.5 && EM::abs(2.0) == 2.0);
+        EU_CHECK(EM::fabs(-0.25) == 0.25);
+        EU_CHECK(EM::square(-3.0) == 9.0);
+        EU_CHECK(EM::cube(-2.0) == -8.0);
+        EU_CHECK(EM::EMax(1.0, -1.0) == 1.0 && EM::EMin(1.0, -1.0) == -1.0);
+
+        EU_CHECK(EM::round(2.5) == 3 && EM::round(-2.5) == -3 && EM::round(2.4) == 2);
+        EU_CHECK(EM::floor(2.7) == 2 && EM::floor(-2.2) == -3 && EM::floor(-2.0) == -2);
+        EU_CHECK(EM::ceil(2.2) == 3 && EM::ceil(-2.7) == -2 && EM::ceil(3.0) == 3);
+        EU_CHECK_NEAR(EM::mod(7.5, 2.0), 1.5, 0.0);
+        EU_CHECK_NEAR(EM::mod(-1.0, 3.0), 2.0, 0.0);
+
+        EU_CHECK(EM::rectangleArea(3.0, 4.0) == 12.0);
+        EU_CHECK(EM::rectanglePerimeter(3.0, 4.0) == 14.0);
+        EU_CHECK(EM::triangleArea(3.0, 4.0) == 6.0);
+        EU_CHECK(EM::lerp(2.0, 6.0, 0.0) == 2.0 && EM::lerp(2.0, 6.0, 1.0) == 6.0 && EM::lerp(2.0, 6.0, 0.25) == 3.0);
+        EU_CHECK(EM::approxEqual(1.0, 1.0 + 1e-7) && !EM::approxEqual(1.0, 1.0 + 1e-5));
+
+        // factorial: exacto hasta 2^53 y a pocos ULP del producto entero hasta 20!.
+        uint64_t product = 1;
+        for (int n = 0; n <= 20; ++n) {
+            product *= n > 1 ? static_cast<uint64_t>(n) : 1u;
+            EU_CHECK(Test::ulpDistance(EM::factorial(n), static_cast<double>(product)) <= 2);
+        }
+
+        // Dominio: NaN fuera de él y casos límite.
+        EU_CHECK(std::isnan(EM::sqrt(-1.0)));
+        EU_CHECK(EM::sqrt(0.0) == 0.0);
+        EU_CHECK(std::isnan(EM::log(0.0)));
+        EU_CHECK(std::isnan(EM::asin(1.5)));
+        EU_CHECK(std::isnan(EM::factorial(-1)));
+        EU_CHECK(EM::power(0.0, 2.0) == 0.0 && std::isnan(EM::power(-2.0, 0.5)));
+        EU_CHECK(EM::power(5.0, 0.0) == 1.0);
+    }
+
+}
+
+/**
+ * @brief Error máximo de cada función de EngineMath en su dominio de uso.
+ */
+void testEngineMath() {
+    for (const AccuracyCase& test : kCases) {
+        checkAccuracy(test);
+    }
+    testExactFunctions();
+}
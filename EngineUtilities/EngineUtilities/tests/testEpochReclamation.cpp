@@ -0,0 +1,166 @@
+/**
+ * @file testEpochReclamation.cpp
+ * @brief Pruebas de CEpochManager y CEpochGuard.
+ * @author Hannin Abarca
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Memory/CEpochManager.h"
+
+namespace {
+
+    using EngineUtilities::CEpochGuard;
+    using EngineUtilities::CEpochManager;
+
+    /// Recurso de ejemplo: cuenta las instancias vivas y marca su memoria al destruirse.
+    struct Asset {
+        static std::atomic<int> alive;
+        static const uint32_t kValid = 0xA55E7u;
+        uint32_t magic;
+        int version;
+        explicit Asset(int v) : magic(kValid), version(v) { alive.fetch_add(1); }
+        ~Asset() { magic = 0; alive.fetch_sub(1); }
+    };
+    std::atomic<int> Asset::alive{ 0 };
+
+    int customFreed = 0;
+
+    void countingDeleter(void* object) {
+        ++customFreed;
+        delete static_cast<Asset*>(object);
+    }
+
+    void testRetireAndCollect() {
+        {
+            CEpochManager manager(1000);
+            for (int i = 0; i < 10; ++i) {
+                manager.retire(new Asset(i));
+            }
+            manager.retire<Asset>(nullptr);
+            EU_CHECK(manager.pendingCount() == 10 && Asset::alive.load() == 10);
+
+            // Sin lectores, la época avanza en cada collect(); hacen falta dos avances.
+            uint64_t start = manager.epoch();
+            EU_CHECK(manager.collect() == 0);
+            EU_CHECK(manager.collect() == 10);
+            EU_CHECK(manager.epoch() == start + 2);
+            EU_CHECK(manager.pendingCount() == 0 && Asset::alive.load() == 0);
+
+            // Secciones anidadas del propio hilo: la época sigue avanzando porque el hilo la observa.
+            {
+                CEpochGuard outer(manager);
+                CEpochGuard inner(manager);
+                manager.retire(new Asset(0), countingDeleter);
+                EU_CHECK(manager.collect() == 0);
+            }
+            EU_CHECK(manager.collect() == 1 && customFreed == 1);
+
+            // El destructor libera lo que quede pendiente.
+            manager.retire(new Asset(1));
+            manager.retire(new Asset(2));
+        }
+        EU_CHECK(Asset::alive.load() == 0);
+    }
+
+    void testReaderBlocksReclamation() {
+        CEpochManager manager(1000);
+        std::atomic<int> phase{ 0 };
+        std::thread reader([&]() {
+            CEpochGuard guard(manager);
+            phase.store(1);
+            while (phase.load() != 2) {
+                std::this_thread::yield();
+            }
+        });
+        while (phase.load() != 1) {
+            std::this_thread::yield();
+        }
+
+        // El lector está en la época actual: se puede avanzar una vez, pero no dos.
+        manager.retire(new Asset(0));
+        for (int i = 0; i < 5; ++i) {
+            manager.collect();
+        }
+        EU_CHECK(manager.pendingCount() == 1 && Asset::alive.load() == 1);
+
+        phase.store(2);
+        reader.join();
+        manager.collect();
+        manager.collect();
+        EU_CHECK(manager.pendingCount() == 0 && Asset::alive.load() == 0);
+    }
+
+    void testAssetTable() {
+        // Tabla de recursos de solo lectura para los lectores; el escritor reemplaza entradas
+        // y retira las antiguas. Un lector nunca debe ver un recurso destruido.
+        const int slotCount = 64;
+        const int replacements = 20000;
+        const int readers = 4;
+        {
+            CEpochManager manager(32);
+            std::vector<std::atomic<Asset*>> table(slotCount);
+            for (std::atomic<Asset*>& slot : table) {
+                slot.store(new Asset(0));
+            }
+            std::atomic<bool> done{ false };
+            std::atomic<bool> valid{ true };
+            std::atomic<int> maxVersion{ 0 };
+            std::vector<std::thread> threads;
+            for (int r = 0; r < readers; ++r) {
+                threads.emplace_back([&, r]() {
+                    std::mt19937 rng(r);
+                    int seen = 0;
+                    while (!done.load(std::memory_order_relaxed)) {
+                        CEpochGuard guard(manager);
+                        for (int i = 0; i < 16; ++i) {
+                            const Asset* asset = table[rng() % slotCount].load(std::memory_order_acquire);
+                            if (asset->magic != Asset::kValid) {
+                                valid.store(false);
+                            }
+                            seen = asset->version > seen ? asset->version : seen;
+                        }
+                    }
+                    if (seen > maxVersion.load()) {
+                        maxVersion.store(seen);
+                    }
+                });
+            }
+            std::mt19937 rng(99);
+            for (int v = 1; v <= replacements; ++v) {
+                Asset* old = table[rng() % slotCount].exchange(new Asset(v), std::memory_order_acq_rel);
+                manager.retire(old);
+                if (v % 1000 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            done.store(true);
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            EU_CHECK(valid.load());
+            EU_CHECK(maxVersion.load() > 0);
+            // Las retiradas periódicas mantienen acotada la lista de pendientes.
+            EU_CHECK(manager.pendingCount() < static_cast<size_t>(replacements));
+
+            for (std::atomic<Asset*>& slot : table) {
+                manager.retire(slot.load());
+            }
+        }
+        EU_CHECK(Asset::alive.load() == 0);
+    }
+
+}
+
+/**
+ * @brief Pruebas de la reclamación de memoria por épocas.
+ */
+void testEpochReclamation() {
+    testRetireAndCollect();
+    testReaderBlocksReclamation();
+    testAssetTable();
+}
@@ -0,0 +1,169 @@
+/**
+ * @file testFrustum.cpp
+ * @brief Pruebas de CFrustum y del descarte por lotes de FrustumCulling.h.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/FrustumCulling.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CAABBArray;
+    using EngineUtilities::CBoundingSphere;
+    using EngineUtilities::CBoundingSphereArray;
+    using EngineUtilities::CFrustum;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+
+    /// Proyección en perspectiva con la cámara mirando hacia -z (como gluPerspective).
+    Matriz4x4 perspective(double fovY, double aspect, double nearZ, double farZ, bool zeroToOneDepth) {
+        double f = 1.0 / EngineUtilities::tan(fovY / 2.0);
+        double depth = zeroToOneDepth ? farZ / (nearZ - farZ) : (farZ + nearZ) / (nearZ - farZ);
+        double offset = zeroToOneDepth ? farZ * nearZ / (nearZ - farZ) : 2.0 * farZ * nearZ / (nearZ - farZ);
+        return Matriz4x4(
+            f / aspect, 0.0, 0.0, 0.0,
+            0.0, f, 0.0, 0.0,
+            0.0, 0.0, depth, offset,
+            0.0, 0.0, -1.0, 0.0);
+    }
+
+    void testPlanes() {
+        for (int convention = 0; convention < 2; ++convention) {
+            bool zeroToOne = convention == 1;
+            CFrustum frustum = CFrustum::fromMatrix(perspective(EngineUtilities::PI / 2.0, 1.0, 1.0, 100.0, zeroToOne), zeroToOne);
+
+            EU_CHECK(frustum.contains(CVector3(0.0f, 0.0f, -10.0f)));
+            EU_CHECK(frustum.contains(CVector3(9.0f, -9.0f, -10.0f)));
+            EU_CHECK(!frustum.contains(CVector3(11.0f, 0.0f, -10.0f)));
+            EU_CHECK(!frustum.contains(CVector3(0.0f, 0.0f, 10.0f)));
+            EU_CHECK(!frustum.contains(CVector3(0.0f, 0.0f, -0.5f)));
+            EU_CHECK(!frustum.contains(CVector3(0.0f, 0.0f, -150.0f)));
+
+            // Los planos están normalizados: la distancia es euclídea.
+            EU_CHECK_NEAR(frustum.distance(CFrustum::kNear, CVector3(0.0f, 0.0f, -3.0f)), 2.0, 1e-4);
+            EU_CHECK_NEAR(frustum.distance(CFrustum::kFar, CVector3(0.0f, 0.0f, -40.0f)), 60.0, 1e-3);
+            EU_CHECK_NEAR(frustum.distance(CFrustum::kRight, CVector3(12.0f, 0.0f, -10.0f)), -2.0 / 1.41421356, 1e-4);
+        }
+
+        // Con una vista, los planos quedan en espacio mundo: coincide con recortar en clip.
+        Matriz4x4 viewProjection = perspective(1.0, 1.5, 0.5, 50.0, false) *
+            Matriz4x4::RotateZ(0.3) * Matriz4x4::Translate(-5.0, 2.0, 1.0);
+        CFrustum frustum = CFrustum::fromMatrix(viewProjection);
+        std::mt19937 rng(6);
+        std::uniform_real_distribution<float> dist(-60.0f, 60.0f);
+        int compared = 0;
+        bool same = true;
+        for (int i = 0; i < 5000; ++i) {
+            CVector3 p(dist(rng), dist(rng), dist(rng));
+            double clip[4];
+            for (int row = 0; row < 4; ++row) {
+                const double* m = viewProjection.m[row];
+                clip[row] = m[0] * p.x + m[1] * p.y + m[2] * p.z + m[3];
+            }
+            double w = clip[3];
+            double margin = w;
+            for (int axis = 0; axis < 3; ++axis) {
+                margin = EngineUtilities::EMin(margin, EngineUtilities::EMin(w - clip[axis], w + clip[axis]));
+            }
+            if (EngineUtilities::fabs(margin) < 1e-3) {
+                continue;
+            }
+            ++compared;
+            same = same && frustum.contains(p) == (margin > 0.0);
+        }
+        EU_CHECK(same && compared > 4000);
+    }
+
+    void testVolumes() {
+        CFrustum frustum = CFrustum::fromMatrix(perspective(EngineUtilities::PI / 2.0, 1.0, 1.0, 100.0, false));
+
+        // La esfera a 12 unidades del eje está a 1,414 fuera del plano derecho.
+        EU_CHECK(frustum.intersects(CBoundingSphere(CVector3(12.0f, 0.0f, -10.0f), 1.5f)));
+        EU_CHECK(!frustum.intersects(CBoundingSphere(CVector3(12.0f, 0.0f, -10.0f), 1.0f)));
+        EU_CHECK(!frustum.intersects(CBoundingSphere()));
+        EU_CHECK(frustum.contains(CBoundingSphere(CVector3(0.0f, 0.0f, -10.0f), 5.0f)));
+        EU_CHECK(!frustum.contains(CBoundingSphere(CVector3(0.0f, 0.0f, -10.0f), 8.0f)));
+        EU_CHECK(frustum.intersects(CBoundingSphere(CVector3(0.0f, 0.0f, -10.0f), 8.0f)));
+
+        CAABB inside(CVector3(-1.0f, -1.0f, -11.0f), CVector3(1.0f, 1.0f, -9.0f));
+        CAABB crossing(CVector3(8.0f, -1.0f, -11.0f), CVector3(12.0f, 1.0f, -9.0f));
+        CAABB outside(CVector3(12.0f, -1.0f, -11.0f), CVector3(13.0f, 1.0f, -10.5f));
+        CAABB behind(CVector3(-1.0f, -1.0f, 1.0f), CVector3(1.0f, 1.0f, 2.0f));
+        EU_CHECK(frustum.intersects(inside) && frustum.contains(inside));
+        EU_CHECK(frustum.intersects(crossing) && !frustum.contains(crossing));
+        EU_CHECK(!frustum.intersects(outside) && !frustum.intersects(behind));
+        EU_CHECK(!frustum.intersects(CAABB()) && !frustum.contains(CAABB()));
+
+        // El frustum por defecto no descarta nada.
+        EU_CHECK(CFrustum().intersects(behind) && CFrustum().contains(CVector3(1e6f, 0.0f, 0.0f)));
+    }
+
+    void testBatch() {
+        const size_t count = 5001;
+        CFrustum frustum = CFrustum::fromMatrix(perspective(1.2, 1.7, 0.1, 80.0, true) *
+            Matriz4x4::RotateZ(-0.7) * Matriz4x4::Translate(0.0, 3.0, 10.0), true);
+        std::mt19937 rng(13);
+        std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.0f, 6.0f);
+        CBoundingSphereArray spheres;
+        CAABBArray boxes;
+        for (size_t i = 0; i < count; ++i) {
+            CVector3 center(position(rng), position(rng), position(rng));
+            spheres.push(i % 101 == 0 ? CBoundingSphere() : CBoundingSphere(center, size(rng)));
+            boxes.push(i % 103 == 0 ? CAABB() :
+                CAABB::fromCenterExtents(center, CVector3(size(rng), size(rng), size(rng))));
+        }
+
+        std::vector<uint32_t> expectedSpheres;
+        std::vector<uint32_t> expectedBoxes;
+        for (size_t i = 0; i < count; ++i) {
+            if (frustum.intersects(spheres.get(i))) {
+                expectedSpheres.push_back(static_cast<uint32_t>(i));
+            }
+            if (frustum.intersects(boxes.get(i))) {
+                expectedBoxes.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        EU_CHECK(!expectedSpheres.empty() && expectedSpheres.size() < count / 2);
+
+        std::vector<uint32_t> visible(count);
+        size_t visibleCount = EngineUtilities::cullSpheres(frustum, spheres, visible.data());
+        EU_CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedSpheres);
+        visibleCount = EngineUtilities::cullAABBs(frustum, boxes, visible.data());
+        EU_CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedBoxes);
+
+        // Un subrango devuelve índices absolutos.
+        visibleCount = EngineUtilities::cullSpheres(frustum, spheres, 1000, 2000, visible.data());
+        size_t inRange = 0;
+        for (uint32_t index : expectedSpheres) {
+            inRange += index >= 1000 && index < 2000 ? 1 : 0;
+        }
+        EU_CHECK(visibleCount == inRange && (visibleCount == 0 || visible[0] >= 1000));
+
+        // En paralelo el resultado es idéntico, con cualquier tamaño de bloque.
+        CJobSystem jobs(3);
+        for (size_t grain : { size_t(1), size_t(64), size_t(1000), EngineUtilities::kCullGrain }) {
+            std::fill(visible.begin(), visible.end(), 0xFFFFFFFFu);
+            visibleCount = EngineUtilities::parallelCullSpheres(jobs, frustum, spheres, visible.data(), grain);
+            EU_CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedSpheres);
+            visibleCount = EngineUtilities::parallelCullAABBs(jobs, frustum, boxes, visible.data(), grain);
+            EU_CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedBoxes);
+        }
+    }
+
+}
+
+/**
+ * @brief Pruebas de CFrustum y FrustumCulling.h.
+ */
+void testFrustum() {
+    testPlanes();
+    testVolumes();
+    testBatch();
+}
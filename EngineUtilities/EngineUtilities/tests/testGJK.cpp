@@ -0,0 +1,309 @@
+/**
+ * @file testGJK.cpp
+ * @brief Pruebas de GJK y EPA sobre esferas, cápsulas, cajas y envolventes convexas.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/GJK.h"
+
+namespace {
+
+    using EngineUtilities::CBoxShape;
+    using EngineUtilities::CCapsuleShape;
+    using EngineUtilities::CConvexHullShape;
+    using EngineUtilities::CGjkCache;
+    using EngineUtilities::CGjkResult;
+    using EngineUtilities::CGjkSolver;
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CSphereShape;
+    using EngineUtilities::CVector3;
+
+    const CVector3 kBoxCorners[8] = {
+        CVector3(-1.0f, -1.0f, -1.0f), CVector3(1.0f, -1.0f, -1.0f), CVector3(-1.0f, 1.0f, -1.0f), CVector3(1.0f, 1.0f, -1.0f),
+        CVector3(-1.0f, -1.0f, 1.0f), CVector3(1.0f, -1.0f, 1.0f), CVector3(-1.0f, 1.0f, 1.0f), CVector3(1.0f, 1.0f, 1.0f),
+    };
+
+    CQuaternion randomRotation(std::mt19937& rng) {
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        CQuaternion q(normal(rng), normal(rng), normal(rng), normal(rng));
+        float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        return CQuaternion(q.x / length, q.y / length, q.z / length, q.w / length);
+    }
+
+    CBoxShape translated(const CBoxShape& box, const CVector3& offset) {
+        CBoxShape moved = box;
+        moved.position += offset;
+        return moved;
+    }
+
+    /// Menor solape entre dos cajas por los 15 ejes del teorema del eje separador.
+    float satPenetration(const CBoxShape& a, const CBoxShape& b) {
+        std::vector<CVector3> axes;
+        for (int i = 0; i < 3; ++i) {
+            axes.push_back(a.axes[i]);
+            axes.push_back(b.axes[i]);
+            for (int j = 0; j < 3; ++j) {
+                axes.push_back(a.axes[i].cross(b.axes[j]));
+            }
+        }
+        float best = INFINITY;
+        for (const CVector3& axis : axes) {
+            float length = std::sqrt(axis.lengthSquare());
+            if (length < 1e-4f) {
+                continue;
+            }
+            CVector3 n = axis / length;
+            float radiusA = 0.0f;
+            float radiusB = 0.0f;
+            for (int i = 0; i < 3; ++i) {
+                radiusA += a.halfExtents[i] * std::fabs(n.dot(a.axes[i]));
+                radiusB += b.halfExtents[i] * std::fabs(n.dot(b.axes[i]));
+            }
+            best = std::fmin(best, radiusA + radiusB - std::fabs(n.dot(b.position - a.position)));
+        }
+        return best;
+    }
+
+    void testSpheresAndCapsules() {
+        CGjkSolver solver;
+        CGjkResult result;
+        CSphereShape sphere(CVector3(0.0f, 0.0f, 0.0f), 1.0f);
+
+        EU_CHECK(!solver.contact(sphere, CSphereShape(CVector3(3.0f, 0.0f, 0.0f), 0.5f), result));
+        EU_CHECK_NEAR(result.distance, 1.5f, 1e-5f);
+        EU_CHECK_NEAR(result.normal.x, 1.0f, 1e-5f);
+        EU_CHECK_NEAR(result.pointA.x, 1.0f, 1e-5f);
+        EU_CHECK_NEAR(result.pointB.x, 2.5f, 1e-5f);
+        EU_CHECK(!solver.overlap(sphere, CSphereShape(CVector3(3.0f, 0.0f, 0.0f), 0.5f)));
+
+        // Núcleos separados, márgenes cortados: la profundidad sale de GJK.
+        EU_CHECK(solver.contact(sphere, CSphereShape(CVector3(0.0f, 1.0f, 0.0f), 1.0f), result));
+        EU_CHECK_NEAR(result.distance, -1.0f, 1e-5f);
+        EU_CHECK_NEAR(result.normal.y, 1.0f, 1e-5f);
+        EU_CHECK(solver.overlap(sphere, CSphereShape(CVector3(0.0f, 1.0f, 0.0f), 1.0f)));
+
+        // Centros coincidentes: A - B es un punto y la profundidad es la suma de radios.
+        EU_CHECK(solver.contact(sphere, CSphereShape(CVector3(0.0f, 0.0f, 0.0f), 0.5f), result));
+        EU_CHECK_NEAR(result.distance, -1.5f, 1e-5f);
+        EU_CHECK_NEAR(result.normal.lengthSquare(), 1.0f, 1e-5f);
+
+        CCapsuleShape capsule(CVector3(-1.0f, 0.0f, 0.0f), CVector3(1.0f, 0.0f, 0.0f), 0.5f);
+        EU_CHECK(!solver.contact(capsule, CSphereShape(CVector3(0.3f, 2.0f, 0.0f), 0.5f), result));
+        EU_CHECK_NEAR(result.distance, 1.0f, 1e-5f);
+        EU_CHECK_NEAR(result.pointA.x, 0.3f, 1e-5f);
+        EU_CHECK_NEAR(result.pointA.y, 0.5f, 1e-5f);
+
+        CCapsuleShape crossing(CVector3(0.0f, -1.0f, 0.3f), CVector3(0.0f, 1.0f, 0.3f), 0.5f);
+        EU_CHECK(solver.contact(capsule, crossing, result));
+        EU_CHECK_NEAR(result.distance, -0.7f, 1e-5f);
+        EU_CHECK_NEAR(result.normal.z, 1.0f, 1e-5f);
+
+        // Segmentos colineales solapados: A - B es un segmento, sin grosor en ninguna perpendicular.
+        CCapsuleShape inner(CVector3(-0.5f, 0.0f, 0.0f), CVector3(0.5f, 0.0f, 0.0f), 0.5f);
+        EU_CHECK(solver.contact(capsule, inner, result));
+        EU_CHECK_NEAR(result.distance, -1.0f, 1e-5f);
+        EU_CHECK_NEAR(result.normal.x, 0.0f, 1e-5f);
+    }
+
+    void testBoxes() {
+        CGjkSolver solver;
+        CGjkResult result;
+        CBoxShape a(CVector3(0.0f, 0.0f, 0.0f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f));
+
+        EU_CHECK(!solver.contact(a, CBoxShape(CVector3(3.0f, 0.5f, 0.0f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f)), result));
+        EU_CHECK_NEAR(result.distance, 1.0f, 1e-5f);
+        EU_CHECK_NEAR(result.normal.x, 1.0f, 1e-5f);
+
+        // Caja girada 45 grados: la esquina queda a 3.5 - sqrt(2) del centro.
+        CQuaternion turn = CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 0.78539816f);
+        CBoxShape diamond(CVector3(3.5f, 0.0f, 0.0f), turn, CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(!solver.contact(a, diamond, result));
+        EU_CHECK_NEAR(result.distance, 2.5f - std::sqrt(2.0f), 1e-4f);
+
+        // Penetración: la salida más corta es por x, 0.5.
+        CBoxShape deep(CVector3(1.5f, 0.2f, 0.1f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(solver.contact(a, deep, result));
+        EU_CHECK_NEAR(result.distance, -0.5f, 1e-4f);
+        EU_CHECK_NEAR(result.normal.x, 1.0f, 1e-4f);
+        CGjkResult after;
+        solver.contact(a, translated(deep, result.normal * -result.distance), after);
+        EU_CHECK_NEAR(after.distance, 0.0f, 1e-3f);
+
+        // La envolvente de las esquinas de una caja se comporta como la caja.
+        CQuaternion rotation = CQuaternion::fromAxisAngle(CVector3(1.0f, 2.0f, 3.0f).normalized(), 0.7f);
+        CBoxShape box(CVector3(0.5f, 2.6f, -0.3f), rotation, CVector3(1.0f, 1.0f, 1.0f));
+        CConvexHullShape hull(kBoxCorners, 8, box.position, rotation);
+        CGjkResult boxResult;
+        CGjkResult hullResult;
+        solver.contact(a, box, boxResult);
+        solver.contact(a, hull, hullResult);
+        EU_CHECK_NEAR(boxResult.distance, hullResult.distance, 1e-4f);
+    }
+
+    void testRandomPairs() {
+        CGjkSolver solver;
+        std::mt19937 rng(49);
+        std::uniform_real_distribution<float> offset(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> extent(0.2f, 1.5f);
+        int wrongDistance = 0;
+        int wrongDepth = 0;
+        int wrongSeparation = 0;
+        int wrongOverlap = 0;
+        int penetrating = 0;
+        for (int i = 0; i < 2000; ++i) {
+            CBoxShape a(CVector3(0.0f, 0.0f, 0.0f), randomRotation(rng), CVector3(extent(rng), extent(rng), extent(rng)));
+            CBoxShape b(CVector3(offset(rng), offset(rng), offset(rng)), randomRotation(rng), CVector3(extent(rng), extent(rng), extent(rng)));
+            CGjkResult result;
+            bool hit = solver.contact(a, b, result);
+            float sat = satPenetration(a, b);
+            if (!hit) {
+                // Separadas: la normal es un eje separador cuya holgura es la distancia, y los
+                // puntos testigo están a esa distancia.
+                float gap = b.supportCore(result.normal * -1.0f).dot(result.normal) - a.supportCore(result.normal).dot(result.normal);
+                float witness = std::sqrt((result.pointB - result.pointA).lengthSquare());
+                wrongDistance += std::fabs(gap - result.distance) < 1e-3f && std::fabs(witness - result.distance) < 1e-3f ? 0 : 1;
+                wrongOverlap += sat > 1e-3f ? 1 : 0;
+            }
+            else {
+                ++penetrating;
+                // La profundidad de EPA coincide con el menor solape de SAT y sacar B por la
+                // normal esa distancia las separa justo.
+                wrongDepth += std::fabs(-result.distance - sat) < 2e-3f ? 0 : 1;
+                CBoxShape out = translated(b, result.normal * (-result.distance + 1e-2f));
+                CBoxShape in = translated(b, result.normal * (-result.distance - 1e-2f));
+                wrongSeparation += !solver.overlap(a, out) && solver.overlap(a, in) ? 0 : 1;
+            }
+            wrongOverlap += solver.overlap(a, b) == hit ? 0 : 1;
+        }
+        EU_CHECK(penetrating > 200);
+        EU_CHECK(wrongDistance == 0);
+        EU_CHECK(wrongDepth == 0);
+        EU_CHECK(wrongSeparation == 0);
+        EU_CHECK(wrongOverlap == 0);
+    }
+
+    void testHullsAndCapsules() {
+        CGjkSolver solver;
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::vector<CVector3> points(24);
+        for (CVector3& point : points) {
+            point = CVector3(unit(rng), unit(rng), unit(rng));
+        }
+        // Separadas: la normal es un eje separador con holgura igual a la distancia. En
+        // contacto: sacar la cápsula por la normal la profundidad las separa.
+        int wrong = 0;
+        std::uniform_real_distribution<float> offset(-4.0f, 4.0f);
+        for (int i = 0; i < 500; ++i) {
+            CConvexHullShape hull(points.data(), points.size(), CVector3(offset(rng), offset(rng), offset(rng)), randomRotation(rng));
+            CVector3 start(offset(rng), offset(rng), offset(rng));
+            CCapsuleShape capsule(start, start + CVector3(unit(rng), unit(rng), unit(rng)), 0.3f);
+            CGjkResult result;
+            if (solver.contact(hull, capsule, result)) {
+                CGjkResult after;
+                solver.contact(hull, CCapsuleShape(capsule.start + result.normal * (-result.distance + 1e-2f),
+                    capsule.end + result.normal * (-result.distance + 1e-2f), capsule.radius), after);
+                wrong += after.intersecting ? 1 : 0;
+                continue;
+            }
+            float gap = capsule.supportCore(result.normal * -1.0f).dot(result.normal) - capsule.radius -
+                hull.supportCore(result.normal).dot(result.normal);
+            wrong += std::fabs(gap - result.distance) < 1e-3f ? 0 : 1;
+        }
+        EU_CHECK(wrong == 0);
+    }
+
+    bool isUnit(const CVector3& v) {
+        return std::fabs(v.lengthSquare() - 1.0f) < 1e-3f;
+    }
+
+    /// Pares planos, tangentes o enormes: la normal de contact() nunca es nula.
+    void testDegenerateContacts() {
+        CGjkSolver solver;
+        CGjkResult result;
+        CBoxShape a(CVector3(), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f));
+
+        // Caras en contacto exacto.
+        EU_CHECK(solver.contact(a, CBoxShape(CVector3(2.0f, 0.3f, 0.0f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f)), result));
+        EU_CHECK(isUnit(result.normal) && result.normal.x > 0.99f);
+        EU_CHECK_NEAR(result.distance, 0.0f, 1e-5f);
+
+        // Triángulos coplanarios que se solapan: A - B es plana.
+        const CVector3 small[3] = { CVector3(0.0f, 0.0f, 0.0f), CVector3(1.0f, 0.0f, 0.0f), CVector3(0.0f, 1.0f, 0.0f) };
+        const CVector3 large[3] = { CVector3(0.2f, 0.2f, 0.0f), CVector3(2.0f, 0.2f, 0.0f), CVector3(0.2f, 2.0f, 0.0f) };
+        EU_CHECK(solver.contact(CConvexHullShape(small, 3, CVector3(), CQuaternion()),
+            CConvexHullShape(large, 3, CVector3(), CQuaternion()), result));
+        EU_CHECK(isUnit(result.normal) && std::fabs(result.normal.z) > 0.99f);
+        EU_CHECK_NEAR(result.distance, 0.0f, 1e-5f);
+
+        // Triángulo que atraviesa la caja: sacarlo por la normal la profundidad los separa.
+        const CVector3 blade[3] = { CVector3(-3.0f, -3.0f, 0.6f), CVector3(3.0f, -3.0f, 0.6f), CVector3(0.0f, 3.0f, 0.6f) };
+        EU_CHECK(solver.contact(a, CConvexHullShape(blade, 3, CVector3(), CQuaternion()), result));
+        EU_CHECK(isUnit(result.normal));
+        EU_CHECK_NEAR(result.distance, -0.4f, 1e-4f);
+
+        // Cajas de 1e10: el cuadrado del producto vectorial de las caras de EPA desborda.
+        const float huge = 1e10f;
+        CBoxShape bigA(CVector3(), CQuaternion(), CVector3(huge, huge, huge));
+        CBoxShape bigB(CVector3(0.5f * huge, 0.25f * huge, 0.0f), CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 0.3f),
+            CVector3(huge, huge, huge));
+        EU_CHECK(solver.contact(bigA, bigB, result));
+        EU_CHECK(isUnit(result.normal));
+        EU_CHECK_NEAR(result.distance / huge, -satPenetration(bigA, bigB) / huge, 1e-3f);
+
+        // Cajas de 1e20: ni siquiera el politopo inicial tiene normales; queda la aproximación
+        // por ejes, que al menos da una dirección válida.
+        const float enormous = 1e20f;
+        EU_CHECK(solver.contact(CBoxShape(CVector3(), CQuaternion(), CVector3(enormous, enormous, enormous)),
+            CBoxShape(CVector3(0.5f * enormous, 0.0f, 0.0f), CQuaternion(), CVector3(enormous, enormous, enormous)), result));
+        EU_CHECK(isUnit(result.normal) && result.distance < 0.0f);
+    }
+
+    void testWarmStart() {
+        CGjkSolver solver;
+        CBoxShape a(CVector3(0.0f, 0.0f, 0.0f), CQuaternion(), CVector3(1.0f, 0.5f, 0.8f));
+        CGjkCache cache;
+        int coldIterations = 0;
+        int warmIterations = 0;
+        int mismatches = 0;
+        // B orbita alrededor de A entrando y saliendo de contacto.
+        for (int frame = 0; frame < 200; ++frame) {
+            float angle = frame * 0.02f;
+            CQuaternion rotation = CQuaternion::fromAxisAngle(CVector3(0.3f, 1.0f, 0.2f).normalized(), angle);
+            CVector3 position(2.2f * std::cos(angle), 0.4f * std::sin(3.0f * angle), 2.2f * std::sin(angle));
+            CBoxShape b(position, rotation, CVector3(0.7f, 0.9f, 0.6f));
+            CGjkResult cold;
+            CGjkResult warm;
+            solver.contact(a, b, cold);
+            solver.contact(a, b, warm, &cache);
+            coldIterations += cold.iterations;
+            warmIterations += warm.iterations;
+            mismatches += cold.intersecting == warm.intersecting && std::fabs(cold.distance - warm.distance) < 1e-3f ? 0 : 1;
+        }
+        EU_CHECK(mismatches == 0);
+        EU_CHECK(warmIterations < coldIterations);
+
+        // overlap con caché coincide con el resultado sin caché.
+        cache.reset();
+        int wrong = 0;
+        for (int frame = 0; frame < 200; ++frame) {
+            CBoxShape b(CVector3(3.0f - frame * 0.015f, 0.3f, 0.0f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f));
+            wrong += solver.overlap(a, b, &cache) == solver.overlap(a, b) ? 0 : 1;
+        }
+        EU_CHECK(wrong == 0);
+    }
+
+}
+
+void testGJK() {
+    testSpheresAndCapsules();
+    testBoxes();
+    testRandomPairs();
+    testHullsAndCapsules();
+    testDegenerateContacts();
+    testWarmStart();
+}
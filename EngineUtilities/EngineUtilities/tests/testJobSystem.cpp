@@ -0,0 +1,254 @@
+/**
+ * @file testJobSystem.cpp
+ * @brief Pruebas de TWorkStealingDeque, CJobSystem y las operaciones de ParallelBatch.h.
+ * @author Hannin Abarca
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Threading/CJobSystem.h"
+#include "../include/Threading/ParallelBatch.h"
+
+namespace {
+
+    using EngineUtilities::CJobCounter;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+    using EngineUtilities::TWorkStealingDeque;
+
+    void testDeque() {
+        TWorkStealingDeque<int> deque(2);
+        for (int i = 1; i <= 100; ++i) {
+            deque.push(i);
+        }
+        EU_CHECK(deque.size() == 100);
+        int item = 0;
+        EU_CHECK(deque.steal(item) && item == 1);
+        EU_CHECK(deque.pop(item) && item == 100);
+        while (deque.pop(item)) {
+        }
+        EU_CHECK(deque.empty() && !deque.steal(item));
+
+        // El propietario inserta y extrae mientras tres ladrones roban: cada elemento se
+        // obtiene exactamente una vez.
+        const int count = 200000;
+        TWorkStealingDeque<int> shared;
+        std::vector<std::atomic<int>> seen(count);
+        std::atomic<bool> done{ false };
+        std::vector<std::thread> thieves;
+        for (int t = 0; t < 3; ++t) {
+            thieves.emplace_back([&]() {
+                int value = 0;
+                while (!done.load()) {
+                    if (shared.steal(value)) {
+                        seen[value].fetch_add(1);
+                    }
+                }
+                while (shared.steal(value)) {
+                    seen[value].fetch_add(1);
+                }
+            });
+        }
+        for (int i = 0; i < count; ++i) {
+            shared.push(i);
+            if (i % 3 == 0 && shared.pop(item)) {
+                seen[item].fetch_add(1);
+            }
+        }
+        while (shared.pop(item)) {
+            seen[item].fetch_add(1);
+        }
+        done.store(true);
+        for (std::thread& thief : thieves) {
+            thief.join();
+        }
+        bool exactlyOnce = true;
+        for (std::atomic<int>& value : seen) {
+            exactlyOnce = exactlyOnce && value.load() == 1;
+        }
+        EU_CHECK(exactlyOnce);
+    }
+
+    void testJobs(CJobSystem& jobs) {
+        std::atomic<int> executed{ 0 };
+        CJobCounter counter;
+        for (int i = 0; i < 1000; ++i) {
+            jobs.run([&executed]() { executed.fetch_add(1); }, &counter);
+        }
+        jobs.wait(counter);
+        EU_CHECK(executed.load() == 1000);
+        EU_CHECK(counter.isDone() && counter.pending() == 0);
+
+        // Encolar mientras los trabajos anteriores terminan: el contador pasa por 1 (y por
+        // kCompleting) con el llamador aún incrementándolo; ningún incremento se pierde.
+        std::atomic<int> racing{ 0 };
+        for (int round = 0; round < 200; ++round) {
+            CJobCounter spawning;
+            for (int i = 0; i < 64; ++i) {
+                jobs.run([&racing]() { racing.fetch_add(1); }, &spawning);
+            }
+            jobs.wait(spawning);
+        }
+        EU_CHECK(racing.load() == 200 * 64);
+
+        // Dependencias: la suma solo se ejecuta cuando terminan todas las escrituras.
+        std::vector<int> values(256, 0);
+        CJobCounter writes;
+        CJobCounter sums;
+        std::atomic<int> total{ -1 };
+        for (size_t i = 0; i < values.size(); ++i) {
+            jobs.run([&values, i]() { values[i] = static_cast<int>(i); }, &writes);
+        }
+        jobs.runAfter(writes, [&values, &total]() {
+            int sum = 0;
+            for (int value : values) {
+                sum += value;
+            }
+            total.store(sum);
+        }, &sums);
+        jobs.wait(sums);
+        EU_CHECK(total.load() == 255 * 256 / 2);
+
+        // Dependencia de un contador que ya terminó: se ejecuta enseguida.
+        std::atomic<int> late{ 0 };
+        jobs.runAfter(writes, [&late]() { late.store(1); }, &sums);
+        jobs.wait(sums);
+        EU_CHECK(late.load() == 1);
+
+        // Cadena de tres etapas.
+        std::vector<int> stages;
+        std::mutex stagesMutex;
+        CJobCounter first, second, third;
+        jobs.run([&]() { std::lock_guard<std::mutex> lock(stagesMutex); stages.push_back(1); }, &first);
+        jobs.runAfter(first, [&]() { std::lock_guard<std::mutex> lock(stagesMutex); stages.push_back(2); }, &second);
+        jobs.runAfter(second, [&]() { std::lock_guard<std::mutex> lock(stagesMutex); stages.push_back(3); }, &third);
+        jobs.wait(third);
+        EU_CHECK(stages.size() == 3 && stages[0] == 1 && stages[1] == 2 && stages[2] == 3);
+
+        // parallelFor visita cada índice exactamente una vez con cualquier grano.
+        const size_t sizes[] = { 0, 1, 7, 1000, 100003 };
+        const size_t grains[] = { 1, 3, 64, 1 << 20 };
+        std::atomic<bool> covered{ true };
+        for (size_t size : sizes) {
+            for (size_t grain : grains) {
+                std::vector<std::atomic<int>> hits(size);
+                jobs.parallelFor(0, size, grain, [&hits, grain, &covered](size_t begin, size_t end) {
+                    if (end - begin > grain || begin >= end) {
+                        covered.store(false);
+                    }
+                    for (size_t i = begin; i < end; ++i) {
+                        hits[i].fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+                for (std::atomic<int>& hit : hits) {
+                    if (hit.load() != 1) {
+                        covered.store(false);
+                    }
+                }
+            }
+        }
+        EU_CHECK(covered.load());
+
+        // parallelFor anidado dentro de los trabajos.
+        std::atomic<int64_t> nestedSum{ 0 };
+        jobs.parallelFor(0, 16, 1, [&jobs, &nestedSum](size_t begin, size_t end) {
+            for (size_t outer = begin; outer < end; ++outer) {
+                jobs.parallelFor(0, 1000, 50, [&nestedSum](size_t first, size_t last) {
+                    nestedSum.fetch_add(static_cast<int64_t>(last - first));
+                });
+            }
+        });
+        EU_CHECK(nestedSum.load() == 16000);
+
+        // Trabajos encolados y esperados desde un hilo externo.
+        std::atomic<int> external{ 0 };
+        std::thread outsider([&jobs, &external]() {
+            CJobCounter outsiderCounter;
+            for (int i = 0; i < 100; ++i) {
+                jobs.run([&external]() { external.fetch_add(1); }, &outsiderCounter);
+            }
+            jobs.wait(outsiderCounter);
+        });
+        outsider.join();
+        EU_CHECK(external.load() == 100);
+    }
+
+    /// Las versiones paralelas dan exactamente el mismo resultado que las serie.
+    void testParallelBatch(CJobSystem& jobs) {
+        const size_t count = 50000;
+        std::mt19937 rng(12);
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        std::vector<CVector3> points(count), velocities(count);
+        for (size_t i = 0; i < count; ++i) {
+            points[i] = CVector3(dist(rng), dist(rng), dist(rng));
+            velocities[i] = CVector3(dist(rng), dist(rng), dist(rng));
+        }
+        Matriz4x4 transform = Matriz4x4::Translate(1.0, 2.0, 3.0) * Matriz4x4::RotateZ(0.7) * Matriz4x4::Scale(2.0, 2.0, 2.0);
+
+        std::vector<CVector3> serial(count), parallel(count);
+        EngineUtilities::transformPoints(transform, points.data(), serial.data(), count);
+        EngineUtilities::parallelTransformPoints(jobs, transform, points.data(), parallel.data(), count, 1000);
+        EU_CHECK(serial == parallel);
+        EU_CHECK(serial[0] == CVector3(
+            static_cast<float>(transform.m[0][0] * points[0].x + transform.m[0][1] * points[0].y + transform.m[0][2] * points[0].z + transform.m[0][3]),
+            static_cast<float>(transform.m[1][0] * points[0].x + transform.m[1][1] * points[0].y + transform.m[1][2] * points[0].z + transform.m[1][3]),
+            static_cast<float>(transform.m[2][0] * points[0].x + transform.m[2][1] * points[0].y + transform.m[2][2] * points[0].z + transform.m[2][3])));
+
+        EngineUtilities::transformDirections(transform, points.data(), serial.data(), count);
+        EngineUtilities::parallelTransformDirections(jobs, transform, points.data(), parallel.data(), count, 1000);
+        EU_CHECK(serial == parallel);
+
+        std::vector<CVector3> serialPositions(points), parallelPositions(points);
+        EngineUtilities::integrate(serialPositions.data(), velocities.data(), 0.016f, count);
+        EngineUtilities::parallelIntegrate(jobs, parallelPositions.data(), velocities.data(), 0.016f, count, 1000);
+        EU_CHECK(serialPositions == parallelPositions);
+
+        EngineUtilities::normalizeVectors(serialPositions.data(), count);
+        EngineUtilities::parallelNormalizeVectors(jobs, parallelPositions.data(), count, 1000);
+        EU_CHECK(serialPositions == parallelPositions);
+
+        const size_t matrixCount = 2000;
+        std::vector<Matriz4x4> locals(matrixCount), parents(matrixCount), serialWorld(matrixCount), parallelWorld(matrixCount);
+        for (size_t i = 0; i < matrixCount; ++i) {
+            locals[i] = Matriz4x4::Translate(dist(rng), dist(rng), dist(rng)) * Matriz4x4::RotateZ(dist(rng));
+            parents[i] = Matriz4x4::RotateZ(dist(rng)) * Matriz4x4::Scale(1.0, 2.0, 3.0);
+        }
+        EngineUtilities::multiplyMatrices(parents.data(), locals.data(), serialWorld.data(), matrixCount);
+        EngineUtilities::parallelMultiplyMatrices(jobs, parents.data(), locals.data(), parallelWorld.data(), matrixCount, 64);
+        bool sameWorld = true;
+        for (size_t i = 0; i < matrixCount; ++i) {
+            sameWorld = sameWorld && serialWorld[i] == parallelWorld[i] && serialWorld[i] == parents[i] * locals[i];
+        }
+        EngineUtilities::parallelMultiplyMatrices(jobs, transform, locals.data(), parallelWorld.data(), matrixCount, 64);
+        for (size_t i = 0; i < matrixCount; ++i) {
+            sameWorld = sameWorld && parallelWorld[i] == transform * locals[i];
+        }
+        EU_CHECK(sameWorld);
+    }
+
+}
+
+/**
+ * @brief Cola de Chase-Lev concurrente, trabajos con contadores y dependencias, parallelFor
+ *        y operaciones por lotes, con y sin hilos en el pool.
+ */
+void testJobSystem() {
+    testDeque();
+    {
+        CJobSystem jobs(3);
+        EU_CHECK(jobs.workerCount() == 3 && jobs.concurrency() == 4);
+        testJobs(jobs);
+        testParallelBatch(jobs);
+    }
+    {
+        // Sin hilos en el pool todo lo ejecuta el llamador dentro de wait().
+        CJobSystem jobs(0);
+        testJobs(jobs);
+        testParallelBatch(jobs);
+    }
+}
@@ -0,0 +1,203 @@
+/**
+ * @file testKdTree.cpp
+ * @brief Pruebas de CKdTree frente a recorrer todos los puntos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/CKdTree.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CKdTree;
+    using EngineUtilities::CVector3;
+
+    /// Nube con la mitad de los puntos uniformes y la otra mitad en cúmulos densos.
+    std::vector<CVector3> makeCloud(size_t count, float range, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-range, range);
+        std::normal_distribution<float> spread(0.0f, range * 0.02f);
+        std::vector<CVector3> points(count);
+        CVector3 site;
+        for (size_t i = 0; i < count; ++i) {
+            if (i % 2 == 0) {
+                points[i] = CVector3(position(rng), position(rng), position(rng));
+                continue;
+            }
+            if (i % 200 == 1) {
+                site = CVector3(position(rng), position(rng), position(rng));
+            }
+            points[i] = site + CVector3(spread(rng), spread(rng), spread(rng));
+        }
+        return points;
+    }
+
+    /// Distancias al cuadrado de todos los puntos con el mismo núcleo que usan las hojas.
+    std::vector<float> bruteDistances(const std::vector<CVector3>& points, const CVector3& center) {
+        std::vector<float> xs(points.size());
+        std::vector<float> ys(points.size());
+        std::vector<float> zs(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            xs[i] = points[i].x;
+            ys[i] = points[i].y;
+            zs[i] = points[i].z;
+        }
+        std::vector<float> distances(points.size());
+        EngineUtilities::distanceSquaredBatch(xs.data(), ys.data(), zs.data(), points.size(), center, distances.data());
+        return distances;
+    }
+
+    void testEmptyAndSmall() {
+        CKdTree tree;
+        uint32_t index = 0;
+        float distance = 0.0f;
+        EU_CHECK(tree.size() == 0 && tree.validate() && tree.nearest(CVector3()) == UINT32_MAX);
+        EU_CHECK(tree.nearest(CVector3(), 4, &index, &distance) == 0);
+        std::vector<uint32_t> found;
+        EU_CHECK(tree.queryRadius(CVector3(), 100.0f, found) == 0);
+
+        CVector3 points[4] = { CVector3(-0.01f, 0.0f, 0.0f), CVector3(0.01f, 0.0f, 0.0f), CVector3(-2.01f, -4.0f, 6.0f),
+            CVector3(-1000.0f, 1000.0f, -1000.0f) };
+        tree.build(points, 4);
+        EU_CHECK(tree.size() == 4 && tree.validate());
+        EU_CHECK(tree.queryRadius(CVector3(), 0.02f, found) == 2);
+        EU_CHECK(tree.nearest(CVector3(-1.0f, -3.0f, 5.0f)) == 2);
+        EU_CHECK(tree.nearest(CVector3(-900.0f, 900.0f, -900.0f), 10.0f) == UINT32_MAX);
+        uint32_t indices[8];
+        float distances[8];
+        EU_CHECK(tree.nearest(CVector3(0.02f, 0.0f, 0.0f), 8, indices, distances) == 4);
+        EU_CHECK(indices[0] == 1 && indices[1] == 0 && indices[2] == 2 && indices[3] == 3);
+        EU_CHECK_NEAR(distances[0], 0.0001, 1e-6);
+
+        // Todos los puntos iguales: cortes con toda la mitad en el plano.
+        std::vector<CVector3> same(100, CVector3(0.5f, 0.5f, 0.5f));
+        tree.build(same.data(), same.size());
+        found.clear();
+        EU_CHECK(tree.validate() && tree.queryRadius(CVector3(0.5f, 0.5f, 0.5f), 0.0f, found) == 100);
+        EU_CHECK(tree.nearest(CVector3(), 8, indices, distances) == 8);
+
+        // El núcleo SIMD coincide con la distancia escalar (incluidos los restos de cada paquete).
+        std::vector<CVector3> cloud = makeCloud(37, 10.0f, 50);
+        std::vector<float> batch = bruteDistances(cloud, CVector3(1.0f, 2.0f, 3.0f));
+        bool sameKernel = true;
+        for (size_t i = 0; i < cloud.size(); ++i) {
+            float expected = (cloud[i] - CVector3(1.0f, 2.0f, 3.0f)).lengthSquare();
+            sameKernel = sameKernel && std::abs(batch[i] - expected) <= 1e-5f * expected;
+        }
+        EU_CHECK(sameKernel);
+    }
+
+    void testAgainstBruteForce() {
+        const float range = 50.0f;
+        std::vector<CVector3> points = makeCloud(20000, range, 51);
+        CKdTree tree;
+        tree.build(points.data(), points.size());
+        EU_CHECK(tree.size() == points.size() && tree.validate());
+        EU_CHECK(tree.bounds().contains(points[0]) && tree.bounds().contains(points[1]));
+
+        std::mt19937 rng(52);
+        std::uniform_real_distribution<float> position(-range * 1.2f, range * 1.2f);
+        std::uniform_real_distribution<float> radiusDistribution(0.0f, 8.0f);
+        bool sameRadius = true;
+        bool sameNearest = true;
+        const size_t k = 8;
+        uint32_t indices[k];
+        float nearest[k];
+        std::vector<uint32_t> found;
+        for (int q = 0; q < 300; ++q) {
+            // Parte de las consultas cae sobre los propios puntos (distancia 0 y empates).
+            CVector3 center = q % 3 == 0 ? points[rng() % points.size()] : CVector3(position(rng), position(rng), position(rng));
+            float radius = radiusDistribution(rng);
+            std::vector<float> distances = bruteDistances(points, center);
+            found.clear();
+            tree.queryRadius(center, radius, found);
+            std::sort(found.begin(), found.end());
+            std::vector<uint32_t> expected;
+            for (size_t i = 0; i < points.size(); ++i) {
+                if (distances[i] <= radius * radius) {
+                    expected.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            sameRadius = sameRadius && found == expected;
+
+            float maxDistance = q % 2 == 0 ? INFINITY : radius;
+            size_t n = tree.nearest(center, k, indices, nearest, maxDistance);
+            std::vector<float> sorted = distances;
+            std::sort(sorted.begin(), sorted.end());
+            size_t expectedCount = 0;
+            while (expectedCount < k && sorted[expectedCount] <= maxDistance * maxDistance) {
+                ++expectedCount;
+            }
+            sameNearest = sameNearest && n == expectedCount;
+            for (size_t i = 0; i < n && i < expectedCount; ++i) {
+                sameNearest = sameNearest && nearest[i] == sorted[i] && distances[indices[i]] == nearest[i];
+            }
+        }
+        EU_CHECK(sameRadius);
+        EU_CHECK(sameNearest);
+    }
+
+    void testBatchAndParallel() {
+        const float range = 40.0f;
+        std::vector<CVector3> points = makeCloud(70000, range, 53);
+        CJobSystem jobs(3);
+        CKdTree serial;
+        CKdTree parallel;
+        serial.build(points.data(), points.size());
+        parallel.build(points.data(), points.size(), &jobs);
+        EU_CHECK(parallel.validate() && parallel.size() == points.size());
+
+        // Consultas sueltas y a lo largo de un camino (coherentes), algunas fuera de la nube.
+        std::mt19937 rng(54);
+        std::uniform_real_distribution<float> position(-range * 1.5f, range * 1.5f);
+        const size_t count = 3000;
+        std::vector<CVector3> queries(count);
+        for (size_t q = 0; q < count; ++q) {
+            queries[q] = q < count / 2 ? CVector3(position(rng), position(rng), position(rng)) :
+                CVector3(-range + 0.05f * static_cast<float>(q - count / 2), 3.0f, -2.0f);
+        }
+        const size_t k = 5;
+        std::vector<uint32_t> batchIndices(count * k);
+        std::vector<float> batchDistances(count * k);
+        bool sameBatch = true;
+        for (int pass = 0; pass < 2; ++pass) {
+            // La segunda pasada limita la distancia: quedan huecos.
+            float maxDistance = pass == 0 ? INFINITY : 1.5f;
+            parallel.nearestBatch(queries.data(), count, k, batchIndices.data(), batchDistances.data(), &jobs, maxDistance);
+            uint32_t indices[k];
+            float distances[k];
+            for (size_t q = 0; q < count; ++q) {
+                size_t n = serial.nearest(queries[q], k, indices, distances, maxDistance);
+                for (size_t i = 0; i < k; ++i) {
+                    uint32_t index = batchIndices[q * k + i];
+                    float distance = batchDistances[q * k + i];
+                    sameBatch = sameBatch && (i < n ? distance == distances[i] &&
+                        (points[index] - queries[q]).lengthSquare() <= distance * 1.0001f + 1e-6f :
+                        index == UINT32_MAX && distance == INFINITY);
+                }
+            }
+        }
+        EU_CHECK(sameBatch);
+        // Sin trabajos, el mismo resultado.
+        std::vector<float> serialDistances(count * k);
+        std::vector<uint32_t> serialIndices(count * k);
+        serial.nearestBatch(queries.data(), count, k, serialIndices.data(), serialDistances.data());
+        parallel.nearestBatch(queries.data(), count, k, batchIndices.data(), batchDistances.data(), &jobs);
+        EU_CHECK(serialDistances == batchDistances);
+    }
+
+}
+
+/**
+ * @brief Pruebas de CKdTree.
+ */
+void testKdTree() {
+    testEmptyAndSmall();
+    testAgainstBruteForce();
+    testBatchAndParallel();
+}
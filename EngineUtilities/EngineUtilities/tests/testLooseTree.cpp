@@ -0,0 +1,243 @@
+/**
+ * @file testLooseTree.cpp
+ * @brief Pruebas del octree y el quadtree holgados frente a recorrer todos los objetos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/TLooseTree.h"
+#include "../include/Matriz/Matriz4x4.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CFrustum;
+    using EngineUtilities::CLooseOctree;
+    using EngineUtilities::CLooseQuadtree;
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz4x4;
+
+    /// Proyección en perspectiva con la cámara mirando hacia -z (como gluPerspective).
+    Matriz4x4 perspective(double fovY, double aspect, double nearZ, double farZ) {
+        double f = 1.0 / EngineUtilities::tan(fovY / 2.0);
+        return Matriz4x4(
+            f / aspect, 0.0, 0.0, 0.0,
+            0.0, f, 0.0, 0.0,
+            0.0, 0.0, (farZ + nearZ) / (nearZ - farZ), 2.0 * farZ * nearZ / (nearZ - farZ),
+            0.0, 0.0, -1.0, 0.0);
+    }
+
+    /// Proxies que devuelve una consulta, ordenados por userData.
+    template<typename Query>
+    std::vector<uint32_t> collect(const Query& query) {
+        std::vector<uint32_t> found;
+        query(found);
+        std::sort(found.begin(), found.end());
+        return found;
+    }
+
+    /// Caja aleatoria: la mayoría pequeñas, algunas grandes y algunas fuera del mundo.
+    CAABB randomBox(std::mt19937& rng, float range) {
+        std::uniform_real_distribution<float> position(-range, range);
+        std::uniform_real_distribution<float> size(0.1f, 3.0f);
+        CVector3 extents(size(rng), size(rng), size(rng));
+        if (rng() % 20 == 0) {
+            extents = extents * 15.0f;
+        }
+        return CAABB::fromCenterExtents(CVector3(position(rng), position(rng), position(rng)), extents);
+    }
+
+    void testStructure() {
+        CLooseOctree tree(CVector3(-64.0f, -64.0f, -64.0f), 128.0f, 6);
+        EU_CHECK(tree.validate() && tree.size() == 0 && tree.nodeCount() == 1);
+
+        // Un objeto pequeño baja hasta la máxima profundidad; uno enorme se queda en la raíz.
+        uint32_t small = tree.insert(CAABB::fromCenterExtents(CVector3(10.0f, 10.0f, 10.0f), CVector3(0.5f, 0.5f, 0.5f)), 1);
+        EU_CHECK(tree.nodeCount() == 7);
+        uint32_t huge = tree.insert(CAABB(CVector3(-100.0f, -1.0f, -1.0f), CVector3(100.0f, 1.0f, 1.0f)), 2);
+        uint32_t outside = tree.insert(CAABB::fromCenterExtents(CVector3(500.0f, 0.0f, 0.0f), CVector3(1.0f, 1.0f, 1.0f)), 3);
+        EU_CHECK(tree.validate() && tree.size() == 3 && tree.nodeCount() == 7);
+        EU_CHECK(tree.userData(small) == 1 && tree.userData(huge) == 2 && tree.userData(outside) == 3);
+
+        // Moverse dentro de la celda no cambia de nodo; cruzarla sí, y la rama vieja se poda.
+        EU_CHECK(!tree.update(small, CAABB::fromCenterExtents(CVector3(10.2f, 10.1f, 10.0f), CVector3(0.5f, 0.5f, 0.5f))));
+        EU_CHECK(tree.update(small, CAABB::fromCenterExtents(CVector3(-30.0f, 10.0f, 10.0f), CVector3(0.5f, 0.5f, 0.5f))));
+        EU_CHECK(tree.validate() && tree.nodeCount() == 7);
+        // Crecer lo sube de nivel.
+        EU_CHECK(tree.update(small, CAABB::fromCenterExtents(CVector3(-30.0f, 10.0f, 10.0f), CVector3(20.0f, 1.0f, 1.0f))));
+        EU_CHECK(tree.validate() && tree.nodeCount() < 7);
+
+        EU_CHECK(tree.remove(small) && !tree.remove(small) && !tree.remove(99));
+        EU_CHECK(tree.validate() && tree.size() == 2 && tree.nodeCount() == 1);
+        // El hueco se recicla.
+        EU_CHECK(tree.insert(CAABB::fromCenterExtents(CVector3(), CVector3(1.0f, 1.0f, 1.0f)), 4) == small);
+        tree.clear();
+        EU_CHECK(tree.validate() && tree.size() == 0 && tree.nodeCount() == 1);
+
+        // Objetos exactamente sobre los bordes de celda.
+        for (int i = -64; i <= 64; i += 8) {
+            float p = static_cast<float>(i);
+            tree.insert(CAABB::fromCenterExtents(CVector3(p, p, -p), CVector3(0.5f, 0.5f, 0.5f)), static_cast<uint32_t>(i + 64));
+        }
+        EU_CHECK(tree.validate());
+    }
+
+    void testQueries() {
+        const float range = 120.0f;
+        CLooseOctree tree(CVector3(-100.0f, -100.0f, -100.0f), 200.0f, 7);
+        std::mt19937 rng(41);
+        std::vector<CAABB> boxes(3000);
+        std::vector<uint32_t> proxies(boxes.size());
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            boxes[i] = randomBox(rng, range);
+            proxies[i] = tree.insert(boxes[i], static_cast<uint32_t>(i));
+        }
+        // Mover la mitad: la estructura y las consultas deben seguir siendo exactas.
+        std::uniform_real_distribution<float> step(-6.0f, 6.0f);
+        for (size_t i = 0; i < boxes.size(); i += 2) {
+            CVector3 offset(step(rng), step(rng), step(rng));
+            boxes[i] = CAABB(boxes[i].min + offset, boxes[i].max + offset);
+            tree.update(proxies[i], boxes[i]);
+        }
+        EU_CHECK(tree.validate() && tree.size() == boxes.size());
+
+        std::uniform_real_distribution<float> position(-range, range);
+        bool sameBox = true;
+        bool sameSphere = true;
+        bool sameRay = true;
+        for (int q = 0; q < 200; ++q) {
+            CVector3 center(position(rng), position(rng), position(rng));
+            CAABB query = CAABB::fromCenterExtents(center, CVector3(10.0f, 4.0f, 15.0f));
+            std::vector<uint32_t> expected;
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                if (boxes[i].overlaps(query)) {
+                    expected.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            sameBox = sameBox && expected == collect([&](std::vector<uint32_t>& found) {
+                tree.query(query, [&](uint32_t proxy) {
+                    found.push_back(tree.userData(proxy));
+                    return true;
+                });
+            });
+
+            float radius = 12.0f;
+            expected.clear();
+            for (size_t i = 0; i < boxes.size(); ++i) {
+                if (boxes[i].distanceSquared(center) <= radius * radius) {
+                    expected.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            sameSphere = sameSphere && expected == collect([&](std::vector<uint32_t>& found) {
+                tree.querySphere(center, radius, [&](uint32_t proxy) {
+                    found.push_back(tree.userData(proxy));
+                    return true;
+                });
+            });
+
+            // Rayo: la caja más cercana.
+            CVector3 direction = CVector3(position(rng), position(rng), position(rng)).normalized();
+            CVector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+            float closest = 300.0f;
+            for (const CAABB& box : boxes) {
+                float t = 0.0f;
+                if (box.intersectsRay(center, inverse, closest, t)) {
+                    closest = t;
+                }
+            }
+            float treeClosest = 300.0f;
+            tree.raycast(center, direction, 300.0f, [&](uint32_t proxy, float maxT) {
+                float t = 0.0f;
+                if (boxes[tree.userData(proxy)].intersectsRay(center, inverse, maxT, t)) {
+                    treeClosest = t;
+                    return t;
+                }
+                return maxT;
+            });
+            sameRay = sameRay && treeClosest == closest;
+        }
+        EU_CHECK(sameBox);
+        EU_CHECK(sameSphere);
+        EU_CHECK(sameRay);
+
+        // Frustum: nunca falta un objeto visible (puede sobrar alguno cerca de las esquinas).
+        CFrustum frustum = CFrustum::fromMatrix(perspective(1.2, 1.5, 0.5, 150.0) *
+            Matriz4x4::RotateZ(0.4) * Matriz4x4::Translate(20.0, -10.0, 30.0));
+        std::vector<uint8_t> reported(boxes.size(), 0);
+        tree.query(frustum, [&](uint32_t proxy) {
+            ++reported[tree.userData(proxy)];
+            return true;
+        });
+        bool complete = true;
+        size_t visible = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            bool expectedVisible = frustum.intersects(boxes[i]);
+            visible += expectedVisible ? 1 : 0;
+            complete = complete && reported[i] <= 1 && (!expectedVisible || reported[i] == 1);
+        }
+        EU_CHECK(complete && visible > 50);
+
+        // Detener la consulta a la primera.
+        int calls = 0;
+        tree.query(CAABB(CVector3(-200.0f, -200.0f, -200.0f), CVector3(200.0f, 200.0f, 200.0f)), [&](uint32_t) {
+            ++calls;
+            return false;
+        });
+        EU_CHECK(calls == 1);
+    }
+
+    void testQuadtree() {
+        CLooseQuadtree tree(CVector2(0.0f, 0.0f), 1024.0f, 8);
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> position(0.0f, 1024.0f);
+        std::uniform_real_distribution<float> size(0.5f, 6.0f);
+        std::vector<CVector2> mins(2000);
+        std::vector<CVector2> maxs(2000);
+        std::vector<uint32_t> proxies(mins.size());
+        for (size_t i = 0; i < mins.size(); ++i) {
+            CVector2 center(position(rng), position(rng));
+            CVector2 half(size(rng), size(rng));
+            mins[i] = center - half;
+            maxs[i] = center + half;
+            proxies[i] = tree.insert(mins[i], maxs[i], static_cast<uint32_t>(i));
+        }
+        for (size_t i = 0; i < mins.size(); i += 3) {
+            tree.remove(proxies[i]);
+        }
+        EU_CHECK(tree.validate());
+        bool same = true;
+        for (int q = 0; q < 200; ++q) {
+            CVector2 center(position(rng), position(rng));
+            float radius = 30.0f;
+            std::vector<uint32_t> expected;
+            for (size_t i = 0; i < mins.size(); ++i) {
+                float dx = std::max(0.0f, std::max(mins[i].x - center.x, center.x - maxs[i].x));
+                float dy = std::max(0.0f, std::max(mins[i].y - center.y, center.y - maxs[i].y));
+                if (i % 3 != 0 && dx * dx + dy * dy <= radius * radius) {
+                    expected.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            same = same && expected == collect([&](std::vector<uint32_t>& found) {
+                tree.querySphere(center, radius, [&](uint32_t proxy) {
+                    found.push_back(tree.userData(proxy));
+                    return true;
+                });
+            });
+        }
+        EU_CHECK(same);
+    }
+
+}
+
+/**
+ * @brief Pruebas de TLooseTree.
+ */
+void testLooseTree() {
+    testStructure();
+    testQueries();
+    testQuadtree();
+}
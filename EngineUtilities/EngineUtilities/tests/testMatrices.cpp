@@ -0,0 +1,158 @@
+/**
+ * @file testMatrices.cpp
+ * @brief Identidades de Matriz2x2, Matriz3x3 y Matriz4x4.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <random>
+#include "TestHarness.h"
+#include "../include/Matriz/Matriz2x2.h"
+#include "../include/Matriz/Matriz3x3.h"
+#include "../include/Matriz/Matriz4x4.h"
+
+namespace {
+
+    using EngineUtilities::Matriz2x2;
+    using EngineUtilities::Matriz3x3;
+    using EngineUtilities::Matriz4x4;
+
+    const int kSamples = 1000; ///< Matrices aleatorias por identidad.
+
+    /// Número de filas/columnas de cada matriz.
+    template<typename M> struct MatrixSize;
+    template<> struct MatrixSize<Matriz2x2> { static const int value = 2; };
+    template<> struct MatrixSize<Matriz3x3> { static const int value = 3; };
+    template<> struct MatrixSize<Matriz4x4> { static const int value = 4; };
+
+    /// Acceso uniforme a los elementos: Matriz2x2/3x3 guardan sus campos contiguos por filas.
+    template<typename M>
+    double& element(M& matrix, int row, int column) {
+        return (&matrix.m00)[row * MatrixSize<M>::value + column];
+    }
+
+    double& element(Matriz4x4& matrix, int row, int column) {
+        return matrix.m[row][column];
+    }
+
+    /// Matriz con elementos en [-2, 2] más 3 en la diagonal: siempre bien condicionada.
+    template<typename M>
+    M randomMatrix(std::mt19937& rng) {
+        std::uniform_real_distribution<double> dist(-2.0, 2.0);
+        M result;
+        for (int i = 0; i < MatrixSize<M>::value; ++i) {
+            for (int j = 0; j < MatrixSize<M>::value; ++j) {
+                element(result, i, j) = dist(rng) + (i == j ? 3.0 : 0.0);
+            }
+        }
+        return result;
+    }
+
+    template<typename M>
+    double maxDifference(M a, M b) {
+        double result = 0.0;
+        for (int i = 0; i < MatrixSize<M>::value; ++i) {
+            for (int j = 0; j < MatrixSize<M>::value; ++j) {
+                result = std::fmax(result, std::fabs(element(a, i, j) - element(b, i, j)));
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Identidades comunes a las tres matrices, evaluadas sobre matrices aleatorias.
+     */
+    template<typename M>
+    void testCommonIdentities(unsigned seed) {
+        std::mt19937 rng(seed);
+        const M identity;
+
+        double neutral = 0.0, inverseLeft = 0.0, inverseRight = 0.0, transposeInvolution = 0.0;
+        double transposeProduct = 0.0, associative = 0.0, distributive = 0.0, scalar = 0.0;
+        for (int i = 0; i < kSamples; ++i) {
+            M a = randomMatrix<M>(rng);
+            M b = randomMatrix<M>(rng);
+            M c = randomMatrix<M>(rng);
+
+            neutral = std::fmax(neutral, std::fmax(maxDifference(a * identity, a), maxDifference(identity * a, a)));
+            inverseLeft = std::fmax(inverseLeft, maxDifference(a.inverse() * a, identity));
+            inverseRight = std::fmax(inverseRight, maxDifference(a * a.inverse(), identity));
+            transposeInvolution = std::fmax(transposeInvolution, maxDifference(a.transpose().transpose(), a));
+            transposeProduct = std::fmax(transposeProduct, maxDifference((a * b).transpose(), b.transpose() * a.transpose()));
+            associative = std::fmax(associative, maxDifference((a * b) * c, a * (b * c)));
+            distributive = std::fmax(distributive, maxDifference(a * (b + c), a * b + a * c));
+            scalar = std::fmax(scalar, maxDifference((a * 2.5) / 2.5, a) + maxDifference((a + b) - b, a));
+        }
+
+        EU_CHECK(neutral == 0.0);
+        EU_CHECK_NEAR(inverseLeft, 0.0, 1e-12);
+        EU_CHECK_NEAR(inverseRight, 0.0, 1e-12);
+        EU_CHECK(transposeInvolution == 0.0);
+        EU_CHECK_NEAR(transposeProduct, 0.0, 1e-12);
+        EU_CHECK_NEAR(associative, 0.0, 1e-10);
+        EU_CHECK_NEAR(distributive, 0.0, 1e-12);
+        EU_CHECK_NEAR(scalar, 0.0, 1e-14);
+
+        // Una matriz singular no tiene inversa: se devuelve la identidad.
+        M singular = randomMatrix<M>(rng);
+        for (int j = 0; j < MatrixSize<M>::value; ++j) {
+            element(singular, 1, j) = element(singular, 0, j) * 2.0;
+        }
+        EU_CHECK(singular.inverse() == identity);
+        EU_CHECK(identity.inverse() == identity);
+    }
+
+    /// det(AB) = det(A) det(B) y det(A^T) = det(A).
+    template<typename M>
+    void testDeterminant(unsigned seed) {
+        std::mt19937 rng(seed);
+        double multiplicative = 0.0, transposed = 0.0;
+        for (int i = 0; i < kSamples; ++i) {
+            M a = randomMatrix<M>(rng);
+            M b = randomMatrix<M>(rng);
+            double expected = a.determinant() * b.determinant();
+            multiplicative = std::fmax(multiplicative, std::fabs((a * b).determinant() - expected) / std::fabs(expected));
+            transposed = std::fmax(transposed, std::fabs(a.transpose().determinant() - a.determinant()));
+        }
+        EU_CHECK_NEAR(multiplicative, 0.0, 1e-11);
+        EU_CHECK_NEAR(transposed, 0.0, 1e-12);
+    }
+
+}
+
+/**
+ * @brief Comprueba inversa, transpuesta, producto y determinante de las matrices y los
+ *        valores conocidos de sus transformaciones.
+ */
+void testMatrices() {
+    testCommonIdentities<Matriz2x2>(6);
+    testCommonIdentities<Matriz3x3>(7);
+    testCommonIdentities<Matriz4x4>(8);
+    testDeterminant<Matriz2x2>(9);
+    testDeterminant<Matriz3x3>(10);
+
+    const double halfPi = EngineUtilities::PI / 2.0;
+
+    EU_CHECK(Matriz2x2::Scale(2.0, 3.0) == Matriz2x2(2.0, 0.0, 0.0, 3.0));
+    EU_CHECK(Matriz2x2::Rotate(halfPi) == Matriz2x2(0.0, -1.0, 1.0, 0.0));
+    EU_CHECK(Matriz2x2::Rotate(0.3) * Matriz2x2::Rotate(0.4) == Matriz2x2::Rotate(0.7));
+    EU_CHECK(Matriz2x2::Rotate(0.3).inverse() == Matriz2x2::Rotate(0.3).transpose());
+    EU_CHECK(Matriz2x2(1.0, 2.0, 3.0, 4.0).determinant() == -2.0);
+
+    EU_CHECK(Matriz3x3::Scale(2.0, 3.0).determinant() == 6.0);
+    EU_CHECK(Matriz3x3::Rotate(0.3) * Matriz3x3::Rotate(0.4) == Matriz3x3::Rotate(0.7));
+    EU_CHECK(Matriz3x3::Rotate(0.3).inverse() == Matriz3x3::Rotate(0.3).transpose());
+    // sin y cos de EngineMath tienen un error absoluto de hasta 2e-7.
+    EU_CHECK_NEAR(Matriz3x3::Rotate(1.1).determinant(), 1.0, 1e-6);
+
+    Matriz4x4 translate = Matriz4x4::Translate(1.0, 2.0, 3.0);
+    EU_CHECK(translate.m[0][3] == 1.0 && translate.m[1][3] == 2.0 && translate.m[2][3] == 3.0);
+    EU_CHECK(translate.inverse() == Matriz4x4::Translate(-1.0, -2.0, -3.0));
+    EU_CHECK(Matriz4x4::Scale(2.0, 4.0, 8.0).inverse() == Matriz4x4::Scale(0.5, 0.25, 0.125));
+    EU_CHECK(Matriz4x4::RotateZ(0.3) * Matriz4x4::RotateZ(0.4) == Matriz4x4::RotateZ(0.7));
+    EU_CHECK(Matriz4x4::RotateZ(halfPi) == Matriz4x4(
+        0.0, -1.0, 0.0, 0.0,
+        1.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 1.0));
+}
@@ -0,0 +1,85 @@
+/**
+ * @file testMemoryTracker.cpp
+ * @brief Pruebas de MemoryTracker con la instrumentación activa en esta unidad.
+ * @author Hannin Abarca
+ */
+
+// Los tipos instrumentados están en un espacio de nombres anónimo para no compartir
+// instancias de plantilla con las unidades compiladas sin instrumentación.
+#define ENGINEUTILITIES_MEMORY_TRACKING 1
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Memory/TSharedPointer.h"
+#include "../include/Memory/TUniquePtr.h"
+
+namespace {
+
+    using EngineUtilities::MemoryTracker;
+    using EngineUtilities::TSharedPointer;
+    using EngineUtilities::TypeMemoryStats;
+    using EngineUtilities::TUniquePtr;
+
+    struct TrackedMesh {
+        double vertices[16];
+    };
+
+    struct TrackedTexture {
+        int pixels[8];
+    };
+
+    /// Estadísticas del tipo cuyo nombre contiene name (vacías si no se registró).
+    TypeMemoryStats statsFor(const char* name) {
+        for (const TypeMemoryStats& stats : MemoryTracker::snapshot()) {
+            if (stats.typeName.find(name) != std::string::npos) {
+                return stats;
+            }
+        }
+        return TypeMemoryStats{};
+    }
+
+}
+
+/**
+ * @brief Asignaciones, bytes vivos, pico y operaciones de recuento por tipo, también
+ *        desde varios hilos.
+ */
+void testMemoryTracker() {
+    {
+        TSharedPointer<TrackedMesh> a = EngineUtilities::MakeShared<TrackedMesh>();
+        TSharedPointer<TrackedMesh> b = EngineUtilities::MakeShared<TrackedMesh>();
+        TSharedPointer<TrackedMesh> copy = a;
+        TypeMemoryStats stats = statsFor("TrackedMesh");
+        EU_CHECK(stats.allocations == 2);
+        EU_CHECK(stats.liveObjects == 2);
+        EU_CHECK(stats.liveBytes == static_cast<int64_t>(2 * sizeof(TrackedMesh)));
+        EU_CHECK(stats.refIncrements == 3);
+    }
+    TypeMemoryStats mesh = statsFor("TrackedMesh");
+    EU_CHECK(mesh.frees == 2);
+    EU_CHECK(mesh.liveBytes == 0);
+    EU_CHECK(mesh.peakBytes == static_cast<int64_t>(2 * sizeof(TrackedMesh)));
+    EU_CHECK(mesh.refIncrements == mesh.refDecrements);
+
+    // Los contadores de hilos ya terminados se siguen sumando.
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 100; ++i) {
+                TUniquePtr<TrackedTexture> texture = EngineUtilities::MakeUnique<TrackedTexture>();
+                TUniquePtr<TrackedTexture> moved(std::move(texture));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    TypeMemoryStats texture = statsFor("TrackedTexture");
+    EU_CHECK(texture.allocations == 400);
+    EU_CHECK(texture.frees == 400);
+    EU_CHECK(texture.liveObjects == 0);
+    EU_CHECK(texture.peakBytes >= static_cast<int64_t>(sizeof(TrackedTexture)));
+}
@@ -0,0 +1,209 @@
+/**
+ * @file testOBB.cpp
+ * @brief Pruebas de la caja orientada: ejes separadores, ajuste por covarianza y lotes.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/BoundsBatch.h"
+#include "../include/Geometry/COBB.h"
+#include "../include/Geometry/GJK.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CBoxShape;
+    using EngineUtilities::CConvexHullShape;
+    using EngineUtilities::CGjkResult;
+    using EngineUtilities::CGjkSolver;
+    using EngineUtilities::COBB;
+    using EngineUtilities::COBBArray;
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::Matriz3x3;
+
+    CQuaternion randomRotation(std::mt19937& rng) {
+        std::normal_distribution<float> normal(0.0f, 1.0f);
+        CQuaternion q(normal(rng), normal(rng), normal(rng), normal(rng));
+        float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        return CQuaternion(q.x / length, q.y / length, q.z / length, q.w / length);
+    }
+
+    void testBasics() {
+        CQuaternion rotation = CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 1.5707963f);
+        COBB box(CVector3(1.0f, 2.0f, 3.0f), rotation, CVector3(2.0f, 1.0f, 0.5f));
+        // Girada 90 grados en z: el eje x local apunta a +y.
+        EU_CHECK_NEAR(box.axes[0].y, 1.0f, 1e-5f);
+        EU_CHECK(box.contains(CVector3(1.0f, 3.9f, 3.0f)));
+        EU_CHECK(!box.contains(CVector3(2.5f, 2.0f, 3.0f)));
+        CVector3 closest = box.closestPoint(CVector3(1.0f, 10.0f, 3.0f));
+        EU_CHECK_NEAR(closest.y, 4.0f, 1e-5f);
+
+        // La misma orientación dada como matriz y la matriz de vuelta.
+        COBB fromMatrix(box.center, box.rotation(), box.halfExtents);
+        for (int axis = 0; axis < 3; ++axis) {
+            EU_CHECK_NEAR((fromMatrix.axes[axis] - box.axes[axis]).lengthSquare(), 0.0f, 1e-10f);
+        }
+        EU_CHECK(Matriz3x3(0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0) == box.rotation());
+
+        CAABB bounds = box.bounds();
+        EU_CHECK_NEAR(bounds.min.x, 0.0f, 1e-5f);
+        EU_CHECK_NEAR(bounds.max.y, 4.0f, 1e-5f);
+        EU_CHECK_NEAR(box.volume(), 8.0f, 1e-5f);
+        COBB aligned = COBB::fromAABB(CAABB(CVector3(-1.0f, 0.0f, 2.0f), CVector3(1.0f, 4.0f, 3.0f)));
+        EU_CHECK_NEAR(aligned.center.y, 2.0f, 1e-6f);
+        EU_CHECK_NEAR(aligned.halfExtents.z, 0.5f, 1e-6f);
+    }
+
+    /// SAT frente a GJK en pares aleatorios; los casi tangentes (|distancia| < 1e-4) no cuentan.
+    void testBoxBox() {
+        std::mt19937 rng(50);
+        std::uniform_real_distribution<float> offset(-3.0f, 3.0f);
+        std::uniform_real_distribution<float> extent(0.1f, 1.5f);
+        CGjkSolver solver;
+        int wrong = 0;
+        int overlapping = 0;
+        for (int i = 0; i < 5000; ++i) {
+            CQuaternion ra = randomRotation(rng);
+            // Uno de cada cuatro pares comparte orientación: aristas paralelas.
+            CQuaternion rb = i % 4 == 0 ? ra : randomRotation(rng);
+            CVector3 ea(extent(rng), extent(rng), extent(rng));
+            CVector3 eb(extent(rng), extent(rng), extent(rng));
+            CVector3 position(offset(rng), offset(rng), offset(rng));
+            COBB a(CVector3(), ra, ea);
+            COBB b(position, rb, eb);
+            CGjkResult result;
+            solver.distance(CBoxShape(CVector3(), ra, ea), CBoxShape(position, rb, eb), result);
+            if (std::fabs(result.distance) < 1e-4f && !result.intersecting) {
+                continue;
+            }
+            overlapping += result.intersecting ? 1 : 0;
+            wrong += a.overlaps(b) == result.intersecting && b.overlaps(a) == result.intersecting ? 0 : 1;
+        }
+        EU_CHECK(overlapping > 500);
+        EU_CHECK(wrong == 0);
+
+        // Caras en contacto exacto cuentan como solape.
+        COBB unit(CVector3(), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(unit.overlaps(COBB(CVector3(2.0f, 0.5f, 0.0f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f))));
+        EU_CHECK(!unit.overlaps(COBB(CVector3(2.01f, 0.5f, 0.0f), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f))));
+        // Separadas solo por un eje de aristas: dos cajas giradas 45 grados en ejes cruzados.
+        COBB edgeA(CVector3(), CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 0.78539816f), CVector3(1.0f, 1.0f, 1.0f));
+        COBB edgeB(CVector3(2.9f, 0.0f, 0.0f), CQuaternion::fromAxisAngle(CVector3(0.0f, 1.0f, 0.0f), 0.78539816f), CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(!edgeA.overlaps(edgeB));
+        EU_CHECK(edgeA.overlaps(COBB(CVector3(2.7f, 0.0f, 0.0f), edgeB.rotation(), edgeB.halfExtents)));
+    }
+
+    void testBoxTriangle() {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> offset(-1.5f, 1.5f);
+        std::uniform_real_distribution<float> unit(-1.5f, 1.5f);
+        std::uniform_real_distribution<float> extent(0.1f, 1.2f);
+        CGjkSolver solver;
+        int wrong = 0;
+        int overlapping = 0;
+        for (int i = 0; i < 5000; ++i) {
+            CQuaternion rotation = randomRotation(rng);
+            CVector3 extents(extent(rng), extent(rng), extent(rng));
+            COBB box(CVector3(), rotation, extents);
+            CVector3 base(offset(rng), offset(rng), offset(rng));
+            CVector3 triangle[3] = { base, base + CVector3(unit(rng), unit(rng), unit(rng)), base + CVector3(unit(rng), unit(rng), unit(rng)) };
+            CGjkResult result;
+            solver.distance(CBoxShape(CVector3(), rotation, extents), CConvexHullShape(triangle, 3, CVector3(), CQuaternion()), result);
+            if (std::fabs(result.distance) < 1e-4f && !result.intersecting) {
+                continue;
+            }
+            overlapping += result.intersecting ? 1 : 0;
+            wrong += box.overlapsTriangle(triangle[0], triangle[1], triangle[2]) == result.intersecting ? 0 : 1;
+        }
+        EU_CHECK(overlapping > 500);
+        EU_CHECK(wrong == 0);
+
+        COBB unitBox(CVector3(), CQuaternion(), CVector3(1.0f, 1.0f, 1.0f));
+        // Triángulo grande que atraviesa la caja sin vértices dentro.
+        EU_CHECK(unitBox.overlapsTriangle(CVector3(-10.0f, -10.0f, 0.5f), CVector3(10.0f, -10.0f, 0.5f), CVector3(0.0f, 10.0f, 0.5f)));
+        // Mismo triángulo por encima de la caja.
+        EU_CHECK(!unitBox.overlapsTriangle(CVector3(-10.0f, -10.0f, 1.5f), CVector3(10.0f, -10.0f, 1.5f), CVector3(0.0f, 10.0f, 1.5f)));
+    }
+
+    void testFit() {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        CQuaternion rotation = randomRotation(rng);
+        COBB truth(CVector3(4.0f, -2.0f, 1.0f), rotation, CVector3(3.0f, 1.0f, 0.4f));
+        // Puntos en la superficie de la caja: la covarianza recupera sus ejes.
+        std::vector<CVector3> points;
+        for (int i = 0; i < 4000; ++i) {
+            CVector3 local(unit(rng), unit(rng), unit(rng));
+            local[i % 3] = local[i % 3] < 0.0f ? -1.0f : 1.0f;
+            points.push_back(truth.center + truth.axes[0] * (local.x * truth.halfExtents.x) +
+                truth.axes[1] * (local.y * truth.halfExtents.y) + truth.axes[2] * (local.z * truth.halfExtents.z));
+        }
+        COBB fitted = COBB::fromPoints(points.data(), points.size());
+        int outside = 0;
+        for (const CVector3& point : points) {
+            COBB grown = fitted;
+            grown.halfExtents += CVector3(1e-4f, 1e-4f, 1e-4f);
+            outside += grown.contains(point) ? 0 : 1;
+        }
+        EU_CHECK(outside == 0);
+        EU_CHECK(fitted.volume() < truth.volume() * 1.05f);
+        EU_CHECK_NEAR((fitted.center - truth.center).lengthSquare(), 0.0f, 1e-3f);
+        // Base ortonormal y dextrógira.
+        EU_CHECK_NEAR(fitted.axes[0].dot(fitted.axes[1]), 0.0f, 1e-5f);
+        EU_CHECK_NEAR(fitted.axes[0].cross(fitted.axes[1]).dot(fitted.axes[2]), 1.0f, 1e-5f);
+
+        // Puntos en un plano y un único punto.
+        std::vector<CVector3> flat = { CVector3(0.0f, 0.0f, 0.0f), CVector3(2.0f, 2.0f, 0.0f), CVector3(2.0f, 0.0f, 0.0f), CVector3(0.0f, 2.0f, 0.0f) };
+        COBB flatBox = COBB::fromPoints(flat.data(), flat.size());
+        EU_CHECK_NEAR(flatBox.volume(), 0.0f, 1e-5f);
+        EU_CHECK_NEAR(flatBox.center.x, 1.0f, 1e-5f);
+        COBB single = COBB::fromPoints(flat.data() + 1, 1);
+        EU_CHECK_NEAR(single.center.y, 2.0f, 1e-5f);
+    }
+
+    void testBatch() {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> offset(-4.0f, 4.0f);
+        std::uniform_real_distribution<float> extent(0.1f, 1.5f);
+        COBBArray boxes;
+        std::vector<COBB> scalar;
+        for (int i = 0; i < 1003; ++i) {
+            COBB box(CVector3(offset(rng), offset(rng), offset(rng)), randomRotation(rng), CVector3(extent(rng), extent(rng), extent(rng)));
+            boxes.push(box);
+            scalar.push_back(box);
+        }
+        EU_CHECK(boxes.size() == 1003);
+        EU_CHECK_NEAR((boxes.get(17).axes[2] - scalar[17].axes[2]).lengthSquare(), 0.0f, 0.0f);
+        int mismatches = 0;
+        size_t total = 0;
+        std::vector<uint8_t> flags(boxes.size());
+        for (int q = 0; q < 20; ++q) {
+            COBB query(CVector3(offset(rng), offset(rng), offset(rng)), randomRotation(rng), CVector3(extent(rng), extent(rng), extent(rng)));
+            size_t hits = EngineUtilities::overlapBatch(boxes, query, flags.data());
+            size_t expected = 0;
+            for (size_t i = 0; i < scalar.size(); ++i) {
+                bool overlap = query.overlaps(scalar[i]);
+                expected += overlap ? 1 : 0;
+                mismatches += (flags[i] != 0) == overlap ? 0 : 1;
+            }
+            mismatches += hits == expected ? 0 : 1;
+            total += hits;
+        }
+        EU_CHECK(total > 0);
+        EU_CHECK(mismatches == 0);
+    }
+
+}
+
+void testOBB() {
+    testBasics();
+    testBoxBox();
+    testBoxTriangle();
+    testFit();
+    testBatch();
+}
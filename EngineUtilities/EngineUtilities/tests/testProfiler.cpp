@@ -0,0 +1,136 @@
+/**
+ * @file testProfiler.cpp
+ * @brief Pruebas de Profiler con las zonas de perfilado activas en esta unidad.
+ * @author Hannin Abarca
+ */
+
+#define ENGINEUTILITIES_PROFILING 1
+
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Utilities/Profiler.h"
+
+namespace {
+
+    using EngineUtilities::ProfileEvent;
+    using EngineUtilities::Profiler;
+
+    /// Zonas cuyo nombre es name.
+    std::vector<ProfileEvent> eventsNamed(const std::vector<ProfileEvent>& events, const char* name) {
+        std::vector<ProfileEvent> result;
+        for (const ProfileEvent& event : events) {
+            if (std::strcmp(event.name, name) == 0) {
+                result.push_back(event);
+            }
+        }
+        return result;
+    }
+
+    void profiledFunction() {
+        EU_PROFILE_FUNCTION();
+    }
+
+}
+
+/**
+ * @brief Anidamiento, hilos, desbordamiento del buffer circular y exportación a JSON.
+ */
+void testProfiler() {
+    Profiler::clear();
+
+    // Zonas anidadas: la interior queda contenida en la exterior.
+    {
+        EU_PROFILE_ZONE("exterior");
+        {
+            EU_PROFILE_ZONE("interior");
+        }
+        profiledFunction();
+    }
+    std::vector<ProfileEvent> events = Profiler::collect();
+    std::vector<ProfileEvent> outer = eventsNamed(events, "exterior");
+    std::vector<ProfileEvent> inner = eventsNamed(events, "interior");
+    EU_CHECK(events.size() == 3);
+    EU_CHECK(outer.size() == 1 && inner.size() == 1);
+    EU_CHECK(eventsNamed(events, "profiledFunction").size() == 1);
+    EU_CHECK(outer[0].start <= inner[0].start && inner[0].end <= outer[0].end);
+    EU_CHECK(inner[0].start <= inner[0].end);
+    EU_CHECK(outer[0].threadId == inner[0].threadId);
+
+    // collect() no consume; clear() sí.
+    EU_CHECK(Profiler::collect().size() == 3);
+    Profiler::clear();
+    EU_CHECK(Profiler::collect().empty());
+
+    // Cada hilo escribe en su propio buffer.
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            EU_PROFILE_THREAD_NAME("worker");
+            for (int i = 0; i < 1000; ++i) {
+                EU_PROFILE_ZONE("trabajo");
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    events = Profiler::collect();
+    EU_CHECK(eventsNamed(events, "trabajo").size() == 4000);
+    bool sorted = true;
+    for (size_t i = 1; i < events.size(); ++i) {
+        sorted = sorted && events[i - 1].start <= events[i].start;
+    }
+    EU_CHECK(sorted);
+    EU_CHECK(Profiler::droppedEvents() == 0);
+    Profiler::clear();
+
+    // Al desbordar el buffer se conservan las zonas más recientes.
+    const uint64_t extra = 100;
+    for (uint64_t i = 0; i < Profiler::kBufferEvents + extra; ++i) {
+        Profiler::record("desborde", i, i + 1);
+    }
+    events = Profiler::collect();
+    EU_CHECK(events.size() == Profiler::kBufferEvents - 1);
+    EU_CHECK(!events.empty() && events.front().start == extra + 1);
+    EU_CHECK(Profiler::droppedEvents() == extra + 1);
+    Profiler::clear();
+    EU_CHECK(Profiler::droppedEvents() == 0);
+
+    // collect() con un hilo escribiendo: nunca devuelve zonas a medio escribir.
+    std::atomic<bool> writing{ true };
+    std::thread writer([&writing]() {
+        for (uint64_t i = 0; i < 4 * Profiler::kBufferEvents; ++i) {
+            Profiler::record("concurrente", 2 * i, 2 * i + 1);
+        }
+        writing.store(false);
+    });
+    bool consistent = true;
+    do {
+        for (const ProfileEvent& event : Profiler::collect()) {
+            consistent = consistent && event.name != nullptr && event.end == event.start + 1;
+        }
+    } while (writing.load());
+    writer.join();
+    EU_CHECK(consistent);
+    Profiler::clear();
+
+    // Exportación: un evento completo por zona y los metadatos de los hilos con nombre.
+    EU_PROFILE_THREAD_NAME("principal \"main\"");
+    {
+        EU_PROFILE_ZONE("exportada");
+    }
+    std::ostringstream trace;
+    Profiler::writeChromeTrace(trace);
+    std::string json = trace.str();
+    EU_CHECK(json.find("\"traceEvents\":[") != std::string::npos);
+    EU_CHECK(json.find("{\"name\":\"exportada\",\"ph\":\"X\",\"pid\":1,\"tid\":") != std::string::npos);
+    EU_CHECK(json.find("\"args\":{\"name\":\"principal \\\"main\\\"\"}") != std::string::npos);
+    EU_CHECK(json.find("\"dur\":") != std::string::npos);
+    EU_CHECK(Profiler::ticksPerMicrosecond() > 0.0);
+    Profiler::clear();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file testQueues.cpp
+ * @brief Pruebas de las colas sin bloqueos TSPSCQueue y TMPMCQueue.
+ * @author Hannin Abarca
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Containers/TMPMCQueue.h"
+#include "../include/Containers/TSPSCQueue.h"
+
+namespace {
+
+    using EngineUtilities::TMPMCQueue;
+    using EngineUtilities::TSPSCQueue;
+
+    /// Orden FIFO, capacidad, llena/vacía y lotes con vuelta del array; igual para las dos colas.
+    template<template<typename> class Queue>
+    void testSingleThreaded() {
+        Queue<int> small(5);
+        EU_CHECK(small.capacity() == 8);
+        EU_CHECK(Queue<int>(0).capacity() == 2);
+        EU_CHECK(Queue<int>(16).capacity() == 16);
+
+        int value = 0;
+        EU_CHECK(small.empty() && !small.tryPop(value));
+        for (int i = 0; i < 8; ++i) {
+            EU_CHECK(small.tryPush(i));
+        }
+        EU_CHECK(!small.tryPush(99));
+        EU_CHECK(small.sizeApprox() == 8);
+        for (int i = 0; i < 8; ++i) {
+            EU_CHECK(small.tryPop(value) && value == i);
+        }
+        EU_CHECK(small.empty());
+
+        // Lotes que cruzan el final del array circular.
+        int input[6] = { 10, 11, 12, 13, 14, 15 };
+        int output[8] = {};
+        for (int lap = 0; lap < 5; ++lap) {
+            EU_CHECK(small.tryPushBatch(input, 6) == 6);
+            EU_CHECK(small.tryPushBatch(input, 6) == 2);
+            EU_CHECK(small.tryPopBatch(output, 3) == 3);
+            EU_CHECK(output[0] == 10 && output[2] == 12);
+            EU_CHECK(small.tryPopBatch(output, 8) == 5);
+            EU_CHECK(output[2] == 15 && output[3] == 10 && output[4] == 11);
+            EU_CHECK(small.tryPopBatch(output, 8) == 0);
+        }
+
+        // Tipos no triviales: los elementos restantes se destruyen con la cola.
+        std::shared_ptr<int> tracked = std::make_shared<int>(7);
+        {
+            Queue<std::shared_ptr<int>> owners(4);
+            EU_CHECK(owners.tryPush(tracked) && owners.tryPush(tracked) && owners.tryPush(tracked));
+            std::shared_ptr<int> popped;
+            EU_CHECK(owners.tryPop(popped) && popped == tracked);
+            popped.reset();
+            EU_CHECK(tracked.use_count() == 3);
+        }
+        EU_CHECK(tracked.use_count() == 1);
+
+        Queue<std::string> strings(2);
+        EU_CHECK(strings.tryEmplace(40, 'x') && strings.tryPush(std::string("corta")));
+        std::string text;
+        EU_CHECK(strings.tryPop(text) && text == std::string(40, 'x'));
+        EU_CHECK(strings.tryPop(text) && text == "corta");
+    }
+
+    void testSPSCThreaded() {
+        // El consumidor debe ver todos los valores en orden, con y sin lotes.
+        const int count = 500000;
+        TSPSCQueue<int> queue(64);
+        std::thread producer([&]() {
+            int batch[16];
+            int next = 0;
+            while (next < count) {
+                if (next % 3 == 0) {
+                    int n = 0;
+                    while (n < 16 && next + n < count) {
+                        batch[n] = next + n;
+                        ++n;
+                    }
+                    next += static_cast<int>(queue.tryPushBatch(batch, n));
+                }
+                else if (queue.tryPush(next)) {
+                    ++next;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        bool ordered = true;
+        int expected = 0;
+        int batch[8];
+        while (expected < count) {
+            size_t n = queue.tryPopBatch(batch, expected % 2 == 0 ? 8 : 1);
+            for (size_t i = 0; i < n; ++i) {
+                ordered = ordered && batch[i] == expected;
+                ++expected;
+            }
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        EU_CHECK(ordered);
+        EU_CHECK(queue.empty());
+    }
+
+    void testMPMCThreaded(bool batched) {
+        // Cuatro productores y cuatro consumidores: cada valor se extrae exactamente una vez y
+        // los de un mismo productor salen en orden.
+        const int producers = 4;
+        const int perProducer = 50000;
+        const int total = producers * perProducer;
+        TMPMCQueue<int> queue(128);
+        std::vector<std::atomic<int>> seen(total);
+        std::atomic<int> consumed{ 0 };
+        std::atomic<bool> ordered{ true };
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p]() {
+                int batch[8];
+                int next = 0;
+                while (next < perProducer) {
+                    size_t pushed = 0;
+                    if (batched) {
+                        int n = 0;
+                        while (n < 8 && next + n < perProducer) {
+                            batch[n] = p * perProducer + next + n;
+                            ++n;
+                        }
+                        pushed = queue.tryPushBatch(batch, n);
+                    }
+                    else {
+                        pushed = queue.tryPush(p * perProducer + next) ? 1 : 0;
+                    }
+                    next += static_cast<int>(pushed);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int c = 0; c < 4; ++c) {
+            threads.emplace_back([&]() {
+                int last[producers] = { -1, -1, -1, -1 };
+                int batch[8];
+                while (consumed.load() < total) {
+                    size_t n = batched ? queue.tryPopBatch(batch, 8) : (queue.tryPop(batch[0]) ? 1 : 0);
+                    for (size_t i = 0; i < n; ++i) {
+                        int value = batch[i];
+                        seen[value].fetch_add(1);
+                        if (value <= last[value / perProducer]) {
+                            ordered.store(false);
+                        }
+                        last[value / perProducer] = value;
+                    }
+                    consumed.fetch_add(static_cast<int>(n));
+                    if (n == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        bool exactlyOnce = true;
+        for (std::atomic<int>& value : seen) {
+            exactlyOnce = exactlyOnce && value.load() == 1;
+        }
+        EU_CHECK(exactlyOnce);
+        EU_CHECK(ordered.load());
+        EU_CHECK(queue.empty());
+    }
+
+}
+
+/**
+ * @brief Pruebas de TSPSCQueue y TMPMCQueue.
+ */
+void testQueues() {
+    testSingleThreaded<TSPSCQueue>();
+    testSingleThreaded<TMPMCQueue>();
+    testSPSCThreaded();
+    testMPMCThreaded(false);
+    testMPMCThreaded(true);
+}
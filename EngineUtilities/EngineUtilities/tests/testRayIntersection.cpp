@@ -0,0 +1,303 @@
+/**
+ * @file testRayIntersection.cpp
+ * @brief Pruebas de las intersecciones de rayos y segmentos, escalares y por paquetes.
+ * @author Hannin Abarca
+ */
+
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/RayIntersection.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CBoundingSphere;
+    using EngineUtilities::CRayArray;
+    using EngineUtilities::CTriangleHit;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::CVector4;
+    using EngineUtilities::CWatertightRay;
+    using EngineUtilities::TRayPacket;
+
+    CVector3 inverseOf(const CVector3& direction) {
+        return CVector3(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+    }
+
+    /// Rayos aleatorios hacia la zona [-4, 4]^3, algunos con componentes de dirección a 0 o -0.
+    CRayArray randomRays(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-6.0f, 6.0f);
+        std::uniform_real_distribution<float> target(-4.0f, 4.0f);
+        CRayArray rays;
+        for (size_t i = 0; i < count; ++i) {
+            CVector3 origin(position(rng), position(rng), position(rng));
+            CVector3 direction = CVector3(target(rng), target(rng), target(rng)) - origin;
+            if (i % 7 == 0) {
+                direction[static_cast<int>(i % 3)] = (i % 2 == 0) ? 0.0f : -0.0f;
+            }
+            rays.push(origin, direction, i % 5 == 0 ? 0.5f : INFINITY);
+        }
+        return rays;
+    }
+
+    /// Malla plana (z = 0) de n x n celdas con los vértices desplazados al azar, dos triángulos por celda.
+    std::vector<CVector3> jitteredGrid(int n, unsigned seed, std::vector<CVector3>& points) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+        points.resize(static_cast<size_t>((n + 1) * (n + 1)));
+        for (int j = 0; j <= n; ++j) {
+            for (int i = 0; i <= n; ++i) {
+                points[j * (n + 1) + i] = CVector3(i + jitter(rng), j + jitter(rng), 0.0f);
+            }
+        }
+        std::vector<CVector3> vertices;
+        for (int j = 0; j < n; ++j) {
+            for (int i = 0; i < n; ++i) {
+                const CVector3& a = points[j * (n + 1) + i];
+                const CVector3& b = points[j * (n + 1) + i + 1];
+                const CVector3& c = points[(j + 1) * (n + 1) + i];
+                const CVector3& d = points[(j + 1) * (n + 1) + i + 1];
+                vertices.insert(vertices.end(), { a, b, d, a, d, c });
+            }
+        }
+        return vertices;
+    }
+
+    void testAABB() {
+        CAABB box(CVector3(-1.0f, -1.0f, -1.0f), CVector3(1.0f, 2.0f, 3.0f));
+        float tEnter = 0.0f, tExit = 0.0f;
+        CVector3 direction(1.0f, 0.0f, 0.0f);
+        EU_CHECK(EngineUtilities::intersectRayAABB(CVector3(-5.0f, 0.0f, 0.0f), inverseOf(direction), box, INFINITY, tEnter, tExit));
+        EU_CHECK_NEAR(tEnter, 4.0f, 1e-6f);
+        EU_CHECK(!EngineUtilities::intersectRayAABB(CVector3(-5.0f, 0.0f, 0.0f), inverseOf(direction), box, 3.9f, tEnter, tExit));
+        EU_CHECK(EngineUtilities::intersectRayAABB(CVector3(0.0f, 0.0f, 0.0f), inverseOf(CVector3(0.3f, -0.2f, 0.1f)), box,
+            INFINITY, tEnter, tExit) && tEnter == 0.0f);
+
+        // Rayos que recorren una cara (dirección 0 o -0 en su eje) tocan la caja; un ulp fuera, no.
+        int wrong = 0;
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int side = 0; side < 2; ++side) {
+                for (int sign = 0; sign < 2; ++sign) {
+                    CVector3 onFace(-0.5f, 0.5f, 1.0f);
+                    onFace[axis] = side == 0 ? box.min[axis] : box.max[axis];
+                    CVector3 outside = onFace;
+                    outside[axis] = side == 0 ? std::nextafter(box.min[axis], -INFINITY) : std::nextafter(box.max[axis], INFINITY);
+                    CVector3 dir(0.6f, -0.7f, 0.4f);
+                    dir[axis] = sign == 0 ? 0.0f : -0.0f;
+                    // dir[axis] es 0: el origen sigue en el plano de la cara.
+                    CVector3 start = onFace - dir * 20.0f;
+                    CVector3 startOutside = outside - dir * 20.0f;
+                    wrong += EngineUtilities::intersectRayAABB(start, inverseOf(dir), box, INFINITY, tEnter, tExit) ? 0 : 1;
+                    wrong += EngineUtilities::intersectRayAABB(startOutside, inverseOf(dir), box, INFINITY, tEnter, tExit) ? 1 : 0;
+                }
+            }
+        }
+        EU_CHECK(wrong == 0);
+
+        // Paquetes: mismos impactos y entradas que la versión escalar.
+        CRayArray rays = randomRays(1003, 3);
+        int mismatches = 0;
+        EngineUtilities::simdForEach(0, rays.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            TRayPacket<Pack> packet(rays, i);
+            Pack t;
+            int bits = EngineUtilities::intersectRayAABB(packet, box, t);
+            float lanes[Pack::kWidth];
+            t.store(lanes);
+            for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                CVector3 origin, dir;
+                float maxT = 0.0f;
+                rays.get(i + lane, origin, dir, maxT);
+                float scalarT = 0.0f;
+                bool hit = EngineUtilities::intersectRayAABB(origin, inverseOf(dir), box, maxT, scalarT, tExit);
+                mismatches += (hit != ((bits >> lane & 1) != 0) || (hit && scalarT != lanes[lane])) ? 1 : 0;
+            }
+        });
+        EU_CHECK(mismatches == 0);
+    }
+
+    void testSphereAndPlane() {
+        CBoundingSphere sphere(CVector3(0.0f, 0.0f, 10.0f), 2.0f);
+        float t = 0.0f;
+        EU_CHECK(EngineUtilities::intersectRaySphere(CVector3(0.0f, 0.0f, 0.0f), CVector3(0.0f, 0.0f, 2.0f), sphere, INFINITY, t));
+        EU_CHECK_NEAR(t, 4.0f, 1e-5f);
+        // Desde dentro: la salida.
+        EU_CHECK(EngineUtilities::intersectRaySphere(CVector3(0.0f, 0.0f, 10.0f), CVector3(1.0f, 0.0f, 0.0f), sphere, INFINITY, t) &&
+            std::fabs(t - 2.0f) < 1e-5f);
+        EU_CHECK(!EngineUtilities::intersectRaySphere(CVector3(0.0f, 0.0f, 20.0f), CVector3(0.0f, 0.0f, 1.0f), sphere, INFINITY, t));
+
+        // Casi tangente desde muy lejos: el punto más cercano al centro mantiene la precisión.
+        int wrong = 0;
+        CBoundingSphere small(CVector3(3.0f, -2.0f, 1.0f), 0.01f);
+        for (int i = 0; i < 64; ++i) {
+            float angle = 0.1f * i;
+            CVector3 side(std::cos(angle), std::sin(angle), 0.0f);
+            CVector3 origin = small.center + CVector3(0.0f, 0.0f, -20000.0f);
+            CVector3 inside = origin + side * (0.999f * small.radius);
+            CVector3 outside = origin + side * (1.001f * small.radius);
+            // t exacto en double; a 20000 unidades un float solo distingue unos 0.002.
+            double dx = static_cast<double>(inside.x) - small.center.x;
+            double dy = static_cast<double>(inside.y) - small.center.y;
+            double expected = (static_cast<double>(small.center.z) - inside.z) -
+                std::sqrt(static_cast<double>(small.radius) * small.radius - dx * dx - dy * dy);
+            float hitT = 0.0f;
+            if (!EngineUtilities::intersectRaySphere(inside, CVector3(0.0f, 0.0f, 1.0f), small, INFINITY, hitT) ||
+                std::fabs(hitT - expected) > 0.01) {
+                ++wrong;
+            }
+            wrong += EngineUtilities::intersectRaySphere(outside, CVector3(0.0f, 0.0f, 1.0f), small, INFINITY, hitT) ? 1 : 0;
+        }
+        EU_CHECK(wrong == 0);
+
+        CVector4 plane(0.0f, 1.0f, 0.0f, -3.0f); // y = 3
+        EU_CHECK(EngineUtilities::intersectRayPlane(CVector3(1.0f, 0.0f, 0.0f), CVector3(0.0f, 2.0f, 0.0f), plane, INFINITY, t) &&
+            t == 1.5f);
+        EU_CHECK(!EngineUtilities::intersectRayPlane(CVector3(1.0f, 3.0f, 0.0f), CVector3(1.0f, 0.0f, 0.0f), plane, INFINITY, t));
+
+        CRayArray rays = randomRays(1001, 5);
+        CBoundingSphere centered(CVector3(0.5f, -0.5f, 0.25f), 2.5f);
+        CVector4 tilted(0.6f, 0.0f, 0.8f, -0.5f);
+        int mismatches = 0;
+        EngineUtilities::simdForEach(0, rays.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            TRayPacket<Pack> packet(rays, i);
+            Pack sphereT, planeT;
+            int sphereBits = EngineUtilities::intersectRaySphere(packet, centered, sphereT);
+            int planeBits = EngineUtilities::intersectRayPlane(packet, tilted, planeT);
+            float sphereLanes[Pack::kWidth], planeLanes[Pack::kWidth];
+            sphereT.store(sphereLanes);
+            planeT.store(planeLanes);
+            for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                CVector3 origin, dir;
+                float maxT = 0.0f, scalarT = 0.0f;
+                rays.get(i + lane, origin, dir, maxT);
+                bool hit = EngineUtilities::intersectRaySphere(origin, dir, centered, maxT, scalarT);
+                mismatches += (hit != ((sphereBits >> lane & 1) != 0) || (hit && std::fabs(scalarT - sphereLanes[lane]) > 1e-5f)) ? 1 : 0;
+                hit = EngineUtilities::intersectRayPlane(origin, dir, tilted, maxT, scalarT);
+                mismatches += (hit != ((planeBits >> lane & 1) != 0) || (hit && std::fabs(scalarT - planeLanes[lane]) > 1e-5f)) ? 1 : 0;
+            }
+        });
+        EU_CHECK(mismatches == 0);
+    }
+
+    void testTriangles() {
+        CVector3 v0(0.0f, 0.0f, 0.0f), v1(2.0f, 0.0f, 0.0f), v2(0.0f, 2.0f, 0.0f);
+        float t = 0.0f, u = 0.0f, v = 0.0f;
+        EU_CHECK(EngineUtilities::intersectRayTriangle(CVector3(0.5f, 0.5f, 3.0f), CVector3(0.0f, 0.0f, -1.0f), v0, v1, v2, INFINITY, t, u, v));
+        EU_CHECK(std::fabs(t - 3.0f) < 1e-6f && std::fabs(u - 0.25f) < 1e-6f && std::fabs(v - 0.25f) < 1e-6f);
+        EU_CHECK(EngineUtilities::intersectRayTriangleWatertight(CVector3(0.5f, 0.5f, -3.0f), CVector3(0.0f, 0.0f, 1.0f), v0, v1, v2, INFINITY, t, u, v));
+        EU_CHECK(std::fabs(t - 3.0f) < 1e-6f && std::fabs(u - 0.25f) < 1e-6f && std::fabs(v - 0.25f) < 1e-6f);
+        // Segmentos: el extremo sobre el triángulo cuenta; uno que se queda corto, no.
+        EU_CHECK(EngineUtilities::intersectSegmentTriangle(CVector3(0.5f, 0.5f, 1.0f), CVector3(0.5f, 0.5f, 0.0f), v0, v1, v2, t, u, v) &&
+            t == 1.0f);
+        EU_CHECK(!EngineUtilities::intersectSegmentTriangle(CVector3(0.5f, 0.5f, 1.0f), CVector3(0.5f, 0.5f, 0.001f), v0, v1, v2, t, u, v));
+        float tBox = 0.0f;
+        CAABB box(CVector3(-1.0f, -1.0f, -1.0f), CVector3(1.0f, 1.0f, 1.0f));
+        EU_CHECK(EngineUtilities::intersectSegmentAABB(CVector3(-3.0f, 0.0f, 0.0f), CVector3(1.0f, 0.0f, 0.0f), box, tBox) && tBox == 0.5f);
+        EU_CHECK(!EngineUtilities::intersectSegmentAABB(CVector3(-3.0f, 0.0f, 0.0f), CVector3(-1.5f, 0.0f, 0.0f), box, tBox));
+
+        // Rayos aleatorios: las dos pruebas y sus paquetes coinciden.
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> corner(-3.0f, 3.0f);
+        std::vector<CVector3> triangles;
+        for (int i = 0; i < 24; ++i) {
+            triangles.push_back(CVector3(corner(rng), corner(rng), corner(rng)));
+        }
+        CRayArray rays = randomRays(997, 13);
+        int mismatches = 0;
+        int hits = 0;
+        EngineUtilities::simdForEach(0, rays.size(), [&](auto pack, size_t i) {
+            using Pack = decltype(pack);
+            TRayPacket<Pack> packet(rays, i);
+            for (size_t k = 0; k < triangles.size(); k += 3) {
+                Pack mtT, mtU, mtV, wtT, wtU, wtV;
+                int mtBits = EngineUtilities::intersectRayTriangle(packet, triangles[k], triangles[k + 1], triangles[k + 2], mtT, mtU, mtV);
+                int wtBits = EngineUtilities::intersectRayTriangleWatertight(packet, triangles[k], triangles[k + 1], triangles[k + 2], wtT, wtU, wtV);
+                float lanesT[Pack::kWidth], lanesU[Pack::kWidth], lanesV[Pack::kWidth];
+                wtT.store(lanesT);
+                wtU.store(lanesU);
+                wtV.store(lanesV);
+                for (int lane = 0; lane < Pack::kWidth; ++lane) {
+                    CVector3 origin, dir;
+                    float maxT = 0.0f;
+                    rays.get(i + lane, origin, dir, maxT);
+                    float mt[3] = {}, wt[3] = {};
+                    bool mtHit = EngineUtilities::intersectRayTriangle(origin, dir, triangles[k], triangles[k + 1], triangles[k + 2], maxT, mt[0], mt[1], mt[2]);
+                    bool wtHit = EngineUtilities::intersectRayTriangleWatertight(origin, dir, triangles[k], triangles[k + 1], triangles[k + 2], maxT, wt[0], wt[1], wt[2]);
+                    hits += wtHit ? 1 : 0;
+                    mismatches += (mtHit != wtHit || mtHit != ((mtBits >> lane & 1) != 0) || wtHit != ((wtBits >> lane & 1) != 0)) ? 1 : 0;
+                    if (wtHit && (std::fabs(mt[0] - wt[0]) > 1e-4f * (1.0f + wt[0]) || std::fabs(mt[1] - wt[1]) > 1e-4f ||
+                        std::fabs(mt[2] - wt[2]) > 1e-4f || std::fabs(lanesT[lane] - wt[0]) > 1e-4f * (1.0f + wt[0]) ||
+                        std::fabs(lanesU[lane] - wt[1]) > 1e-4f || std::fabs(lanesV[lane] - wt[2]) > 1e-4f)) {
+                        ++mismatches;
+                    }
+                }
+            }
+        });
+        EU_CHECK(hits > 100);
+        EU_CHECK(mismatches == 0);
+    }
+
+    /// Rayos casi paralelos a una malla plana que apuntan a sus vértices y aristas interiores.
+    void testGrazingWatertight() {
+        const int n = 12;
+        std::vector<CVector3> points;
+        std::vector<CVector3> vertices = jitteredGrid(n, 21, points);
+        size_t triangleCount = vertices.size() / 3;
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<float> azimuth(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> elevation(1e-4f, 1e-2f);
+        std::uniform_real_distribution<float> along(0.0f, 1.0f);
+        std::uniform_int_distribution<int> interior(2, n - 2);
+        CRayArray rays;
+        for (int i = 0; i < 3000; ++i) {
+            int x = interior(rng), y = interior(rng);
+            CVector3 target = points[y * (n + 1) + x];
+            if (i % 3 != 0) {
+                // Punto de una arista: horizontal, vertical o diagonal de la celda.
+                int kind = i % 3 == 1 ? 1 : (n + 2);
+                target = CVector3::lerp(target, points[y * (n + 1) + x + kind], along(rng));
+                target.z = 0.0f;
+            }
+            float a = azimuth(rng), e = elevation(rng);
+            CVector3 direction(std::cos(e) * std::cos(a), std::cos(e) * std::sin(a), -std::sin(e));
+            rays.push(target - direction * 5.0f, direction);
+        }
+        int leaks = 0;
+        for (size_t r = 0; r < rays.size(); ++r) {
+            CVector3 origin, direction;
+            float maxT = 0.0f;
+            rays.get(r, origin, direction, maxT);
+            CWatertightRay ray(origin, direction);
+            bool hit = false;
+            for (size_t k = 0; k < triangleCount && !hit; ++k) {
+                float t, u, v;
+                hit = EngineUtilities::intersectRayTriangleWatertight(ray, vertices[3 * k], vertices[3 * k + 1], vertices[3 * k + 2], maxT, t, u, v);
+            }
+            leaks += hit ? 0 : 1;
+        }
+        EU_CHECK(leaks == 0);
+
+        // Trazado por paquetes: ningún rayo se cuela y el impacto más cercano es el del escalar.
+        std::vector<CTriangleHit> hits(rays.size());
+        size_t found = EngineUtilities::intersectTrianglesBatch(rays, vertices.data(), triangleCount, hits.data());
+        EU_CHECK(found == rays.size());
+        int wrongT = 0;
+        for (size_t r = 0; r < rays.size(); ++r) {
+            // El blanco está a t = 5 (salvo el redondeo del origen).
+            wrongT += std::fabs(hits[r].t - 5.0f) < 0.05f ? 0 : 1;
+        }
+        EU_CHECK(wrongT == 0);
+    }
+
+}
+
+void testRayIntersection() {
+    testAABB();
+    testSphereAndPlane();
+    testTriangles();
+    testGrazingWatertight();
+}
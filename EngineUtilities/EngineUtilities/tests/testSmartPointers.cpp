@@ -0,0 +1,188 @@
+/**
+ * @file testSmartPointers.cpp
+ * @brief Pruebas de TSharedPointer, TWeakPointer, TUniquePtr y TStaticPtr.
+ * @author Hannin Abarca
+ */
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Memory/TSharedPointer.h"
+#include "../include/Memory/TStaticPtr.h"
+#include "../include/Memory/TUniquePtr.h"
+#include "../include/Memory/TWeakPointer.h"
+
+namespace {
+
+    using EngineUtilities::TSharedPointer;
+    using EngineUtilities::TStaticPtr;
+    using EngineUtilities::TUniquePtr;
+    using EngineUtilities::TWeakPointer;
+
+    /// Cuenta los objetos vivos para detectar fugas y dobles liberaciones.
+    struct Tracked {
+        static int alive;
+        int value;
+        explicit Tracked(int v = 0) : value(v) { ++alive; }
+        virtual ~Tracked() { --alive; }
+    };
+    int Tracked::alive = 0;
+
+    struct DerivedTracked : Tracked {
+        explicit DerivedTracked(int v) : Tracked(v) {}
+    };
+
+    /// Servicio para TStaticPtr; cuenta cuántas veces se construye.
+    struct CountedService {
+        static std::atomic<int> constructions;
+        CountedService() { constructions.fetch_add(1); }
+    };
+    std::atomic<int> CountedService::constructions{ 0 };
+
+    /// Orden en que se destruyen los servicios de testStaticShutdownOrder().
+    std::vector<int> destroyedServices;
+
+    /// Servicio que anota su destrucción; Id distingue los tipos.
+    template<int Id>
+    struct OrderedService {
+        ~OrderedService() {
+            destroyedServices.push_back(Id);
+        }
+    };
+
+    using FirstService = OrderedService<1>;
+    using SecondService = OrderedService<2>;
+    using ThirdService = OrderedService<3>;
+
+    /// Depende de SecondService: al destruirse comprueba que aún existe.
+    struct DependentService {
+        ~DependentService() {
+            dependencyAlive = !TStaticPtr<SecondService>::isNull();
+            destroyedServices.push_back(4);
+        }
+        static bool dependencyAlive;
+    };
+    bool DependentService::dependencyAlive = false;
+
+    void testShared() {
+        {
+            TSharedPointer<Tracked> a = EngineUtilities::MakeShared<Tracked>(5);
+            EU_CHECK(a->value == 5);
+            EU_CHECK(*a.refCount == 1);
+            {
+                TSharedPointer<Tracked> b = a;
+                EU_CHECK(*a.refCount == 2);
+                TSharedPointer<Tracked> c(std::move(b));
+                EU_CHECK(b.isNull());
+                EU_CHECK(*a.refCount == 2);
+            }
+            EU_CHECK(*a.refCount == 1);
+
+            TSharedPointer<Tracked> other(new Tracked(9));
+            a = other;
+            EU_CHECK(Tracked::alive == 1);
+            EU_CHECK(a.get() == other.get());
+
+            a.reset();
+            EU_CHECK(a.isNull());
+            EU_CHECK(*other.refCount == 1);
+        }
+        EU_CHECK(Tracked::alive == 0);
+
+        {
+            TSharedPointer<Tracked> base(new DerivedTracked(3));
+            TSharedPointer<DerivedTracked> derived = base.dynamic_pointer_cast<DerivedTracked>();
+            EU_CHECK(!derived.isNull());
+            EU_CHECK(*base.refCount == 2);
+            TSharedPointer<Tracked> plain(new Tracked(1));
+            EU_CHECK(plain.dynamic_pointer_cast<DerivedTracked>().isNull());
+        }
+        EU_CHECK(Tracked::alive == 0);
+    }
+
+    void testWeak() {
+        TSharedPointer<Tracked> shared = EngineUtilities::MakeShared<Tracked>(4);
+        TWeakPointer<Tracked> weak(shared);
+        TSharedPointer<Tracked> locked = weak.lock();
+        EU_CHECK(locked.get() == shared.get());
+        EU_CHECK(*shared.refCount == 2);
+    }
+
+    void testUnique() {
+        {
+            TUniquePtr<Tracked> a = EngineUtilities::MakeUnique<Tracked>(7);
+            TUniquePtr<Tracked> b(std::move(a));
+            EU_CHECK(a.isNull());
+            EU_CHECK(b->value == 7);
+
+            Tracked* raw = b.release();
+            EU_CHECK(b.isNull());
+            EU_CHECK(Tracked::alive == 1);
+            b.reset(raw);
+
+            TUniquePtr<Tracked> derived(new DerivedTracked(2));
+            b = std::move(derived);
+            EU_CHECK(Tracked::alive == 1);
+            EU_CHECK(b->value == 2);
+        }
+        EU_CHECK(Tracked::alive == 0);
+    }
+
+    void testStatic() {
+        CountedService::constructions = 0;
+        std::vector<std::thread> threads;
+        std::atomic<CountedService*> seen[8];
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&seen, t]() { seen[t] = TStaticPtr<CountedService>::getOrCreate(); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        EU_CHECK(CountedService::constructions == 1);
+        for (int t = 1; t < 8; ++t) {
+            EU_CHECK(seen[t].load() == seen[0].load());
+        }
+
+        TStaticPtr<CountedService>::shutdown();
+        EU_CHECK(TStaticPtr<CountedService>::isNull());
+    }
+
+    /// shutdownAll() destruye los servicios en orden inverso al de creación (LIFO).
+    void testStaticShutdownOrder() {
+        destroyedServices.clear();
+        TStaticPtr<FirstService>::getOrCreate();
+        TStaticPtr<SecondService>::getOrCreate();
+        TStaticPtr<DependentService>::getOrCreate();
+        TStaticPtr<ThirdService>::getOrCreate();
+        // Pedirlo otra vez no cambia su posición en el orden.
+        TStaticPtr<FirstService>::getOrCreate();
+
+        EngineUtilities::StaticPtrRegistry::shutdownAll();
+        EU_CHECK(destroyedServices.size() == 4);
+        EU_CHECK(destroyedServices == std::vector<int>({ 3, 4, 2, 1 }));
+        EU_CHECK(DependentService::dependencyAlive);
+        EU_CHECK(TStaticPtr<FirstService>::isNull() && TStaticPtr<SecondService>::isNull() &&
+            TStaticPtr<DependentService>::isNull() && TStaticPtr<ThirdService>::isNull());
+
+        // Tras el apagado, volver a crear un servicio lo registra de nuevo.
+        destroyedServices.clear();
+        TStaticPtr<SecondService>::getOrCreate();
+        TStaticPtr<FirstService>::getOrCreate();
+        EngineUtilities::StaticPtrRegistry::shutdownAll();
+        EU_CHECK(destroyedServices == std::vector<int>({ 1, 2 }));
+    }
+
+}
+
+/**
+ * @brief Propiedad, recuentos y liberación de los punteros inteligentes.
+ */
+void testSmartPointers() {
+    testShared();
+    testWeak();
+    testUnique();
+    testStatic();
+    testStaticShutdownOrder();
+}
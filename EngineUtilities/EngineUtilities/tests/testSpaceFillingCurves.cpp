@@ -0,0 +1,252 @@
+/**
+ * @file testSpaceFillingCurves.cpp
+ * @brief Pruebas de los códigos de Morton y Hilbert y de CRadixSorter.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/SpaceFillingCurves.h"
+#include "../include/Utilities/CRadixSorter.h"
+
+namespace {
+
+    using EngineUtilities::CAABB;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CRadixSorter;
+    using EngineUtilities::CSpatialQuantizer;
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+
+    void testMorton() {
+        // Valores conocidos: x en el bit bajo de cada grupo.
+        EU_CHECK(EngineUtilities::mortonEncode3(1, 0, 0) == 1 && EngineUtilities::mortonEncode3(0, 1, 0) == 2 &&
+            EngineUtilities::mortonEncode3(0, 0, 1) == 4 && EngineUtilities::mortonEncode3(3, 0, 0) == 9);
+        EU_CHECK(EngineUtilities::mortonEncode2(1, 0) == 1 && EngineUtilities::mortonEncode2(0, 1) == 2 &&
+            EngineUtilities::mortonEncode2(3, 3) == 15);
+        EU_CHECK(EngineUtilities::mortonEncode3(0x1FFFFF, 0x1FFFFF, 0x1FFFFF) == 0x7FFFFFFFFFFFFFFFull);
+        EU_CHECK(EngineUtilities::mortonEncode2(0xFFFFFFFFu, 0xFFFFFFFFu) == 0xFFFFFFFFFFFFFFFFull);
+
+        // Ida y vuelta, y la ruta con BMI2 (si está compilada) igual que la portable.
+        std::mt19937 rng(60);
+        bool roundTrip = true;
+        bool samePaths = true;
+        for (int i = 0; i < 10000; ++i) {
+            uint32_t x = rng(), y = rng(), z = rng() & 0x1FFFFF;
+            uint32_t dx, dy, dz;
+            uint64_t code2 = EngineUtilities::mortonEncode2(x, y);
+            EngineUtilities::mortonDecode2(code2, dx, dy);
+            roundTrip = roundTrip && dx == x && dy == y;
+            samePaths = samePaths && code2 == EngineUtilities::mortonEncode2Portable(x, y);
+            EngineUtilities::mortonDecode2Portable(code2, dx, dy);
+            samePaths = samePaths && dx == x && dy == y;
+
+            x &= 0x1FFFFF;
+            y &= 0x1FFFFF;
+            uint64_t code3 = EngineUtilities::mortonEncode3(x, y, z);
+            EngineUtilities::mortonDecode3(code3, dx, dy, dz);
+            roundTrip = roundTrip && dx == x && dy == y && dz == z && code3 < (1ull << 63);
+            samePaths = samePaths && code3 == EngineUtilities::mortonEncode3Portable(x, y, z);
+            EngineUtilities::mortonDecode3Portable(code3, dx, dy, dz);
+            samePaths = samePaths && dx == x && dy == y && dz == z;
+        }
+        EU_CHECK(roundTrip);
+        EU_CHECK(samePaths);
+    }
+
+    void testHilbert() {
+        // Rejilla de 2^bits completa alrededor del origen y de la esquina lejana: el índice es
+        // una biyección y dos índices consecutivos son celdas vecinas (distancia Manhattan 1).
+        const uint32_t side = 16;
+        std::vector<uint64_t> codes;
+        bool roundTrip = true;
+        for (uint32_t y = 0; y < side; ++y) {
+            for (uint32_t x = 0; x < side; ++x) {
+                uint64_t code = EngineUtilities::hilbertEncode2(x, y);
+                uint32_t dx, dy;
+                EngineUtilities::hilbertDecode2(code, dx, dy);
+                roundTrip = roundTrip && dx == x && dy == y;
+            }
+        }
+        EU_CHECK(roundTrip);
+        bool adjacent2 = true;
+        uint32_t px = 0, py = 0;
+        EngineUtilities::hilbertDecode2(0, px, py);
+        EU_CHECK(px == 0 && py == 0);
+        for (uint64_t code = 1; code < 4096; ++code) {
+            uint32_t x, y;
+            EngineUtilities::hilbertDecode2(code, x, y);
+            uint32_t manhattan = (x > px ? x - px : px - x) + (y > py ? y - py : py - y);
+            adjacent2 = adjacent2 && manhattan == 1;
+            px = x;
+            py = y;
+        }
+        EU_CHECK(adjacent2);
+
+        bool adjacent3 = true;
+        bool roundTrip3 = true;
+        uint32_t pz = 0;
+        EngineUtilities::hilbertDecode3(0, px, py, pz);
+        EU_CHECK(px == 0 && py == 0 && pz == 0);
+        for (uint64_t code = 1; code < 32768; ++code) {
+            uint32_t x, y, z;
+            EngineUtilities::hilbertDecode3(code, x, y, z);
+            roundTrip3 = roundTrip3 && EngineUtilities::hilbertEncode3(x, y, z) == code;
+            uint32_t manhattan = (x > px ? x - px : px - x) + (y > py ? y - py : py - y) + (z > pz ? z - pz : pz - z);
+            adjacent3 = adjacent3 && manhattan == 1;
+            px = x;
+            py = y;
+            pz = z;
+        }
+        EU_CHECK(adjacent3);
+        EU_CHECK(roundTrip3);
+
+        // Celdas al azar en toda la rejilla.
+        std::mt19937 rng(61);
+        bool randomTrip = true;
+        for (int i = 0; i < 10000; ++i) {
+            uint32_t x = rng() & 0x1FFFFF, y = rng() & 0x1FFFFF, z = rng() & 0x1FFFFF;
+            uint32_t dx, dy, dz;
+            EngineUtilities::hilbertDecode3(EngineUtilities::hilbertEncode3(x, y, z), dx, dy, dz);
+            randomTrip = randomTrip && dx == x && dy == y && dz == z;
+            x = rng();
+            y = rng();
+            EngineUtilities::hilbertDecode2(EngineUtilities::hilbertEncode2(x, y), dx, dy);
+            randomTrip = randomTrip && dx == x && dy == y;
+        }
+        EU_CHECK(randomTrip);
+    }
+
+    void testQuantizer() {
+        CAABB bounds(CVector3(-10.0f, 0.0f, 5.0f), CVector3(10.0f, 4.0f, 5.0f));
+        CSpatialQuantizer quantizer(bounds);
+        uint32_t x, y, z;
+        quantizer.cell(CVector3(-10.0f, 0.0f, 5.0f), x, y, z);
+        EU_CHECK(x == 0 && y == 0 && z == 0);
+        // El máximo y lo que queda fuera van a la última celda; la z sin extensión, a la 0.
+        quantizer.cell(CVector3(10.0f, 100.0f, 7.0f), x, y, z);
+        EU_CHECK(x == 0x1FFFFF && y == 0x1FFFFF && z == 0);
+        quantizer.cell(CVector3(-50.0f, 2.0f, NAN), x, y, z);
+        EU_CHECK(x == 0 && y == 0x100000 && z == 0);
+        CVector3 center = quantizer.cellCenter(x, y, z);
+        EU_CHECK_NEAR(center.y, 2.0, 1e-5);
+
+        CSpatialQuantizer plane(CVector2(0.0f, 0.0f), CVector2(1.0f, 1.0f));
+        plane.cell(CVector2(0.5f, 0.25f), x, y);
+        EU_CHECK(x == 0x80000000u && y == 0x40000000u);
+
+        // Lote igual que uno a uno, en serie y en paralelo.
+        std::mt19937 rng(62);
+        std::uniform_real_distribution<float> position(-12.0f, 12.0f);
+        std::vector<CVector3> points(40000);
+        for (CVector3& point : points) {
+            point = CVector3(position(rng), position(rng) * 0.2f, position(rng));
+        }
+        CAABB cloud = CAABB::fromPoints(points.data(), points.size());
+        std::vector<uint64_t> morton(points.size());
+        std::vector<uint64_t> hilbert(points.size());
+        CJobSystem jobs(2);
+        EngineUtilities::parallelMortonCodes(jobs, points.data(), points.size(), cloud, morton.data());
+        EngineUtilities::hilbertCodes(points.data(), points.size(), cloud, hilbert.data());
+        bool sameBatch = true;
+        for (size_t i = 0; i < points.size(); ++i) {
+            sameBatch = sameBatch && morton[i] == EngineUtilities::mortonCode(points[i], cloud) &&
+                hilbert[i] == EngineUtilities::hilbertCode(points[i], cloud);
+        }
+        EU_CHECK(sameBatch);
+    }
+
+    /// Comprueba que el orden de radix es el de std::stable_sort por los keyBits bits bajos.
+    bool sortsLikeStableSort(size_t count, int keyBits, CJobSystem* jobs, unsigned seed) {
+        std::mt19937_64 rng(seed);
+        std::vector<uint64_t> keys(count);
+        for (size_t i = 0; i < count; ++i) {
+            // Muchas claves repetidas para comprobar la estabilidad.
+            keys[i] = i % 3 == 0 ? rng() % 64 : rng();
+        }
+        std::vector<uint32_t> values(count);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<uint32_t>(i);
+        }
+        const uint64_t mask = keyBits >= 64 ? ~0ull : (1ull << keyBits) - 1;
+        std::vector<uint32_t> expected = values;
+        std::stable_sort(expected.begin(), expected.end(), [&](uint32_t a, uint32_t b) {
+            return (keys[a] & mask) < (keys[b] & mask);
+        });
+        std::vector<uint64_t> original = keys;
+        CRadixSorter sorter;
+        sorter.sort(keys, values, keyBits, jobs);
+        bool same = values == expected;
+        for (size_t i = 0; i < count && same; ++i) {
+            same = keys[i] == original[expected[i]];
+        }
+        return same;
+    }
+
+    void testRadixSort() {
+        EU_CHECK(sortsLikeStableSort(1000, 64, nullptr, 63));
+        EU_CHECK(sortsLikeStableSort(1000, 20, nullptr, 64));
+        CJobSystem jobs(3);
+        EU_CHECK(sortsLikeStableSort(300000, 64, &jobs, 65));
+        EU_CHECK(sortsLikeStableSort(300000, 37, &jobs, 66));
+        // Sin hilos en el pool el sistema de trabajos no aporta nada: toma el camino serie.
+        CJobSystem noWorkers(0);
+        EU_CHECK(sortsLikeStableSort(300000, 64, &noWorkers, 67));
+
+        // Solo claves, claves ya ordenadas y todas iguales (pasadas que se saltan).
+        CRadixSorter sorter;
+        std::vector<uint64_t> keys(200000);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            keys[i] = (keys.size() - i) * 977;
+        }
+        sorter.sort(keys.data(), nullptr, keys.size(), 64, &jobs);
+        EU_CHECK(std::is_sorted(keys.begin(), keys.end()));
+        sorter.sort(keys.data(), nullptr, keys.size(), 64, &jobs);
+        EU_CHECK(std::is_sorted(keys.begin(), keys.end()) && keys.front() == 977);
+        std::vector<uint64_t> same(5000, 42);
+        std::vector<uint32_t> values(same.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<uint32_t>(i);
+        }
+        sorter.sort(same, values);
+        EU_CHECK(same[0] == 42 && values[0] == 0 && values[4999] == 4999);
+
+        // Ordenar por código deja consecutivos los puntos cercanos: la distancia media entre
+        // vecinos del array baja mucho frente al orden original.
+        std::mt19937 rng(67);
+        std::uniform_real_distribution<float> position(0.0f, 100.0f);
+        std::vector<CVector3> points(20000);
+        for (CVector3& point : points) {
+            point = CVector3(position(rng), position(rng), position(rng));
+        }
+        CAABB bounds = CAABB::fromPoints(points.data(), points.size());
+        std::vector<uint64_t> codes(points.size());
+        std::vector<uint32_t> order(points.size());
+        EngineUtilities::hilbertCodes(points.data(), points.size(), bounds, codes.data());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        sorter.sort(codes, order, 63);
+        double before = 0.0;
+        double after = 0.0;
+        for (size_t i = 1; i < points.size(); ++i) {
+            before += (points[i] - points[i - 1]).length();
+            after += (points[order[i]] - points[order[i - 1]]).length();
+        }
+        EU_CHECK(after * 10.0 < before);
+    }
+
+}
+
+/**
+ * @brief Pruebas de SpaceFillingCurves.h y CRadixSorter.
+ */
+void testSpaceFillingCurves() {
+    testMorton();
+    testHilbert();
+    testQuantizer();
+    testRadixSort();
+}
@@ -0,0 +1,220 @@
+/**
+ * @file testSpatialHashGrid.cpp
+ * @brief Pruebas de TSpatialHashGrid en 2D y 3D frente a recorrer todos los puntos.
+ * @author Hannin Abarca
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/TSpatialHashGrid.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CSpatialHashGrid2D;
+    using EngineUtilities::CSpatialHashGrid3D;
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+
+    CVector2 randomPoint(std::mt19937& rng, std::uniform_real_distribution<float>& position, CVector2*) {
+        return CVector2(position(rng), position(rng));
+    }
+
+    CVector3 randomPoint(std::mt19937& rng, std::uniform_real_distribution<float>& position, CVector3*) {
+        return CVector3(position(rng), position(rng), position(rng));
+    }
+
+    /// Compara radio y k vecinos de la rejilla con la fuerza bruta en consultas aleatorias.
+    template<typename GridT, typename VectorT>
+    void checkAgainstBruteForce(size_t count, float range, float cellSize, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-range, range);
+        std::vector<VectorT> points(count);
+        for (VectorT& point : points) {
+            point = randomPoint(rng, position, static_cast<VectorT*>(nullptr));
+        }
+        GridT grid(cellSize);
+        grid.build(points.data(), count);
+        EU_CHECK(grid.size() == count && grid.bucketCount() >= 2 * count);
+
+        std::uniform_real_distribution<float> radiusDistribution(0.0f, 3.0f * cellSize);
+        bool sameRadius = true;
+        bool sameNearest = true;
+        std::vector<uint32_t> found;
+        std::vector<float> distances(count);
+        const size_t k = 8;
+        uint32_t indices[k];
+        float nearest[k];
+        for (int q = 0; q < 300; ++q) {
+            VectorT center = randomPoint(rng, position, static_cast<VectorT*>(nullptr)) * 1.1f;
+            float radius = radiusDistribution(rng);
+            found.clear();
+            grid.queryRadius(center, radius, found);
+            std::sort(found.begin(), found.end());
+            std::vector<uint32_t> expected;
+            for (size_t i = 0; i < count; ++i) {
+                distances[i] = (points[i] - center).lengthSquare();
+                if (distances[i] <= radius * radius) {
+                    expected.push_back(static_cast<uint32_t>(i));
+                }
+            }
+            sameRadius = sameRadius && found == expected;
+
+            // Sin límite y con maxDistance = radius.
+            float maxDistance = q % 2 == 0 ? INFINITY : radius;
+            size_t n = grid.nearest(center, k, indices, nearest, maxDistance);
+            std::vector<float> sorted = distances;
+            std::sort(sorted.begin(), sorted.end());
+            size_t expectedCount = 0;
+            while (expectedCount < k && expectedCount < count && sorted[expectedCount] <= maxDistance * maxDistance) {
+                ++expectedCount;
+            }
+            sameNearest = sameNearest && n == expectedCount;
+            for (size_t i = 0; i < n && i < expectedCount; ++i) {
+                sameNearest = sameNearest && nearest[i] == sorted[i] && distances[indices[i]] == nearest[i];
+            }
+        }
+        EU_CHECK(sameRadius);
+        EU_CHECK(sameNearest);
+    }
+
+    void testEmptyAndSmall() {
+        CSpatialHashGrid3D grid(2.0f);
+        uint32_t index = 0;
+        float distance = 0.0f;
+        EU_CHECK(grid.size() == 0 && grid.nearest(CVector3()) == UINT32_MAX);
+        EU_CHECK(grid.nearest(CVector3(), 4, &index, &distance) == 0);
+        grid.build(nullptr, 0);
+        std::vector<uint32_t> found;
+        EU_CHECK(grid.queryRadius(CVector3(), 100.0f, found) == 0);
+
+        // Coordenadas negativas justo a ambos lados de los bordes de celda.
+        CVector3 points[4] = { CVector3(-0.01f, 0.0f, 0.0f), CVector3(0.01f, 0.0f, 0.0f), CVector3(-2.01f, -4.0f, 6.0f),
+            CVector3(-1000.0f, 1000.0f, -1000.0f) };
+        grid.build(points, 4);
+        EU_CHECK(grid.size() == 4);
+        EU_CHECK(grid.queryRadius(CVector3(), 0.02f, found) == 2);
+        EU_CHECK(grid.nearest(CVector3(-1.0f, -3.0f, 5.0f)) == 2);
+        EU_CHECK(grid.nearest(CVector3(-900.0f, 900.0f, -900.0f)) == 3);
+        EU_CHECK(grid.nearest(CVector3(-900.0f, 900.0f, -900.0f), 10.0f) == UINT32_MAX);
+        uint32_t indices[8];
+        float distances[8];
+        EU_CHECK(grid.nearest(CVector3(0.02f, 0.0f, 0.0f), 8, indices, distances) == 4);
+        EU_CHECK(indices[0] == 1 && indices[1] == 0 && indices[2] == 2 && indices[3] == 3);
+        EU_CHECK_NEAR(distances[0], 0.0001, 1e-6);
+
+        // Todos los puntos en la misma celda.
+        std::vector<CVector2> same(100, CVector2(0.5f, 0.5f));
+        CSpatialHashGrid2D grid2(1.0f);
+        grid2.build(same.data(), same.size());
+        EU_CHECK(grid2.queryRadius(CVector2(0.5f, 0.5f), 0.0f, found) == 100);
+
+        // Radios cuyas celdas no caben en int: la caja de consulta se satura y no pierde puntos.
+        std::vector<CVector3> spread;
+        for (int i = 0; i < 100; ++i) {
+            spread.push_back(CVector3(static_cast<float>(i % 10), static_cast<float>(i / 10), 0.0f));
+        }
+        CSpatialHashGrid3D unitGrid(1.0f);
+        unitGrid.build(spread.data(), spread.size());
+        const float hugeRadii[] = { 1e9f, 3e9f, 1e12f, INFINITY };
+        for (float radius : hugeRadii) {
+            found.clear();
+            EU_CHECK(unitGrid.queryRadius(CVector3(), radius, found) == 100);
+        }
+        // Consultas de vecinos a ~1e10 celdas (>> 2^30): los anillos no desbordan. Celdas de
+        // 1e-6 para que las distancias, de ~1e4, aún distingan los puntos en float.
+        std::vector<CVector3> row;
+        for (int i = 0; i < 10; ++i) {
+            row.push_back(CVector3(static_cast<float>(i), 0.0f, 0.0f));
+        }
+        CSpatialHashGrid3D rowGrid(1e-6f);
+        rowGrid.build(row.data(), row.size());
+        EU_CHECK(rowGrid.nearest(CVector3(-1e4f, 0.0f, 0.0f)) == 0);
+        EU_CHECK(rowGrid.nearest(CVector3(1e4f, 0.0f, 0.0f)) == 9);
+        // Lejos en y y z pero a la altura del punto 4 en x.
+        CSpatialHashGrid3D fineGrid(1e-8f);
+        fineGrid.build(row.data(), row.size());
+        EU_CHECK(fineGrid.nearest(CVector3(4.2f, -30.0f, 30.0f)) == 4);
+        EU_CHECK(rowGrid.nearest(CVector3(-1e12f, 0.0f, 0.0f)) != UINT32_MAX);
+        uint32_t farIndices[3];
+        float farDistances[3];
+        EU_CHECK(rowGrid.nearest(CVector3(3e3f, 0.0f, 0.0f), 3, farIndices, farDistances) == 3);
+        EU_CHECK(farIndices[0] == 9 && farIndices[1] == 8 && farIndices[2] == 7);
+        CSpatialHashGrid2D rowGrid2(1e-6f);
+        std::vector<CVector2> row2 = { CVector2(0.0f, 0.0f), CVector2(5.0f, 0.0f) };
+        rowGrid2.build(row2.data(), row2.size());
+        EU_CHECK(rowGrid2.nearest(CVector2(-INFINITY, 0.0f)) != UINT32_MAX);
+        EU_CHECK(rowGrid2.nearest(CVector2(-1e4f, 3e3f)) == 0);
+        EU_CHECK(rowGrid2.nearest(CVector2(1e4f, 1e4f)) == 1);
+
+        CVector3 far(1e12f, -1e12f, 0.0f);
+        unitGrid.build(&far, 1);
+        found.clear();
+        EU_CHECK(unitGrid.queryRadius(CVector3(), 2e12f, found) == 1);
+        EU_CHECK(unitGrid.nearest(CVector3()) == 0);
+
+        // Con un sistema de trabajos sin hilos en el pool la construcción es la serie.
+        CJobSystem serialJobs(0);
+        CSpatialHashGrid3D viaJobs(1.0f);
+        unitGrid.build(spread.data(), spread.size());
+        viaJobs.build(spread.data(), spread.size(), &serialJobs);
+        std::vector<uint32_t> expected;
+        found.clear();
+        unitGrid.queryRadius(CVector3(4.0f, 4.0f, 0.0f), 2.5f, expected);
+        viaJobs.queryRadius(CVector3(4.0f, 4.0f, 0.0f), 2.5f, found);
+        EU_CHECK(!found.empty() && found == expected);
+    }
+
+    void testAgainstBruteForce() {
+        checkAgainstBruteForce<CSpatialHashGrid2D, CVector2>(5000, 100.0f, 2.0f, 31);
+        checkAgainstBruteForce<CSpatialHashGrid3D, CVector3>(5000, 30.0f, 3.0f, 32);
+        // Celdas mucho mayores y mucho menores que la separación media.
+        checkAgainstBruteForce<CSpatialHashGrid3D, CVector3>(2000, 30.0f, 40.0f, 33);
+        checkAgainstBruteForce<CSpatialHashGrid2D, CVector2>(500, 100.0f, 0.05f, 34);
+    }
+
+    void testParallelBuild() {
+        const size_t count = 70000;
+        std::mt19937 rng(35);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::vector<CVector3> points(count);
+        for (CVector3& point : points) {
+            point = CVector3(position(rng), position(rng), position(rng));
+        }
+        CJobSystem jobs(3);
+        CSpatialHashGrid3D serial(1.5f);
+        CSpatialHashGrid3D parallel(1.5f);
+        serial.build(points.data(), count);
+        // Dos veces: la segunda reutiliza los contadores atómicos.
+        parallel.build(points.data(), count / 2, &jobs);
+        parallel.build(points.data(), count, &jobs);
+        EU_CHECK(parallel.size() == count && parallel.bucketCount() == serial.bucketCount());
+
+        // Mismo orden dentro de cada cubeta: las consultas devuelven la misma secuencia.
+        bool same = true;
+        std::vector<uint32_t> a;
+        std::vector<uint32_t> b;
+        for (int q = 0; q < 500; ++q) {
+            CVector3 center(position(rng), position(rng), position(rng));
+            a.clear();
+            b.clear();
+            serial.queryRadius(center, 4.0f, a);
+            parallel.queryRadius(center, 4.0f, b);
+            same = same && a == b;
+        }
+        EU_CHECK(same);
+    }
+
+}
+
+/**
+ * @brief Pruebas de TSpatialHashGrid.
+ */
+void testSpatialHashGrid() {
+    testEmptyAndSmall();
+    testAgainstBruteForce();
+    testParallelBuild();
+}
@@ -0,0 +1,190 @@
+/**
+ * @file testStaticBVH.cpp
+ * @brief Pruebas de CStaticBVH frente a probar todos los triángulos.
+ * @author Hannin Abarca
+ */
+
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Geometry/CStaticBVH.h"
+
+namespace {
+
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CStaticBVH;
+    using EngineUtilities::CTriangleHit;
+    using EngineUtilities::CVector3;
+
+    /// Sopa de triángulos aleatorios (tres vértices consecutivos por triángulo).
+    std::vector<CVector3> randomTriangles(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+        std::vector<CVector3> vertices;
+        for (size_t i = 0; i < count; ++i) {
+            CVector3 center(position(rng), position(rng), position(rng));
+            for (int k = 0; k < 3; ++k) {
+                vertices.push_back(center + CVector3(offset(rng), offset(rng), offset(rng)));
+            }
+        }
+        return vertices;
+    }
+
+    /// Impacto más cercano probando todos los triángulos (Möller-Trumbore en double).
+    bool bruteForce(const std::vector<CVector3>& vertices, const CVector3& origin, const CVector3& direction, float maxT,
+        double& closest) {
+        bool found = false;
+        closest = maxT;
+        for (size_t i = 0; i + 2 < vertices.size(); i += 3) {
+            double e1[3], e2[3], s[3], d[3] = { direction.x, direction.y, direction.z };
+            for (int axis = 0; axis < 3; ++axis) {
+                e1[axis] = static_cast<double>(vertices[i + 1][axis]) - vertices[i][axis];
+                e2[axis] = static_cast<double>(vertices[i + 2][axis]) - vertices[i][axis];
+                s[axis] = static_cast<double>(origin[axis]) - vertices[i][axis];
+            }
+            double p[3] = { d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0] };
+            double det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+            if (det == 0.0) {
+                continue;
+            }
+            double u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) / det;
+            double q[3] = { s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0] };
+            double v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) / det;
+            double t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) / det;
+            if (u >= 0.0 && v >= 0.0 && u + v <= 1.0 && t >= 0.0 && t < closest) {
+                closest = t;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    void testEmptyAndSmall() {
+        CStaticBVH bvh;
+        CTriangleHit hit;
+        EU_CHECK(bvh.validate() && bvh.nodeCount() == 0 && bvh.bounds().isEmpty());
+        EU_CHECK(!bvh.raycast(CVector3(), CVector3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+
+        // Un triángulo en el plano z = 5.
+        CVector3 triangle[3] = { CVector3(-1.0f, -1.0f, 5.0f), CVector3(3.0f, -1.0f, 5.0f), CVector3(-1.0f, 3.0f, 5.0f) };
+        bvh.build(triangle, 1);
+        EU_CHECK(bvh.validate() && bvh.nodeCount() == 1 && bvh.depth() == 0);
+        EU_CHECK(bvh.raycast(CVector3(0.0f, 0.0f, 0.0f), CVector3(0.0f, 0.0f, 2.0f), 100.0f, hit));
+        EU_CHECK_NEAR(hit.t, 2.5, 1e-6);
+        EU_CHECK_NEAR(hit.u, 0.25, 1e-6);
+        EU_CHECK_NEAR(hit.v, 0.25, 1e-6);
+        EU_CHECK(hit.triangle == 0);
+        // Por la otra cara, fuera del triángulo y más allá de maxT.
+        EU_CHECK(bvh.raycast(CVector3(0.0f, 0.0f, 9.0f), CVector3(0.0f, 0.0f, -1.0f), 100.0f, hit));
+        EU_CHECK(!bvh.raycast(CVector3(2.5f, 2.5f, 0.0f), CVector3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+        EU_CHECK(!bvh.raycast(CVector3(0.0f, 0.0f, 0.0f), CVector3(0.0f, 0.0f, 1.0f), 4.0f, hit));
+
+        // Segmentos: t es la fracción recorrida.
+        EU_CHECK(bvh.segmentcast(CVector3(0.0f, 0.0f, 4.0f), CVector3(0.0f, 0.0f, 8.0f), hit));
+        EU_CHECK_NEAR(hit.t, 0.25, 1e-6);
+        EU_CHECK(bvh.segmentBlocked(CVector3(0.0f, 0.0f, 4.0f), CVector3(0.0f, 0.0f, 8.0f)));
+        EU_CHECK(!bvh.segmentBlocked(CVector3(0.0f, 0.0f, 4.0f), CVector3(0.0f, 0.0f, 4.9f)));
+
+        // Malla indexada: dos triángulos que comparten arista.
+        CVector3 quad[4] = { CVector3(0.0f, 0.0f, 0.0f), CVector3(1.0f, 0.0f, 0.0f), CVector3(1.0f, 1.0f, 0.0f), CVector3(0.0f, 1.0f, 0.0f) };
+        uint32_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+        bvh.build(quad, indices, 2);
+        EU_CHECK(bvh.validate() && bvh.triangleCount() == 2);
+        EU_CHECK(bvh.raycast(CVector3(0.8f, 0.2f, 1.0f), CVector3(0.0f, 0.0f, -1.0f), 10.0f, hit) && hit.triangle == 0);
+        EU_CHECK(bvh.raycast(CVector3(0.2f, 0.8f, 1.0f), CVector3(0.0f, 0.0f, -1.0f), 10.0f, hit) && hit.triangle == 1);
+
+        // Muchos triángulos con el mismo centroide: no hay corte SAH posible.
+        std::vector<CVector3> stacked;
+        for (int i = 0; i < 100; ++i) {
+            float size = 1.0f + static_cast<float>(i);
+            stacked.push_back(CVector3(-size, -size, 0.0f));
+            stacked.push_back(CVector3(2.0f * size, -size, 0.0f));
+            stacked.push_back(CVector3(-size, 2.0f * size, 0.0f));
+        }
+        bvh.build(stacked.data(), 100);
+        EU_CHECK(bvh.validate() && bvh.depth() < 20);
+        // (10, 10) solo está dentro de los triángulos con size >= 20.
+        EU_CHECK(bvh.raycast(CVector3(10.0f, 10.0f, 1.0f), CVector3(0.0f, 0.0f, -1.0f), 10.0f, hit));
+        EU_CHECK(hit.triangle >= 19);
+        EU_CHECK_NEAR(hit.t, 1.0, 1e-5);
+    }
+
+    void testAgainstBruteForce() {
+        const size_t count = 3000;
+        std::vector<CVector3> vertices = randomTriangles(count, 21);
+        CStaticBVH bvh;
+        bvh.build(vertices.data(), count);
+        EU_CHECK(bvh.validate() && bvh.triangleCount() == count);
+        EU_CHECK(bvh.nodeCount() < 2 * count && bvh.depth() < 40);
+
+        std::mt19937 rng(22);
+        std::uniform_real_distribution<float> position(-70.0f, 70.0f);
+        int hits = 0;
+        int edgeCases = 0;
+        bool same = true;
+        bool anySame = true;
+        for (int r = 0; r < 2000; ++r) {
+            CVector3 origin(position(rng), position(rng), position(rng));
+            CVector3 direction;
+            if (r % 2 == 0) {
+                // Hacia el centroide de un triángulo: casi siempre impacta.
+                size_t target = rng() % count;
+                direction = (vertices[3 * target] + vertices[3 * target + 1] + vertices[3 * target + 2]) * (1.0f / 3.0f) - origin;
+            }
+            else {
+                direction = CVector3(position(rng), position(rng), position(rng));
+            }
+            double expected = 0.0;
+            bool expectedHit = bruteForce(vertices, origin, direction, 4.0f, expected);
+            CTriangleHit hit;
+            bool found = bvh.raycast(origin, direction, 4.0f, hit);
+            hits += found ? 1 : 0;
+            // Un rayo que roza una arista puede decidirse distinto en float y en double.
+            if (found != expectedHit) {
+                ++edgeCases;
+            }
+            else if (found) {
+                same = same && EngineUtilities::fabs(hit.t - expected) < 1e-4 * (1.0 + expected);
+            }
+            anySame = anySame && bvh.anyHit(origin, direction, 4.0f) == found;
+        }
+        EU_CHECK(same && anySame && hits > 800 && edgeCases <= 2);
+    }
+
+    void testParallelBuild() {
+        const size_t count = 60000;
+        std::vector<CVector3> vertices = randomTriangles(count, 23);
+        CStaticBVH serial;
+        CStaticBVH parallel;
+        CJobSystem jobs(3);
+        serial.build(vertices.data(), count);
+        parallel.build(vertices.data(), count, &jobs);
+        EU_CHECK(parallel.validate());
+        // Los mismos cortes: mismo número de nodos y la misma respuesta a cada rayo.
+        EU_CHECK(parallel.nodeCount() == serial.nodeCount() && parallel.depth() == serial.depth());
+        std::mt19937 rng(24);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        bool same = true;
+        for (int r = 0; r < 2000; ++r) {
+            CVector3 origin(position(rng), position(rng), position(rng));
+            CVector3 direction = CVector3(position(rng), position(rng), position(rng)) - origin;
+            CTriangleHit a;
+            CTriangleHit b;
+            bool hitA = serial.raycast(origin, direction, 1.0f, a);
+            bool hitB = parallel.raycast(origin, direction, 1.0f, b);
+            same = same && hitA == hitB && (!hitA || (a.t == b.t && a.triangle == b.triangle));
+        }
+        EU_CHECK(same);
+    }
+
+}
+
+/**
+ * @brief Pruebas de CStaticBVH.
+ */
+void testStaticBVH() {
+    testEmptyAndSmall();
+    testAgainstBruteForce();
+    testParallelBuild();
+}
@@ -0,0 +1,106 @@
+/**
+ * @file testTSlotMap.cpp
+ * @brief Pruebas de TSlotMap y sus handles generacionales.
+ * @author Hannin Abarca
+ */
+
+#include <stdexcept>
+#include "TestHarness.h"
+#include "../include/Containers/TSlotMap.h"
+
+namespace {
+
+    using EngineUtilities::SlotHandle32;
+    using EngineUtilities::SlotHandle64;
+    using EngineUtilities::TSlotMap;
+
+    template<typename HandleT>
+    void testHandles() {
+        TSlotMap<int, HandleT> map;
+        HandleT a = map.insert(1);
+        HandleT b = map.insert(2);
+        HandleT c = map.insert(3);
+        EU_CHECK(map.size() == 3);
+        EU_CHECK(*map.get(b) == 2);
+
+        // Borrar del medio mueve el último al hueco sin invalidar su handle.
+        EU_CHECK(map.erase(b));
+        EU_CHECK(!map.contains(b));
+        EU_CHECK(map.get(b) == nullptr);
+        EU_CHECK(*map.get(c) == 3);
+        EU_CHECK(!map.erase(b));
+
+        // El slot reutilizado tiene otra generación: el handle antiguo sigue sin ser válido.
+        HandleT d = map.insert(4);
+        EU_CHECK(d.index() == b.index());
+        EU_CHECK(d.generation() != b.generation());
+        EU_CHECK(map.get(b) == nullptr);
+        EU_CHECK(*map.get(d) == 4);
+
+        int sum = 0;
+        for (int value : map) {
+            sum += value;
+        }
+        EU_CHECK(sum == 1 + 3 + 4);
+        for (size_t i = 0; i < map.size(); ++i) {
+            EU_CHECK(*map.get(map.handleAt(i)) == map.data()[i]);
+        }
+
+        map.clear();
+        EU_CHECK(map.empty());
+        EU_CHECK(!map.contains(a) && !map.contains(c) && !map.contains(d));
+        EU_CHECK(map.get(HandleT()) == nullptr);
+    }
+
+    /// Su constructor lanza con valores negativos.
+    struct ThrowingValue {
+        int value;
+        explicit ThrowingValue(int v) : value(v) {
+            if (v < 0) {
+                throw std::runtime_error("ThrowingValue");
+            }
+        }
+    };
+
+    /// Intenta emplazar un valor cuyo constructor lanza; devuelve si la excepción llegó.
+    bool emplaceThrows(TSlotMap<ThrowingValue, SlotHandle32>& map) {
+        try {
+            map.emplace(-1);
+        }
+        catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    }
+
+    void testThrowingConstructor() {
+        TSlotMap<ThrowingValue, SlotHandle32> map;
+        SlotHandle32 a = map.emplace(1);
+        SlotHandle32 b = map.emplace(2);
+        map.erase(a);
+
+        // Con un slot libre: el slot sigue en la lista libre y el array denso no cambia.
+        EU_CHECK(emplaceThrows(map));
+        EU_CHECK(map.size() == 1 && map.get(b)->value == 2 && map.handleAt(0) == b);
+        EU_CHECK(!map.contains(a));
+        SlotHandle32 c = map.emplace(3);
+        EU_CHECK(c.index() == a.index() && c.generation() != a.generation());
+
+        // Sin slots libres: no se añade ningún slot nuevo.
+        EU_CHECK(emplaceThrows(map));
+        EU_CHECK(map.size() == 2 && map.get(c)->value == 3);
+        SlotHandle32 d = map.emplace(4);
+        EU_CHECK(d.index() == 2 && map.size() == 3 && map.get(d)->value == 4);
+    }
+
+}
+
+/**
+ * @brief Inserción, borrado y detección de handles obsoletos con handles de 32 y 64 bits, y
+ *        emplace() con un constructor que lanza.
+ */
+void testTSlotMap() {
+    testHandles<SlotHandle32>();
+    testHandles<SlotHandle64>();
+    testThrowingConstructor();
+}
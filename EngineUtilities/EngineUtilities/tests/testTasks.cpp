@@ -0,0 +1,168 @@
+/**
+ * @file testTasks.cpp
+ * @brief Pruebas de TTask, CTaskScheduler y la cancelación cooperativa.
+ * @author Hannin Abarca
+ *
+ * TTask requiere C++20; compilada con un estándar anterior la suite no hace nada.
+ */
+
+#include <cstdio>
+#include "TestHarness.h"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "../include/Threading/TTask.h"
+
+namespace {
+
+    using EngineUtilities::CCancellationSource;
+    using EngineUtilities::CCancellationToken;
+    using EngineUtilities::CJobCounter;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CTaskScheduler;
+    using EngineUtilities::TTask;
+
+    TTask<int> add(int a, int b) {
+        co_return a + b;
+    }
+
+    /// Cadena de continuaciones: cada nivel espera al siguiente.
+    TTask<long> sumTo(int n) {
+        if (n == 0) {
+            co_return 0;
+        }
+        co_return n + co_await sumTo(n - 1);
+    }
+
+    TTask<int> square(CTaskScheduler& scheduler, int value) {
+        co_await scheduler.schedule();
+        co_return value * value;
+    }
+
+    TTask<std::unique_ptr<int>> makeBoxed(int value) {
+        co_return std::make_unique<int>(value);
+    }
+
+    /// Carga en varias etapas que se detiene si se cancela entre etapas.
+    TTask<int> loadInStages(CTaskScheduler& scheduler, CCancellationToken token, int stages,
+        CCancellationSource* cancelAfterFirst) {
+        int completed = 0;
+        for (int stage = 0; stage < stages; ++stage) {
+            if (!co_await scheduler.schedule(token)) {
+                co_return -completed;
+            }
+            ++completed;
+            if (cancelAfterFirst != nullptr) {
+                cancelAfterFirst->cancel();
+            }
+        }
+        co_return completed;
+    }
+
+    TTask<int> sumOfJobs(CTaskScheduler& scheduler, std::atomic<int>& executed) {
+        CJobCounter counter;
+        for (int i = 0; i < 50; ++i) {
+            scheduler.jobSystem().run([&executed]() { executed.fetch_add(1); }, &counter);
+        }
+        co_await scheduler.wait(counter);
+        co_return executed.load();
+    }
+
+    TTask<int> fanOut(CTaskScheduler& scheduler, int count) {
+        std::vector<TTask<int>> tasks;
+        for (int i = 0; i < count; ++i) {
+            tasks.push_back(square(scheduler, i));
+        }
+        std::vector<int> results = co_await scheduler.whenAll(std::move(tasks));
+        bool ordered = static_cast<int>(results.size()) == count;
+        for (int i = 0; ordered && i < count; ++i) {
+            ordered = results[i] == i * i;
+        }
+        co_return ordered ? count : -1;
+    }
+
+    TTask<> increment(CTaskScheduler& scheduler, std::atomic<int>& value) {
+        co_await scheduler.schedule();
+        value.fetch_add(1);
+    }
+
+    TTask<> markStarted(bool& started) {
+        started = true;
+        co_return;
+    }
+
+    void testScheduler(CJobSystem& jobs) {
+        CTaskScheduler scheduler(jobs);
+
+        EU_CHECK(scheduler.syncWait(add(2, 3)) == 5);
+        EU_CHECK(scheduler.syncWait(sumTo(1000)) == 500500);
+        EU_CHECK(scheduler.syncWait(square(scheduler, 12)) == 144);
+        std::unique_ptr<int> boxed = scheduler.syncWait(makeBoxed(9));
+        EU_CHECK(boxed != nullptr && *boxed == 9);
+
+        // Esperar trabajos normales desde una corrutina.
+        std::atomic<int> executed{ 0 };
+        EU_CHECK(scheduler.syncWait(sumOfJobs(scheduler, executed)) == 50);
+
+        // whenAll conserva el orden de los resultados.
+        EU_CHECK(scheduler.syncWait(fanOut(scheduler, 200)) == 200);
+
+        std::atomic<int> value{ 0 };
+        std::vector<TTask<>> increments;
+        for (int i = 0; i < 100; ++i) {
+            increments.push_back(increment(scheduler, value));
+        }
+        scheduler.syncWait(scheduler.whenAll(std::move(increments)));
+        EU_CHECK(value.load() == 100);
+
+        // spawn() cuenta las tareas lanzadas en un CJobCounter normal.
+        CJobCounter counter;
+        for (int i = 0; i < 100; ++i) {
+            scheduler.spawn(increment(scheduler, value), counter);
+        }
+        jobs.wait(counter);
+        EU_CHECK(value.load() == 200 && counter.isDone());
+
+        // Cancelación: antes de empezar, y entre etapas.
+        CCancellationSource cancelled;
+        cancelled.cancel();
+        EU_CHECK(scheduler.syncWait(loadInStages(scheduler, cancelled.token(), 5, nullptr)) == 0);
+        CCancellationSource midway;
+        EU_CHECK(scheduler.syncWait(loadInStages(scheduler, midway.token(), 5, &midway)) == -1);
+        EU_CHECK(scheduler.syncWait(loadInStages(scheduler, CCancellationToken(), 5, nullptr)) == 5);
+
+        // Una tarea que nunca se espera no ejecuta su cuerpo.
+        bool started = false;
+        {
+            TTask<> unused = markStarted(started);
+            EU_CHECK(unused.valid() && !unused.isDone());
+        }
+        EU_CHECK(!started);
+    }
+
+}
+
+/**
+ * @brief Pruebas de las tareas con corrutinas, con y sin hilos en el pool.
+ */
+void testTasks() {
+    {
+        CJobSystem jobs(3);
+        testScheduler(jobs);
+    }
+    {
+        CJobSystem jobs(0);
+        testScheduler(jobs);
+    }
+}
+
+#else
+
+void testTasks() {
+    std::printf("  (omitida: TTask requiere C++20)\n");
+}
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * @file testTransformHierarchy.cpp
+ * @brief Pruebas de CTransformHierarchy: composición, marcas de cambio, orden y actualización paralela.
+ * @author Hannin Abarca
+ */
+
+#include <cstring>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Scene/CTransformHierarchy.h"
+
+namespace {
+
+    using EngineUtilities::CAffineTransform;
+    using EngineUtilities::CJobSystem;
+    using EngineUtilities::CQuaternion;
+    using EngineUtilities::CTransformHierarchy;
+    using EngineUtilities::CVector3;
+    using Handle = CTransformHierarchy::Handle;
+
+    /// Referencia: aplica escala, rotación y traslación de cada nivel, del hijo hacia la raíz.
+    CVector3 applyChain(const std::vector<CVector3>& positions, const std::vector<CQuaternion>& rotations,
+        const std::vector<CVector3>& scales, CVector3 point) {
+        for (size_t i = positions.size(); i-- > 0; ) {
+            point = CVector3(point.x * scales[i].x, point.y * scales[i].y, point.z * scales[i].z);
+            point = rotations[i].rotate(point) + positions[i];
+        }
+        return point;
+    }
+
+    bool nearVector(const CVector3& a, const CVector3& b, float tolerance) {
+        return std::fabs(a.x - b.x) <= tolerance && std::fabs(a.y - b.y) <= tolerance && std::fabs(a.z - b.z) <= tolerance;
+    }
+
+    void testComposition() {
+        std::vector<CVector3> positions = { CVector3(1.0f, 2.0f, 3.0f), CVector3(-4.0f, 0.5f, 2.0f), CVector3(0.0f, 3.0f, -1.0f) };
+        std::vector<CQuaternion> rotations = {
+            CQuaternion::fromAxisAngle(CVector3(0.0f, 0.0f, 1.0f), 0.7f),
+            CQuaternion::fromAxisAngle(CVector3(1.0f, 1.0f, 0.0f).normalized(), -1.2f),
+            CQuaternion::fromAxisAngle(CVector3(0.2f, -0.5f, 1.0f).normalized(), 2.5f) };
+        std::vector<CVector3> scales = { CVector3(2.0f, 2.0f, 2.0f), CVector3(1.0f, 0.5f, 3.0f), CVector3(1.0f, 1.0f, 1.0f) };
+
+        CTransformHierarchy hierarchy;
+        Handle root = hierarchy.create(Handle(), positions[0], rotations[0], scales[0]);
+        Handle middle = hierarchy.create(root, positions[1], rotations[1], scales[1]);
+        Handle leaf = hierarchy.create(middle, positions[2], rotations[2], scales[2]);
+        EU_CHECK(hierarchy.update() == 3);
+        EU_CHECK(hierarchy.levelCount() == 3);
+        EU_CHECK(hierarchy.parent(leaf) == middle && hierarchy.parent(root).isNull());
+
+        CVector3 point(0.3f, -1.5f, 2.0f);
+        CVector3 expected = applyChain(positions, rotations, scales, point);
+        EU_CHECK(nearVector(hierarchy.world(leaf)->transformPoint(point), expected, 1e-4f));
+
+        // La matriz double equivale a componer las matrices de cada nivel.
+        EngineUtilities::Matriz4x4 world = hierarchy.worldMatrix(leaf);
+        double x = world.m[0][0] * point.x + world.m[0][1] * point.y + world.m[0][2] * point.z + world.m[0][3];
+        EU_CHECK_NEAR(x, expected.x, 1e-4);
+        EU_CHECK(world.m[3][3] == 1.0 && world.m[3][0] == 0.0);
+
+        // Sin cambios no se recalcula nada; un cambio recalcula solo su subárbol.
+        EU_CHECK(hierarchy.update() == 0);
+        Handle other = hierarchy.create(root);
+        EU_CHECK(hierarchy.update() == 1);
+        positions[1] = CVector3(5.0f, 5.0f, 5.0f);
+        EU_CHECK(hierarchy.setLocalPosition(middle, positions[1]));
+        EU_CHECK(hierarchy.update() == 2);
+        EU_CHECK(nearVector(hierarchy.world(leaf)->transformPoint(point),
+            applyChain(positions, rotations, scales, point), 1e-4f));
+        EU_CHECK(hierarchy.setLocalScale(root, CVector3(1.0f, 1.0f, 1.0f)));
+        EU_CHECK(hierarchy.update() == 4);
+
+        // Cambio de padre: el nodo conserva su transformación local.
+        EU_CHECK(!hierarchy.setParent(root, leaf));
+        EU_CHECK(!hierarchy.setParent(middle, middle));
+        EU_CHECK(hierarchy.setParent(leaf, Handle()));
+        EU_CHECK(hierarchy.update() == 1);
+        EU_CHECK(hierarchy.levelCount() == 2);
+        CVector3 alone = rotations[2].rotate(point) + positions[2];
+        EU_CHECK(nearVector(hierarchy.world(leaf)->transformPoint(point), alone, 1e-4f));
+
+        // Destruir un nodo destruye su subárbol e invalida los handles.
+        EU_CHECK(hierarchy.setParent(leaf, other));
+        EU_CHECK(hierarchy.destroy(root));
+        EU_CHECK(hierarchy.size() == 0);
+        EU_CHECK(!hierarchy.contains(root) && !hierarchy.contains(middle) && !hierarchy.contains(leaf));
+        EU_CHECK(!hierarchy.destroy(root) && !hierarchy.setLocalPosition(leaf, point));
+        EU_CHECK(hierarchy.world(leaf) == nullptr);
+        EU_CHECK(hierarchy.create(leaf).isNull());
+    }
+
+    /// Árbol aleatorio: cada nodo cuelga de uno anterior (o es raíz).
+    std::vector<Handle> buildRandomTree(CTransformHierarchy& hierarchy, size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+        std::vector<Handle> nodes;
+        for (size_t i = 0; i < count; ++i) {
+            Handle parent = i == 0 || rng() % 50 == 0 ? Handle() : nodes[rng() % nodes.size()];
+            CQuaternion rotation = CQuaternion::fromAxisAngle(CVector3(dist(rng), dist(rng), 1.0f).normalized(), dist(rng));
+            nodes.push_back(hierarchy.create(parent, CVector3(dist(rng), dist(rng), dist(rng)), rotation,
+                CVector3(1.0f, 1.0f, 1.0f)));
+        }
+        return nodes;
+    }
+
+    void testOrderAndParallel() {
+        const size_t count = 20000;
+        CTransformHierarchy serial;
+        CTransformHierarchy parallel;
+        std::vector<Handle> serialNodes = buildRandomTree(serial, count, 5);
+        std::vector<Handle> parallelNodes = buildRandomTree(parallel, count, 5);
+        EU_CHECK(serial.update() == count);
+
+        // Orden en anchura: el padre siempre va antes y los niveles no retroceden.
+        const uint32_t* parents = serial.parentData();
+        bool parentsFirst = true;
+        for (size_t i = 0; i < count; ++i) {
+            parentsFirst = parentsFirst && (parents[i] == CTransformHierarchy::kNoParent || parents[i] < i);
+        }
+        EU_CHECK(parentsFirst);
+        EU_CHECK(serial.levelCount() > 3);
+
+        CJobSystem jobs(3);
+        EU_CHECK(parallel.update(jobs, 256) == count);
+        EU_CHECK(std::memcmp(serial.worldData(), parallel.worldData(), count * sizeof(CAffineTransform)) == 0);
+
+        // Los mismos cambios dan los mismos resultados en serie y en paralelo.
+        std::mt19937 rng(11);
+        for (int i = 0; i < 200; ++i) {
+            size_t node = rng() % count;
+            CVector3 position(static_cast<float>(i), 1.0f, -2.0f);
+            serial.setLocalPosition(serialNodes[node], position);
+            parallel.setLocalPosition(parallelNodes[node], position);
+        }
+        size_t recomputed = serial.update();
+        EU_CHECK(recomputed >= 200 && recomputed < count);
+        EU_CHECK(parallel.update(jobs, 256) == recomputed);
+        EU_CHECK(std::memcmp(serial.worldData(), parallel.worldData(), count * sizeof(CAffineTransform)) == 0);
+
+        // Los handles siguen apuntando al mismo nodo tras el reordenamiento.
+        EU_CHECK(serial.localPosition(serialNodes[count / 2]) == parallel.localPosition(parallelNodes[count / 2]));
+    }
+
+}
+
+/**
+ * @brief Pruebas de CTransformHierarchy.
+ */
+void testTransformHierarchy() {
+    testComposition();
+    testOrderAndParallel();
+}
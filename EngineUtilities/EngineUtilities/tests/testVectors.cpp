@@ -0,0 +1,180 @@
+/**
+ * @file testVectors.cpp
+ * @brief Identidades algebraicas de CVector2, CVector3 y CVector4.
+ * @author Hannin Abarca
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "TestHarness.h"
+#include "../include/Vector/CVector2.h"
+#include "../include/Vector/CVector3.h"
+#include "../include/Vector/CVector4.h"
+
+namespace {
+
+    using EngineUtilities::CVector2;
+    using EngineUtilities::CVector3;
+    using EngineUtilities::CVector4;
+
+    const int kSamples = 1000;  ///< Pares de vectores aleatorios por identidad.
+    const float kTolerance = 2e-5f; ///< Error relativo admitido (unos pocos ULP de float sobre 10).
+
+    CVector2 randomVector(std::mt19937& rng, std::uniform_real_distribution<float>& d, CVector2*) {
+        return CVector2(d(rng), d(rng));
+    }
+
+    CVector3 randomVector(std::mt19937& rng, std::uniform_real_distribution<float>& d, CVector3*) {
+        return CVector3(d(rng), d(rng), d(rng));
+    }
+
+    CVector4 randomVector(std::mt19937& rng, std::uniform_real_distribution<float>& d, CVector4*) {
+        return CVector4(d(rng), d(rng), d(rng), d(rng));
+    }
+
+    /// Mayor diferencia entre componentes de a y b.
+    template<typename V>
+    float maxDifference(const V& a, const V& b) {
+        const int components = static_cast<int>(sizeof(V) / sizeof(float));
+        float result = 0.0f;
+        for (int i = 0; i < components; ++i) {
+            result = std::fmax(result, std::fabs(a[i] - b[i]));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Identidades comunes a los tres vectores, evaluadas sobre pares aleatorios en
+     *        [-10, 10]. Cada identidad se comprueba una vez con su error máximo.
+     */
+    template<typename V>
+    void testCommonIdentities(unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        float commutative = 0.0f, inverseOps = 0.0f, scaling = 0.0f, compound = 0.0f;
+        float dotSelf = 0.0f, dotSymmetric = 0.0f, unitLength = 0.0f, normalizeMatch = 0.0f;
+        float distanceLength = 0.0f, lerpEnds = 0.0f, lerpMid = 0.0f, cauchySchwarz = 0.0f;
+        bool equality = true;
+
+        for (int i = 0; i < kSamples; ++i) {
+            V a = randomVector(rng, dist, static_cast<V*>(nullptr));
+            V b = randomVector(rng, dist, static_cast<V*>(nullptr));
+            float s = 0.5f + unit(rng);
+            float t = unit(rng);
+            float scale = std::fmax(a.length(), b.length()) * kTolerance;
+
+            commutative = std::fmax(commutative, maxDifference(a + b, b + a));
+            inverseOps = std::fmax(inverseOps, maxDifference((a + b) - b, a) / scale);
+            scaling = std::fmax(scaling, maxDifference((a * s) / s, a) / scale);
+
+            V c = a;
+            c += b;
+            c -= a;
+            c *= s;
+            c /= s;
+            compound = std::fmax(compound, maxDifference(c, b) / scale);
+
+            dotSelf = std::fmax(dotSelf, std::fabs(a.dot(a) - a.lengthSquare()));
+            dotSymmetric = std::fmax(dotSymmetric, std::fabs(a.dot(b) - b.dot(a)));
+            unitLength = std::fmax(unitLength, std::fabs(a.normalized().length() - 1.0f));
+            V n = a;
+            n.normalize();
+            normalizeMatch = std::fmax(normalizeMatch, maxDifference(n, a.normalized()));
+            distanceLength = std::fmax(distanceLength, std::fabs(V::distance(a, b) - (b - a).length()));
+            lerpEnds = std::fmax(lerpEnds, std::fmax(maxDifference(V::lerp(a, b, 0.0f), a), maxDifference(V::lerp(a, b, 1.0f), b)) / scale);
+            lerpMid = std::fmax(lerpMid, maxDifference(V::lerp(a, b, t), a * (1.0f - t) + b * t) / scale);
+            // |a . b| <= |a| |b| (con margen de redondeo).
+            cauchySchwarz = std::fmax(cauchySchwarz, std::fabs(a.dot(b)) - a.length() * b.length() * (1.0f + kTolerance));
+
+            equality = equality && (a == a) && !(a != a) && (a != a + V::one());
+        }
+
+        EU_CHECK(commutative == 0.0f);
+        EU_CHECK_NEAR(inverseOps, 0.0, 1.0);
+        EU_CHECK_NEAR(scaling, 0.0, 1.0);
+        EU_CHECK_NEAR(compound, 0.0, 1.0);
+        EU_CHECK_NEAR(dotSelf, 0.0, 0.0);
+        EU_CHECK(dotSymmetric == 0.0f);
+        EU_CHECK_NEAR(unitLength, 0.0, 1e-6);
+        EU_CHECK(normalizeMatch == 0.0f);
+        EU_CHECK(distanceLength == 0.0f);
+        EU_CHECK_NEAR(lerpEnds, 0.0, 1.0);
+        EU_CHECK_NEAR(lerpMid, 0.0, 1.0);
+        EU_CHECK(cauchySchwarz <= 0.0f);
+        EU_CHECK(equality);
+
+        EU_CHECK(V::zero().lengthSquare() == 0.0f);
+        EU_CHECK(V::zero().normalized() == V::zero());
+        EU_CHECK(V::one().dot(V::one()) == static_cast<float>(sizeof(V) / sizeof(float)));
+    }
+
+    void testCVector2() {
+        testCommonIdentities<CVector2>(1);
+
+        CVector2 a(3.0f, 4.0f);
+        CVector2 b(-2.0f, 1.0f);
+        EU_CHECK(a.length() == 5.0f);
+        EU_CHECK(a.cross(b) == 3.0f * 1.0f - 4.0f * -2.0f);
+        EU_CHECK(a.cross(a) == 0.0f);
+        EU_CHECK(a.cross(b) == -b.cross(a));
+
+        CVector2 v(1.0f, 2.0f);
+        v.move(CVector2(1.0f, 1.0f));
+        EU_CHECK(v == CVector2(2.0f, 3.0f));
+        v.scale(CVector2(2.0f, -1.0f));
+        EU_CHECK(v == CVector2(4.0f, -3.0f));
+        v.setScale(CVector2(0.5f, 2.0f));
+        EU_CHECK(v == CVector2(2.0f, -6.0f));
+        v.setPosition(a);
+        EU_CHECK(v == a);
+        v.setOrigin(b);
+        EU_CHECK(v == b);
+    }
+
+    void testCVector3() {
+        testCommonIdentities<CVector3>(2);
+
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+        float orthogonal = 0.0f, anticommutative = 0.0f, lagrange = 0.0f;
+        for (int i = 0; i < kSamples; ++i) {
+            CVector3 a(dist(rng), dist(rng), dist(rng));
+            CVector3 b(dist(rng), dist(rng), dist(rng));
+            CVector3 c = a.cross(b);
+            float scale = a.lengthSquare() * b.lengthSquare();
+            orthogonal = std::fmax(orthogonal, std::fmax(std::fabs(c.dot(a)), std::fabs(c.dot(b))) / (a.length() * b.length() * a.length()));
+            anticommutative = std::fmax(anticommutative, maxDifference(c, b.cross(a) * -1.0f));
+            // Identidad de Lagrange: |a x b|^2 = |a|^2 |b|^2 - (a . b)^2.
+            float dot = a.dot(b);
+            lagrange = std::fmax(lagrange, std::fabs(c.lengthSquare() - (scale - dot * dot)) / scale);
+        }
+        EU_CHECK_NEAR(orthogonal, 0.0, 1e-5);
+        EU_CHECK(anticommutative == 0.0f);
+        EU_CHECK_NEAR(lagrange, 0.0, 1e-4);
+
+        CVector3 x(1.0f, 0.0f, 0.0f), y(0.0f, 1.0f, 0.0f), z(0.0f, 0.0f, 1.0f);
+        EU_CHECK(x.cross(y) == z && y.cross(z) == x && z.cross(x) == y);
+    }
+
+    void testCVector4() {
+        testCommonIdentities<CVector4>(4);
+
+        CVector4 a(1.0f, 2.0f, 3.0f, 4.0f);
+        EU_CHECK(a[0] == 1.0f && a[1] == 2.0f && a[2] == 3.0f && a[3] == 4.0f);
+        EU_CHECK(a.lengthSquare() == 30.0f);
+    }
+
+}
+
+/**
+ * @brief Identidades de suma, escala, producto punto y cruzado, normalización e
+ *        interpolación de los tres vectores.
+ */
+void testVectors() {
+    testCVector2();
+    testCVector3();
+    testCVector4();
+}